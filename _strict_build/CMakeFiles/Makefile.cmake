@@ -0,0 +1,174 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bindings/CMakeLists.txt"
+  "/root/repo/cmake/FindKerberos5.cmake"
+  "/root/repo/cmake/FindLibUuid.cmake"
+  "/root/repo/cmake/FindMacaroons.cmake"
+  "/root/repo/cmake/FindOpenSSL.cmake"
+  "/root/repo/cmake/FindReadline.cmake"
+  "/root/repo/cmake/FindSciTokensCpp.cmake"
+  "/root/repo/cmake/FindSystemd.cmake"
+  "/root/repo/cmake/FindTinyXml.cmake"
+  "/root/repo/cmake/FindVOMS.cmake"
+  "/root/repo/cmake/Findfuse.cmake"
+  "/root/repo/cmake/GNUInstallDirs.cmake"
+  "/root/repo/cmake/XRootDCommon.cmake"
+  "/root/repo/cmake/XRootDConfig.cmake.in"
+  "/root/repo/cmake/XRootDDefaults.cmake"
+  "/root/repo/cmake/XRootDFindLibs.cmake"
+  "/root/repo/cmake/XRootDOSDefs.cmake"
+  "/root/repo/cmake/XRootDSummary.cmake"
+  "/root/repo/cmake/XRootDSystemCheck.cmake"
+  "/root/repo/cmake/XRootDUtils.cmake"
+  "/root/repo/cmake_uninstall.cmake.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/XrdApps.cmake"
+  "/root/repo/src/XrdCl/CMakeLists.txt"
+  "/root/repo/src/XrdCrypto.cmake"
+  "/root/repo/src/XrdDaemons.cmake"
+  "/root/repo/src/XrdFfs.cmake"
+  "/root/repo/src/XrdFrm.cmake"
+  "/root/repo/src/XrdHeaders.cmake"
+  "/root/repo/src/XrdHttp.cmake"
+  "/root/repo/src/XrdPfc.cmake"
+  "/root/repo/src/XrdPlugins.cmake"
+  "/root/repo/src/XrdPosix.cmake"
+  "/root/repo/src/XrdSec.cmake"
+  "/root/repo/src/XrdSecgsi.cmake"
+  "/root/repo/src/XrdServer.cmake"
+  "/root/repo/src/XrdSsi.cmake"
+  "/root/repo/src/XrdTpc.cmake"
+  "/root/repo/src/XrdUtils.cmake"
+  "/root/repo/src/XrdXml.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindFrameworks.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonLibs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake/XRootDConfig.cmake"
+  "cmake_uninstall.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bindings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/plugins.dir/DependInfo.cmake"
+  "CMakeFiles/XrdVersion.hh.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdadler32.dir/DependInfo.cmake"
+  "src/CMakeFiles/cconfig.dir/DependInfo.cmake"
+  "src/CMakeFiles/mpxstats.dir/DependInfo.cmake"
+  "src/CMakeFiles/wait41.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdacctest.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdmapc.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdpinls.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdqstats.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdAppUtils.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdClProxyPlugin-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdCryptoLite.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdCryptossl-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSec-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecProt-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecpwd-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdpwdadmin.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecsss-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdsssadmin.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecunix-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdXml.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecgsi-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecgsiAUTHZVO-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSecgsiGMAPDN-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdgsiproxy.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdgsitest.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdXrootd-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrootd.dir/DependInfo.cmake"
+  "src/CMakeFiles/cmsd.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdFrm.dir/DependInfo.cmake"
+  "src/CMakeFiles/frm_admin.dir/DependInfo.cmake"
+  "src/CMakeFiles/frm_purged.dir/DependInfo.cmake"
+  "src/CMakeFiles/frm_xfrd.dir/DependInfo.cmake"
+  "src/CMakeFiles/frm_xfragent.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdPosixPreload.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdFfs.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdPss-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdBwm-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdN2No2p-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdOssSIgpfsT-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdCksCalczcrc32-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdThrottle-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdCmsRedirectLocal-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSsiLib.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSsiShMap.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSsi-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdSsiLog-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdPfc-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdBlacklistDecision-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/xrdpfc_print.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdHttpUtils.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdHttp-5.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdHttpTPC-5.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/xrdfs.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/xrdcp.dir/DependInfo.cmake"
+  )
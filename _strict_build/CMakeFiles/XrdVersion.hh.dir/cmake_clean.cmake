@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdVersion.hh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/XrdVersion.hh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdCpConfig.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdCpConfig.cc.o.d"
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdCpFile.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdCpFile.cc.o.d"
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdMpxXml.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdApps/XrdMpxXml.cc.o.d"
+  "libXrdAppUtils.pdb"
+  "libXrdAppUtils.so"
+  "libXrdAppUtils.so.2"
+  "libXrdAppUtils.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdAppUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPfc/XrdPfcBlacklistDecision.cc" "src/CMakeFiles/XrdBlacklistDecision-5.dir/XrdPfc/XrdPfcBlacklistDecision.cc.o" "gcc" "src/CMakeFiles/XrdBlacklistDecision-5.dir/XrdPfc/XrdPfcBlacklistDecision.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdBlacklistDecision-5.dir/XrdPfc/XrdPfcBlacklistDecision.cc.o"
+  "CMakeFiles/XrdBlacklistDecision-5.dir/XrdPfc/XrdPfcBlacklistDecision.cc.o.d"
+  "libXrdBlacklistDecision-5.pdb"
+  "libXrdBlacklistDecision-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdBlacklistDecision-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
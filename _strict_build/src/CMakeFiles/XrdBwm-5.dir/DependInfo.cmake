@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdBwm/XrdBwm.cc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwm.cc.o" "gcc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwm.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmConfig.cc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmConfig.cc.o" "gcc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmConfig.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmHandle.cc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmHandle.cc.o" "gcc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmHandle.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmLogger.cc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmLogger.cc.o" "gcc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmLogger.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmPolicy1.cc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmPolicy1.cc.o" "gcc" "src/CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmPolicy1.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwm.cc.o"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwm.cc.o.d"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmConfig.cc.o"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmConfig.cc.o.d"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmHandle.cc.o"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmHandle.cc.o.d"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmLogger.cc.o"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmLogger.cc.o.d"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmPolicy1.cc.o"
+  "CMakeFiles/XrdBwm-5.dir/XrdBwm/XrdBwmPolicy1.cc.o.d"
+  "libXrdBwm-5.pdb"
+  "libXrdBwm-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdBwm-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
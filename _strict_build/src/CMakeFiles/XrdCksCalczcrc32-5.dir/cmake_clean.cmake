@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdCksCalczcrc32-5.dir/XrdCks/XrdCksCalczcrc32.cc.o"
+  "CMakeFiles/XrdCksCalczcrc32-5.dir/XrdCks/XrdCksCalczcrc32.cc.o.d"
+  "libXrdCksCalczcrc32-5.pdb"
+  "libXrdCksCalczcrc32-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCksCalczcrc32-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
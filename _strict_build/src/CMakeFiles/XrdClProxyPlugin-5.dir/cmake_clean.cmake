@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdClProxyPlugin-5.dir/XrdApps/XrdClProxyPlugin/ProxyPrefixFile.cc.o"
+  "CMakeFiles/XrdClProxyPlugin-5.dir/XrdApps/XrdClProxyPlugin/ProxyPrefixFile.cc.o.d"
+  "CMakeFiles/XrdClProxyPlugin-5.dir/XrdApps/XrdClProxyPlugin/ProxyPrefixPlugin.cc.o"
+  "CMakeFiles/XrdClProxyPlugin-5.dir/XrdApps/XrdClProxyPlugin/ProxyPrefixPlugin.cc.o.d"
+  "libXrdClProxyPlugin-5.pdb"
+  "libXrdClProxyPlugin-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClProxyPlugin-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdCmsRedirectLocal-5.dir/XrdCms/XrdCmsRedirLocal.cc.o"
+  "CMakeFiles/XrdCmsRedirectLocal-5.dir/XrdCms/XrdCmsRedirLocal.cc.o.d"
+  "libXrdCmsRedirectLocal-5.pdb"
+  "libXrdCmsRedirectLocal-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCmsRedirectLocal-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCrypto/XrdCryptoAux.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoAux.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoAux.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoBasic.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoBasic.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoBasic.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoCipher.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoCipher.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoCipher.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoFactory.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoFactory.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoFactory.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoMsgDigest.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoMsgDigest.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoMsgDigest.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoRSA.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoRSA.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoRSA.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoX509.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoX509Chain.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Chain.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Chain.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoX509Crl.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Crl.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Crl.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoX509Req.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Req.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Req.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptogsiX509Chain.cc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptogsiX509Chain.cc.o" "gcc" "src/CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptogsiX509Chain.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdCrypto.so" "/root/repo/_strict_build/src/libXrdCrypto.so.2.0.0"
+  "/root/repo/_strict_build/src/libXrdCrypto.so.2" "/root/repo/_strict_build/src/libXrdCrypto.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoAux.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoAux.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoBasic.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoBasic.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoCipher.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoCipher.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoFactory.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoFactory.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoMsgDigest.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoMsgDigest.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoRSA.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoRSA.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Chain.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Chain.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Crl.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Crl.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Req.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptoX509Req.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptogsiX509Chain.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCrypto/XrdCryptogsiX509Chain.cc.o.d"
+  "libXrdCrypto.pdb"
+  "libXrdCrypto.so"
+  "libXrdCrypto.so.2"
+  "libXrdCrypto.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCrypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdCryptoLite.dir/XrdCrypto/XrdCryptoLite.cc.o"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCrypto/XrdCryptoLite.cc.o.d"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCrypto/XrdCryptoLite_bf32.cc.o"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCrypto/XrdCryptoLite_bf32.cc.o.d"
+  "libXrdCryptoLite.pdb"
+  "libXrdCryptoLite.so"
+  "libXrdCryptoLite.so.2"
+  "libXrdCryptoLite.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCryptoLite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
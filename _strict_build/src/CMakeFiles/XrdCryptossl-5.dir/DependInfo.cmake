@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCrypto/XrdCryptosslAux.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslAux.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslAux.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslCipher.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslCipher.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslCipher.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslFactory.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslFactory.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslFactory.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslMsgDigest.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslMsgDigest.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslMsgDigest.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslRSA.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslRSA.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslRSA.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslX509.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslX509Crl.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Crl.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Crl.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslX509Req.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Req.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Req.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslgsiAux.cc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslgsiAux.cc.o" "gcc" "src/CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslgsiAux.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslAux.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslAux.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslCipher.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslCipher.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslFactory.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslFactory.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslMsgDigest.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslMsgDigest.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslRSA.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslRSA.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Crl.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Crl.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Req.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslX509Req.cc.o.d"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslgsiAux.cc.o"
+  "CMakeFiles/XrdCryptossl-5.dir/XrdCrypto/XrdCryptosslgsiAux.cc.o.d"
+  "libXrdCryptossl-5.pdb"
+  "libXrdCryptossl-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCryptossl-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
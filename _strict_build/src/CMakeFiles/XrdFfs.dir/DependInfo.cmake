@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFfs/XrdFfsDent.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsDent.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsDent.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsFsinfo.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsFsinfo.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsFsinfo.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsMisc.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsMisc.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsMisc.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsPosix.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsPosix.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsPosix.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsQueue.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsQueue.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsQueue.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsWcache.cc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsWcache.cc.o" "gcc" "src/CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsWcache.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdFfs.so" "/root/repo/_strict_build/src/libXrdFfs.so.3.0.0"
+  "/root/repo/_strict_build/src/libXrdFfs.so.3" "/root/repo/_strict_build/src/libXrdFfs.so.3.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
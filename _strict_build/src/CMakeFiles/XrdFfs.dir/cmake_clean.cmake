@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsDent.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsDent.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsFsinfo.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsFsinfo.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsMisc.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsMisc.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsPosix.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsPosix.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsQueue.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsQueue.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsWcache.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfs/XrdFfsWcache.cc.o.d"
+  "libXrdFfs.pdb"
+  "libXrdFfs.so"
+  "libXrdFfs.so.3"
+  "libXrdFfs.so.3.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdFfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
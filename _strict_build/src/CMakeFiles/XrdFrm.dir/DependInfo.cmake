@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFrm/XrdFrmCns.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmCns.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmCns.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmConfig.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmConfig.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmConfig.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmFiles.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmFiles.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmFiles.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmMigrate.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMigrate.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMigrate.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmMonitor.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMonitor.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMonitor.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmReqBoss.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmReqBoss.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmReqBoss.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmTSort.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTSort.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTSort.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmTransfer.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTransfer.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTransfer.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrAgent.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrAgent.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrAgent.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrDaemon.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrDaemon.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrDaemon.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrQueue.cc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrQueue.cc.o" "gcc" "src/CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrQueue.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
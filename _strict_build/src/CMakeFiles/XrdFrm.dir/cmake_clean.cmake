@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmCns.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmCns.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmConfig.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmConfig.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmFiles.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmFiles.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMigrate.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMigrate.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMonitor.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmMonitor.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmReqBoss.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmReqBoss.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTSort.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTSort.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTransfer.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmTransfer.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrAgent.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrAgent.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrDaemon.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrDaemon.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrQueue.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrm/XrdFrmXfrQueue.cc.o.d"
+  "libXrdFrm.a"
+  "libXrdFrm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdFrm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
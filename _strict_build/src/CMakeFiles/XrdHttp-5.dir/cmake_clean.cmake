@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdHttp-5.dir/XrdHttp/XrdHttpModule.cc.o"
+  "CMakeFiles/XrdHttp-5.dir/XrdHttp/XrdHttpModule.cc.o.d"
+  "libXrdHttp-5.pdb"
+  "libXrdHttp-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttp-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
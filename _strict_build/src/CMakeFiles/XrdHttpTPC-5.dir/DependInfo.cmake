@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdTpc/XrdTpcConfigure.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcConfigure.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcConfigure.cc.o.d"
+  "/root/repo/src/XrdTpc/XrdTpcCurlLoop.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcCurlLoop.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcCurlLoop.cc.o.d"
+  "/root/repo/src/XrdTpc/XrdTpcMultistream.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcMultistream.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcMultistream.cc.o.d"
+  "/root/repo/src/XrdTpc/XrdTpcState.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcState.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcState.cc.o.d"
+  "/root/repo/src/XrdTpc/XrdTpcStream.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcStream.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcStream.cc.o.d"
+  "/root/repo/src/XrdTpc/XrdTpcTPC.cc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcTPC.cc.o" "gcc" "src/CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcTPC.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdHttpUtils.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
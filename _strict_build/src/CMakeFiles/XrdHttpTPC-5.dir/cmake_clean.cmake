@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcConfigure.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcConfigure.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcCurlLoop.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcCurlLoop.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcMultistream.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcMultistream.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcState.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcState.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcStream.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcStream.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcTPC.cc.o"
+  "CMakeFiles/XrdHttpTPC-5.dir/XrdTpc/XrdTpcTPC.cc.o.d"
+  "libXrdHttpTPC-5.pdb"
+  "libXrdHttpTPC-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttpTPC-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
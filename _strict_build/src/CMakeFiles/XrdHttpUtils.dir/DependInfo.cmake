@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdHttp/XrdHttpExtHandler.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpExtHandler.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpExtHandler.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpProtocol.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpProtocol.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpProtocol.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpReq.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpReq.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpReq.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpSecurity.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpSecurity.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpSecurity.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpTrace.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpTrace.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpTrace.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpUtils.cc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpUtils.cc.o" "gcc" "src/CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpUtils.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdHttpUtils.so" "/root/repo/_strict_build/src/libXrdHttpUtils.so.2.0.0"
+  "/root/repo/_strict_build/src/libXrdHttpUtils.so.2" "/root/repo/_strict_build/src/libXrdHttpUtils.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
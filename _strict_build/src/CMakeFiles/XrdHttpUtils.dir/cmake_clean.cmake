@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpExtHandler.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpExtHandler.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpProtocol.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpProtocol.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpReq.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpReq.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpSecurity.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpSecurity.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpTrace.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpTrace.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpUtils.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttp/XrdHttpUtils.cc.o.d"
+  "libXrdHttpUtils.pdb"
+  "libXrdHttpUtils.so"
+  "libXrdHttpUtils.so.2"
+  "libXrdHttpUtils.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttpUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdN2No2p-5.dir/XrdOuc/XrdOucN2No2p.cc.o"
+  "CMakeFiles/XrdN2No2p-5.dir/XrdOuc/XrdOucN2No2p.cc.o.d"
+  "libXrdN2No2p-5.pdb"
+  "libXrdN2No2p-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdN2No2p-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdOssSIgpfsT-5.dir/XrdOss/XrdOssSIgpfsT.cc.o"
+  "CMakeFiles/XrdOssSIgpfsT-5.dir/XrdOss/XrdOssSIgpfsT.cc.o.d"
+  "libXrdOssSIgpfsT-5.pdb"
+  "libXrdOssSIgpfsT-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOssSIgpfsT-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPfc/XrdPfc.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfc.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfc.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcBufferPool.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcBufferPool.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcBufferPool.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcCommand.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcCommand.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcCommand.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcConfiguration.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcConfiguration.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcConfiguration.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcFile.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcFile.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcFile.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIO.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIO.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIO.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIOEntireFile.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOEntireFile.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOEntireFile.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIOFileBlock.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOFileBlock.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOFileBlock.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcInfo.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcInfo.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcInfo.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcPurge.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcPurge.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcPurge.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcUsageIndex.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcUsageIndex.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcUsageIndex.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcVRead.cc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcVRead.cc.o" "gcc" "src/CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcVRead.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfc.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfc.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcBufferPool.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcBufferPool.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcCommand.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcCommand.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcConfiguration.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcConfiguration.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcFile.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcFile.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIO.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIO.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOEntireFile.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOEntireFile.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOFileBlock.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcIOFileBlock.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcInfo.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcInfo.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcPurge.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcPurge.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcUsageIndex.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcUsageIndex.cc.o.d"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcVRead.cc.o"
+  "CMakeFiles/XrdPfc-5.dir/XrdPfc/XrdPfcVRead.cc.o.d"
+  "libXrdPfc-5.pdb"
+  "libXrdPfc-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPfc-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPosix/XrdPosixAdmin.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixAdmin.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixAdmin.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixCache.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCache.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCache.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixCallBack.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCallBack.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCallBack.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixConfig.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixConfig.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixConfig.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixDir.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixDir.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixDir.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixFile.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFile.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFile.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixFileRH.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFileRH.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFileRH.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixMap.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixMap.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixMap.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixObject.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixObject.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixObject.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPrepIO.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixPrepIO.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixPrepIO.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixXrootd.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootd.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootd.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixXrootdPath.cc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootdPath.cc.o" "gcc" "src/CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootdPath.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdPosix.so" "/root/repo/_strict_build/src/libXrdPosix.so.3.0.0"
+  "/root/repo/_strict_build/src/libXrdPosix.so.3" "/root/repo/_strict_build/src/libXrdPosix.so.3.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixAdmin.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixAdmin.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCache.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCache.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCallBack.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixCallBack.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixConfig.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixConfig.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixDir.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixDir.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFile.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFile.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFileRH.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixFileRH.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixMap.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixMap.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixObject.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixObject.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixPrepIO.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixPrepIO.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootd.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootd.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootdPath.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosix/XrdPosixXrootdPath.cc.o.d"
+  "libXrdPosix.pdb"
+  "libXrdPosix.so"
+  "libXrdPosix.so.3"
+  "libXrdPosix.so.3.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPosix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPosix/XrdPosix.cc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosix.cc.o" "gcc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosix.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixLinkage.cc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixLinkage.cc.o" "gcc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixLinkage.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPreload.cc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload.cc.o" "gcc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPreload32.cc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload32.cc.o" "gcc" "src/CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload32.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdPosixPreload.so" "/root/repo/_strict_build/src/libXrdPosixPreload.so.2.0.0"
+  "/root/repo/_strict_build/src/libXrdPosixPreload.so.2" "/root/repo/_strict_build/src/libXrdPosixPreload.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
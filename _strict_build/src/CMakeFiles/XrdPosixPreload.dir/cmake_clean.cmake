@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosix.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosix.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixLinkage.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixLinkage.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload32.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix/XrdPosixPreload32.cc.o.d"
+  "libXrdPosixPreload.pdb"
+  "libXrdPosixPreload.so"
+  "libXrdPosixPreload.so.2"
+  "libXrdPosixPreload.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPosixPreload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPss/XrdPss.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPss.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPss.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssAio.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAio.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAio.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssAioCB.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAioCB.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAioCB.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssCks.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssCks.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssCks.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssConfig.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssConfig.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssConfig.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssUrlInfo.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUrlInfo.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUrlInfo.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssUtils.cc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUtils.cc.o" "gcc" "src/CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUtils.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPss.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPss.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAio.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAio.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAioCB.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssAioCB.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssCks.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssCks.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssConfig.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssConfig.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUrlInfo.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUrlInfo.cc.o.d"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUtils.cc.o"
+  "CMakeFiles/XrdPss-5.dir/XrdPss/XrdPssUtils.cc.o.d"
+  "libXrdPss-5.pdb"
+  "libXrdPss-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPss-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
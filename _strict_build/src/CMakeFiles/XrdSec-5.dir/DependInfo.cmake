@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSec/XrdSecClient.cc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecClient.cc.o" "gcc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecClient.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecPManager.cc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecPManager.cc.o" "gcc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecPManager.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecProtocolhost.cc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecProtocolhost.cc.o" "gcc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecProtocolhost.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecServer.cc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecServer.cc.o" "gcc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecServer.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecTLayer.cc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecTLayer.cc.o" "gcc" "src/CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecTLayer.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecClient.cc.o"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecClient.cc.o.d"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecPManager.cc.o"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecPManager.cc.o.d"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecProtocolhost.cc.o"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecProtocolhost.cc.o.d"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecServer.cc.o"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecServer.cc.o.d"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecTLayer.cc.o"
+  "CMakeFiles/XrdSec-5.dir/XrdSec/XrdSecTLayer.cc.o.d"
+  "libXrdSec-5.pdb"
+  "libXrdSec-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSec-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
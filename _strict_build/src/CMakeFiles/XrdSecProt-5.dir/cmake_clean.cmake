@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecProt-5.dir/XrdSec/XrdSecProtect.cc.o"
+  "CMakeFiles/XrdSecProt-5.dir/XrdSec/XrdSecProtect.cc.o.d"
+  "CMakeFiles/XrdSecProt-5.dir/XrdSec/XrdSecProtector.cc.o"
+  "CMakeFiles/XrdSecProt-5.dir/XrdSec/XrdSecProtector.cc.o.d"
+  "libXrdSecProt-5.pdb"
+  "libXrdSecProt-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecProt-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecgsi-5.dir/XrdSecgsi/XrdSecProtocolgsi.cc.o"
+  "CMakeFiles/XrdSecgsi-5.dir/XrdSecgsi/XrdSecProtocolgsi.cc.o.d"
+  "libXrdSecgsi-5.pdb"
+  "libXrdSecgsi-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsi-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecgsiAUTHZVO-5.dir/XrdSecgsi/XrdSecgsiAuthzFunVO.cc.o"
+  "CMakeFiles/XrdSecgsiAUTHZVO-5.dir/XrdSecgsi/XrdSecgsiAuthzFunVO.cc.o.d"
+  "libXrdSecgsiAUTHZVO-5.pdb"
+  "libXrdSecgsiAUTHZVO-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsiAUTHZVO-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
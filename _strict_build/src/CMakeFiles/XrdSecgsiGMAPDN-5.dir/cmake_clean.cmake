@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecgsiGMAPDN-5.dir/XrdSecgsi/XrdSecgsiGMAPFunDN.cc.o"
+  "CMakeFiles/XrdSecgsiGMAPDN-5.dir/XrdSecgsi/XrdSecgsiGMAPFunDN.cc.o.d"
+  "libXrdSecgsiGMAPDN-5.pdb"
+  "libXrdSecgsiGMAPDN-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsiGMAPDN-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
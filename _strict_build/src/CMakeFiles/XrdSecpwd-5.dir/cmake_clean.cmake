@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecpwd-5.dir/XrdSecpwd/XrdSecProtocolpwd.cc.o"
+  "CMakeFiles/XrdSecpwd-5.dir/XrdSecpwd/XrdSecProtocolpwd.cc.o.d"
+  "libXrdSecpwd-5.pdb"
+  "libXrdSecpwd-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecpwd-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
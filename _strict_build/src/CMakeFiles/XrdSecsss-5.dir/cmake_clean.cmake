@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecsss-5.dir/XrdSecsss/XrdSecProtocolsss.cc.o"
+  "CMakeFiles/XrdSecsss-5.dir/XrdSecsss/XrdSecProtocolsss.cc.o.d"
+  "libXrdSecsss-5.pdb"
+  "libXrdSecsss-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecsss-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSecunix-5.dir/XrdSecunix/XrdSecProtocolunix.cc.o"
+  "CMakeFiles/XrdSecunix-5.dir/XrdSecunix/XrdSecProtocolunix.cc.o.d"
+  "libXrdSecunix-5.pdb"
+  "libXrdSecunix-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecunix-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,125 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdAcc/XrdAccAccess.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAccess.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAccess.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccAudit.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAudit.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAudit.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccAuthFile.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAuthFile.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAuthFile.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccCapability.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccCapability.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccCapability.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccConfig.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccEntity.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccEntity.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccEntity.cc.o.d"
+  "/root/repo/src/XrdAcc/XrdAccGroups.cc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccGroups.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdAcc/XrdAccGroups.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsBlackList.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsBlackList.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsBlackList.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClient.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClient.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClient.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClientConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientConfig.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClientMan.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMan.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMan.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClientMsg.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMsg.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMsg.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsFinder.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsFinder.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsFinder.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsLogin.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsLogin.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsLogin.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsParser.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsParser.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsParser.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRRData.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRRData.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRRData.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRTable.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRTable.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRTable.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsResp.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsResp.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsResp.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsSecurity.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsSecurity.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsSecurity.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsTalk.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsTalk.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsTalk.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsUtils.cc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsUtils.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdCms/XrdCmsUtils.cc.o.d"
+  "/root/repo/src/XrdDig/XrdDigAuth.cc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigAuth.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigAuth.cc.o.d"
+  "/root/repo/src/XrdDig/XrdDigConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigConfig.cc.o.d"
+  "/root/repo/src/XrdDig/XrdDigFS.cc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigFS.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdDig/XrdDigFS.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcCID.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcCID.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcCID.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcProxy.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcProxy.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcProxy.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcReqAgent.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqAgent.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqAgent.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcReqFile.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqFile.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqFile.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcTrace.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcTrace.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcTrace.cc.o.d"
+  "/root/repo/src/XrdFrc/XrdFrcUtils.cc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcUtils.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcUtils.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfs.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfs.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfs.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsCPFile.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCPFile.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCPFile.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsChkPnt.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsChkPnt.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsChkPnt.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsCksStream.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCksStream.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCksStream.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfig.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsConfigCP.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigCP.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigCP.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsConfigPI.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigPI.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigPI.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsEvr.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvr.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvr.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsEvs.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvs.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvs.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsFAttr.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFAttr.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFAttr.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsFS.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFS.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFS.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsFSctl.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFSctl.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFSctl.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsHandle.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsHandle.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsHandle.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsPoscq.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsPoscq.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsPoscq.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsStats.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsStats.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsStats.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsTPC.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPC.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPC.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsTPCAuth.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCAuth.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCAuth.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsTPCInfo.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCInfo.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCInfo.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsTPCJob.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCJob.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCJob.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsTPCProg.cc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCProg.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCProg.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOss.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOss.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOss.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssAio.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssAio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssAio.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssApi.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssApi.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssApi.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssAt.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssAt.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssAt.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssCache.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCache.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCache.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssConfig.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssCopy.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCopy.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCopy.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssCreate.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCreate.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssCreate.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssMSS.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssMSS.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssMSS.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssMio.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssMio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssMio.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssPath.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssPath.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssPath.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssReloc.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssReloc.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssReloc.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssRename.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssRename.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssRename.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssSpace.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssSpace.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssSpace.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssStage.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssStage.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssStage.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssStat.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssStat.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssStat.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssUnlink.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssUnlink.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssUnlink.cc.o.d"
+  "/root/repo/src/XrdOss/XrdOssUring.cc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssUring.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdOss/XrdOssUring.cc.o.d"
+  "/root/repo/src/XrdSfs/XrdSfsInterface.cc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsInterface.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsInterface.cc.o.d"
+  "/root/repo/src/XrdSfs/XrdSfsNative.cc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsNative.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsNative.cc.o.d"
+  "/root/repo/src/XrdSfs/XrdSfsXio.cc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsXio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsXio.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdAdmin.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAdmin.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAdmin.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdAio.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAio.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdBridge.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdBridge.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdBridge.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdCallBack.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdCallBack.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdCallBack.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdConfig.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfig.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfig.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdConfigMon.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfigMon.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfigMon.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdFile.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFile.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFile.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdFileLock1.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFileLock1.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFileLock1.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdGSReal.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGSReal.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGSReal.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdGStream.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGStream.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGStream.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdJob.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdJob.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdJob.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdLoadLib.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdLoadLib.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdLoadLib.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdMonFMap.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFMap.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFMap.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdMonFile.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFile.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFile.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdMonitor.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonitor.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonitor.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdPio.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPio.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdPrepare.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPrepare.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPrepare.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdProtocol.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdProtocol.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdProtocol.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdResponse.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdResponse.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdResponse.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdStats.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdStats.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdStats.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdTransPend.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransPend.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransPend.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdTransSend.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransSend.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransSend.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdTransit.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransit.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransit.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdXeq.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeq.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeq.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdXeqAio.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqAio.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqAio.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdXeqChkPnt.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqChkPnt.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqChkPnt.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdXeqFAttr.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqFAttr.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqFAttr.cc.o.d"
+  "/root/repo/src/XrdXrootd/XrdXrootdXeqPgrw.cc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqPgrw.cc.o" "gcc" "src/CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqPgrw.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdServer.so" "/root/repo/_strict_build/src/libXrdServer.so.3.0.0"
+  "/root/repo/_strict_build/src/libXrdServer.so.3" "/root/repo/_strict_build/src/libXrdServer.so.3.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,209 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAccess.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAccess.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAudit.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAudit.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAuthFile.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccAuthFile.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccCapability.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccCapability.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccEntity.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccEntity.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccGroups.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdAcc/XrdAccGroups.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsBlackList.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsBlackList.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClient.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClient.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMan.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMan.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMsg.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsClientMsg.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsFinder.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsFinder.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsLogin.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsLogin.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsParser.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsParser.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRRData.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRRData.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRTable.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsRTable.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsResp.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsResp.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsSecurity.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsSecurity.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsTalk.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsTalk.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsUtils.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdCms/XrdCmsUtils.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigAuth.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigAuth.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigFS.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdDig/XrdDigFS.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcCID.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcCID.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcProxy.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcProxy.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqAgent.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqAgent.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqFile.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcReqFile.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcTrace.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcTrace.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcUtils.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdFrc/XrdFrcUtils.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfs.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfs.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCPFile.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCPFile.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsChkPnt.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsChkPnt.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCksStream.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsCksStream.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigCP.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigCP.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigPI.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsConfigPI.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvr.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvr.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvs.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsEvs.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFAttr.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFAttr.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFS.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFS.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFSctl.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsFSctl.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsHandle.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsHandle.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsPoscq.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsPoscq.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsStats.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsStats.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPC.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPC.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCAuth.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCAuth.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCInfo.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCInfo.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCJob.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCJob.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCProg.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOfs/XrdOfsTPCProg.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOss.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOss.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssAio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssAio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssApi.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssApi.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssAt.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssAt.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCache.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCache.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCopy.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCopy.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCreate.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssCreate.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssMSS.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssMSS.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssMio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssMio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssPath.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssPath.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssReloc.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssReloc.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssRename.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssRename.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssSpace.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssSpace.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssStage.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssStage.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssStat.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssStat.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssUnlink.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssUnlink.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssUring.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdOss/XrdOssUring.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsInterface.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsInterface.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsNative.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsNative.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsXio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdSfs/XrdSfsXio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAdmin.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAdmin.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdAio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdBridge.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdBridge.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdCallBack.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdCallBack.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfig.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfig.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfigMon.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdConfigMon.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFile.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFile.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFileLock1.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdFileLock1.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGSReal.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGSReal.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGStream.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdGStream.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdJob.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdJob.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdLoadLib.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdLoadLib.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFMap.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFMap.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFile.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonFile.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonitor.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdMonitor.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPrepare.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdPrepare.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdProtocol.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdProtocol.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdResponse.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdResponse.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdStats.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdStats.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransPend.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransPend.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransSend.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransSend.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransit.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdTransit.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeq.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeq.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqAio.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqAio.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqChkPnt.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqChkPnt.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqFAttr.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqFAttr.cc.o.d"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqPgrw.cc.o"
+  "CMakeFiles/XrdServer.dir/XrdXrootd/XrdXrootdXeqPgrw.cc.o.d"
+  "libXrdServer.pdb"
+  "libXrdServer.so"
+  "libXrdServer.so.3"
+  "libXrdServer.so.3.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdServer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSsi/XrdSsiDir.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiDir.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiDir.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFile.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFile.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFile.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileReq.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileReq.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileReq.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileSess.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileSess.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileSess.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSfs.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfs.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfs.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSfsConfig.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfsConfig.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfsConfig.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiStat.cc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiStat.cc.o" "gcc" "src/CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiStat.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdSsiLib.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
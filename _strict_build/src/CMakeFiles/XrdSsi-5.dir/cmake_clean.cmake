@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiDir.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiDir.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFile.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFile.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileReq.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileReq.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileSess.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiFileSess.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfs.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfs.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfsConfig.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiSfsConfig.cc.o.d"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiStat.cc.o"
+  "CMakeFiles/XrdSsi-5.dir/XrdSsi/XrdSsiStat.cc.o.d"
+  "libXrdSsi-5.pdb"
+  "libXrdSsi-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsi-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSsi/XrdSsiAlert.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAlert.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAlert.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiAtomics.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAtomics.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAtomics.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiClient.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiClient.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiClient.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiCms.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiCms.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiCms.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiErrInfo.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiErrInfo.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiErrInfo.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiEvent.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiEvent.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiEvent.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileResource.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiFileResource.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiFileResource.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiLogger.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiLogger.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiLogger.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiRequest.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiRequest.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiRequest.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiResponder.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiResponder.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiResponder.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiScale.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiScale.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiScale.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiServReal.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiServReal.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiServReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiService.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiService.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiService.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSessReal.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiSessReal.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiSessReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiStats.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiStats.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiStats.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiTaskReal.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiTaskReal.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiTaskReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiUtils.cc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiUtils.cc.o" "gcc" "src/CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiUtils.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdSsiLib.so" "/root/repo/_strict_build/src/libXrdSsiLib.so.2.0.0"
+  "/root/repo/_strict_build/src/libXrdSsiLib.so.2" "/root/repo/_strict_build/src/libXrdSsiLib.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAlert.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAlert.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAtomics.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiAtomics.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiClient.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiClient.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiCms.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiCms.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiErrInfo.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiErrInfo.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiEvent.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiEvent.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiFileResource.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiFileResource.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiLogger.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiLogger.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiRequest.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiRequest.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiResponder.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiResponder.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiScale.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiScale.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiServReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiServReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiService.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiService.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiSessReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiSessReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiStats.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiStats.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiTaskReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiTaskReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiUtils.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsi/XrdSsiUtils.cc.o.d"
+  "libXrdSsiLib.pdb"
+  "libXrdSsiLib.so"
+  "libXrdSsiLib.so.2"
+  "libXrdSsiLib.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSsiLog-5.dir/XrdSsi/XrdSsiLogging.cc.o"
+  "CMakeFiles/XrdSsiLog-5.dir/XrdSsi/XrdSsiLogging.cc.o.d"
+  "libXrdSsiLog-5.pdb"
+  "libXrdSsiLog-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiLog-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
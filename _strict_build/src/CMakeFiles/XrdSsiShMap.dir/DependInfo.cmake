@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSsi/XrdSsiShMam.cc" "src/CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMam.cc.o" "gcc" "src/CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMam.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiShMat.cc" "src/CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMat.cc.o" "gcc" "src/CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMat.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdSsiShMap.so" "/root/repo/_strict_build/src/libXrdSsiShMap.so.2.0.0"
+  "/root/repo/_strict_build/src/libXrdSsiShMap.so.2" "/root/repo/_strict_build/src/libXrdSsiShMap.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
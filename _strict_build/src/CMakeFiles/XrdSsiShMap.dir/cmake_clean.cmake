@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMam.cc.o"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMam.cc.o.d"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMat.cc.o"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsi/XrdSsiShMat.cc.o.d"
+  "libXrdSsiShMap.pdb"
+  "libXrdSsiShMap.so"
+  "libXrdSsiShMap.so.2"
+  "libXrdSsiShMap.so.2.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiShMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
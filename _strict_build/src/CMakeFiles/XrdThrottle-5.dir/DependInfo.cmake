@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdOfs/XrdOfsFS.cc" "src/CMakeFiles/XrdThrottle-5.dir/XrdOfs/XrdOfsFS.cc.o" "gcc" "src/CMakeFiles/XrdThrottle-5.dir/XrdOfs/XrdOfsFS.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFile.cc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFile.cc.o" "gcc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFile.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFileSystem.cc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystem.cc.o" "gcc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystem.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFileSystemConfig.cc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystemConfig.cc.o" "gcc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystemConfig.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleManager.cc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleManager.cc.o" "gcc" "src/CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleManager.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdThrottle-5.dir/XrdOfs/XrdOfsFS.cc.o"
+  "CMakeFiles/XrdThrottle-5.dir/XrdOfs/XrdOfsFS.cc.o.d"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFile.cc.o"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFile.cc.o.d"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystem.cc.o"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystem.cc.o.d"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystemConfig.cc.o"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleFileSystemConfig.cc.o.d"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleManager.cc.o"
+  "CMakeFiles/XrdThrottle-5.dir/XrdThrottle/XrdThrottleManager.cc.o.d"
+  "libXrdThrottle-5.pdb"
+  "libXrdThrottle-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdThrottle-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
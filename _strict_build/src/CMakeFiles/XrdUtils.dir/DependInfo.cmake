@@ -0,0 +1,139 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XProtocol/XProtocol.cc" "src/CMakeFiles/XrdUtils.dir/XProtocol/XProtocol.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XProtocol/XProtocol.cc.o.d"
+  "/root/repo/src/Xrd/XrdBuffXL.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdBuffXL.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdBuffXL.cc.o.d"
+  "/root/repo/src/Xrd/XrdBuffer.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdBuffer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdBuffer.cc.o.d"
+  "/root/repo/src/Xrd/XrdGlobals.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdGlobals.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdGlobals.cc.o.d"
+  "/root/repo/src/Xrd/XrdInet.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdInet.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdInet.cc.o.d"
+  "/root/repo/src/Xrd/XrdInfo.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdInfo.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdInfo.cc.o.d"
+  "/root/repo/src/Xrd/XrdLink.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLink.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLink.cc.o.d"
+  "/root/repo/src/Xrd/XrdLinkCtl.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkCtl.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkCtl.cc.o.d"
+  "/root/repo/src/Xrd/XrdLinkMatch.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkMatch.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkMatch.cc.o.d"
+  "/root/repo/src/Xrd/XrdLinkXeq.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkXeq.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdLinkXeq.cc.o.d"
+  "/root/repo/src/Xrd/XrdPoll.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdPoll.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdPoll.cc.o.d"
+  "/root/repo/src/Xrd/XrdScheduler.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdScheduler.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdScheduler.cc.o.d"
+  "/root/repo/src/Xrd/XrdSendQ.cc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdSendQ.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/Xrd/XrdSendQ.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksAssist.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksAssist.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksAssist.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksCalccrc32.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalccrc32.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalccrc32.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksCalcmd5.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalcmd5.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalcmd5.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksConfig.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksConfig.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksConfig.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksLoader.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksLoader.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksLoader.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksManOss.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManOss.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManOss.cc.o.d"
+  "/root/repo/src/XrdCks/XrdCksManager.cc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManager.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManager.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNet.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNet.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNet.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetAddr.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddr.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddr.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetAddrInfo.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddrInfo.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddrInfo.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetBuffer.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetBuffer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetBuffer.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetCache.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCache.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCache.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetCmsNotify.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCmsNotify.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCmsNotify.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetConnect.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetConnect.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetConnect.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetIF.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetIF.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetIF.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetMsg.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetMsg.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetMsg.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetRegistry.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetRegistry.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetRegistry.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetSecurity.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSecurity.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSecurity.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetSocket.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSocket.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSocket.cc.o.d"
+  "/root/repo/src/XrdNet/XrdNetUtils.cc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetUtils.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdNet/XrdNetUtils.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucArgs.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucArgs.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucArgs.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucBackTrace.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBackTrace.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBackTrace.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucBuffer.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBuffer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBuffer.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucCRC.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucCRC32C.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC32C.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC32C.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucCache.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCache.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCache.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucCallBack.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCallBack.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCallBack.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucERoute.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucERoute.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucERoute.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucEnv.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucEnv.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucEnv.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucExport.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucExport.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucExport.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucFileInfo.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucFileInfo.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucFileInfo.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucGMap.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucGMap.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucGMap.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucHashVal.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucHashVal.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucHashVal.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucLogging.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucLogging.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucLogging.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucMsubs.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucMsubs.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucMsubs.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucN2NLoader.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucN2NLoader.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucN2NLoader.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucNList.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNList.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNList.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucNSWalk.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNSWalk.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNSWalk.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucName2Name.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucName2Name.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucName2Name.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucPinLoader.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinLoader.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinLoader.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucPinPath.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinPath.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinPath.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucPreload.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPreload.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPreload.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucProg.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucProg.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucProg.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucPsx.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPsx.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPsx.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucPup.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPup.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPup.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucReqID.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucReqID.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucReqID.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucSHA3.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSHA3.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSHA3.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucSid.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSid.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSid.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucSiteName.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSiteName.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSiteName.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucStream.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucStream.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucStream.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucString.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucString.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucString.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucSxeq.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSxeq.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSxeq.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucTPC.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTPC.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTPC.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucTokenizer.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTokenizer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTokenizer.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucTrace.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTrace.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTrace.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucUtils.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucUtils.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucUtils.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOucVerName.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucVerName.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucVerName.cc.o.d"
+  "/root/repo/src/XrdOuc/XrdOuca2x.cc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOuca2x.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdOuc/XrdOuca2x.cc.o.d"
+  "/root/repo/src/XrdRmc/XrdRmc.cc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmc.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmc.cc.o.d"
+  "/root/repo/src/XrdRmc/XrdRmcData.cc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcData.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcData.cc.o.d"
+  "/root/repo/src/XrdRmc/XrdRmcReal.cc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcReal.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcReal.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecEntity.cc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntity.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntity.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecEntityAttr.cc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityAttr.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityAttr.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecEntityXtra.cc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityXtra.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityXtra.cc.o.d"
+  "/root/repo/src/XrdSec/XrdSecLoadSecurity.cc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecLoadSecurity.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSec/XrdSecLoadSecurity.cc.o.d"
+  "/root/repo/src/XrdSecsss/XrdSecsssCon.cc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssCon.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssCon.cc.o.d"
+  "/root/repo/src/XrdSecsss/XrdSecsssEnt.cc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssEnt.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssEnt.cc.o.d"
+  "/root/repo/src/XrdSecsss/XrdSecsssID.cc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssID.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssID.cc.o.d"
+  "/root/repo/src/XrdSecsss/XrdSecsssKT.cc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssKT.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssKT.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutAux.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutAux.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutAux.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutBuckList.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuckList.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuckList.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutBucket.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBucket.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBucket.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutBuffer.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuffer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuffer.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutCacheEntry.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutCacheEntry.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutCacheEntry.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutPFCache.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFCache.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFCache.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutPFEntry.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFEntry.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFEntry.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutPFile.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFile.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFile.cc.o.d"
+  "/root/repo/src/XrdSut/XrdSutRndm.cc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutRndm.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSut/XrdSutRndm.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysDir.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysDir.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysDir.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysE2T.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysE2T.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysE2T.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysError.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysError.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysError.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysFAttr.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFAttr.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFAttr.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysFallocate.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFallocate.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFallocate.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysIOEvents.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOEvents.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOEvents.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysIOUring.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOUring.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOUring.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysLogger.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogger.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogger.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysLogging.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogging.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogging.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysPlatform.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlatform.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlatform.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysPlugin.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlugin.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlugin.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysPriv.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPriv.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPriv.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysPthread.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPthread.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPthread.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysTimer.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTimer.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTimer.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysTrace.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTrace.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTrace.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysUtils.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysUtils.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysUtils.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysXAttr.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXAttr.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXAttr.cc.o.d"
+  "/root/repo/src/XrdSys/XrdSysXSLock.cc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXSLock.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXSLock.cc.o.d"
+  "/root/repo/src/XrdTls/XrdTls.cc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTls.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTls.cc.o.d"
+  "/root/repo/src/XrdTls/XrdTlsContext.cc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsContext.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsContext.cc.o.d"
+  "/root/repo/src/XrdTls/XrdTlsNotary.cc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsNotary.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsNotary.cc.o.d"
+  "/root/repo/src/XrdTls/XrdTlsPeerCerts.cc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsPeerCerts.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsPeerCerts.cc.o.d"
+  "/root/repo/src/XrdTls/XrdTlsSocket.cc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsSocket.cc.o" "gcc" "src/CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsSocket.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdUtils.so" "/root/repo/_strict_build/src/libXrdUtils.so.3.0.0"
+  "/root/repo/_strict_build/src/libXrdUtils.so.3" "/root/repo/_strict_build/src/libXrdUtils.so.3.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,239 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdUtils.dir/XProtocol/XProtocol.cc.o"
+  "CMakeFiles/XrdUtils.dir/XProtocol/XProtocol.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdBuffXL.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdBuffXL.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdBuffer.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdBuffer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdGlobals.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdGlobals.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdInet.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdInet.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdInfo.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdInfo.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLink.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLink.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkCtl.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkCtl.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkMatch.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkMatch.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkXeq.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdLinkXeq.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdPoll.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdPoll.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdScheduler.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdScheduler.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdSendQ.cc.o"
+  "CMakeFiles/XrdUtils.dir/Xrd/XrdSendQ.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksAssist.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksAssist.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalccrc32.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalccrc32.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalcmd5.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksCalcmd5.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksConfig.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksConfig.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksLoader.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksLoader.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManOss.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManOss.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManager.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdCks/XrdCksManager.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNet.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNet.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddr.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddr.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddrInfo.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetAddrInfo.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetBuffer.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetBuffer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCache.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCache.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCmsNotify.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetCmsNotify.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetConnect.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetConnect.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetIF.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetIF.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetMsg.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetMsg.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetRegistry.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetRegistry.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSecurity.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSecurity.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSocket.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetSocket.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetUtils.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdNet/XrdNetUtils.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucArgs.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucArgs.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBackTrace.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBackTrace.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBuffer.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucBuffer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC32C.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCRC32C.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCache.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCache.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCallBack.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucCallBack.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucERoute.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucERoute.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucEnv.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucEnv.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucExport.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucExport.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucFileInfo.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucFileInfo.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucGMap.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucGMap.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucHashVal.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucHashVal.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucLogging.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucLogging.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucMsubs.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucMsubs.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucN2NLoader.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucN2NLoader.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNList.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNList.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNSWalk.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucNSWalk.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucName2Name.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucName2Name.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinLoader.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinLoader.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinPath.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPinPath.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPreload.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPreload.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucProg.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucProg.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPsx.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPsx.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPup.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucPup.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucReqID.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucReqID.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSHA3.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSHA3.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSid.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSid.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSiteName.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSiteName.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucStream.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucStream.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucString.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucString.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSxeq.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucSxeq.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTPC.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTPC.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTokenizer.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTokenizer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTrace.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucTrace.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucUtils.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucUtils.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucVerName.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOucVerName.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOuca2x.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdOuc/XrdOuca2x.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmc.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmc.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcData.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcData.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcReal.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdRmc/XrdRmcReal.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntity.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntity.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityAttr.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityAttr.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityXtra.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecEntityXtra.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecLoadSecurity.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSec/XrdSecLoadSecurity.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssCon.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssCon.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssEnt.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssEnt.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssID.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssID.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssKT.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSecsss/XrdSecsssKT.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutAux.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutAux.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuckList.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuckList.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBucket.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBucket.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuffer.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutBuffer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutCacheEntry.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutCacheEntry.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFCache.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFCache.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFEntry.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFEntry.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFile.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutPFile.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutRndm.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSut/XrdSutRndm.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysDir.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysDir.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysE2T.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysE2T.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysError.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysError.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFAttr.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFAttr.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFallocate.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysFallocate.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOEvents.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOEvents.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOUring.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysIOUring.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogger.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogger.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogging.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysLogging.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlatform.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlatform.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlugin.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPlugin.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPriv.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPriv.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPthread.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysPthread.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTimer.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTimer.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTrace.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysTrace.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysUtils.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysUtils.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXAttr.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXAttr.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXSLock.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdSys/XrdSysXSLock.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTls.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTls.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsContext.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsContext.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsNotary.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsNotary.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsPeerCerts.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsPeerCerts.cc.o.d"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsSocket.cc.o"
+  "CMakeFiles/XrdUtils.dir/XrdTls/XrdTlsSocket.cc.o.d"
+  "libXrdUtils.pdb"
+  "libXrdUtils.so"
+  "libXrdUtils.so.3"
+  "libXrdUtils.so.3.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
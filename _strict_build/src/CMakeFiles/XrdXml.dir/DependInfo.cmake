@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdXml/XrdXmlMetaLink.cc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlMetaLink.cc.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlMetaLink.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlRdrTiny.cc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrTiny.cc.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrTiny.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlRdrXml2.cc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrXml2.cc.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrXml2.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlReader.cc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlReader.cc.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/XrdXmlReader.cc.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinystr.cpp" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinystr.cpp.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinystr.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxml.cpp" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxml.cpp.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxml.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxmlerror.cpp" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlerror.cpp.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlerror.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxmlparser.cpp" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlparser.cpp.o" "gcc" "src/CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlparser.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_strict_build/src/libXrdXml.so" "/root/repo/_strict_build/src/libXrdXml.so.3.0.0"
+  "/root/repo/_strict_build/src/libXrdXml.so.3" "/root/repo/_strict_build/src/libXrdXml.so.3.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
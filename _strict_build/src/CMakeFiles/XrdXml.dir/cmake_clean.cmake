@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlMetaLink.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlMetaLink.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrTiny.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrTiny.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrXml2.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlRdrXml2.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlReader.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/XrdXmlReader.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinystr.cpp.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinystr.cpp.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxml.cpp.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxml.cpp.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlerror.cpp.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlerror.cpp.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlparser.cpp.o"
+  "CMakeFiles/XrdXml.dir/XrdXml/tinyxml/tinyxmlparser.cpp.o.d"
+  "libXrdXml.pdb"
+  "libXrdXml.so"
+  "libXrdXml.so.3"
+  "libXrdXml.so.3.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
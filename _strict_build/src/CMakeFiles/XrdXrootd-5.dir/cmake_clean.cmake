@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdXrootd-5.dir/XrdXrootd/XrdXrootdPlugin.cc.o"
+  "CMakeFiles/XrdXrootd-5.dir/XrdXrootd/XrdXrootdPlugin.cc.o.d"
+  "libXrdXrootd-5.pdb"
+  "libXrdXrootd-5.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdXrootd-5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cconfig.dir/XrdApps/XrdAppsCconfig.cc.o"
+  "CMakeFiles/cconfig.dir/XrdApps/XrdAppsCconfig.cc.o.d"
+  "cconfig"
+  "cconfig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
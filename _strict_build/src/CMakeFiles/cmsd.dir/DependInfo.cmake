@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Xrd/XrdConfig.cc" "src/CMakeFiles/cmsd.dir/Xrd/XrdConfig.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/Xrd/XrdConfig.cc.o.d"
+  "/root/repo/src/Xrd/XrdMain.cc" "src/CMakeFiles/cmsd.dir/Xrd/XrdMain.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/Xrd/XrdMain.cc.o.d"
+  "/root/repo/src/Xrd/XrdProtLoad.cc" "src/CMakeFiles/cmsd.dir/Xrd/XrdProtLoad.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/Xrd/XrdProtLoad.cc.o.d"
+  "/root/repo/src/Xrd/XrdStats.cc" "src/CMakeFiles/cmsd.dir/Xrd/XrdStats.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/Xrd/XrdStats.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsAdmin.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsAdmin.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsAdmin.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsBaseFS.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsBaseFS.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsBaseFS.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsCache.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsCache.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsCache.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClustID.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsClustID.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsClustID.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsCluster.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsCluster.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsCluster.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsConfig.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsConfig.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsConfig.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsJob.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsJob.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsJob.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsKey.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsKey.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsKey.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManList.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManList.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManList.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManTree.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManTree.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManTree.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManager.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManager.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsManager.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsMeter.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsMeter.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsMeter.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsNash.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsNash.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsNash.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsNode.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsNode.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsNode.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPList.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPList.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPList.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPrepArgs.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepArgs.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepArgs.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPrepare.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepare.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepare.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsProtocol.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsProtocol.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsProtocol.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRRQ.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsRRQ.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsRRQ.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRouting.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsRouting.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsRouting.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsState.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsState.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsState.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsSupervisor.cc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsSupervisor.cc.o" "gcc" "src/CMakeFiles/cmsd.dir/XrdCms/XrdCmsSupervisor.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
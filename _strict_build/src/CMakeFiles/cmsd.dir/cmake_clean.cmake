@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmsd.dir/Xrd/XrdConfig.cc.o"
+  "CMakeFiles/cmsd.dir/Xrd/XrdConfig.cc.o.d"
+  "CMakeFiles/cmsd.dir/Xrd/XrdMain.cc.o"
+  "CMakeFiles/cmsd.dir/Xrd/XrdMain.cc.o.d"
+  "CMakeFiles/cmsd.dir/Xrd/XrdProtLoad.cc.o"
+  "CMakeFiles/cmsd.dir/Xrd/XrdProtLoad.cc.o.d"
+  "CMakeFiles/cmsd.dir/Xrd/XrdStats.cc.o"
+  "CMakeFiles/cmsd.dir/Xrd/XrdStats.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsAdmin.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsAdmin.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsBaseFS.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsBaseFS.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsCache.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsCache.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsClustID.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsClustID.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsCluster.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsCluster.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsConfig.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsConfig.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsJob.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsJob.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsKey.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsKey.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManList.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManList.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManTree.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManTree.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManager.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsManager.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsMeter.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsMeter.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsNash.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsNash.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsNode.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsNode.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPList.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPList.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepArgs.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepArgs.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepare.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsPrepare.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsProtocol.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsProtocol.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsRRQ.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsRRQ.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsRouting.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsRouting.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsState.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsState.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsSupervisor.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCms/XrdCmsSupervisor.cc.o.d"
+  "cmsd"
+  "cmsd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmsd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
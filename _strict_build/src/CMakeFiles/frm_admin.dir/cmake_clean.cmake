@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdmin.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdmin.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminAudit.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminAudit.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminFiles.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminFiles.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminFind.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminFind.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminMain.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminMain.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminQuery.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminQuery.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminUnlink.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrm/XrdFrmAdminUnlink.cc.o.d"
+  "frm_admin"
+  "frm_admin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_admin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
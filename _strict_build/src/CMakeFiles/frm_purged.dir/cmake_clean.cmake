@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frm_purged.dir/XrdFrm/XrdFrmPurgMain.cc.o"
+  "CMakeFiles/frm_purged.dir/XrdFrm/XrdFrmPurgMain.cc.o.d"
+  "CMakeFiles/frm_purged.dir/XrdFrm/XrdFrmPurge.cc.o"
+  "CMakeFiles/frm_purged.dir/XrdFrm/XrdFrmPurge.cc.o.d"
+  "frm_purged"
+  "frm_purged.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_purged.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
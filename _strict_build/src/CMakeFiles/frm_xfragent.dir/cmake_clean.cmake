@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frm_xfragent.dir/XrdFrm/XrdFrmXfrMain.cc.o"
+  "CMakeFiles/frm_xfragent.dir/XrdFrm/XrdFrmXfrMain.cc.o.d"
+  "frm_xfragent"
+  "frm_xfragent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_xfragent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frm_xfrd.dir/XrdFrm/XrdFrmXfrMain.cc.o"
+  "CMakeFiles/frm_xfrd.dir/XrdFrm/XrdFrmXfrMain.cc.o.d"
+  "frm_xfrd"
+  "frm_xfrd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_xfrd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpxstats.dir/XrdApps/XrdMpxStats.cc.o"
+  "CMakeFiles/mpxstats.dir/XrdApps/XrdMpxStats.cc.o.d"
+  "mpxstats"
+  "mpxstats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpxstats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wait41.dir/XrdApps/XrdWait41.cc.o"
+  "CMakeFiles/wait41.dir/XrdApps/XrdWait41.cc.o.d"
+  "wait41"
+  "wait41.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait41.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
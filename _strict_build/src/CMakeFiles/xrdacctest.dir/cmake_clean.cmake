@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdacctest.dir/XrdApps/XrdAccTest.cc.o"
+  "CMakeFiles/xrdacctest.dir/XrdApps/XrdAccTest.cc.o.d"
+  "xrdacctest"
+  "xrdacctest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdacctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
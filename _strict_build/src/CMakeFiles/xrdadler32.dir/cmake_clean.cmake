@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdadler32.dir/XrdApps/Xrdadler32.cc.o"
+  "CMakeFiles/xrdadler32.dir/XrdApps/Xrdadler32.cc.o.d"
+  "xrdadler32"
+  "xrdadler32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdadler32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
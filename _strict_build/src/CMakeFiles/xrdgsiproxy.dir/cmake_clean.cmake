@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdgsiproxy.dir/XrdSecgsi/XrdSecgsiProxy.cc.o"
+  "CMakeFiles/xrdgsiproxy.dir/XrdSecgsi/XrdSecgsiProxy.cc.o.d"
+  "xrdgsiproxy"
+  "xrdgsiproxy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdgsiproxy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
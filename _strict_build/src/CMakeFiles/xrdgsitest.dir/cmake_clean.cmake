@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdgsitest.dir/XrdSecgsi/XrdSecgsitest.cc.o"
+  "CMakeFiles/xrdgsitest.dir/XrdSecgsi/XrdSecgsitest.cc.o.d"
+  "xrdgsitest"
+  "xrdgsitest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdgsitest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
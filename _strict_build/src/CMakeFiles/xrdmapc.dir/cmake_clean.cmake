@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdmapc.dir/XrdApps/XrdMapCluster.cc.o"
+  "CMakeFiles/xrdmapc.dir/XrdApps/XrdMapCluster.cc.o.d"
+  "xrdmapc"
+  "xrdmapc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdmapc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
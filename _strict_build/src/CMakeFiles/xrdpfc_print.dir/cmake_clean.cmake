@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdpfc_print.dir/XrdPfc/XrdPfcInfo.cc.o"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfc/XrdPfcInfo.cc.o.d"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfc/XrdPfcPrint.cc.o"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfc/XrdPfcPrint.cc.o.d"
+  "xrdpfc_print"
+  "xrdpfc_print.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpfc_print.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
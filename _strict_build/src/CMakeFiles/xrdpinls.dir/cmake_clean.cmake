@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdpinls.dir/XrdApps/XrdPinls.cc.o"
+  "CMakeFiles/xrdpinls.dir/XrdApps/XrdPinls.cc.o.d"
+  "xrdpinls"
+  "xrdpinls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpinls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdpwdadmin.dir/XrdSecpwd/XrdSecpwdSrvAdmin.cc.o"
+  "CMakeFiles/xrdpwdadmin.dir/XrdSecpwd/XrdSecpwdSrvAdmin.cc.o.d"
+  "xrdpwdadmin"
+  "xrdpwdadmin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpwdadmin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdqstats.dir/XrdApps/XrdQStats.cc.o"
+  "CMakeFiles/xrdqstats.dir/XrdApps/XrdQStats.cc.o.d"
+  "xrdqstats"
+  "xrdqstats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdqstats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdsssadmin.dir/XrdSecsss/XrdSecsssAdmin.cc.o"
+  "CMakeFiles/xrdsssadmin.dir/XrdSecsss/XrdSecsssAdmin.cc.o.d"
+  "xrdsssadmin"
+  "xrdsssadmin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdsssadmin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
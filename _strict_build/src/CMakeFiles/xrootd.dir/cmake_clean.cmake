@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrootd.dir/Xrd/XrdConfig.cc.o"
+  "CMakeFiles/xrootd.dir/Xrd/XrdConfig.cc.o.d"
+  "CMakeFiles/xrootd.dir/Xrd/XrdMain.cc.o"
+  "CMakeFiles/xrootd.dir/Xrd/XrdMain.cc.o.d"
+  "CMakeFiles/xrootd.dir/Xrd/XrdProtLoad.cc.o"
+  "CMakeFiles/xrootd.dir/Xrd/XrdProtLoad.cc.o.d"
+  "CMakeFiles/xrootd.dir/Xrd/XrdStats.cc.o"
+  "CMakeFiles/xrootd.dir/Xrd/XrdStats.cc.o.d"
+  "xrootd"
+  "xrootd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrootd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
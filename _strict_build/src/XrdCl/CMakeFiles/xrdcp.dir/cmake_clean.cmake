@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdcp.dir/XrdClCopy.cc.o"
+  "CMakeFiles/xrdcp.dir/XrdClCopy.cc.o.d"
+  "xrdcp"
+  "xrdcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCl/XrdClFS.cc" "src/XrdCl/CMakeFiles/xrdfs.dir/XrdClFS.cc.o" "gcc" "src/XrdCl/CMakeFiles/xrdfs.dir/XrdClFS.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFSExecutor.cc" "src/XrdCl/CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o" "gcc" "src/XrdCl/CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_strict_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_strict_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
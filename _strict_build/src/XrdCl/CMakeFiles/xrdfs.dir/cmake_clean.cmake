@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xrdfs.dir/XrdClFS.cc.o"
+  "CMakeFiles/xrdfs.dir/XrdClFS.cc.o.d"
+  "CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o"
+  "CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o.d"
+  "xrdfs"
+  "xrdfs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
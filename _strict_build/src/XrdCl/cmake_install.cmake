@@ -0,0 +1,219 @@
+# Install script for directory: /root/repo/src/XrdCl
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so.3.0.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so.3"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_strict_build/src/XrdCl/libXrdCl.so.3.0.0"
+    "/root/repo/_strict_build/src/XrdCl/libXrdCl.so.3"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so.3.0.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so.3"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_strict_build/src:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_strict_build/src/XrdCl/libXrdCl.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so"
+         OLD_RPATH "/root/repo/_strict_build/src:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libXrdCl.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_strict_build/src/XrdCl/xrdfs")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs"
+         OLD_RPATH "/root/repo/_strict_build/src/XrdCl:/root/repo/_strict_build/src:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdfs")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_strict_build/src/XrdCl/xrdcp")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp"
+         OLD_RPATH "/root/repo/_strict_build/src/XrdCl:/root/repo/_strict_build/src:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/xrdcp")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/xrootd/XrdCl" TYPE FILE FILES
+    "/root/repo/src/XrdCl/XrdClAnyObject.hh"
+    "/root/repo/src/XrdCl/XrdClBuffer.hh"
+    "/root/repo/src/XrdCl/XrdClBufferPool.hh"
+    "/root/repo/src/XrdCl/XrdClConstants.hh"
+    "/root/repo/src/XrdCl/XrdClCopyProcess.hh"
+    "/root/repo/src/XrdCl/XrdClDefaultEnv.hh"
+    "/root/repo/src/XrdCl/XrdClEnv.hh"
+    "/root/repo/src/XrdCl/XrdClFile.hh"
+    "/root/repo/src/XrdCl/XrdClFileSystem.hh"
+    "/root/repo/src/XrdCl/XrdClFileSystemUtils.hh"
+    "/root/repo/src/XrdCl/XrdClMonitor.hh"
+    "/root/repo/src/XrdCl/XrdClStatus.hh"
+    "/root/repo/src/XrdCl/XrdClURL.hh"
+    "/root/repo/src/XrdCl/XrdClXRootDResponses.hh"
+    "/root/repo/src/XrdCl/XrdClOptional.hh"
+    "/root/repo/src/XrdCl/XrdClPlugInInterface.hh"
+    "/root/repo/src/XrdCl/XrdClPlugInManager.hh"
+    "/root/repo/src/XrdCl/XrdClPropertyList.hh"
+    "/root/repo/src/XrdCl/XrdClLog.hh"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/xrootd/private/XrdCl" TYPE FILE FILES
+    "/root/repo/src/XrdCl/XrdClMessage.hh"
+    "/root/repo/src/XrdCl/XrdClPostMaster.hh"
+    "/root/repo/src/XrdCl/XrdClPostMasterInterfaces.hh"
+    "/root/repo/src/XrdCl/XrdClTransportManager.hh"
+    "/root/repo/src/XrdCl/XrdClResponseJob.hh"
+    "/root/repo/src/XrdCl/XrdClZipArchive.hh"
+    "/root/repo/src/XrdCl/XrdClZipCache.hh"
+    "/root/repo/src/XrdCl/XrdClOperations.hh"
+    "/root/repo/src/XrdCl/XrdClOperationHandlers.hh"
+    "/root/repo/src/XrdCl/XrdClArg.hh"
+    "/root/repo/src/XrdCl/XrdClCtx.hh"
+    "/root/repo/src/XrdCl/XrdClFwd.hh"
+    "/root/repo/src/XrdCl/XrdClParallelOperation.hh"
+    "/root/repo/src/XrdCl/XrdClFileOperations.hh"
+    "/root/repo/src/XrdCl/XrdClFileSystemOperations.hh"
+    "/root/repo/src/XrdCl/XrdClZipOperations.hh"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/man/man1" TYPE FILE FILES
+    "/root/repo/docs/man/xrdfs.1"
+    "/root/repo/docs/man/xrdcp.1"
+    "/root/repo/docs/man/xrdmapc.1"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  
+    EXECUTE_PROCESS(
+      COMMAND ln -sf xrdcp xrdcopy
+      WORKING_DIRECTORY $ENV{DESTDIR}//usr/local/bin )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  
+    EXECUTE_PROCESS(
+      COMMAND ln -sf xrdcp.1 xrdcopy.1
+      WORKING_DIRECTORY $ENV{DESTDIR}//usr/local/share/man/man1 )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  
+    FOREACH(MANPAGE xrdfs.1 xrdcp.1 xrdmapc.1)
+      MESSAGE( "-- Processing: " $ENV{DESTDIR}//usr/local/share/man/man1/${MANPAGE} )
+      EXECUTE_PROCESS(
+        COMMAND cat ${MANPAGE}
+        COMMAND sed  -e "s/__VERSION__/v20261017-1daf19a/"
+        OUTPUT_FILE ${MANPAGE}.new
+        WORKING_DIRECTORY $ENV{DESTDIR}//usr/local/share/man/man1 )
+      EXECUTE_PROCESS(
+        COMMAND mv -f ${MANPAGE}.new ${MANPAGE}
+        WORKING_DIRECTORY $ENV{DESTDIR}//usr/local/share/man/man1 )
+    ENDFOREACH()
+endif()
+
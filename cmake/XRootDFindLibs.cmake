@@ -87,12 +87,6 @@ if( ENABLE_HTTP )
   endif()
 endif()
 
-if( BUILD_TPC )
-set ( CMAKE_REQUIRED_LIBRARIES ${CURL_LIBRARIES} )
-check_function_exists( curl_multi_wait HAVE_CURL_MULTI_WAIT )
-compiler_define_if_found( HAVE_CURL_MULTI_WAIT HAVE_CURL_MULTI_WAIT )
-endif()
-
 find_package( Macaroons )
 include (FindPkgConfig)
 pkg_check_modules(JSON json-c)
@@ -80,6 +80,21 @@ if( NOT MacOSX )
   endif()
 endif()
 
+#-------------------------------------------------------------------------------
+# io_uring (we need IORING_OP_READ/WRITE, the kernel is asked about them via
+# IORING_REGISTER_PROBE which came in the same release as IO_URING_OP_SUPPORTED)
+#-------------------------------------------------------------------------------
+if( LINUX )
+  check_symbol_exists( IO_URING_OP_SUPPORTED "linux/io_uring.h" HAVE_IO_URING )
+  compiler_define_if_found( HAVE_IO_URING HAVE_IO_URING )
+endif()
+
+#-------------------------------------------------------------------------------
+# In kernel copies between local files
+#-------------------------------------------------------------------------------
+check_function_exists( copy_file_range HAVE_COPY_FILE_RANGE )
+compiler_define_if_found( HAVE_COPY_FILE_RANGE HAVE_COPY_FILE_RANGE )
+
 #-------------------------------------------------------------------------------
 # Check for libcrypt
 #-------------------------------------------------------------------------------
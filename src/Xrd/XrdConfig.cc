@@ -265,8 +265,11 @@ XrdConfig::XrdConfig()
    repDest[1] = 0;
    repInt     = 600;
    repOpts    = 0;
+   logBsz     = 0;
+   logDrop    = false;
    ppNet      = 0;
-   tlsOpts    = 9ULL | XrdTlsContext::servr | XrdTlsContext::logVF;
+   tlsOpts    = 9ULL | XrdTlsContext::servr | XrdTlsContext::logVF
+                     | XrdTlsContext::ktlsON;
    tlsNoVer   = false;
    tlsNoCAD   = true;
    NetADM     = 0;
@@ -767,6 +770,12 @@ int XrdConfig::Configure(int argc, char **argv)
    temp = (NoGo ? " initialization failed." : " initialization completed.");
    sprintf(buff, "%s:%d", myInstance, PortTCP);
    Log.Say("------ ", buff, temp);
+
+// Switch to asynchronous logging if so wanted. We do this last so that any
+// configuration errors are written out before we possibly exit.
+//
+   if (!NoGo && logBsz && (retc = Log.logger()->setAsync(logBsz, logDrop)))
+      Log.Emsg("Config", -retc, "enable asynchronous logging");
    if (LogInfo.logArg)
       {strcat(buff, " running ");
        retc = strlen(buff);
@@ -803,6 +812,7 @@ int XrdConfig::ConfigXeq(char *var, XrdOucStream &Config, XrdSysError *eDest)
    TS_Xeq("adminpath",     xapath);
    TS_Xeq("allow",         xallow);
    TS_Xeq("homepath",      xhpath);
+   TS_Xeq("logging",       xlog);
    TS_Xeq("pidpath",       xpidf);
    TS_Xeq("port",          xport);
    TS_Xeq("protocol",      xprot);
@@ -1647,6 +1657,76 @@ int XrdConfig::xbuf(XrdSysError *eDest, XrdOucStream &Config)
     return 0;
 }
 
+/******************************************************************************/
+/*                                  x l o g                                   */
+/******************************************************************************/
+
+/* Function: xlog
+
+   Purpose:  To parse the directive: logging {sync | async [bsz <sz>]
+                                                            [full {drop|wait}]}
+
+             sync      messages are written by the thread issuing them. This is
+                       the default.
+             async     messages are placed in a per-thread buffer and are
+                       written by a dedicated thread.
+             <sz>      the size of each thread's buffer. The default is 64k.
+             drop      drop messages when the thread's buffer is full. The
+                       number of dropped messages is periodically logged.
+             wait      wait for buffer space to become available. This is the
+                       default.
+
+   Output: 0 upon success or !0 upon failure.
+*/
+
+int XrdConfig::xlog(XrdSysError *eDest, XrdOucStream &Config)
+{
+    char *val;
+    long long bsz = 65536;
+    bool drop = false;
+
+// Get the mode
+//
+   if (!(val = Config.GetWord()))
+      {eDest->Emsg("Config", "logging mode not specified"); return 1;}
+   if (!strcmp(val, "sync")) {logBsz = 0; return 0;}
+   if ( strcmp(val, "async"))
+      {eDest->Emsg("Config", "invalid logging mode -", val); return 1;}
+
+// Process the options
+//
+   while((val = Config.GetWord()))
+        {if (!strcmp(val, "bsz"))
+            {if (!(val = Config.GetWord()))
+                {eDest->Emsg("Config", "logging bsz value not specified");
+                 return 1;
+                }
+             if (XrdOuca2x::a2sz(*eDest, "logging bsz", val, &bsz,
+                                 4096, 64*1024*1024)) return 1;
+            }
+         else if (!strcmp(val, "full"))
+            {if (!(val = Config.GetWord()))
+                {eDest->Emsg("Config", "logging full value not specified");
+                 return 1;
+                }
+                  if (!strcmp(val, "drop")) drop = true;
+             else if (!strcmp(val, "wait")) drop = false;
+             else {eDest->Emsg("Config", "invalid logging full value -", val);
+                   return 1;
+                  }
+            }
+         else {eDest->Emsg("Config", "invalid logging option -", val);
+               return 1;
+              }
+        }
+
+// All done
+//
+   logBsz  = static_cast<int>(bsz);
+   logDrop = drop;
+   return 0;
+}
+
 /******************************************************************************/
 /*                                  x n e t                                   */
 /******************************************************************************/
@@ -2141,6 +2221,7 @@ int XrdConfig::xrep(XrdSysError *eDest, XrdOucStream &Config)
 
    Purpose:  To parse directive: sched [mint <mint>] [maxt <maxt>] [avlt <at>]
                                        [idle <idle>] [stksz <qnt>] [core <cv>]
+                                       [queues {<nq> | cores}]
 
              <mint>   is the minimum number of threads that we need. Once
                       this number of threads is created, it does not decrease.
@@ -2157,6 +2238,10 @@ int XrdConfig::xrep(XrdSysError *eDest, XrdOucStream &Config)
              <idle>   The time (in time spec) between checks for underused
                       threads. Those found will be terminated. Default is 780.
              <qnt>    The thread stack size in bytes or K, M, or G.
+             <nq>     The number of run queues. Workers take jobs from their
+                      own queue and steal from the others when it is empty.
+                      Specify cores to use one queue per online core. The
+                      default is a single queue.
 
    Output: 0 upon success or 1 upon failure.
 */
@@ -2166,7 +2251,7 @@ int XrdConfig::xsched(XrdSysError *eDest, XrdOucStream &Config)
     char *val;
     long long lpp;
     int  i, ppp = 0;
-    int  V_mint = -1, V_maxt = -1, V_idle = -1, V_avlt = -1;
+    int  V_mint = -1, V_maxt = -1, V_idle = -1, V_avlt = -1, V_runq = -1;
     struct schedopts {const char *opname; int minv; int *oploc;
                       const char *opmsg;} scopts[] =
        {
@@ -2175,7 +2260,8 @@ int XrdConfig::xsched(XrdSysError *eDest, XrdOucStream &Config)
         {"maxt",       1, &V_maxt, "sched maxt"},
         {"avlt",       1, &V_avlt, "sched avlt"},
         {"core",       1,       0, "sched core"},
-        {"idle",       0, &V_idle, "sched idle"}
+        {"idle",       0, &V_idle, "sched idle"},
+        {"queues",     1, &V_runq, "sched queues"}
        };
     int numopts = sizeof(scopts)/sizeof(struct schedopts);
 
@@ -2202,6 +2288,8 @@ int XrdConfig::xsched(XrdSysError *eDest, XrdOucStream &Config)
                                   return 1;
                                  }
                            }
+                   else if (*scopts[i].opname == 'q' && !strcmp("cores", val))
+                           ppp = 0;
                    else if (*scopts[i].opname == 's')
                            {if (XrdOuca2x::a2sz(*eDest, scopts[i].opmsg, val,
                                                 &lpp, scopts[i].minv)) return 1;
@@ -2234,6 +2322,7 @@ int XrdConfig::xsched(XrdSysError *eDest, XrdOucStream &Config)
 // Establish scheduler options
 //
    Sched.setParms(V_mint, V_maxt, V_avlt, V_idle);
+   if (V_runq >= 0) Sched.setQueues(V_runq);
    return 0;
 }
 
@@ -2339,6 +2428,8 @@ int XrdConfig::xtcpmon(XrdSysError *eDest, XrdOucStream &Config)
              <opts>   options:
                       [no]detail       do [not] print TLS library msgs
                       hsto <sec>       handshake timeout (default 10).
+                      [no]ktls         do [not] use kernel TLS offload when
+                                       available (default ktls).
 
    Output: 0 upon success or 1 upon failure.
 */
@@ -2368,6 +2459,8 @@ int XrdConfig::xtls(XrdSysError *eDest, XrdOucStream &Config)
 
 do {     if (!strcmp(val,   "detail")) SSLmsgs = true;
     else if (!strcmp(val, "nodetail")) SSLmsgs = false;
+    else if (!strcmp(val,   "ktls")) tlsOpts |=  XrdTlsContext::ktlsON;
+    else if (!strcmp(val, "noktls")) tlsOpts &= ~XrdTlsContext::ktlsON;
     else if (!strcmp(val, "hsto" ))
             {if (!(val = Config.GetWord()))
                 {eDest->Emsg("Config", "tls hsto value not specified");
@@ -123,10 +123,12 @@ int                 PortTLS;      // TCP port to listen on for TLS connections
 int                 AdminMode;
 int                 HomeMode;
 int                 repInt;
+int                 logBsz;       // Async logging buffer size (0 -> sync)
 
 uint64_t            tlsOpts;
 bool                tlsNoVer;
 bool                tlsNoCAD;
+bool                logDrop;      // Async logging drops messages when full
 
 char                repOpts;
 char                ppNet;
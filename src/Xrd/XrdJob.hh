@@ -39,6 +39,8 @@
 // queue processing since that's where it spends a lot of time. This class
 // should not be depedent on any other class.
 
+class XrdSchedulerTimer;
+
 class XrdJob
 {
 friend class XrdScheduler;
@@ -53,6 +55,11 @@ virtual void  DoIt() = 0;
 virtual      ~XrdJob() {}
 
 private:
-time_t      SchedTime; // -> Time job is to be scheduled
+// The timer state of a timed job lives in the scheduler; the union keeps the
+// original size of this class so that derived classes are not affected.
+//
+union {time_t             SchedTime; // -> Zero when not timed
+       XrdSchedulerTimer *SchedTP;   // -> Timer wheel entry (timed jobs only)
+      };
 };
 #endif
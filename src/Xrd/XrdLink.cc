@@ -122,6 +122,7 @@ void XrdLink::ResetLink()
    Instance =  0;
    isBridged= false;
    isTLS    = false;
+   isKTLS   = false;
 }
 
 /******************************************************************************/
@@ -344,7 +345,7 @@ int XrdLink::Send(const sfVec *sfP, int sfN)
 {
 // Make sure we have valid vector count
 //
-   if (sfN < 1 || sfN > XrdOucSFVec::sfMax)
+   if (sfN < 1 || sfN > XrdLinkXeq::sfMaxVec)
       {Log.Emsg("Link", E2BIG, "send file to", ID);
        return -1;
       }
@@ -547,6 +547,17 @@ bool            hasBridge() const {return isBridged;}
 
 bool            hasTLS() const {return isTLS;}
 
+//-----------------------------------------------------------------------------
+//! Indicate whether or not the kernel encrypts data sent on this TLS link.
+//! When true, file data may be sent using Send(const sfVec *, int) without
+//! the data passing through user space.
+//!
+//! @return true    this link is  using kernel TLS offload for sending.
+//! @return false   this link not using kernel TLS offload for sending.
+//-----------------------------------------------------------------------------
+
+bool            hasKTLS() const {return isKTLS;}
+
 //-----------------------------------------------------------------------------
 //! Return TLS protocol version being used.
 //!
@@ -577,6 +588,7 @@ char           *HostName;     // Pointer to the hostname
 unsigned int    Instance;     // Instance number of this object
 bool            isBridged;    // If true, this link is an in-memory bridge
 bool            isTLS;        // If true, this link uses TLS for all I/O
-char            rsvd2[2];
+bool            isKTLS;       // If true, the kernel encrypts what we send
+char            rsvd2[1];
 };
 #endif
@@ -614,7 +614,7 @@ int XrdLinkXeq::Send(const sfVec *sfP, int sfN)
 
 #elif defined(__solaris__)
 
-    sendfilevec_t vecSF[XrdOucSFVec::sfMax], *vecSFP = vecSF;
+    sendfilevec_t vecSF[sfMaxVec], *vecSFP = vecSF;
     size_t xframt, totamt, bytes = 0;
     ssize_t retc;
     int i = 0;
@@ -907,6 +907,7 @@ bool XrdLinkXeq::setTLS(bool enable, XrdTlsContext *ctx)
    if (!enable)
       {tlsIO.Shutdown();
        isTLS = enable;
+       isKTLS = false;
        Addr.SetTLS(enable);
        return true;
       }
@@ -932,9 +933,13 @@ bool XrdLinkXeq::setTLS(bool enable, XrdTlsContext *ctx)
 // Diagnose return state
 //
    if (rc != XrdTls::TLS_AOK) Log.Emsg("LinkXeq", eMsg.c_str());
-      else {isTLS = enable;
+      else {char buff[64];
+            isTLS = enable;
+            isKTLS = tlsIO.kTLS();
             Addr.SetTLS(enable);
-            Log.Emsg("LinkXeq", ID, "connection upgraded to", verTLS());
+            snprintf(buff, sizeof(buff), "%s%s", verTLS(),
+                     (isKTLS ? " (kTLS)" : ""));
+            Log.Emsg("LinkXeq", ID, "connection upgraded to", buff);
            }
    return rc == XrdTls::TLS_AOK;
 }
@@ -1291,27 +1296,38 @@ int XrdLinkXeq::TLS_Send(const sfVec *sfP, int sfN)
    ssize_t totamt = 0;
    char myBuff[65536];
 
-// Convert the sendfile to a regular send. The conversion is not particularly
-// fast and caller are advised to avoid using sendfile on TLS connections.
+// When the kernel does the encryption we can hand file segments directly to
+// the kernel. Otherwise, convert the sendfile to a regular send. The
+// conversion is not particularly fast and callers are advised to avoid using
+// sendfile on TLS connections that are not offloaded (see hasKTLS()).
 //
    isIdle = 0;
    for (int i = 0; i < sfN; sfP++, i++)
        {if (!(bytes = sfP->sendsz)) continue;
-        totamt += bytes;
         if (sfP->fdnum < 0)
            {if (!TLS_Write(sfP->buffer, bytes)) return -1;
+            totamt += bytes;
             continue;
            }
         offset = sfP->offset;
         fileFD = sfP->fdnum;
-        buffsz = (bytes < (int)sizeof(myBuff) ? bytes : sizeof(myBuff));
-        do {do {retc = pread(fileFD, myBuff, buffsz, offset);}
-                       while(retc < 0 && errno == EINTR);
-            if (retc < 0) return SFError(errno);
-            if (!retc) break;
-            if (!TLS_Write(myBuff, buffsz)) return -1;
-            offset += buffsz; bytes -= buffsz; totamt += retc;
-           } while(bytes > 0);
+        if (isKTLS)
+           {XrdTls::RC rc;
+            do {rc = tlsIO.SendFile(fileFD, offset, bytes, retc);
+                if (rc != XrdTls::TLS_AOK) return TLS_Error("send file to",rc);
+                if (!retc) break;
+                offset += retc; bytes -= retc; totamt += retc;
+               } while(bytes > 0);
+           } else {
+            do {buffsz = (bytes < (int)sizeof(myBuff) ? bytes : sizeof(myBuff));
+                do {retc = pread(fileFD, myBuff, buffsz, offset);}
+                   while(retc < 0 && errno == EINTR);
+                if (retc < 0) return SFError(errno);
+                if (!retc) break;
+                if (!TLS_Write(myBuff, retc)) return -1;
+                offset += retc; bytes -= retc; totamt += retc;
+               } while(bytes > 0);
+           }
        }
 
 // We are done
@@ -101,6 +101,8 @@ int           Send(const struct iovec *iov, int iocnt, int bytes=0);
 
 int           Send(const sfVec *sdP, int sdn); // Iff sfOK > 0
 
+static const int sfMaxVec = 64; // Longest sfVec accepted by Send(sfVec)
+
 void          setID(const char *userid, int procid);
 
 void          setLocation(XrdNetAddrInfo::LocInfo &loc) {Addr.SetLocation(loc);}
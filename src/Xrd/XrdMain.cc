@@ -77,6 +77,7 @@ Where:
 
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysHeaders.hh"
+#include "XrdSys/XrdSysLogger.hh"
 #include "XrdSys/XrdSysPthread.hh"
 #include "XrdSys/XrdSysUtils.hh"
 
@@ -186,6 +187,7 @@ int main(int argc, char *argv[])
                              (void *)new XrdMain(Main.Config.NetADM),
                              XRDSYSTHREAD_BIND, "Admin handler")))
       {Main.Config.ProtInfo.eDest->Emsg("main", retc, "create admin thread");
+       Main.Config.ProtInfo.eDest->logger()->Flush();
        _exit(3);
       }
 
@@ -202,6 +204,7 @@ int main(int argc, char *argv[])
            if ((retc = XrdSysThread::Run(&tid, mainAccept, (void *)Parms,
                                          XRDSYSTHREAD_BIND, strdup(buff))))
               {Main.Config.ProtInfo.eDest->Emsg("main", retc, "create", buff);
+               Main.Config.ProtInfo.eDest->logger()->Flush();
                _exit(3);
               }
           }
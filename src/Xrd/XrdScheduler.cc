@@ -31,6 +31,8 @@
 #include <fcntl.h>
 #include <signal.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -41,6 +43,7 @@
 
 #include "Xrd/XrdJob.hh"
 #include "Xrd/XrdScheduler.hh"
+#include "XrdSys/XrdSysAtomics.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysLogger.hh"
 
@@ -67,6 +70,71 @@ class XrdSchedulerPID
      ~XrdSchedulerPID() {}
      };
   
+// A timed job is linked into its timer wheel slot through one of these. The
+// entries are recycled and never freed (the scheduler is never deleted).
+//
+class XrdSchedulerTimer
+     {public:
+      XrdSchedulerTimer *Next;
+      XrdSchedulerTimer *Prev;
+      XrdJob            *Job;
+      long long          When;   // Deadline in milliseconds
+      int                Slot;   // Timer wheel slot holding the entry
+
+      XrdSchedulerTimer() : Next(0), Prev(0), Job(0), When(0), Slot(0) {}
+     ~XrdSchedulerTimer() {}
+     };
+
+// Pending work is spread over one or more run queues. A thread adds jobs to
+// its home queue and a worker first looks at its own queue before stealing
+// from the others. The padding keeps neighbouring queues off each other's
+// cache line (an aligned type would need an aligned operator new).
+//
+class XrdSchedulerQueues
+     {public:
+      struct RunQueue
+            {XrdSysMutex       qMutex;
+             XrdJob           *qFirst;
+             XrdJob           *qLast;
+             std::atomic<bool> qBusy;  // Lock free probe: true if qFirst is set
+             char              qPad[64];
+                               RunQueue() : qFirst(0), qLast(0), qBusy(false) {}
+            };
+
+      RunQueue         Queue[MAX_SCHED_RUNQ];
+      int              numQ;   // Number of run queues in use
+      std::atomic<int> nextQ;  // Next home queue to hand out
+
+      XrdSchedulerQueues() : numQ(1), nextQ(0) {}
+     ~XrdSchedulerQueues() {}
+     };
+
+// Timed jobs are hashed by their deadline in milliseconds into the slots of
+// a timer wheel; the bitmap tells which slots are occupied.
+//
+#define XRD_SCHED_TSLOTS 1024   // Timer wheel slots (power of 2, at least 64)
+
+class XrdSchedulerWheel
+     {public:
+      struct TimerSlot
+            {XrdSchedulerTimer *First;   // Timed jobs hashed to this slot
+             long long          MinTime; // Earliest deadline (may be early)
+            };
+
+      TimerSlot          Slot[XRD_SCHED_TSLOTS];
+      unsigned long long Bits[XRD_SCHED_TSLOTS/64]; // Non-empty slots
+      long long          Tick;  // Last millisecond processed
+      long long          Next;  // When the timer thread wakes up next
+      XrdSchedulerTimer *Free;  // Timer entries available for reuse
+
+      XrdSchedulerWheel(long long now) : Tick(now), Next(now + 60*60*1000),
+                                         Free(0)
+                       {memset(Slot, 0, sizeof(Slot));
+                        memset(Bits, 0, sizeof(Bits));
+                       }
+     ~XrdSchedulerWheel() {}
+     };
+  
 /******************************************************************************/
 /*            E x t e r n a l   T h r e a d   I n t e r f a c e s             */
 /******************************************************************************/
@@ -96,7 +164,7 @@ void *XrdStartWorking(void *carg)
 XrdScheduler::XrdScheduler(XrdSysError *eP, XrdOucTrace *tP,
                            int minw, int maxw, int maxi)
               : XrdJob("underused thread monitor"),
-                WorkAvail(0, "sched work")
+                WorkAvail(0, "sched work"), TimerRings(0, "sched timer")
 {
 
 // Perform common initialization
@@ -158,7 +226,7 @@ XrdScheduler::XrdScheduler(XrdSysError *eP, XrdOucTrace *tP,
 //
 XrdScheduler::XrdScheduler(int minw, int maxw, int maxi)
               : XrdJob("underused thread monitor"),
-                WorkAvail(0, "sched work")
+                WorkAvail(0, "sched work"), TimerRings(0, "sched timer")
 {
    XrdSysLogger *Logger;
    int eFD;
@@ -201,28 +269,15 @@ XrdScheduler::~XrdScheduler()  // The scheduler is never deleted!
 
 void XrdScheduler::Cancel(XrdJob *jp)
 {
-   XrdJob *p, *pp = 0;
-
-// Lock the queue
-//
-   TimerMutex.Lock();
 
-// Find the matching job, if any
+// Remove the job from its timer slot, if it is in one
 //
-   p = TimerQueue;
-   while(p && p != jp) {pp = p; p = p->NextJob;}
-
-// Delete the job element
-//
-   if (p)
-      {if (pp) pp->NextJob = p->NextJob;
-          else  TimerQueue = p->NextJob;
+   TimerRings.Lock();
+   if (jp->SchedTP)
+      {TimerDel(jp);
        TRACE(SCHED, "time event " <<jp->Comment <<" cancelled");
       }
-
-// All done
-//
-   TimerMutex.UnLock();
+   TimerRings.UnLock();
 }
   
 /******************************************************************************/
@@ -345,32 +400,35 @@ void *XrdScheduler::Reaper()
   
 void XrdScheduler::Run()
 {
-   int waiting;
+   int waiting, myQ = homeQueue();
    XrdJob *jp;
 
-// Wait for work then do it (an endless task for a worker thread)
+// Wait for work then do it (an endless task for a worker thread). Each post
+// of the semaphore corresponds to a queued job or a layoff. A worker that
+// successfully claims a job is guaranteed to find one in some run queue.
 //
-   do {do {DispatchMutex.Lock();          idl_Workers++;DispatchMutex.UnLock();
+   do {do {AtomicBeg(DispatchMutex);
+           AtomicInc(idl_Workers);
+           AtomicEnd(DispatchMutex);
            WorkAvail.Wait();
-           DispatchMutex.Lock();waiting = --idl_Workers;DispatchMutex.UnLock();
-           SchedMutex.Lock();
-           if ((jp = WorkFirst))
-              {if (!(WorkFirst = jp->NextJob)) WorkLast = 0;
-               if (num_JobsinQ) num_JobsinQ--;
-                  else XrdLog->Emsg("Scheduler","Job queue count underflow!");
-              } else {
-               num_JobsinQ = 0;
-               if (num_Layoffs > 0)
-                  {num_Layoffs--;
-                   if (waiting)
-                      {num_TDestroy++; num_Workers--;
-                       TRACE(SCHED, "terminating thread; workers=" <<num_Workers);
-                       SchedMutex.UnLock();
-                       return;
-                      }
-                  }
-              }
-           SchedMutex.UnLock();
+           AtomicBeg(DispatchMutex);
+           waiting = AtomicDec(idl_Workers) - 1;
+           AtomicEnd(DispatchMutex);
+           if (Claim()) jp = Dequeue(myQ);
+              else {jp = 0;
+                    SchedMutex.Lock();
+                    if (num_Layoffs > 0)
+                       {num_Layoffs--;
+                        if (waiting)
+                           {num_TDestroy++; num_Workers--;
+                            TRACE(SCHED, "terminating thread; workers="
+                                         <<num_Workers);
+                            SchedMutex.UnLock();
+                            return;
+                           }
+                       }
+                    SchedMutex.UnLock();
+                   }
           } while(!jp);
 
     // Check if we should hire a new worker (we always want 1 idle thread)
@@ -389,99 +447,83 @@ void XrdScheduler::Run()
   
 void XrdScheduler::Schedule(XrdJob *jp)
 {
-// Lock down our data area
-//
-   SchedMutex.Lock();
+   XrdSchedulerQueues::RunQueue *rq = &RunQ->Queue[homeQueue()];
+   int inQ;
 
-// Place the request on the queue and broadcast it
+// Place the request on our home queue
 //
    jp->NextJob  = 0;
-   if (WorkFirst)
-      {WorkLast->NextJob = jp;
-       WorkLast = jp;
-      } else {
-       WorkFirst = jp;
-       WorkLast  = jp;
-      }
-   WorkAvail.Post();
+   rq->qMutex.Lock();
+   if (rq->qFirst) rq->qLast->NextJob = jp;
+      else         rq->qFirst        = jp;
+   rq->qLast = jp;
+   rq->qBusy = true;
+   rq->qMutex.UnLock();
 
-// Calculate statistics
+// Calculate statistics (the maximum is advisory so we don't serialize it)
 //
-   num_Jobs++;
-   num_JobsinQ++;
-   if (num_JobsinQ > max_QLength) max_QLength = num_JobsinQ;
+   AtomicInc(num_Jobs);
+   inQ = ++num_JobsinQ;
+   if (inQ > max_QLength) max_QLength = inQ;
 
-// Unlock the data area and return
+// Now that the job can be claimed, wake up a worker
 //
-   SchedMutex.UnLock();
+   WorkAvail.Post();
 }
 
 /******************************************************************************/
   
 void XrdScheduler::Schedule(int numjobs, XrdJob *jfirst, XrdJob *jlast)
 {
+   XrdSchedulerQueues::RunQueue *rq = &RunQ->Queue[homeQueue()];
+   int inQ;
 
-// Lock down our data area
-//
-   SchedMutex.Lock();
-
-// Place the request list on the queue
+// Place the request list on our home queue
 //
    jlast->NextJob = 0;
-   if (WorkFirst)
-      {WorkLast->NextJob = jfirst;
-       WorkLast = jlast;
-      } else {
-       WorkFirst = jfirst;
-       WorkLast  = jlast;
-      }
+   rq->qMutex.Lock();
+   if (rq->qFirst) rq->qLast->NextJob = jfirst;
+      else         rq->qFirst        = jfirst;
+   rq->qLast = jlast;
+   rq->qBusy = true;
+   rq->qMutex.UnLock();
 
 // Calculate statistics
 //
-   num_Jobs    += numjobs;
-   num_JobsinQ += numjobs;
-   if (num_JobsinQ > max_QLength) max_QLength = num_JobsinQ;
+   AtomicAdd(num_Jobs, numjobs);
+   inQ = (num_JobsinQ += numjobs);
+   if (inQ > max_QLength) max_QLength = inQ;
 
 // Indicate number of jobs to work on
 //
    while(numjobs--) WorkAvail.Post();
-
-// Unlock the data area and return
-//
-   SchedMutex.UnLock();
 }
 
 /******************************************************************************/
 
 void XrdScheduler::Schedule(XrdJob *jp, time_t atime)
 {
-   XrdJob *pp = 0, *p;
-
-// Cancel this event, if scheduled
-//
-   Cancel(jp);
+   long long msdelay = (static_cast<long long>(atime) - time(0)) * 1000;
 
-// Lock the queue
+// Add the job to the timer wheel (this cancels any prior scheduling)
 //
    if (TRACING(TRACE_SCHED) && *(jp->Comment) != '.')
       {TRACE(SCHED, "scheduling " <<jp->Comment <<" in " <<atime-time(0) <<" seconds");}
-   jp->SchedTime = atime;
-   TimerMutex.Lock();
+   TimerAdd(jp, Clock() + msdelay);
+}
 
-// Find the insertion point for the work element
-//
-   p = TimerQueue;
-   while(p && p->SchedTime <= atime) {pp = p; p = p->NextJob;}
+/******************************************************************************/
+/*                            S c h e d u l e M S                             */
+/******************************************************************************/
 
-// Insert the job element
-//
-   jp->NextJob = p;
-   if (pp)  pp->NextJob = jp;
-      else {TimerQueue = jp; TimerRings.Signal();}
+void XrdScheduler::ScheduleMS(XrdJob *jp, int msdelay)
+{
 
-// All done
+// Add the job to the timer wheel (this cancels any prior scheduling)
 //
-   TimerMutex.UnLock();
+   if (TRACING(TRACE_SCHED) && *(jp->Comment) != '.')
+      {TRACE(SCHED, "scheduling " <<jp->Comment <<" in " <<msdelay <<" ms");}
+   TimerAdd(jp, Clock() + msdelay);
 }
 
 /******************************************************************************/
@@ -530,6 +572,28 @@ void XrdScheduler::setParms(int minw, int maxw, int avlw, int maxi, int once)
    TRACE(SCHED,"Set stk_Workers=" <<stk_Workers <<" max_Workidl=" <<max_Workidl);
 }
 
+/******************************************************************************/
+/*                             s e t Q u e u e s                              */
+/******************************************************************************/
+
+void XrdScheduler::setQueues(int numq)
+{
+
+// Use one queue per online core if so wanted
+//
+   if (numq <= 0) numq = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+   if (numq < 1) numq = 1;
+      else if (numq > MAX_SCHED_RUNQ) numq = MAX_SCHED_RUNQ;
+
+// We can only ever add queues as jobs may already sit in the existing ones
+//
+   SchedMutex.Lock();
+   if (numq > RunQ->numQ) RunQ->numQ = numq;
+   SchedMutex.UnLock();
+
+   TRACE(SCHED, "Set num_RunQ=" <<RunQ->numQ);
+}
+
 /******************************************************************************/
 /*                                 S t a r t                                  */
 /******************************************************************************/
@@ -608,29 +672,148 @@ int XrdScheduler::Stats(char *buff, int blen, int do_sync)
   
 void XrdScheduler::TimeSched()
 {
-   XrdJob *jp;
-   int wtime;
-
-// Continuous loop until we find some work here
-//
-   do {TimerMutex.Lock();
-       if (TimerQueue) wtime = TimerQueue->SchedTime-time(0);
-          else wtime = 60*60;
-       if (wtime > 0)
-          {TimerMutex.UnLock();
-           TimerRings.Wait(wtime);
-          } else {
-           jp = TimerQueue;
-           TimerQueue = jp->NextJob;
-           Schedule(jp);
-           TimerMutex.UnLock();
-          }
+   const long long maxWait = 60*60*1000;
+   XrdSchedulerWheel *twP = TimerWheel;
+   XrdSchedulerWheel::TimerSlot *tsP;
+   XrdSchedulerTimer *tP, *tnext;
+   XrdJob *jp, *jfirst, *jlast;
+   long long tnow, numTicks, tick;
+   int i, numjobs;
+
+// Continuous loop looking for expired timers. Each pass visits every occupied
+// slot whose tick elapsed since the previous pass (at most one revolution),
+// moves expired jobs to the run queue, and then sleeps until the earliest
+// deadline. Empty slots are skipped using the occupancy bitmap.
+//
+   TimerRings.Lock();
+   do {tnow = Clock();
+       numTicks = tnow - twP->Tick;
+       if (numTicks > XRD_SCHED_TSLOTS) numTicks = XRD_SCHED_TSLOTS;
+       jfirst = jlast = 0; numjobs = 0;
+
+       tick = 0;
+       while((i = TimerSeek(twP->Tick+tick, static_cast<int>(numTicks-tick))))
+            {tick += i;
+             tsP = &twP->Slot[(twP->Tick+tick) & (XRD_SCHED_TSLOTS-1)];
+             tsP->MinTime = tnow + maxWait;
+             tP = tsP->First;
+             while(tP)
+                  {tnext = tP->Next;
+                   if (tP->When <= tnow)
+                      {jp = tP->Job;
+                       TimerDel(jp);
+                       jp->NextJob = 0;
+                       if (jlast) jlast->NextJob = jp;
+                          else    jfirst        = jp;
+                       jlast = jp; numjobs++;
+                      } else if (tP->When < tsP->MinTime)
+                                tsP->MinTime = tP->When;
+                   tP = tnext;
+                  }
+            }
+       if (tnow > twP->Tick) twP->Tick = tnow;
+
+// Run whatever expired. We keep the timer lock so that a job cannot be
+// rescheduled before it is on the run queue.
+//
+       if (numjobs) Schedule(numjobs, jfirst, jlast);
+
+// Determine when the next timer expires and wait for it or for a new timer
+// that expires even earlier. A pending job is never due before its slot comes
+// around again, so the walk stops at the first slot past the best deadline.
+//
+       twP->Next = tnow + maxWait;
+       tick = 0;
+       while((i = TimerSeek(twP->Tick+tick,
+                            XRD_SCHED_TSLOTS-static_cast<int>(tick))))
+            {tick += i;
+             if (twP->Tick+tick >= twP->Next) break;
+             tsP = &twP->Slot[(twP->Tick+tick) & (XRD_SCHED_TSLOTS-1)];
+             if (tsP->MinTime < twP->Next) twP->Next = tsP->MinTime;
+            }
+       if (twP->Next > tnow)
+          TimerRings.WaitMS(static_cast<int>(twP->Next - tnow));
        } while(1);
 }
 
 /******************************************************************************/
 /*                       P r i v a t e   M e t h o d s                        */
 /******************************************************************************/
+/******************************************************************************/
+/*                                 C l a i m                                  */
+/******************************************************************************/
+
+// Reserve one queued job for the caller. Since the count is only raised after
+// a job is on a run queue, a successful claim means a job is there for us.
+//
+bool XrdScheduler::Claim()
+{
+   int inQ = num_JobsinQ;
+
+   while(inQ > 0)
+        {if (num_JobsinQ.compare_exchange_weak(inQ, inQ-1)) return true;}
+   return false;
+}
+
+/******************************************************************************/
+/*                                 C l o c k                                  */
+/******************************************************************************/
+
+// Return a monotonic time in milliseconds used for the timer wheel.
+//
+long long XrdScheduler::Clock()
+{
+   struct timespec tnow;
+
+   clock_gettime(CLOCK_MONOTONIC, &tnow);
+   return static_cast<long long>(tnow.tv_sec)*1000 + tnow.tv_nsec/1000000;
+}
+
+/******************************************************************************/
+/*                               D e q u e u e                                */
+/******************************************************************************/
+
+// Remove a job we have claimed, looking at our home queue first and then
+// stealing from the other queues in order. A claim guarantees that a job is
+// queued somewhere, so we keep looking until we find it.
+//
+XrdJob *XrdScheduler::Dequeue(int qHome)
+{
+   XrdSchedulerQueues::RunQueue *rq;
+   XrdJob *jp;
+   int i, numQ = RunQ->numQ;
+
+   while(1)
+        {for (i = 0; i < numQ; i++)
+             {rq = &RunQ->Queue[(qHome+i) % numQ];
+              if (!rq->qBusy) continue;
+              rq->qMutex.Lock();
+              if ((jp = rq->qFirst))
+                 {if (!(rq->qFirst = jp->NextJob))
+                     {rq->qLast = 0; rq->qBusy = false;}
+                  rq->qMutex.UnLock();
+                  return jp;
+                 }
+              rq->qMutex.UnLock();
+             }
+        }
+}
+
+/******************************************************************************/
+/*                             h o m e Q u e u e                              */
+/******************************************************************************/
+
+// Each thread is assigned a home queue the first time it needs one.
+//
+int XrdScheduler::homeQueue()
+{
+   static thread_local int myQ = -1;
+
+   if (RunQ->numQ == 1) return 0;
+   if (myQ < 0) myQ = RunQ->nextQ++;
+   return myQ % RunQ->numQ;
+}
+
 /******************************************************************************/
 /*                           h i r e   W o r k e r                            */
 /******************************************************************************/
@@ -693,7 +876,109 @@ void XrdScheduler::Init(int minw, int maxw, int maxi)
    num_Layoffs =  0;
    num_Limited =  0;
    firstPID    =  0;
-   WorkFirst = WorkLast = TimerQueue = 0;
+   RunQ        =  new XrdSchedulerQueues;
+   WorkLast    =  0;
+   TimerWheel  =  new XrdSchedulerWheel(Clock());
+}
+
+/******************************************************************************/
+/*                              T i m e r A d d                               */
+/******************************************************************************/
+
+void XrdScheduler::TimerAdd(XrdJob *jp, long long when)
+{
+   XrdSchedulerTimer *tP;
+   XrdSchedulerWheel::TimerSlot *tsP;
+
+// Lock the wheel and cancel this event, if scheduled
+//
+   TimerRings.Lock();
+   if (jp->SchedTP) TimerDel(jp);
+
+// Get a timer entry for the job
+//
+   if ((tP = TimerWheel->Free)) TimerWheel->Free = tP->Next;
+      else tP = new XrdSchedulerTimer;
+   tP->Job = jp;
+   jp->SchedTP = tP;
+
+// Hash the entry into the slot for its deadline. Jobs that are already due go
+// into the slot that will be looked at next.
+//
+   tP->When = when;
+   tP->Slot = static_cast<int>((when > TimerWheel->Tick ? when
+                                                        : TimerWheel->Tick+1)
+                               & (XRD_SCHED_TSLOTS-1));
+   tsP = &TimerWheel->Slot[tP->Slot];
+   tP->Prev = 0;
+   if ((tP->Next = tsP->First)) tsP->First->Prev = tP;
+   tsP->First = tP;
+   if (tP->Next == 0 || when < tsP->MinTime) tsP->MinTime = when;
+   TimerWheel->Bits[tP->Slot >> 6] |= 1ULL << (tP->Slot & 63);
+
+// Wake up the timer thread if this job expires before it would wake up
+//
+   if (when < TimerWheel->Next) {TimerWheel->Next = when; TimerRings.Signal();}
+   TimerRings.UnLock();
+}
+
+/******************************************************************************/
+/*                              T i m e r D e l                               */
+/******************************************************************************/
+
+// Caller must hold the TimerRings lock.
+//
+void XrdScheduler::TimerDel(XrdJob *jp)
+{
+   XrdSchedulerTimer *tP = jp->SchedTP;
+   XrdSchedulerWheel::TimerSlot *tsP = &TimerWheel->Slot[tP->Slot];
+
+// Unlink the entry from its slot
+//
+   if (tP->Prev) tP->Prev->Next = tP->Next;
+      else       tsP->First     = tP->Next;
+   if (tP->Next) tP->Next->Prev = tP->Prev;
+   if (!tsP->First)
+      TimerWheel->Bits[tP->Slot >> 6] &= ~(1ULL << (tP->Slot & 63));
+
+// Recycle the entry, the job is no longer timed
+//
+   tP->Job   = 0;
+   tP->Next  = TimerWheel->Free;
+   TimerWheel->Free = tP;
+   jp->SchedTime = 0;
+}
+
+/******************************************************************************/
+/*                             T i m e r S e e k                              */
+/******************************************************************************/
+
+// Return the distance (1 to maxTicks) from tick to the next occupied slot or
+// zero if there is none that close. Caller must hold the TimerRings lock.
+//
+int XrdScheduler::TimerSeek(long long tick, int maxTicks)
+{
+   const int nWords = XRD_SCHED_TSLOTS/64;
+   unsigned long long bits;
+   int slot, dist, w, n;
+
+// Start with the slot following tick. When we come back to its word after a
+// full revolution only the bits below it remain to be looked at.
+//
+   if (maxTicks <= 0) return 0;
+   slot = static_cast<int>((tick+1) & (XRD_SCHED_TSLOTS-1));
+   w    = slot >> 6;
+   bits = TimerWheel->Bits[w] & (~0ULL << (slot & 63));
+   for (n = 0; n <= nWords; n++)
+       {if (bits)
+           {dist = (((w << 6) + __builtin_ctzll(bits) - slot)
+                 & (XRD_SCHED_TSLOTS-1)) + 1;
+            return (dist <= maxTicks ? dist : 0);
+           }
+        w    = (w + 1) & (nWords-1);
+        bits = TimerWheel->Bits[w];
+       }
+   return 0;
 }
 
 /******************************************************************************/
@@ -29,6 +29,7 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <atomic>
 #include <unistd.h>
 #include <sys/types.h>
 
@@ -37,10 +38,14 @@
 
 class XrdOucTrace;
 class XrdSchedulerPID;
+class XrdSchedulerQueues;
+class XrdSchedulerWheel;
 class XrdSysError;
 
 #define MAX_SCHED_PROCS 30000
 
+#define MAX_SCHED_RUNQ  64
+
 class XrdScheduler : public XrdJob
 {
 public:
@@ -64,8 +69,19 @@ void          Schedule(XrdJob *jp);
 void          Schedule(int num, XrdJob *jfirst, XrdJob *jlast);
 void          Schedule(XrdJob *jp, time_t atime);
 
+// Schedule a job to run after the indicated number of milliseconds. Timed
+// jobs are kept in a timer wheel so that adding and cancelling them is O(1).
+//
+void          ScheduleMS(XrdJob *jp, int msdelay);
+
 void          setParms(int minw, int maxw, int avlt, int maxi, int once=0);
 
+// Set the number of run queues (0 -> one per online core). Must be called
+// before Start(); the count may only grow. One queue is the default and
+// gives the classic single FIFO behaviour.
+//
+void          setQueues(int numq);
+
 void          Start();
 
 int           Stats(char *buff, int blen, int do_sync=0);
@@ -101,24 +117,33 @@ int        max_Workers;   // Sched: Max threads we can start
 int        max_Workidl;   // Sched: Max idle time for threads above min_Workers
 int        num_Workers;   // Sched: Number of threads we have
 int        stk_Workers;   // Sched: Number of sticky workers we can have
-int        num_JobsinQ;   // Sched: Number of outstanding jobs in the queue
+std::atomic<int> num_JobsinQ; // Number of queued jobs not yet claimed
 int        num_Layoffs;   // Sched: Number of threads to terminate
 
-XrdJob                *WorkFirst;  // Pending work
-XrdJob                *WorkLast;
+// The run queues and the timer wheel live outside of this object so that its
+// size and layout stay what they were when they were a single list each.
+//
+XrdSchedulerQueues    *RunQ;       // Pending work
+XrdJob                *WorkLast;   // Not used, kept for the class layout
 XrdSysSemaphore        WorkAvail;
 XrdSysMutex            SchedMutex; // Protects private area
-
-XrdJob                *TimerQueue; // Pending work
-XrdSysCondVar          TimerRings;
-XrdSysMutex            TimerMutex; // Protects scheduler area
+XrdSchedulerWheel     *TimerWheel; // Pending timed work
+XrdSysCondVar          TimerRings; // Protects the timer wheel
+XrdSysMutex            TimerMutex; // Not used, kept for the class layout
 
 XrdSchedulerPID       *firstPID;
 XrdSysMutex            ReaperMutex;
 
+bool    Claim();
+static long long Clock();
+XrdJob *Dequeue(int qHome);
+int     homeQueue();
 void hireWorker(int dotrace=1);
 void Init(int minw, int maxw, int maxi);
 void Monitor();
+void TimerAdd(XrdJob *jp, long long when);
+void TimerDel(XrdJob *jp);
+int  TimerSeek(long long tick, int maxTicks);
 void traceExit(pid_t pid, int status);
 static const char *TraceID;
 };
@@ -43,6 +43,7 @@
 #include "XrdNet/XrdNetAddrInfo.hh"
 #include "XrdOuc/XrdOucUtils.hh"
 #include "XrdSys/XrdSysPlugin.hh"
+#include "XrdSys/XrdSysTimer.hh"
   
 /******************************************************************************/
 /*                   E x t e r n a l   R e f e r e n c e s                    */
@@ -90,8 +91,14 @@ XrdAccAuthorize *XrdAccDefaultAuthorizeObject(XrdSysLogger *lp,
 /*                           C o n s t r u c t o r                            */
 /******************************************************************************/
   
-XrdAccAccess::XrdAccAccess(XrdSysError *erp)
+XrdAccAccess::XrdAccAccess(XrdSysError *erp) : Atab_Gen(0)
 {
+// Start with empty tables in slot zero
+//
+   hostRefX[0] = hostRefX[1] = false;
+   hostRefY[0] = hostRefY[1] = false;
+   Atab_Refs[0] = 0; Atab_Refs[1] = 0;
+
 // Get the audit option that we should use
 //
    Auditor = XrdAccAuditObject(erp);
@@ -130,23 +137,25 @@ XrdAccPrivs XrdAccAccess::Access(const XrdSecEntity    *Entity,
        isuser = false;
       }
 
-// Get a shared context for these potentially long running routines
+// Pin the current tables for these potentially long running routines. This
+// does not lock anything; it merely keeps the tables from being replaced.
 //
-   Access_Context.Lock(xs_Shared);
+   int slot = PinTabs();
+   const XrdAccAccess_Tables &Tabs = Atab[slot];
 
 // Setup the host entry in the eInfo structure (it may need to be resolved)
 //
-   eInfo.host = (hostRefX ? Resolve(Entity) : "?");
+   eInfo.host = (hostRefX[slot] ? Resolve(Entity) : "?");
 
 // Run through the exclusive list first as only one rule will apply
 //
-   if (Atab.SXList)
-      {XrdAccAccess_ID *xlP = Atab.SXList;
+   if (Tabs.SXList)
+      {XrdAccAccess_ID *xlP = Tabs.SXList;
        do {int aSeq = 0;
            while(aeP->Next(aSeq, eInfo))
                 {if (xlP->Applies(eInfo))
                     {xlP->caps->Privs(caps, path, plen, phash);
-                     Access_Context.UnLock(xs_Shared);
+                     UnPinTabs(slot);
                      return Access(caps, Entity, path, oper);
                     }
                 }
@@ -156,42 +165,42 @@ XrdAccPrivs XrdAccAccess::Access(const XrdSecEntity    *Entity,
 
 // Check if we really need to resolve the host name
 //
-//???   if (Atab.D_List || Atab.H_Hash || Atab.N_Hash) host = Resolve(Entity);
-   if (!hostRefX && hostRefY) eInfo.host = Resolve(Entity);
+//???   if (Tabs.D_List || Tabs.H_Hash || Tabs.N_Hash) host = Resolve(Entity);
+   if (!hostRefX[slot] && hostRefY[slot]) eInfo.host = Resolve(Entity);
 
 // Establish default privileges
 //
-   if (Atab.Z_List) Atab.Z_List->Privs(caps, path, plen, phash);
+   if (Tabs.Z_List) Tabs.Z_List->Privs(caps, path, plen, phash);
 
 // Next add in the host domain privileges
 //
-   if (Atab.D_List && (cp = Atab.D_List->Find(eInfo.host)))
+   if (Tabs.D_List && (cp = Tabs.D_List->Find(eInfo.host)))
       cp->Privs(caps, path, plen, phash);
 
 // Next add in the host-specific privileges
 //
-   if (Atab.H_Hash && (cp = Atab.H_Hash->Find(eInfo.host)))
+   if (Tabs.H_Hash && (cp = Tabs.H_Hash->Find(eInfo.host)))
       cp->Privs(caps, path, plen, phash);
 
 // Now add in the netgroup privileges
 //
-   if (Atab.N_Hash && *eInfo.host != '?' &&
+   if (Tabs.N_Hash && *eInfo.host != '?' &&
        (glp = XrdAccConfiguration.GroupMaster.NetGroups(eInfo.name,eInfo.host)))
       {char *gname;
        while((gname = (char *)glp->Next()))
-            if ((cp = Atab.N_Hash->Find((const char *)gname)))
+            if ((cp = Tabs.N_Hash->Find((const char *)gname)))
                cp->Privs(caps, path, plen, phash);
        delete glp;
       }
 
 // Check for user fungible privileges
 //
-   if (isuser && Atab.X_List)
-      Atab.X_List->Privs(caps, path, plen, phash, eInfo.name);
+   if (isuser && Tabs.X_List)
+      Tabs.X_List->Privs(caps, path, plen, phash, eInfo.name);
 
 // Add in specific user privileges
 //
-   if (isuser && Atab.U_Hash && (cp = Atab.U_Hash->Find(eInfo.name)))
+   if (isuser && Tabs.U_Hash && (cp = Tabs.U_Hash->Find(eInfo.name)))
       cp->Privs(caps, path, plen, phash);
 
 // The following privileges are based on multiple attributes. Orgs and roles
@@ -204,28 +213,28 @@ XrdAccPrivs XrdAccAccess::Access(const XrdSecEntity    *Entity,
         {
          // Add in the group privileges.
          //
-         if (Atab.G_Hash && eInfo.grup && (cp = Atab.G_Hash->Find(eInfo.grup)))
+         if (Tabs.G_Hash && eInfo.grup && (cp = Tabs.G_Hash->Find(eInfo.grup)))
             cp->Privs(caps, path, plen, phash);
 
          // Add in the org-specific privileges
          //
-         if (Atab.O_Hash && eInfo.vorg && eInfo.vorg != vorgPrev)
+         if (Tabs.O_Hash && eInfo.vorg && eInfo.vorg != vorgPrev)
             {vorgPrev = eInfo.vorg;
-             if ((cp = Atab.O_Hash->Find(eInfo.vorg)))
+             if ((cp = Tabs.O_Hash->Find(eInfo.vorg)))
                 cp->Privs(caps, path, plen, phash);
             }
 
          // Add in the role-specific privileges
          //
-         if (Atab.R_Hash && eInfo.role && eInfo.role != rolePrev)
+         if (Tabs.R_Hash && eInfo.role && eInfo.role != rolePrev)
             {rolePrev = eInfo.role;
-             if ((cp = Atab.R_Hash->Find(eInfo.role)))
+             if ((cp = Tabs.R_Hash->Find(eInfo.role)))
                 cp->Privs(caps, path, plen, phash);
             }
 
          // Finally run through the inclusive list and apply all relevant rules
          //
-         XrdAccAccess_ID *ylP = Atab.SYList;
+         XrdAccAccess_ID *ylP = Tabs.SYList;
          while (ylP)
                {if (ylP->Applies(eInfo))
                    ylP->caps->Privs(caps, path, plen, phash);
@@ -235,7 +244,7 @@ XrdAccPrivs XrdAccAccess::Access(const XrdSecEntity    *Entity,
 
 // We are now done with looking at changeable data
 //
-   Access_Context.UnLock(xs_Shared);
+   UnPinTabs(slot);
 
 // Return the privileges as needed
 //
@@ -334,13 +343,14 @@ const char *XrdAccAccess::Resolve(const XrdSecEntity *Entity)
 /*                              S w a p T a b s                               */
 /******************************************************************************/
 
-#define XrdAccSWAP(x) oldtab.x = Atab.x;   Atab.x  =  newtab.x; \
+#define XrdAccSWAP(x) oldtab.x = Atab[slot].x;   Atab[slot].x = newtab.x; \
                       newtab.x = oldtab.x; oldtab.x = 0;
 
 void XrdAccAccess::SwapTabs(struct XrdAccAccess_Tables &newtab)
 {
    struct XrdAccAccess_Tables oldtab;
    bool hRefX = false, hRefY = false;
+   int slot = (int)((Atab_Gen.load() + 1) & 1);
 
 // Determine if we need to resolve the host name early
 //
@@ -353,7 +363,7 @@ void XrdAccAccess::SwapTabs(struct XrdAccAccess_Tables &newtab)
 // Determine if we need to resolve the hostname at all.
 //
    if (!hRefX)
-      {if (Atab.D_List || Atab.H_Hash || Atab.N_Hash) hRefY = true;
+      {if (newtab.D_List || newtab.H_Hash || newtab.N_Hash) hRefY = true;
           else {XrdAccAccess_ID *ylP = newtab.SYList;
                 while (ylP)
                       {if (ylP->host) {hRefY = true; break;}
@@ -362,11 +372,13 @@ void XrdAccAccess::SwapTabs(struct XrdAccAccess_Tables &newtab)
                }
       }
 
-// Get an exclusive context to change the table pointers
+// The idle slot holds the tables replaced by the previous swap. Wait for any
+// searcher still using them to finish; new searchers only use the current slot.
 //
-   Access_Context.Lock(xs_Exclusive);
+   while(Atab_Refs[slot].load()) XrdSysTimer::Wait(1);
 
-// Save the old pointer while replacing it with the new pointer
+// Place the new tables in the idle slot, moving the old ones into newtab so
+// that the caller deletes them.
 //
    XrdAccSWAP(D_List);
    XrdAccSWAP(E_List);
@@ -382,8 +394,8 @@ void XrdAccAccess::SwapTabs(struct XrdAccAccess_Tables &newtab)
    XrdAccSWAP(Z_List);
    XrdAccSWAP(SXList);
    XrdAccSWAP(SYList);
-   hostRefX = hRefX;
-   hostRefY = hRefY;
+   hostRefX[slot] = hRefX;
+   hostRefY[slot] = hRefY;
 
 // When we set new access tables, we should purge the group cache
 //
@@ -391,7 +403,7 @@ void XrdAccAccess::SwapTabs(struct XrdAccAccess_Tables &newtab)
 
 // We can now let loose new table searchers
 //
-   Access_Context.UnLock(xs_Exclusive);
+   Atab_Gen++;
 }
 
 /******************************************************************************/
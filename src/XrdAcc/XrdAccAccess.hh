@@ -30,12 +30,13 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <atomic>
+
 #include "XrdAcc/XrdAccAudit.hh"
 #include "XrdAcc/XrdAccAuthorize.hh"
 #include "XrdAcc/XrdAccCapability.hh"
 #include "XrdSec/XrdSecEntity.hh"
 #include "XrdOuc/XrdOucHash.hh"
-#include "XrdSys/XrdSysXSLock.hh"
 #include "XrdSys/XrdSysPlatform.hh"
 
 /******************************************************************************/
@@ -145,7 +146,10 @@ static
 const char       *Resolve(const XrdSecEntity *Entity);
 
 // SwapTabs() is used by the configuration object to establish new access
-// control tables. It may be called whenever the tables change.
+// control tables. It may be called whenever the tables change. Searchers never
+// block: the new tables are built in the idle slot and published by advancing
+// the generation number; the previous tables are freed by the next swap once
+// no searcher is using them.
 //
 void              SwapTabs(struct XrdAccAccess_Tables &newtab);
 
@@ -162,11 +166,25 @@ XrdAccPrivs Access(      XrdAccPrivCaps  &caps,
                    const char            *path,
                    const Access_Operation oper);
 
-struct XrdAccAccess_Tables Atab;
-bool   hostRefX; // True if we need to resolve hostname for exclusive rules
-bool   hostRefY; // True if we need to resolve hostname for any other rules
-
-XrdSysXSLock Access_Context;
+int         PinTabs()
+                   {unsigned long long gen;
+                    int slot;
+                    do {gen  = Atab_Gen.load();
+                        slot = (int)(gen & 1);
+                        Atab_Refs[slot]++;
+                        if (Atab_Gen.load() == gen) return slot;
+                        Atab_Refs[slot]--;
+                       } while(1);
+                   }
+
+void        UnPinTabs(int slot) {Atab_Refs[slot]--;}
+
+struct XrdAccAccess_Tables Atab[2]; // Current and previous tables
+bool   hostRefX[2]; // True if we need to resolve hostname for exclusive rules
+bool   hostRefY[2]; // True if we need to resolve hostname for any other rules
+
+std::atomic<unsigned long long> Atab_Gen;     // Low bit selects current Atab
+std::atomic<int>                Atab_Refs[2]; // Searchers using each Atab
 
 XrdAccAudit *Auditor;
 };
@@ -46,7 +46,7 @@ XrdAccCapability::XrdAccCapability(char *pathval, XrdAccPrivCaps &privval)
 
 // Do common initialization
 //
-   next = 0; ctmp = 0;
+   next = 0; ctmp = 0; trie = 0;
    priv.pprivs = privval.pprivs; priv.nprivs = privval.nprivs;
    plen = strlen(pathval); pins = 0; prem = 0;
    pkey = XrdOucHashVal2((const char *)pathval, plen);
@@ -71,24 +71,95 @@ XrdAccCapability::~XrdAccCapability()
      XrdAccCapability *cp, *np = next;
 
      if (path) {free(path); path = 0;}
+     if (trie) {delete trie; trie = 0;}
 
      while(np) {cp = np; np = np->next; cp->next = 0; delete cp;}
      next = 0;
 }
+/******************************************************************************/
+/*                               C o m p i l e                                */
+/******************************************************************************/
+
+void XrdAccCapability::Compile()
+{
+   XrdOucPrefixTrie<XrdAccCapTrieVal> *ptrie;
+
+// Build the trie from the list and then attach it. The list is not yet visible
+// to any searcher so there is no need to serialize this.
+//
+   ptrie = new XrdOucPrefixTrie<XrdAccCapTrieVal>;
+   Fill(*ptrie, 0);
+   if (trie) delete trie;
+   trie = ptrie;
+}
+
+/******************************************************************************/
+/*                                  F i l l                                   */
+/******************************************************************************/
+
+int XrdAccCapability::Fill(XrdOucPrefixTrie<XrdAccCapTrieVal> &ptrie, int seq)
+{
+   XrdAccCapability *cp = this;
+
+// Insert each path in list order, descending into templates. When the same
+// path appears more than once only the first occurrence can ever match.
+//
+   do {if (cp->ctmp) seq = cp->ctmp->Fill(ptrie, seq);
+          else {XrdAccCapTrieVal &tv = ptrie.Insert(cp->path, cp->plen);
+                if (tv.seq < 0) {tv.priv = cp->priv; tv.seq = seq;}
+                seq++;
+               }
+      } while((cp = cp->next));
+   return seq;
+}
+
 /******************************************************************************/
 /*                                 P r i v s                                  */
 /******************************************************************************/
+
+namespace
+{
+// Selects the matching capability that appears first in the list.
+//
+struct XrdAccCapFirst
+      {const XrdAccCapTrieVal *best;
+       void operator()(const XrdAccCapTrieVal &tv)
+                      {if (!best || tv.seq < best->seq) best = &tv;}
+       XrdAccCapFirst() : best(0) {}
+      };
+}
   
 int XrdAccCapability::Privs(      XrdAccPrivCaps &pathpriv,
                             const char           *pathname,
                             const int             pathlen,
                             const unsigned long   pathhash,
                             const char           *pathsub)
+{
+// Use the compiled form if we have one and no substitution is needed
+//
+   if (trie && !pathsub)
+      {XrdAccCapFirst first;
+       if (!trie->Match(pathname, pathlen, first)) return 0;
+       pathpriv.pprivs = (XrdAccPrivs)(pathpriv.pprivs | first.best->priv.pprivs);
+       pathpriv.nprivs = (XrdAccPrivs)(pathpriv.nprivs | first.best->priv.nprivs);
+       return 1;
+      }
+   return PrivsList(pathpriv, pathname, pathlen, pathsub);
+}
+
+/******************************************************************************/
+/*                             P r i v s L i s t                              */
+/******************************************************************************/
+
+int XrdAccCapability::PrivsList(      XrdAccPrivCaps &pathpriv,
+                                const char           *pathname,
+                                const int             pathlen,
+                                const char           *pathsub)
 {XrdAccCapability *cp=this;
  const int psl = (pathsub ? strlen(pathsub) : 0);
 
  do {if (cp->ctmp)
-       {if (cp->ctmp->Privs(pathpriv,pathname,pathlen,pathhash,pathsub))
+       {if (cp->ctmp->PrivsList(pathpriv,pathname,pathlen,pathsub))
            return 1;
        }
         else if (pathlen >= cp->plen)
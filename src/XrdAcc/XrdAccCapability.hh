@@ -35,6 +35,21 @@
 #include <strings.h>
 
 #include "XrdAcc/XrdAccPrivs.hh"
+#include "XrdOuc/XrdOucPrefixTrie.hh"
+
+/******************************************************************************/
+/*                       X r d A c c C a p T r i e V a l                      */
+/******************************************************************************/
+
+// Value kept in the compiled trie for each capability path. The sequence number
+// is the capability's position in the (template expanded) list so that, as
+// with the list, the first capability that matches is the one that applies.
+//
+struct XrdAccCapTrieVal
+      {XrdAccPrivCaps priv;
+       int            seq;
+       XrdAccCapTrieVal() : seq(-1) {}
+      };
 
 /******************************************************************************/
 /*                      X r d A c c C a p a b i l i t y                       */
@@ -76,17 +91,35 @@ int                 Privs(      XrdAccPrivCaps &pathpriv,
 int                 Subcomp(const char *pathname, const int pathlen,
                             const char *pathsub,  const int sublen);
 
+// Compile() builds a prefix trie from this capability and all those that follow
+// it, expanding templates in place. Afterwards, Privs() resolves a path in time
+// proportional to the path length instead of the number of capabilities. The
+// list must not change after it has been compiled. Lists that are searched with
+// a substitution (i.e. pathsub) are always searched linearly.
+//
+void                Compile();
+
+// PrivsList() is Privs() without the benefit of the compiled trie.
+//
+int                 PrivsList(      XrdAccPrivCaps &pathpriv,
+                              const char           *pathname,
+                              const int             pathlen,
+                              const char           *pathsub=0);
+
                   XrdAccCapability(char *pathval, XrdAccPrivCaps &privval);
 
                   XrdAccCapability(XrdAccCapability *taddr)
-                        {next = 0; ctmp = taddr;
+                        {next = 0; ctmp = taddr; trie = 0;
                          pkey = 0; path = 0; plen = 0; pins = 0; prem = 0;
                         }
 
                  ~XrdAccCapability();
 private:
+int               Fill(XrdOucPrefixTrie<XrdAccCapTrieVal> &ptrie, int seq);
+
 XrdAccCapability *next;      // -> Next capability
 XrdAccCapability *ctmp;      // -> Capability template
+XrdOucPrefixTrie<XrdAccCapTrieVal> *trie; // -> Compiled list (head only)
 
 /*----------- The below fields are valid when template is zero -----------*/
 
@@ -702,6 +702,12 @@ int XrdAccConfig::ConfigDBrec(XrdSysError &Eroute,
        return -1;
       }
 
+   // Compile the capabilities so that a path is resolved in a single pass.
+   // Templates are only used via other capabilities and the '=' list needs
+   // user name substitution, so neither benefits from compilation.
+   //
+   if (rectype != Template_ID && !anyuser) mycap.Next()->Compile();
+
    // Insert the capability into the appropriate table/list
    //
         if (sp) sp->caps = mycap.Next();
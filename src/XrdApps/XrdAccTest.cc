@@ -41,7 +41,12 @@
 
 #include "XrdVersion.hh"
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include "XrdAcc/XrdAccAuthorize.hh"
+#include "XrdAcc/XrdAccCapability.hh"
 #include "XrdAcc/XrdAccConfig.hh"
 #include "XrdAcc/XrdAccGroups.hh"
 #include "XrdAcc/XrdAccPrivs.hh"
@@ -50,6 +55,7 @@
 #include "XrdSys/XrdSysLogger.hh"
 #include "XrdNet/XrdNetAddr.hh"
 #include "XrdOuc/XrdOucEnv.hh"
+#include "XrdOuc/XrdOucPrefixTrie.hh"
 #include "XrdOuc/XrdOucStream.hh"
 
 /******************************************************************************/
@@ -103,12 +109,14 @@ int opcnt = sizeof(optab)/sizeof(optab[0]);
 void Usage(const char *msg)
 {
    if (msg) cerr <<"xrdacctest: " <<msg <<endl;
-   cerr <<"Usage: xrdacctest [-c <cfn>] [<ids> | <user> <host>] <act>\n\n";
+   cerr <<"Usage: xrdacctest [-c <cfn>] [<ids> | <user> <host>] <act>\n";
+   cerr <<"       xrdacctest -b <rules>\n\n";
    cerr <<"<ids>: -a <auth> -g <grp> -h <host> -o <org> -r <role> -u <user>\n";
    cerr <<"<act>: <opc> <path> [<path> [...]]\n";
    cerr <<"<opc>: cr - create    mv - rename    st - status    lk - lock\n";
    cerr <<"       rd - read      wr - write     ls - readdir   rm - remove\n";
    cerr <<"       *  - zap args  ?  - display privs\n";
+   cerr <<"-b     benchmark linear vs compiled path matching with <rules> rules\n";
    cerr <<flush;
    exit(msg ? 1 : 0);
 }
@@ -142,6 +150,128 @@ void ZapEntity()
    Entity.name = 0;
 }
   
+/******************************************************************************/
+/*                                 B e n c h                                  */
+/******************************************************************************/
+
+namespace
+{
+double nsPer(std::chrono::steady_clock::time_point beg, int n)
+{
+   std::chrono::duration<double, std::nano> dur
+                = std::chrono::steady_clock::now() - beg;
+   return dur.count() / n;
+}
+}
+
+// Bench() times path resolution against a policy of nrules prefixes, first as
+// an authdb capability list and then as a set of token scopes, comparing the
+// linear search with the compiled prefix trie. Results must be identical.
+//
+int Bench(int nrules)
+{
+   const int nlook = 200000;
+   std::vector<std::string> paths;
+   std::vector<std::pair<Access_Operation, std::string> > scopes;
+   XrdAccPrivCaps privs;
+   XrdAccCapability head((char *)"", privs), *last = &head;
+   char buff[256];
+   unsigned int seed = 1;
+   long long sumL = 0, sumC = 0;
+
+// Generate the rules. Half of the rules are nested under other rules and the
+// same rule set (with alternating operations) doubles as the token scopes.
+//
+   for (int i = 0; i < nrules; i++)
+       {if (i & 1) snprintf(buff, sizeof(buff), "/store/vo%d/user/u%06d/", i % 97, i - 1);
+          else     snprintf(buff, sizeof(buff), "/store/vo%d/user/u%06d", i % 97, i);
+        privs.pprivs = (i & 1 ? XrdAccPriv_Read : XrdAccPriv_All);
+        XrdAccCapability *cp = new XrdAccCapability(buff, privs);
+        last->Add(cp); last = cp;
+        scopes.push_back(std::make_pair(i & 1 ? AOP_Read : AOP_Create,
+                                        std::string(buff)));
+       }
+   XrdAccCapability *caps = head.Next();
+   head.Add(0);
+
+// Generate the lookups; one in eight does not match any rule.
+//
+   for (int i = 0; i < 4096; i++)
+       {int r = rand_r(&seed) % nrules;
+        if (!(i & 7)) snprintf(buff, sizeof(buff), "/other/vo%d/file%d", r, i);
+           else snprintf(buff, sizeof(buff), "%s/data/run%d/file%d.root",
+                         scopes[r].second.c_str(), i % 13, i);
+        paths.push_back(buff);
+       }
+
+// Authdb capabilities: linear list walk
+//
+   auto beg = std::chrono::steady_clock::now();
+   for (int i = 0; i < nlook; i++)
+       {XrdAccPrivCaps pc;
+        const std::string &path = paths[i & 4095];
+        if (caps->PrivsList(pc, path.c_str(), path.size())) sumL += pc.pprivs;
+       }
+   double linCap = nsPer(beg, nlook);
+
+// Authdb capabilities: compiled trie
+//
+   caps->Compile();
+   beg = std::chrono::steady_clock::now();
+   for (int i = 0; i < nlook; i++)
+       {XrdAccPrivCaps pc;
+        const std::string &path = paths[i & 4095];
+        if (caps->Privs(pc, path.c_str(), path.size())) sumC += pc.pprivs;
+       }
+   double triCap = nsPer(beg, nlook);
+
+   if (sumL != sumC)
+      {cerr <<"xrdacctest: capability results differ!" <<endl; return 1;}
+
+// Token scopes: linear compare over every scope
+//
+   sumL = sumC = 0;
+   beg = std::chrono::steady_clock::now();
+   for (int i = 0; i < nlook; i++)
+       {const std::string &path = paths[i & 4095];
+        Access_Operation oper = (i & 1 ? AOP_Read : AOP_Create);
+        for (const auto &rule : scopes)
+            if (oper == rule.first
+            && !path.compare(0, rule.second.size(), rule.second, 0, rule.second.size()))
+               {sumL++; break;}
+       }
+   double linTok = nsPer(beg, nlook);
+
+// Token scopes: trie of operation masks
+//
+   XrdOucPrefixTrie<unsigned int> trie;
+   for (const auto &rule : scopes)
+       trie.Insert(rule.second.c_str(), rule.second.size()) |= 1U << rule.first;
+   beg = std::chrono::steady_clock::now();
+   for (int i = 0; i < nlook; i++)
+       {const std::string &path = paths[i & 4095];
+        unsigned int allowed = 0;
+        auto merge = [&](const unsigned int &ops) {allowed |= ops;};
+        trie.Match(path.c_str(), path.size(), merge);
+        if (allowed & (1U << (i & 1 ? AOP_Read : AOP_Create))) sumC++;
+       }
+   double triTok = nsPer(beg, nlook);
+
+   if (sumL != sumC)
+      {cerr <<"xrdacctest: scope results differ!" <<endl; return 1;}
+
+// Report
+//
+   snprintf(buff, sizeof(buff), "%d rules, %d lookups\n"
+            "authdb: linear %.1f ns  compiled %.1f ns  (%.1fx)\n"
+            "scopes: linear %.1f ns  compiled %.1f ns  (%.1fx)\n",
+            nrules, nlook, linCap, triCap, linCap/triCap,
+            linTok, triTok, linTok/triTok);
+   cout <<buff <<flush;
+   delete caps;
+   return 0;
+}
+
 /******************************************************************************/
 /*                                  m a i n                                   */
 /******************************************************************************/
@@ -176,9 +306,12 @@ bool singleshot=false;
 
 // Get all of the options.
 //
-   while ((c=getopt(argc,argv,"a:c:de:g:h:o:r:u:s")) != (char)EOF)
+   while ((c=getopt(argc,argv,"a:b:c:de:g:h:o:r:u:s")) != (char)EOF)
      { switch(c)
        {
+       case 'b': if ((rc = atoi(optarg)) <= 0) Usage("invalid rule count.");
+                 exit(Bench(rc));
+                 break;
        case 'a': 
 	         {size_t size = sizeof(Entity.prot)-1;
 	          strncpy(Entity.prot, optarg, size);
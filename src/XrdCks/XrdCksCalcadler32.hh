@@ -82,6 +82,20 @@ class XrdCksCalcadler32 : public XrdCksCalc
 {
 public:
 
+// Combine() extends this checksum by one computed separately, starting from
+// Init(), over the segLen bytes that follow the data seen so far. This allows
+// segments of a file to be checksummed in parallel (derived from zlib).
+//
+void        Combine(const XrdCksCalcadler32 &seg, long long segLen)
+                   {unsigned long long rem = segLen % AdlerBase;
+                    unsigned long long s1  = unSum1, s2;
+                    s2  = (rem * s1) % AdlerBase;
+                    s1 += seg.unSum1 + AdlerBase - 1;
+                    s2 += unSum2 + seg.unSum2 + AdlerBase - rem;
+                    unSum1 = static_cast<unsigned int>(s1 % AdlerBase);
+                    unSum2 = static_cast<unsigned int>(s2 % AdlerBase);
+                   }
+
 char *Final()
             {AdlerValue = (unSum2 << 16) | unSum1;
 #ifndef Xrd_Big_Endian
@@ -176,3 +176,48 @@ void XrdCksCalccrc32::Update(const char *p, int reclen)
         C32Result = (C32Result<<8) 
                   ^ crctable[(unsigned char)((C32Result>>24)^*p++)];
 }
+
+/******************************************************************************/
+/*                               C o m b i n e                                */
+/******************************************************************************/
+
+/* With a zero initial value the crc register is linear in the data, so the
+   register for A followed by B is the register for A times x^(8*len(B)) plus
+   the register for B alone, all modulo the polynomial. The power of x is
+   obtained by repeated squaring, so the cost only grows with log(len(B)).
+*/
+void XrdCksCalccrc32::Combine(const XrdCksCalccrc32 &seg, long long segLen)
+{
+   unsigned int xPow = 1, xSq = 0x100; // x^0 and x^8
+   long long n = segLen;
+
+// Compute x^(8*segLen) mod P
+//
+   while(n)
+        {if (n & 1) xPow = MulMod(xPow, xSq);
+         xSq = MulMod(xSq, xSq);
+         n >>= 1;
+        }
+
+// Shift our register past the segment and add in the segment's register
+//
+   C32Result = MulMod(C32Result, xPow) ^ seg.C32Result;
+   TotLen   += seg.TotLen;
+}
+
+/******************************************************************************/
+/*                                M u l M o d                                 */
+/******************************************************************************/
+
+// Multiply two polynomials over GF(2) modulo the crc polynomial
+
+unsigned int XrdCksCalccrc32::MulMod(unsigned int a, unsigned int b)
+{
+   unsigned int prod = 0;
+
+   for (int i = 31; i >= 0; i--)
+       {prod = (prod << 1) ^ (prod & 0x80000000 ? CRC32_POLY : 0);
+        if (b & (1U << i)) prod ^= a;
+       }
+   return prod;
+}
@@ -42,6 +42,13 @@ class XrdCksCalccrc32 : public XrdCksCalc
 {
 public:
 
+// Combine() extends this checksum by one computed separately, starting from
+// Init(), over the segLen bytes that follow the data seen so far. This allows
+// segments of a file to be checksummed in parallel. Neither object may have
+// had Final() called.
+//
+void        Combine(const XrdCksCalccrc32 &seg, long long segLen);
+
 char *Final() {char buff[sizeof(long long)];
                long long tLcs = TotLen;
                int i = 0;
@@ -68,6 +75,9 @@ const char *Type(int &csSz) {csSz = sizeof(TheResult); return "crc32";}
 virtual    ~XrdCksCalccrc32() {}
 
 private:
+static unsigned int MulMod(unsigned int a, unsigned int b);
+
+static const unsigned int CRC32_POLY  = 0x04c11db7;
 static const unsigned int CRC32_XINIT = 0;
 static const unsigned int CRC32_XOROT = 0xffffffff;
 static       unsigned int crctable[256];
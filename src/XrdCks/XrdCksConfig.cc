@@ -71,9 +71,10 @@ XrdCksConfig::XrdCksConfig(const char *cFN, XrdSysError *Eroute, int &aOK,
 /*                             C o n f i g u r e                              */
 /******************************************************************************/
   
-XrdCks *XrdCksConfig::Configure(const char *dfltCalc, int rdsz, XrdOss *ossP)
+XrdCks *XrdCksConfig::Configure(const char *dfltCalc, int rdsz, XrdOss *ossP,
+                                int nthr)
 {
-   XrdCks *myCks = getCks(ossP, rdsz);
+   XrdCks *myCks = getCks(ossP, rdsz, nthr);
    XrdOucTList *tP = CksList;
    int NoGo = 0;
 
@@ -99,7 +100,7 @@ XrdCks *XrdCksConfig::Configure(const char *dfltCalc, int rdsz, XrdOss *ossP)
 /*                                g e t C k s                                 */
 /******************************************************************************/
 
-XrdCks *XrdCksConfig::getCks(XrdOss *ossP, int rdsz)
+XrdCks *XrdCksConfig::getCks(XrdOss *ossP, int rdsz, int nthr)
 {
    XrdOucPinLoader *myLib;
    XrdCks          *(*ep)(XRDCKSINITPARMS);
@@ -107,8 +108,11 @@ XrdCks *XrdCksConfig::getCks(XrdOss *ossP, int rdsz)
 // Authorization comes from the library or we use the default
 //
    if (!CksLib)
-      {if (ossP) return (XrdCks *)new XrdCksManOss (ossP,eDest,rdsz,myVersion);
-          else   return (XrdCks *)new XrdCksManager(     eDest,rdsz,myVersion);
+      {XrdCksManager *manP;
+       if (ossP) manP = new XrdCksManOss (ossP,eDest,rdsz,myVersion);
+          else   manP = new XrdCksManager(     eDest,rdsz,myVersion);
+       if (nthr > 0) manP->Threads(nthr);
+       return (XrdCks *)manP;
       }
 
 // Create a plugin object (we will throw this away without deletion because
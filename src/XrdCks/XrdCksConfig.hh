@@ -43,7 +43,8 @@ class XrdCksConfig
 {
 public:
 
-XrdCks *Configure(const char *dfltCalc=0, int rdsz=0, XrdOss *ossP=0);
+XrdCks *Configure(const char *dfltCalc=0, int rdsz=0, XrdOss *ossP=0,
+                  int nthr=0);
 
 int     Manager() {return CksLib != 0;}
 
@@ -63,7 +64,7 @@ int     ParseLib(XrdOucStream &Config, int &libType);
                        }
 
 private:
-XrdCks      *getCks(XrdOss *ossP, int rdsz);
+XrdCks      *getCks(XrdOss *ossP, int rdsz, int nthr);
 
 XrdSysError    *eDest;
 const char     *cfgFN;
@@ -37,6 +37,11 @@
 #include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+
+#include <atomic>
+#include <map>
+#include <typeinfo>
+#include <vector>
   
 #include "XrdCks/XrdCksCalc.hh"
 #include "XrdCks/XrdCksCalcadler32.hh"
@@ -58,6 +63,159 @@
 #define ENOATTR ENODATA
 #endif
 
+/******************************************************************************/
+/*                         L o c a l   C l a s s e s                          */
+/******************************************************************************/
+/******************************************************************************/
+/*                         X r d C k s C a l c S e t                          */
+/******************************************************************************/
+
+// A set of checksum objects fed from the same data so that several algorithms
+// are computed in a single pass over a file. The first object is the primary.
+
+class XrdCksCalcSet : public XrdCksCalc
+{
+public:
+
+void        Add(XrdCksCalc *csP)
+               {csObj[csNum] = csP;
+                if (typeid(*csP) == typeid(XrdCksCalcadler32))
+                   csComb[csNum++] = 'a';
+                   else if (typeid(*csP) == typeid(XrdCksCalccrc32))
+                           csComb[csNum++] = 'c';
+                           else csComb[csNum++] = 0;
+               }
+
+bool        Combinable()
+               {for (int i = 0; i < csNum; i++) if (!csComb[i]) return false;
+                return csNum > 0;
+               }
+
+void        Combine(XrdCksCalcSet &seg, long long segLen)
+               {for (int i = 0; i < csNum; i++)
+                    {if (csComb[i] == 'a')
+                        static_cast<XrdCksCalcadler32 *>(csObj[i])->Combine(
+                       *static_cast<XrdCksCalcadler32 *>(seg.csObj[i]), segLen);
+                        else
+                        static_cast<XrdCksCalccrc32   *>(csObj[i])->Combine(
+                       *static_cast<XrdCksCalccrc32   *>(seg.csObj[i]), segLen);
+                    }
+               }
+
+char       *Final() {return csObj[0]->Final();}
+
+void        Init() {for (int i = 0; i < csNum; i++) csObj[i]->Init();}
+
+XrdCksCalc *Item(int i) {return csObj[i];}
+
+XrdCksCalc *New()
+               {XrdCksCalcSet *sP = new XrdCksCalcSet;
+                XrdCksCalc    *csP;
+                for (int i = 0; i < csNum; i++)
+                    {if (!(csP = csObj[i]->New())) {delete sP; return 0;}
+                     sP->Add(csP);
+                    }
+                return sP;
+               }
+
+const char *Type(int &csSize) {return csObj[0]->Type(csSize);}
+
+void        Update(const char *Buff, int BLen)
+               {for (int i = 0; i < csNum; i++) csObj[i]->Update(Buff, BLen);}
+
+            XrdCksCalcSet() : csNum(0) {}
+virtual    ~XrdCksCalcSet() {for (int i = 0; i < csNum; i++) csObj[i]->Recycle();}
+
+private:
+
+static const int csMax = 8;   // Same as the manager's table size
+
+XrdCksCalc *csObj[csMax];
+char        csComb[csMax];  // Native algorithm that can combine segments
+int         csNum;
+};
+
+/******************************************************************************/
+/*                          X r d C k s S e g J o b                           */
+/******************************************************************************/
+
+struct XrdCksSegJob
+      {XrdCksManager *Mgr;
+       const char    *Pfn;
+       XrdCksCalc    *csP;
+       off_t          Offset;
+       off_t          Len;
+       pthread_t      tid;
+       int            fd;
+       int            rc;
+       bool           Run;
+      };
+
+/******************************************************************************/
+/*                          X r d C k s M a n A u x                           */
+/******************************************************************************/
+
+// Per-manager state is kept here, keyed by the manager, so that the layout of
+// XrdCksManager (which checksum plugins may derive from) does not change.
+
+class XrdCksManAux
+{
+public:
+
+std::atomic<int> csUsed;     // Algorithms that have been asked for
+int              segThreads; // Threads used to checksum parallel segments
+
+static void          Add(const XrdCksManager *mP);
+
+static XrdCksManAux *Find(const XrdCksManager *mP)
+                        {XrdSysMutexHelper mHelp(auxMutex);
+                         return auxMap[mP];
+                        }
+
+static void          Remove(const XrdCksManager *mP);
+
+                     XrdCksManAux();
+                    ~XrdCksManAux() {}
+private:
+
+static XrdSysMutex                                     auxMutex;
+static std::map<const XrdCksManager *, XrdCksManAux *> auxMap;
+};
+
+XrdSysMutex                                     XrdCksManAux::auxMutex;
+std::map<const XrdCksManager *, XrdCksManAux *> XrdCksManAux::auxMap;
+
+/******************************************************************************/
+
+XrdCksManAux::XrdCksManAux() : csUsed(0)
+{
+// Large files may be checksummed using up to 4 threads
+//
+   long nCPU = sysconf(_SC_NPROCESSORS_ONLN);
+   segThreads = (nCPU > 4 ? 4 : (nCPU > 1 ? static_cast<int>(nCPU) : 1));
+}
+
+/******************************************************************************/
+
+void XrdCksManAux::Add(const XrdCksManager *mP)
+{
+   XrdCksManAux *auxP = new XrdCksManAux;
+   XrdSysMutexHelper mHelp(auxMutex);
+
+   auxMap[mP] = auxP;
+}
+
+/******************************************************************************/
+
+void XrdCksManAux::Remove(const XrdCksManager *mP)
+{
+   XrdSysMutexHelper mHelp(auxMutex);
+   std::map<const XrdCksManager *, XrdCksManAux *>::iterator it;
+
+   if ((it = auxMap.find(mP)) != auxMap.end())
+      {delete it->second; auxMap.erase(it);}
+}
+
 /******************************************************************************/
 /*                           C o n s t r u c t o r                            */
 /******************************************************************************/
@@ -83,6 +241,10 @@ XrdCksManager::XrdCksManager(XrdSysError *erP, int rdsz, XrdVersionInfo &vInfo,
 //
    if (rdsz <= 65536) segSize = 67108864;
       else segSize = ((rdsz/65536) + (rdsz%65536 != 0)) * 65536;
+
+// Allocate the state that is not part of our layout
+//
+   XrdCksManAux::Add(this);
 }
 
 /******************************************************************************/
@@ -99,6 +261,7 @@ XrdCksManager::~XrdCksManager()
         if (csTab[i].Plugin) delete csTab[i].Plugin;
        }
    if (cksLoader) delete cksLoader;
+   XrdCksManAux::Remove(this);
 }
 
 /******************************************************************************/
@@ -107,41 +270,69 @@ XrdCksManager::~XrdCksManager()
   
 int XrdCksManager::Calc(const char *Pfn, XrdCksData &Cks, int doSet)
 {
+   XrdCksCalcSet *sP;
    XrdCksCalc *csP;
-   csInfo *csIP = &csTab[0];
+   csInfo *csIP = &csTab[0], *csVec[csMax];
    time_t MTime;
-   int rc;
+   int i, csNum = 1, csMask, rc;
 
 // Determine which checksum to get
 //
    if (csLast < 0) return -ENOTSUP;
    if (!(*Cks.Name)) Cks.Set(csIP->Name);
       else if (!(csIP = Find(Cks.Name))) return -ENOTSUP;
+   csVec[0] = csIP;
+
+// If the result is to be recorded, also compute any other checksum that has
+// been asked for and is now stale for this file. This way a site that serves
+// several checksum types reads the file just once.
+//
+   if (doSet && (csMask = Used(csIP) & ~(1 << (csIP - csTab))))
+      {int csTop = csLast;
+       if ((rc = ModTime(Pfn, MTime))) return rc;
+       for (i = 0; i <= csTop; i++)
+           {if (!(csMask & (1 << i)) || !csTab[i].Obj) continue;
+            XrdOucXAttr<XrdCksXAttr> xCS;
+            xCS.Attr.Cks.Set(csTab[i].Name);
+            if (xCS.Get(Pfn) <= 0 || xCS.Attr.Cks.fmTime != MTime)
+               csVec[csNum++] = &csTab[i];
+           }
+      }
 
-// If we need not set the checksum then see if we can get it from the
-// extended attributes.
-
-// Obtain a new checksum object
+// Obtain new checksum objects
 //
-   if (!(csP = csIP->Obj->New())) return -ENOMEM;
+   sP = new XrdCksCalcSet;
+   for (i = 0; i < csNum; i++)
+       {if (!(csP = csVec[i]->Obj->New())) {delete sP; return -ENOMEM;}
+        sP->Add(csP);
+       }
 
-// Use the calculator to get and possibly set the checksum
+// Use the calculator to get and possibly set the checksums
 //
-   if (!(rc = Calc(Pfn, MTime, csP)))
-      {memcpy(Cks.Value, csP->Final(), csIP->Len);
+   if (!(rc = Calc(Pfn, MTime, sP)))
+      {memcpy(Cks.Value, sP->Final(), csIP->Len);
        Cks.fmTime = static_cast<long long>(MTime);
        Cks.csTime = static_cast<int>(time(0) - MTime);
        Cks.Length = csIP->Len;
-       csP->Recycle();
+       for (i = 1; i < csNum; i++)
+           {XrdOucXAttr<XrdCksXAttr> xCS;
+            xCS.Attr.Cks.Set(csVec[i]->Name);
+            memcpy(xCS.Attr.Cks.Value, sP->Item(i)->Final(), csVec[i]->Len);
+            xCS.Attr.Cks.fmTime = Cks.fmTime;
+            xCS.Attr.Cks.csTime = Cks.csTime;
+            xCS.Attr.Cks.Length = csVec[i]->Len;
+            xCS.Set(Pfn);
+           }
        if (doSet)
           {XrdOucXAttr<XrdCksXAttr> xCS;
            memcpy(&xCS.Attr.Cks, &Cks, sizeof(xCS.Attr.Cks));
-           if ((rc = xCS.Set(Pfn))) return -rc;
+           if ((rc = xCS.Set(Pfn))) rc = -rc;
           }
       }
 
 // All done
 //
+   delete sP;
    return rc;
 }
 
@@ -149,6 +340,7 @@ int XrdCksManager::Calc(const char *Pfn, XrdCksData &Cks, int doSet)
   
 int XrdCksManager::Calc(const char *Pfn, time_t &MTime, XrdCksCalc *csP)
 {
+   static const off_t parMin = 256*1024*1024;
    class ioFD
         {public:
          int FD;
@@ -156,10 +348,8 @@ int XrdCksManager::Calc(const char *Pfn, time_t &MTime, XrdCksCalc *csP)
             ~ioFD() {if (FD >= 0) close(FD);}
         } In;
    struct stat Stat;
-   char *inBuff;
-   off_t  Offset=0, fileSize;
-   size_t ioSize, calcSize;
-   int rc;
+   XrdCksCalcSet *sP;
+   off_t  fileSize;
 
 // Open the input file
 //
@@ -169,20 +359,117 @@ int XrdCksManager::Calc(const char *Pfn, time_t &MTime, XrdCksCalc *csP)
 //
    if (fstat(In.FD, &Stat)) return -errno;
    if (!(Stat.st_mode & S_IFREG)) return -EPERM;
-   calcSize = fileSize = Stat.st_size;
+   fileSize = Stat.st_size;
    MTime = Stat.st_mtime;
 
+// Large files are checksummed in parallel segments of at least parMin bytes
+// when every algorithm being computed can combine the segment results.
+//
+   int segThreads = XrdCksManAux::Find(this)->segThreads;
+   if (segThreads > 1 && fileSize >= 2*parMin
+   &&  (sP = dynamic_cast<XrdCksCalcSet *>(csP)) && sP->Combinable())
+      {int n = static_cast<int>(fileSize / parMin);
+       if (n > segThreads) n = segThreads;
+       return CalcPar(Pfn, In.FD, fileSize, n, sP);
+      }
+
+// Do the whole file in one go
+//
+   return CalcSeg(Pfn, In.FD, 0, fileSize, csP);
+}
+
+/******************************************************************************/
+/*                               C a l c P a r                                */
+/******************************************************************************/
+  
+int XrdCksManager::CalcPar(const char *Pfn, int fd, off_t fileSize, int n,
+                           XrdCksCalcSet *sP)
+{
+   std::vector<XrdCksSegJob> Job(n);
+   off_t segLen, Offset = 0;
+   int i, rc = 0;
+
+// Split the file into segments that are a multiple of the i/o size so that
+// each segment starts on a page boundary. We do the first segment ourselves.
+//
+   segLen = fileSize / n;
+   segLen = ((segLen + segSize - 1) / segSize) * segSize;
+   for (i = 0; i < n && Offset < fileSize; i++)
+       {Job[i].Mgr    = this;
+        Job[i].Pfn    = Pfn;
+        Job[i].fd     = fd;
+        Job[i].Offset = Offset;
+        Job[i].Len    = (fileSize - Offset < segLen ? fileSize - Offset : segLen);
+        Job[i].rc     = 0;
+        Job[i].Run    = false;
+        Offset       += Job[i].Len;
+        if (!i) Job[i].csP = sP;
+           else if (!(Job[i].csP = sP->New())) {rc = -ENOMEM; break;}
+       }
+   n = i;
+
+// Start a thread for each remaining segment. Should we not be able to get a
+// thread, the segment is done inline once our own segment is complete.
+//
+   if (!rc)
+      {for (i = 1; i < n; i++)
+           Job[i].Run = !XrdSysThread::Run(&Job[i].tid, XrdCksManager::CalcRun,
+                                           (void *)&Job[i], XRDSYSTHREAD_HOLD,
+                                           "cks segment");
+       Job[0].rc = CalcSeg(Pfn, fd, Job[0].Offset, Job[0].Len, sP);
+       for (i = 1; i < n; i++)
+           {if (Job[i].Run) XrdSysThread::Join(Job[i].tid, 0);
+               else CalcRun((void *)&Job[i]);
+           }
+      }
+
+// Combine the segment results in file order
+//
+   for (i = 0; i < n; i++)
+       {if (!rc && Job[i].rc) rc = Job[i].rc;
+        if (i)
+           {if (!rc) sP->Combine(*static_cast<XrdCksCalcSet *>(Job[i].csP),
+                                 Job[i].Len);
+            Job[i].csP->Recycle();
+           }
+       }
+   return rc;
+}
+
+/******************************************************************************/
+/*                               C a l c R u n                                */
+/******************************************************************************/
+  
+void *XrdCksManager::CalcRun(void *carg)
+{
+   XrdCksSegJob *jP = (XrdCksSegJob *)carg;
+
+   jP->rc = jP->Mgr->CalcSeg(jP->Pfn, jP->fd, jP->Offset, jP->Len, jP->csP);
+   return (void *)0;
+}
+
+/******************************************************************************/
+/*                               C a l c S e g                                */
+/******************************************************************************/
+  
+int XrdCksManager::CalcSeg(const char *Pfn, int fd, off_t Offset,
+                           off_t calcSize, XrdCksCalc *csP)
+{
+   char *inBuff;
+   size_t ioSize;
+   int rc;
+
 // We now compute checksum 64MB at a time using mmap I/O
 //
-   ioSize = (fileSize < (off_t)segSize ? fileSize : segSize); rc = 0;
+   ioSize = (calcSize < (off_t)segSize ? calcSize : segSize); rc = 0;
    while(calcSize)
         {if ((inBuff = (char *)mmap(0, ioSize, PROT_READ, 
 #if defined(__FreeBSD__)
-                       MAP_RESERVED0040|MAP_PRIVATE, In.FD, Offset)) == MAP_FAILED)
+                       MAP_RESERVED0040|MAP_PRIVATE, fd, Offset)) == MAP_FAILED)
 #elif defined(__GNU__)
-                       MAP_PRIVATE, In.FD, Offset)) == MAP_FAILED)
+                       MAP_PRIVATE, fd, Offset)) == MAP_FAILED)
 #else
-                       MAP_NORESERVE|MAP_PRIVATE, In.FD, Offset)) == MAP_FAILED)
+                       MAP_NORESERVE|MAP_PRIVATE, fd, Offset)) == MAP_FAILED)
 #endif
             {rc = errno; eDest->Emsg("Cks", rc, "memory map", Pfn); break;}
          madvise(inBuff, ioSize, MADV_SEQUENTIAL);
@@ -190,7 +477,7 @@ int XrdCksManager::Calc(const char *Pfn, time_t &MTime, XrdCksCalc *csP)
          calcSize -= ioSize; Offset += ioSize;
          if (munmap(inBuff, ioSize) < 0)
             {rc = errno; eDest->Emsg("Cks",rc,"unmap memory for",Pfn); break;}
-         if (calcSize < (size_t)segSize) ioSize = calcSize;
+         if (calcSize < (off_t)segSize) ioSize = calcSize;
         }
 
 // Return if we failed
@@ -459,6 +746,12 @@ int XrdCksManager::Get(const char *Pfn, XrdCksData &Cks)
    if (!*Cks.Name) Cks.Set(csTab[0].Name);
    if (!xCS.Attr.Cks.Set(Cks.Name)) return -ENOTSUP;
 
+// Note that this checksum is wanted so that it is kept current along with any
+// other checksum that we need to calculate.
+//
+   for (int i = 0; i <= csLast; i++)
+       if (!strcmp(Cks.Name, csTab[i].Name)) {Used(&csTab[i]); break;}
+
 // Retreive the attribute
 //
    if ((rc = xCS.Get(Pfn)) <= 0) return (rc && rc != -ENOATTR ? rc : -ESRCH);
@@ -610,6 +903,28 @@ int XrdCksManager::Set(const char *Pfn, XrdCksData &Cks, int myTime)
    return xCS.Set(Pfn);
 }
 
+/******************************************************************************/
+/*                               T h r e a d s                                */
+/******************************************************************************/
+
+void XrdCksManager::Threads(int n)
+{
+   XrdCksManAux::Find(this)->segThreads = (n > 0 ? n : 1);
+}
+
+/******************************************************************************/
+/*                                  U s e d                                   */
+/******************************************************************************/
+
+// Record that the checksum is wanted and return all of the wanted checksums
+
+int XrdCksManager::Used(csInfo *csIP)
+{
+   int csBit = 1 << (csIP - csTab);
+
+   return XrdCksManAux::Find(this)->csUsed.fetch_or(csBit) | csBit;
+}
+
 /******************************************************************************/
 /*                                   V e r                                    */
 /******************************************************************************/
@@ -625,6 +940,7 @@ int XrdCksManager::Ver(const char *Pfn, XrdCksData &Cks)
 //
    if (csLast < 0 || (*Cks.Name && !(csIP = Find(Cks.Name)))) return -ENOTSUP;
    xCS.Attr.Cks.Set(csIP->Name);
+   Used(csIP);
 
 // Verify the file
 //
@@ -41,6 +41,7 @@
 */
 
 class  XrdCksCalc;
+class  XrdCksCalcSet;
 class  XrdCksLoader;
 class  XrdSysError;
 struct XrdVersionInfo;
@@ -70,6 +71,12 @@ virtual int         Set(  const char *Pfn, XrdCksData &Cks, int myTime=0);
 
 virtual int         Ver(  const char *Pfn, XrdCksData &Cks);
 
+/* Threads()  sets the maximum number of threads used to checksum a large file
+              in parallel segments. This is only done for algorithms whose
+              segment checksums can be combined (i.e. adler32 and crc32).
+*/
+        void        Threads(int n);
+
                     XrdCksManager(XrdSysError *erP, int iosz,
                                   XrdVersionInfo &vInfo, bool autoload=false);
 virtual            ~XrdCksManager();
@@ -103,8 +110,15 @@ struct csInfo
                                 {memset(Name, 0, sizeof(Name));}
       };
 
+int     CalcPar(const char *Pfn, int fd, off_t fileSize, int n,
+                XrdCksCalcSet *sP);
+static
+void   *CalcRun(void *carg);
+int     CalcSeg(const char *Pfn, int fd, off_t Offset, off_t Len,
+                XrdCksCalc *csP);
 int     Config(const char *cFN, csInfo &Info);
 csInfo *Find(const char *Name);
+int     Used(csInfo *csIP);
 
 static const int csMax = 8;
 csInfo           csTab[csMax];
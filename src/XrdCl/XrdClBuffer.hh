@@ -25,10 +25,12 @@
 #include <cstring>
 #include <string>
 
+#include "XrdCl/XrdClBufferPool.hh"
+
 namespace XrdCl
 {
   //----------------------------------------------------------------------------
-  //! Binary blob representation
+  //! Binary blob representation, the storage comes from the BufferPool
   //----------------------------------------------------------------------------
   class Buffer
   {
@@ -57,6 +59,9 @@ namespace XrdCl
       //------------------------------------------------------------------------
       Buffer& operator=( Buffer && buffer )
       {
+        if( this == &buffer )
+          return *this;
+        Free();
         Steal( std::move( buffer ) );
         return *this;
       }
@@ -87,10 +92,11 @@ namespace XrdCl
       //------------------------------------------------------------------------
       void ReAllocate( uint32_t size )
       {
-        pBuffer = (char *)realloc( pBuffer, size );
-        if( !pBuffer )
+        char *buffer = BufferPool::Reallocate( pBuffer, pSize, size );
+        if( !buffer )
           throw std::bad_alloc();
-        pSize = size;
+        pBuffer = buffer;
+        pSize   = size;
       }
 
       //------------------------------------------------------------------------
@@ -98,7 +104,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       void Free()
       {
-        free( pBuffer );
+        BufferPool::Free( pBuffer );
         pBuffer = 0;
         pSize   = 0;
         pCursor = 0;
@@ -112,9 +118,13 @@ namespace XrdCl
         if( !size )
          return;
 
-        pBuffer = (char *)malloc( size );
+        BufferPool::Free( pBuffer );
+        pBuffer = BufferPool::Allocate( size );
         if( !pBuffer )
+        {
+          pSize = 0;
           throw std::bad_alloc();
+        }
         pSize = size;
       }
 
@@ -223,7 +233,7 @@ namespace XrdCl
       }
 
       //------------------------------------------------------------------------
-      //! Grab a buffer allocated outside
+      //! Grab a buffer allocated outside with malloc
       //------------------------------------------------------------------------
       void Grab( char *buffer, uint32_t size )
       {
@@ -233,7 +243,7 @@ namespace XrdCl
       }
 
       //------------------------------------------------------------------------
-      //! Release the buffer
+      //! Release the buffer, it can be deallocated with free
       //------------------------------------------------------------------------
       char *Release()
       {
@@ -0,0 +1,348 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClBufferPool.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClMonitor.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__FreeBSD__)
+#include <malloc_np.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Size classes: 64B, 128B, ..., 4MB
+  //----------------------------------------------------------------------------
+  const int      MinShift      = 6;
+  const int      NumClasses    = 17;
+  const uint32_t MaxClassSize  = 1U << ( MinShift + NumClasses - 1 );
+
+  //----------------------------------------------------------------------------
+  // Per-thread cache limits
+  //----------------------------------------------------------------------------
+  const int      ThreadSlots   = 8;
+  const uint32_t ThreadMaxKept = 2 * 1024 * 1024;
+
+  inline int HighBit( uint32_t x )
+  {
+    return 31 - __builtin_clz( x );
+  }
+
+  //----------------------------------------------------------------------------
+  // Smallest class holding size bytes
+  //----------------------------------------------------------------------------
+  inline int CeilClass( uint32_t size )
+  {
+    if( size <= ( 1U << MinShift ) ) return 0;
+    return HighBit( size - 1 ) + 1 - MinShift;
+  }
+
+  //----------------------------------------------------------------------------
+  // Largest class fitting in capacity bytes
+  //----------------------------------------------------------------------------
+  inline int FloorClass( uint32_t capacity )
+  {
+    return HighBit( capacity ) - MinShift;
+  }
+
+  //----------------------------------------------------------------------------
+  // Usable size of a malloc'ed block, never less than what was asked for
+  //----------------------------------------------------------------------------
+  inline uint32_t Usable( char *buffer )
+  {
+#if defined(__APPLE__)
+    size_t size = malloc_size( buffer );
+#else
+    size_t size = malloc_usable_size( buffer );
+#endif
+    return size > UINT32_MAX ? UINT32_MAX : size;
+  }
+
+  //----------------------------------------------------------------------------
+  // Shared state, never destroyed so that it outlives all thread caches
+  //----------------------------------------------------------------------------
+  struct PoolState
+  {
+    PoolState(): maxKept( XrdCl::DefaultBufferPoolSize ), bytesKept( 0 ),
+                 hits( 0 ), misses( 0 ), nextReport( 0 )
+    {
+    }
+
+    XrdSysMutex            mutex[NumClasses];
+    std::vector<char*>     free[NumClasses];
+    std::atomic<int64_t>   maxKept;
+    std::atomic<int64_t>   bytesKept;
+    std::atomic<uint64_t>  hits;
+    std::atomic<uint64_t>  misses;
+    std::atomic<time_t>    nextReport;
+  };
+
+  PoolState &State()
+  {
+    static PoolState *state = new PoolState();
+    return *state;
+  }
+
+  //----------------------------------------------------------------------------
+  // Put a block on the shared free list or free it if the list is full
+  //----------------------------------------------------------------------------
+  void PutShared( char *buffer, int cls )
+  {
+    PoolState &st   = State();
+    int64_t    size = int64_t( 1 ) << ( cls + MinShift );
+    if( st.bytesKept.fetch_add( size, std::memory_order_relaxed ) + size >
+        st.maxKept.load( std::memory_order_relaxed ) )
+    {
+      st.bytesKept.fetch_sub( size, std::memory_order_relaxed );
+      free( buffer );
+      return;
+    }
+    XrdSysMutexHelper scopedLock( st.mutex[cls] );
+    st.free[cls].push_back( buffer );
+  }
+
+  //----------------------------------------------------------------------------
+  // Take a block from the shared free list
+  //----------------------------------------------------------------------------
+  char *GetShared( int cls )
+  {
+    PoolState &st = State();
+    char      *buffer = 0;
+    {
+      XrdSysMutexHelper scopedLock( st.mutex[cls] );
+      if( st.free[cls].empty() ) return 0;
+      buffer = st.free[cls].back();
+      st.free[cls].pop_back();
+    }
+    st.bytesKept.fetch_sub( int64_t( 1 ) << ( cls + MinShift ),
+                            std::memory_order_relaxed );
+    return buffer;
+  }
+
+  //----------------------------------------------------------------------------
+  // Per-thread cache, handed over to the shared lists when the thread exits
+  //----------------------------------------------------------------------------
+  struct ThreadCache
+  {
+    ThreadCache(): bytes( 0 )
+    {
+      for( int i = 0; i < NumClasses; ++i ) count[i] = 0;
+    }
+
+    ~ThreadCache()
+    {
+      for( int i = 0; i < NumClasses; ++i )
+        while( count[i] )
+          PutShared( slots[i][--count[i]], i );
+    }
+
+    char     *slots[NumClasses][ThreadSlots];
+    int       count[NumClasses];
+    uint32_t  bytes;
+  };
+
+  thread_local ThreadCache tCache;
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Get a block of at least size bytes
+  //----------------------------------------------------------------------------
+  char *BufferPool::Allocate( uint32_t size, uint32_t &capacity )
+  {
+    PoolState &st = State();
+
+    if( size > MaxClassSize || st.maxKept.load( std::memory_order_relaxed ) <= 0 )
+    {
+      capacity = size;
+      return (char *)malloc( size );
+    }
+
+    int   cls    = CeilClass( size );
+    char *buffer = 0;
+    capacity = 1U << ( cls + MinShift );
+
+    ThreadCache &tc = tCache;
+    if( tc.count[cls] )
+    {
+      buffer = tc.slots[cls][--tc.count[cls]];
+      tc.bytes -= capacity;
+    }
+    else
+      buffer = GetShared( cls );
+
+    if( buffer )
+    {
+      st.hits.fetch_add( 1, std::memory_order_relaxed );
+      return buffer;
+    }
+
+    st.misses.fetch_add( 1, std::memory_order_relaxed );
+    return (char *)malloc( capacity );
+  }
+
+  //----------------------------------------------------------------------------
+  // Give a block back to the pool
+  //----------------------------------------------------------------------------
+  void BufferPool::Free( char *buffer, uint32_t capacity )
+  {
+    if( !buffer ) return;
+
+    PoolState &st = State();
+    if( capacity < ( 1U << MinShift ) || capacity > MaxClassSize ||
+        st.maxKept.load( std::memory_order_relaxed ) <= 0 )
+    {
+      free( buffer );
+      return;
+    }
+
+    int      cls  = FloorClass( capacity );
+    uint32_t size = 1U << ( cls + MinShift );
+
+    ThreadCache &tc = tCache;
+    if( tc.count[cls] < ThreadSlots && tc.bytes + size <= ThreadMaxKept )
+    {
+      tc.slots[cls][tc.count[cls]++] = buffer;
+      tc.bytes += size;
+      return;
+    }
+    PutShared( buffer, cls );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get a block released through its handle
+  //----------------------------------------------------------------------------
+  BufferPool::Block BufferPool::AllocateBlock( uint32_t size )
+  {
+    uint32_t capacity;
+    char    *buffer = Allocate( size, capacity );
+    return Block( buffer, buffer ? capacity : 0 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get a block for a Buffer
+  //----------------------------------------------------------------------------
+  char *BufferPool::Allocate( uint32_t size )
+  {
+    uint32_t capacity;
+    return Allocate( size, capacity );
+  }
+
+  //----------------------------------------------------------------------------
+  // Grow or shrink a Buffer block
+  //----------------------------------------------------------------------------
+  char *BufferPool::Reallocate( char *buffer, uint32_t used, uint32_t size )
+  {
+    if( !buffer )
+      return Allocate( size );
+
+    if( size <= Usable( buffer ) )
+      return buffer;
+
+    char *newBuffer = Allocate( size );
+    if( !newBuffer )
+      return 0;
+    memcpy( newBuffer, buffer, used < size ? used : size );
+    Free( buffer );
+    return newBuffer;
+  }
+
+  //----------------------------------------------------------------------------
+  // Give a Buffer block back to the pool
+  //----------------------------------------------------------------------------
+  void BufferPool::Free( char *buffer )
+  {
+    if( buffer )
+      Free( buffer, Usable( buffer ) );
+  }
+
+  //----------------------------------------------------------------------------
+  // Set the maximum number of bytes kept
+  //----------------------------------------------------------------------------
+  void BufferPool::Configure( int maxKept )
+  {
+    State().maxKept.store( maxKept, std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the statistics
+  //----------------------------------------------------------------------------
+  void BufferPool::GetStats( Stats &stats )
+  {
+    PoolState &st = State();
+    stats.hits      = st.hits.load( std::memory_order_relaxed );
+    stats.misses    = st.misses.load( std::memory_order_relaxed );
+    stats.bytesKept = st.bytesKept.load( std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Report the statistics to the monitor
+  //----------------------------------------------------------------------------
+  void BufferPool::Report( time_t now )
+  {
+    PoolState &st = State();
+
+    int interval = DefaultBufferPoolReport;
+    DefaultEnv::GetEnv()->GetInt( "BufferPoolReport", interval );
+    if( interval <= 0 ) return;
+
+    time_t next = st.nextReport.load( std::memory_order_relaxed );
+    if( now < next ||
+        !st.nextReport.compare_exchange_strong( next, now + interval ) )
+      return;
+    if( !next ) return; // first call only arms the timer
+
+    Monitor *mon = DefaultEnv::GetMonitor();
+    if( !mon ) return;
+
+    Stats stats;
+    GetStats( stats );
+    Monitor::BufferPoolInfo i;
+    i.hits      = stats.hits;
+    i.misses    = stats.misses;
+    i.bytesKept = stats.bytesKept;
+    mon->Event( Monitor::EvBufferPool, &i );
+  }
+
+  //----------------------------------------------------------------------------
+  // Lock / unlock the shared free lists
+  //----------------------------------------------------------------------------
+  void BufferPool::Lock()
+  {
+    PoolState &st = State();
+    for( int i = 0; i < NumClasses; ++i ) st.mutex[i].Lock();
+  }
+
+  void BufferPool::UnLock()
+  {
+    PoolState &st = State();
+    for( int i = NumClasses - 1; i >= 0; --i ) st.mutex[i].UnLock();
+  }
+}
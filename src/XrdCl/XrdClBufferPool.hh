@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_BUFFER_POOL_HH__
+#define __XRD_CL_BUFFER_POOL_HH__
+
+#include <stdint.h>
+#include <time.h>
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  //! Pool of memory blocks backing Buffer and Message objects
+  //!
+  //! Blocks are grouped in power of two size classes and recycled through a
+  //! small per-thread cache and a shared, size limited, free list per class.
+  //! Every block is obtained with malloc, so a block handed out by
+  //! Buffer::Release may still be freed with free and any malloc'ed block
+  //! may be given back to the pool. Buffer does not record the capacity of
+  //! its block, the pool asks the allocator for it instead.
+  //----------------------------------------------------------------------------
+  class BufferPool
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Pool statistics
+      //------------------------------------------------------------------------
+      struct Stats
+      {
+        uint64_t hits;       //!< allocations served from the pool
+        uint64_t misses;     //!< allocations that needed malloc
+        uint64_t bytesKept;  //!< bytes currently kept in shared free lists
+      };
+
+      //------------------------------------------------------------------------
+      //! A block that is given back to the pool when the handle goes away
+      //------------------------------------------------------------------------
+      class Block
+      {
+        public:
+          //--------------------------------------------------------------------
+          //! Constructor, the handle is empty
+          //--------------------------------------------------------------------
+          Block(): pBuffer(0), pCapacity(0) {}
+
+          //--------------------------------------------------------------------
+          //! Move Constructor
+          //--------------------------------------------------------------------
+          Block( Block &&block ): pBuffer( block.pBuffer ),
+                                  pCapacity( block.pCapacity )
+          {
+            block.pBuffer   = 0;
+            block.pCapacity = 0;
+          }
+
+          //--------------------------------------------------------------------
+          //! Move assignment operator
+          //--------------------------------------------------------------------
+          Block& operator=( Block &&block )
+          {
+            if( this == &block )
+              return *this;
+            Reset();
+            pBuffer         = block.pBuffer;
+            pCapacity       = block.pCapacity;
+            block.pBuffer   = 0;
+            block.pCapacity = 0;
+            return *this;
+          }
+
+          Block( const Block& ) = delete;
+          Block& operator=( const Block& ) = delete;
+
+          //--------------------------------------------------------------------
+          //! Destructor
+          //--------------------------------------------------------------------
+          ~Block() { Reset(); }
+
+          //--------------------------------------------------------------------
+          //! Get the memory, 0 if the handle is empty
+          //--------------------------------------------------------------------
+          char *Get() const
+          {
+            return pBuffer;
+          }
+
+          //--------------------------------------------------------------------
+          //! Get the actual size of the block
+          //--------------------------------------------------------------------
+          uint32_t GetCapacity() const
+          {
+            return pCapacity;
+          }
+
+          //--------------------------------------------------------------------
+          //! Give the block back to the pool now
+          //--------------------------------------------------------------------
+          void Reset()
+          {
+            BufferPool::Free( pBuffer, pCapacity );
+            pBuffer   = 0;
+            pCapacity = 0;
+          }
+
+        private:
+          friend class BufferPool;
+
+          Block( char *buffer, uint32_t capacity ): pBuffer( buffer ),
+                                                    pCapacity( capacity ) {}
+
+          char     *pBuffer;
+          uint32_t  pCapacity;
+      };
+
+      //------------------------------------------------------------------------
+      //! Get a block of at least size bytes
+      //!
+      //! @param size requested size
+      //! @return     the block, the handle is empty if out of memory
+      //------------------------------------------------------------------------
+      static Block AllocateBlock( uint32_t size );
+
+      //------------------------------------------------------------------------
+      //! Get a block of at least size bytes for a Buffer
+      //------------------------------------------------------------------------
+      static char *Allocate( uint32_t size );
+
+      //------------------------------------------------------------------------
+      //! Grow or shrink a Buffer block, the first used bytes are preserved
+      //!
+      //! @return the new block or 0 if out of memory, in which case the old
+      //!         block is left as it is
+      //------------------------------------------------------------------------
+      static char *Reallocate( char *buffer, uint32_t used, uint32_t size );
+
+      //------------------------------------------------------------------------
+      //! Give a malloc'ed Buffer block back to the pool
+      //------------------------------------------------------------------------
+      static void Free( char *buffer );
+
+      //------------------------------------------------------------------------
+      //! Set the maximum number of bytes kept in the shared free lists, zero
+      //! disables pooling
+      //------------------------------------------------------------------------
+      static void Configure( int maxKept );
+
+      //------------------------------------------------------------------------
+      //! Get the statistics
+      //------------------------------------------------------------------------
+      static void GetStats( Stats &stats );
+
+      //------------------------------------------------------------------------
+      //! Report the statistics to the monitor if the report interval passed
+      //------------------------------------------------------------------------
+      static void Report( time_t now );
+
+      //------------------------------------------------------------------------
+      //! Lock / unlock the shared free lists (used by the fork handler)
+      //------------------------------------------------------------------------
+      static void Lock();
+      static void UnLock();
+
+    private:
+      static char *Allocate( uint32_t size, uint32_t &capacity );
+      static void  Free( char *buffer, uint32_t capacity );
+  };
+}
+
+#endif // __XRD_CL_BUFFER_POOL_HH__
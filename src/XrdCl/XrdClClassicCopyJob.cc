@@ -244,6 +244,82 @@ namespace
     return false;
   }
 
+  //----------------------------------------------------------------------------
+  //! Copy between two local files within the kernel. The data never enters
+  //! user space and file systems that support reflinks share the extents
+  //! instead of copying them.
+  //----------------------------------------------------------------------------
+  class LocalFileCopy
+  {
+    public:
+      LocalFileCopy(): pSrcFD( -1 ), pDstFD( -1 )
+      {
+      }
+
+      ~LocalFileCopy()
+      {
+        if( pSrcFD >= 0 ) close( pSrcFD );
+        if( pDstFD >= 0 ) close( pDstFD );
+      }
+
+      //------------------------------------------------------------------------
+      //! Open both files, the destination must have been created already
+      //!
+      //! @return false if the copy cannot be done this way
+      //------------------------------------------------------------------------
+      bool Open( const XrdCl::URL &src, const XrdCl::URL &dst )
+      {
+#ifdef HAVE_COPY_FILE_RANGE
+        pSrcFD = open( src.GetPath().c_str(), O_RDONLY );
+        pDstFD = open( dst.GetPath().c_str(), O_WRONLY );
+        return pSrcFD >= 0 && pDstFD >= 0;
+#else
+        return false;
+#endif
+      }
+
+      //------------------------------------------------------------------------
+      //! Copy up to size bytes at offset
+      //!
+      //! @return number of bytes copied, 0 at the end of the source, or -errno
+      //------------------------------------------------------------------------
+      ssize_t Copy( uint64_t offset, size_t size )
+      {
+#ifdef HAVE_COPY_FILE_RANGE
+        loff_t  srcOff = offset, dstOff = offset;
+        ssize_t rc;
+        do
+        {
+          rc = copy_file_range( pSrcFD, &srcOff, pDstFD, &dstOff, size, 0 );
+        }
+        while( rc < 0 && errno == EINTR );
+        return ( rc < 0 ? -errno : rc );
+#else
+        return -ENOTSUP;
+#endif
+      }
+
+      //------------------------------------------------------------------------
+      //! Check if an error means that the kernel cannot copy these files
+      //------------------------------------------------------------------------
+      static bool NotSupported( int err )
+      {
+        return err == EXDEV || err == ENOSYS || err == EOPNOTSUPP ||
+               err == ENOTSUP || err == EINVAL || err == EBADF;
+      }
+
+      //------------------------------------------------------------------------
+      //! Size of a single copy, the progress is reported after each of them
+      //------------------------------------------------------------------------
+      static const size_t SliceSize = 64 * 1024 * 1024;
+
+    private:
+      int pSrcFD;
+      int pDstFD;
+  };
+
+  const size_t LocalFileCopy::SliceSize;
+
   //----------------------------------------------------------------------------
   //! Abstract chunk source
   //----------------------------------------------------------------------------
@@ -2004,7 +2080,58 @@ namespace XrdCl
     ChunkInfo chunkInfo;
     uint64_t  processed = 0;
     auto      start     = time_nsec();
-    while( 1 )
+
+    //--------------------------------------------------------------------------
+    // Let the kernel copy the data between plain local files if nothing has
+    // to look at it on the way
+    //--------------------------------------------------------------------------
+    bool          kernelCopy = false;
+    LocalFileCopy localCopy;
+    if( !xcp && !zip && !dynamicSource && !xRate && checkSumMode == "none" &&
+        src->GetSize() >= 0 &&
+        GetSource().IsLocalFile() && !GetSource().IsMetalink() &&
+        newDestUrl.IsLocalFile() && !newDestUrl.IsMetalink() &&
+        localCopy.Open( GetSource(), newDestUrl ) )
+    {
+      uint64_t offset = continue_ ? dest->GetSize() : 0;
+      kernelCopy = true;
+      while( processed < size )
+      {
+        size_t  slice = std::min<uint64_t>( size - processed,
+                                            LocalFileCopy::SliceSize );
+        ssize_t rc    = localCopy.Copy( offset + processed, slice );
+        if( rc < 0 )
+        {
+          if( !processed && LocalFileCopy::NotSupported( -rc ) )
+          {
+            log->Debug( UtilityMsg, "In kernel copy not possible (%s), copying "
+                        "through user space.", XrdSysE2T( -rc ) );
+            kernelCopy = false;
+            break;
+          }
+          st = XRootDStatus( stError, errOSError, -rc, XrdSysE2T( -rc ) );
+          return UpdateErrMsg( st, "destination" );
+        }
+
+        //----------------------------------------------------------------------
+        // The source shrank, the size check below reports it
+        //----------------------------------------------------------------------
+        if( rc == 0 ) break;
+
+        processed += rc;
+        if( progress )
+        {
+          progress->JobProgress( pJobId, processed, size );
+          if( progress->ShouldCancel( pJobId ) )
+            return XRootDStatus( stError, errOperationInterrupted, kXR_Cancelled, "The copy-job has been cancelled!" );
+        }
+      }
+      if( kernelCopy )
+        log->Debug( UtilityMsg, "Copied %llu bytes within the kernel.",
+                    (unsigned long long)processed );
+    }
+
+    while( !kernelCopy )
     {
       st = src->GetChunk( chunkInfo );
       if( !st.IsOK() )
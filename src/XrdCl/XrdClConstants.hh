@@ -89,8 +89,17 @@ namespace XrdCl
   const int DefaultIPNoShuffle             = 0;
   const int DefaultWantTlsOnNoPgrw         = 0;
   const int DefaultRetryWrtAtLBLimit       = 3;
+  const int DefaultBufferPoolSize          = 67108864;
+  const int DefaultBufferPoolReport        = 300;
+  const int DefaultVectorReadGap           = 0;
+  const int DefaultVectorReadSplit         = 1024;
+  const int DefaultReadAheadWindow         = 0;
+  const int DefaultReadAheadBlockSize      = 1048576;
+  const int DefaultLocalFileUring          = 1;
+  const int DefaultZipIndexSpacing         = 4;
 
   const char * const DefaultPollerPreference   = "built-in";
+  const char * const DefaultZipIndexDir        = "";
   const char * const DefaultNetworkStack       = "IPAuto";
   const char * const DefaultClientMonitor      = "";
   const char * const DefaultClientMonitorParam = "";
@@ -17,6 +17,7 @@
 //------------------------------------------------------------------------------
 
 #include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClBufferPool.hh"
 #include "XrdCl/XrdClConstants.hh"
 #include "XrdCl/XrdClPostMaster.hh"
 #include "XrdCl/XrdClLog.hh"
@@ -298,9 +299,17 @@ namespace XrdCl
     REGISTER_VAR_INT( varsInt, "TlsNoData",               DefaultTlsNoData               );
     REGISTER_VAR_INT( varsInt, "TlsMetalink",             DefaultTlsMetalink             );
     REGISTER_VAR_INT( varsInt, "ZipMtlnCksum",            DefaultZipMtlnCksum            );
+    REGISTER_VAR_INT( varsInt, "BufferPoolSize",          DefaultBufferPoolSize          );
+    REGISTER_VAR_INT( varsInt, "BufferPoolReport",        DefaultBufferPoolReport        );
     REGISTER_VAR_INT( varsInt, "IPNoShuffle",             DefaultIPNoShuffle             );
     REGISTER_VAR_INT( varsInt, "WantTlsOnNoPgrw",         DefaultWantTlsOnNoPgrw         );
     REGISTER_VAR_INT( varsInt, "RetryWrtAtLBLimit",       DefaultRetryWrtAtLBLimit       );
+    REGISTER_VAR_INT( varsInt, "VectorReadGap",           DefaultVectorReadGap           );
+    REGISTER_VAR_INT( varsInt, "VectorReadSplit",         DefaultVectorReadSplit         );
+    REGISTER_VAR_INT( varsInt, "ReadAheadWindow",         DefaultReadAheadWindow         );
+    REGISTER_VAR_INT( varsInt, "ReadAheadBlockSize",      DefaultReadAheadBlockSize      );
+    REGISTER_VAR_INT( varsInt, "LocalFileUring",          DefaultLocalFileUring          );
+    REGISTER_VAR_INT( varsInt, "ZipIndexSpacing",         DefaultZipIndexSpacing         );
 
     REGISTER_VAR_STR( varsStr, "ClientMonitor",           DefaultClientMonitor           );
     REGISTER_VAR_STR( varsStr, "ClientMonitorParam",      DefaultClientMonitorParam      );
@@ -312,6 +321,7 @@ namespace XrdCl
     REGISTER_VAR_STR( varsStr, "OpenRecovery",            DefaultOpenRecovery            );
     REGISTER_VAR_STR( varsStr, "GlfnRedirector",          DefaultGlfnRedirector          );
     REGISTER_VAR_STR( varsStr, "TlsDbgLvl",               DefaultTlsDbgLvl               );
+    REGISTER_VAR_STR( varsStr, "ZipIndexDir",             DefaultZipIndexDir             );
 
     //--------------------------------------------------------------------------
     // Process the configuration files
@@ -664,6 +674,11 @@ namespace XrdCl
     SetUpLog();
 
     sEnv           = new DefaultEnv();
+
+    int bufferPoolSize = DefaultBufferPoolSize;
+    sEnv->GetInt( "BufferPoolSize", bufferPoolSize );
+    BufferPool::Configure( bufferPoolSize );
+
     sForkHandler   = new ForkHandler();
     sFileTimer     = new FileTimer();
     sPlugInManager = new PlugInManager();
@@ -438,7 +438,10 @@ namespace XrdCl
       //!                  2097136 bytes and the default maximum number
       //!                  of chunks per request is 1024. The server
       //!                  may be queried using FileSystem::Query for the
-      //!                  actual settings.
+      //!                  actual settings. Longer lists are split into
+      //!                  several requests (see XRD_VECTORREADSPLIT) and
+      //!                  chunks closer than XRD_VECTORREADGAP bytes are
+      //!                  read as one.
       //! @param buffer    if zero the buffer pointers in the chunk list
       //!                  will be used, otherwise it needs to point to a
       //!                  buffer big enough to hold the requested data
@@ -461,7 +464,10 @@ namespace XrdCl
       //!                  2097136 bytes and the default maximum number
       //!                  of chunks per request is 1024. The server
       //!                  may be queried using FileSystem::Query for the
-      //!                  actual settings.
+      //!                  actual settings. Longer lists are split into
+      //!                  several requests (see XRD_VECTORREADSPLIT) and
+      //!                  chunks closer than XRD_VECTORREADGAP bytes are
+      //!                  read as one.
       //! @param buffer    if zero the buffer pointers in the chunk list
       //!                  will be used, otherwise it needs to point to a
       //!                  buffer big enough to hold the requested data
@@ -733,6 +739,7 @@ namespace XrdCl
       //! Read-only properties:
       //! DataServer [string] - the data server the file is accessed at
       //! LastURL    [string] - final file URL with all the cgi information
+      //! ReadAheadInFlight [int] - number of prefetch requests in flight
       //------------------------------------------------------------------------
       bool GetProperty( const std::string &name, std::string &value ) const;
 
@@ -37,6 +37,7 @@
 #include "XrdCl/XrdClResponseJob.hh"
 #include "XrdCl/XrdClJobManager.hh"
 #include "XrdCl/XrdClUglyHacks.hh"
+#include "XrdCl/XrdClReadAhead.hh"
 #include "XrdClRedirectorRegistry.hh"
 
 #include "XrdOuc/XrdOucCRC.hh"
@@ -44,6 +45,7 @@
 #include "XrdSys/XrdSysPageSize.hh"
 #include "XrdSys/XrdSysKernelBuffer.hh"
 
+#include <algorithm>
 #include <sstream>
 #include <memory>
 #include <sys/time.h>
@@ -139,12 +141,20 @@ namespace
         char                  *buffer    = reinterpret_cast<char*>( pginf->GetBuffer() );
         size_t                 pgnb      = 0;
 
+        //----------------------------------------------------------------------
+        // Calculate the checksums of all the pages in one go, this allows
+        // several pages to be processed at a time
+        //----------------------------------------------------------------------
+        std::vector<uint32_t> crcvals( ( bytesRead + XrdSys::PageSize - 1 ) /
+                                       XrdSys::PageSize );
+        if( !crcvals.empty() )
+          XrdOucCRC::Calc32C( buffer, bytesRead, crcvals.data() );
+
         while( bytesRead > 0 )
         {
           uint32_t pgsize = XrdSys::PageSize;
           if( pgsize > bytesRead ) pgsize = bytesRead;
-          uint32_t crcval = XrdOucCRC::Calc32C( buffer, pgsize );
-          if( crcval != cksums[pgnb] )
+          if( crcvals[pgnb] != cksums[pgnb] )
           {
             Log *log = DefaultEnv::GetLog();
             log->Info( FileMsg, "[0x%x@%s] Received corrupted page, will retry page #%d.",
@@ -335,20 +345,9 @@ namespace
           size_t nbpages = chunk->length / XrdSys::PageSize;
           if( chunk->length % XrdSys::PageSize )
             ++nbpages;
-          cksums.reserve( nbpages );
-
-          size_t  size = chunk->length;
-          char   *buffer = reinterpret_cast<char*>( chunk->buffer );
-
-          for( size_t pg = 0; pg < nbpages; ++pg )
-          {
-            size_t pgsize = XrdSys::PageSize;
-            if( pgsize > size ) pgsize = size;
-            uint32_t crcval = XrdOucCRC::Calc32C( buffer, pgsize );
-            cksums.push_back( crcval );
-            buffer += pgsize;
-            size   -= pgsize;
-          }
+          cksums.resize( nbpages );
+          if( nbpages )
+            XrdOucCRC::Calc32C( chunk->buffer, chunk->length, cksums.data() );
         }
 
         PageInfo *pages = new PageInfo( chunk->offset, chunk->length,
@@ -592,6 +591,153 @@ namespace
       XrdCl::Buffer buffer;
       XrdCl::ResponseHandler *handler;
   };
+
+  //----------------------------------------------------------------------------
+  // Collects the responses to a vector read that has been coalesced and/or
+  // split into several kXR_readv requests. The data of merged chunks goes to
+  // a scratch buffer and is scattered into the user buffers when the request
+  // carrying it comes back. The user handler is called once all of the
+  // requests have been answered.
+  //----------------------------------------------------------------------------
+  class VectorReadCollector
+  {
+    public:
+
+      //------------------------------------------------------------------------
+      // A chunk as requested from the server
+      //------------------------------------------------------------------------
+      struct Segment
+      {
+        Segment( uint64_t off, uint32_t len, size_t member ) :
+          offset( off ), length( len ), members( 1, member )
+        {
+        }
+
+        uint64_t                offset;
+        uint32_t                length;
+        std::unique_ptr<char[]> scratch; //< only if there is more than one member
+        std::vector<size_t>     members; //< indices into the user chunk list
+      };
+
+      //------------------------------------------------------------------------
+      // Constructor
+      //------------------------------------------------------------------------
+      VectorReadCollector( XrdCl::ResponseHandler  *handler,
+                           XrdCl::ChunkList       &&chunks,
+                           std::vector<Segment>   &&segments,
+                           int                      pending ) :
+        userChunks( std::move( chunks ) ),
+        segments( std::move( segments ) ),
+        userHandler( handler ),
+        hostList( 0 ),
+        pending( pending )
+      {
+      }
+
+      //------------------------------------------------------------------------
+      // Copy the data of the merged segments in [first, last) to the user
+      // buffers, the ranges handled by different requests never overlap
+      //------------------------------------------------------------------------
+      void Scatter( size_t first, size_t last )
+      {
+        for( size_t i = first; i < last; ++i )
+        {
+          Segment &seg = segments[i];
+          if( !seg.scratch ) continue;
+          for( size_t j = 0; j < seg.members.size(); ++j )
+          {
+            XrdCl::ChunkInfo &chunk = userChunks[seg.members[j]];
+            memcpy( chunk.buffer, seg.scratch.get() + ( chunk.offset - seg.offset ),
+                    chunk.length );
+          }
+          seg.scratch.reset();
+        }
+      }
+
+      //------------------------------------------------------------------------
+      // Account for count finished requests, the last one calls the user
+      // handler and deletes the collector
+      //------------------------------------------------------------------------
+      void Done( const XrdCl::XRootDStatus &status, XrdCl::HostList *hosts,
+                 int count = 1 )
+      {
+        {
+          XrdSysMutexHelper scopedLock( mutex );
+          if( result.IsOK() && !status.IsOK() ) result = status;
+          if( !hostList ) std::swap( hostList, hosts );
+          pending -= count;
+          if( pending > 0 )
+          {
+            delete hosts;
+            return;
+          }
+        }
+        delete hosts;
+
+        XrdCl::AnyObject *response = 0;
+        if( result.IsOK() )
+        {
+          XrdCl::VectorReadInfo *info = new XrdCl::VectorReadInfo();
+          uint32_t size = 0;
+          for( size_t i = 0; i < userChunks.size(); ++i )
+            size += userChunks[i].length;
+          info->SetSize( size );
+          info->GetChunks().swap( userChunks );
+          response = new XrdCl::AnyObject();
+          response->Set( info );
+        }
+        userHandler->HandleResponseWithHosts( new XrdCl::XRootDStatus( result ),
+                                              response, hostList );
+        delete this;
+      }
+
+      XrdCl::ChunkList      userChunks;
+      std::vector<Segment>  segments;
+
+    private:
+      XrdCl::ResponseHandler *userHandler;
+      XrdCl::HostList        *hostList;
+      XrdCl::XRootDStatus     result;
+      XrdSysMutex             mutex;
+      int                     pending;
+  };
+
+  //----------------------------------------------------------------------------
+  // Handles the response to one of the requests of a split vector read
+  //----------------------------------------------------------------------------
+  class VectorReadPartHandler : public XrdCl::ResponseHandler
+  {
+    public:
+
+      //------------------------------------------------------------------------
+      // Constructor
+      //------------------------------------------------------------------------
+      VectorReadPartHandler( VectorReadCollector *collector,
+                             size_t first, size_t last ) :
+        collector( collector ), first( first ), last( last )
+      {
+      }
+
+      //------------------------------------------------------------------------
+      // Handle the response
+      //------------------------------------------------------------------------
+      virtual void HandleResponseWithHosts( XrdCl::XRootDStatus *status,
+                                            XrdCl::AnyObject    *response,
+                                            XrdCl::HostList     *hostList )
+      {
+        if( status->IsOK() )
+          collector->Scatter( first, last );
+        delete response;
+        collector->Done( *status, hostList );
+        delete status;
+        delete this;
+      }
+
+    private:
+      VectorReadCollector *collector;
+      size_t               first;
+      size_t               last;
+  };
 }
 
 namespace XrdCl
@@ -713,7 +859,8 @@ namespace XrdCl
     pUseVirtRedirector( true ),
     pIsChannelEncrypted( false ),
     pAllowBundledClose( false ),
-    pReOpenHandler( 0 )
+    pReOpenHandler( 0 ),
+    pReadAhead( 0 )
   {
     pFileHandle = new uint8_t[4];
     ResetMonitoringVars();
@@ -745,7 +892,8 @@ namespace XrdCl
     pFollowRedirects( true ),
     pUseVirtRedirector( useVirtRedirector ),
     pAllowBundledClose( false ),
-    pReOpenHandler( 0 )
+    pReOpenHandler( 0 ),
+    pReadAhead( 0 )
   {
     pFileHandle = new uint8_t[4];
     ResetMonitoringVars();
@@ -789,6 +937,7 @@ namespace XrdCl
     delete pLoadBalancer;
     delete [] pFileHandle;
     delete pLFileHandler;
+    delete pReadAhead;
   }
 
   //----------------------------------------------------------------------------
@@ -938,11 +1087,33 @@ namespace XrdCl
         pFileState == Recovering )
       return XRootDStatus( stError, errInvalidOp );
 
-    if( !pAllowBundledClose && !pInTheFly.empty() )
+    //--------------------------------------------------------------------------
+    // Prefetches do not count as requests in flight, the close is issued once
+    // they are back
+    //--------------------------------------------------------------------------
+    size_t prefetches = ( pReadAhead ? pReadAhead->InFlight() : 0 );
+    if( !pAllowBundledClose && pInTheFly.size() > prefetches )
       return XRootDStatus( stError, errInvalidOp );
 
     pFileState = CloseInProgress;
 
+    if( pReadAhead && pReadAhead->DeferClose( handler, timeout ) )
+    {
+      Log *log = DefaultEnv::GetLog();
+      log->Debug( FileMsg, "[0x%x@%s] Deferring the close until the read-ahead "
+                  "requests are back", this, pFileUrl->GetURL().c_str() );
+      return XRootDStatus();
+    }
+
+    return IssueClose( handler, timeout );
+  }
+
+  //----------------------------------------------------------------------------
+  // Send the close request, the caller holds pMutex
+  //----------------------------------------------------------------------------
+  XRootDStatus FileStateHandler::IssueClose( ResponseHandler *handler,
+                                             uint16_t         timeout )
+  {
     Log *log = DefaultEnv::GetLog();
     log->Debug( FileMsg, "[0x%x@%s] Sending a close command for handle 0x%x to "
                 "%s", this, pFileUrl->GetURL().c_str(),
@@ -1053,6 +1224,30 @@ namespace XrdCl
     if( pFileState != Opened && pFileState != Recovering )
       return XRootDStatus( stError, errInvalidOp );
 
+    if( !pReadAhead )
+      return SendRead( offset, size, buffer, handler, timeout );
+
+    //--------------------------------------------------------------------------
+    // Serve the read from the prefetched data if we can and keep the
+    // read-ahead window full
+    //--------------------------------------------------------------------------
+    XRootDStatus st;
+    if( !pReadAhead->Read( offset, size, buffer, handler, *pDataServer ) )
+      st = SendRead( offset, size, buffer, handler, timeout );
+    if( st.IsOK() )
+      pReadAhead->Refill();
+    return st;
+  }
+
+  //----------------------------------------------------------------------------
+  // Send a read request, the caller holds pMutex
+  //----------------------------------------------------------------------------
+  XRootDStatus FileStateHandler::SendRead( uint64_t         offset,
+                                           uint32_t         size,
+                                           void            *buffer,
+                                           ResponseHandler *handler,
+                                           uint16_t         timeout )
+  {
     Log *log = DefaultEnv::GetLog();
     log->Debug( FileMsg, "[0x%x@%s] Sending a read command for handle 0x%x to "
                 "%s", this, pFileUrl->GetURL().c_str(),
@@ -1400,34 +1595,17 @@ namespace XrdCl
     if( pFileState != Opened && pFileState != Recovering )
       return XRootDStatus( stError, errInvalidOp );
 
-    Log *log = DefaultEnv::GetLog();
-    log->Debug( FileMsg, "[0x%x@%s] Sending a vector read command for handle "
-                "0x%x to %s", this, pFileUrl->GetURL().c_str(),
-                *((uint32_t*)pFileHandle), pDataServer->GetHostId().c_str() );
-
     //--------------------------------------------------------------------------
-    // Build the message
+    // Resolve the buffer of every chunk
     //--------------------------------------------------------------------------
-    Message            *msg;
-    ClientReadVRequest *req;
-    MessageUtils::CreateRequest( msg, req, sizeof(readahead_list)*chunks.size() );
-
-    req->requestid = kXR_readv;
-    req->dlen      = sizeof(readahead_list)*chunks.size();
+    ChunkList list;
+    char     *cursor   = (char*)buffer;
+    bool      canMerge = true;
+    uint64_t  totSize  = 0;
 
-    ChunkList *list   = new ChunkList();
-    char      *cursor = (char*)buffer;
-
-    //--------------------------------------------------------------------------
-    // Copy the chunk info
-    //--------------------------------------------------------------------------
-    readahead_list *dataChunk = (readahead_list*)msg->GetBuffer( 24 );
+    list.reserve( chunks.size() );
     for( size_t i = 0; i < chunks.size(); ++i )
     {
-      dataChunk[i].rlen   = chunks[i].length;
-      dataChunk[i].offset = chunks[i].offset;
-      memcpy( dataChunk[i].fhandle, pFileHandle, 4 );
-
       void *chunkBuffer;
       if( cursor )
       {
@@ -1437,25 +1615,133 @@ namespace XrdCl
       else
         chunkBuffer = chunks[i].buffer;
 
-      list->push_back( ChunkInfo( chunks[i].offset,
-                                  chunks[i].length,
-                                  chunkBuffer ) );
+      if( !chunkBuffer ) canMerge = false;
+      totSize += chunks[i].length + sizeof(readahead_list);
+      list.push_back( ChunkInfo( chunks[i].offset,
+                                 chunks[i].length,
+                                 chunkBuffer ) );
     }
 
     //--------------------------------------------------------------------------
-    // Send the message
+    // Chunks that are less than VectorReadGap bytes apart are read as one, and
+    // no request carries more than VectorReadSplit chunks or more data than
+    // the server accepts in a single readv
     //--------------------------------------------------------------------------
-    MessageSendParams params;
-    params.timeout         = timeout;
-    params.followRedirects = false;
-    params.stateful        = true;
-    params.chunkList       = list;
-    MessageUtils::ProcessSendParams( params );
+    static const uint64_t maxMergedSize = 2097136;
+    static const uint64_t maxReqSize    = 0x7fffffff;
 
-    XRootDTransport::SetDescription( msg );
-    StatefulHandler *stHandler = new StatefulHandler( this, handler, msg, params );
+    Env *env   = DefaultEnv::GetEnv();
+    int  gap   = DefaultVectorReadGap;
+    int  split = DefaultVectorReadSplit;
+    env->GetInt( "VectorReadGap",   gap   );
+    env->GetInt( "VectorReadSplit", split );
+    if( split <= 0 || split > XrdProto::maxRvecsz )
+      split = XrdProto::maxRvecsz;
+    if( gap <= 0 ) canMerge = false;
 
-    return SendOrQueue( *pDataServer, msg, stHandler, params );
+    if( !canMerge && list.size() <= (size_t)split && totSize <= maxReqSize )
+      return SendVectorRead( list, handler, timeout );
+
+    //--------------------------------------------------------------------------
+    // Merge the chunks in offset order
+    //--------------------------------------------------------------------------
+    typedef VectorReadCollector::Segment Segment;
+    std::vector<size_t>  order( list.size() );
+    std::vector<Segment> segments;
+    bool merged = false;
+
+    for( size_t i = 0; i < order.size(); ++i ) order[i] = i;
+    if( canMerge )
+      std::stable_sort( order.begin(), order.end(),
+                        [&list]( size_t a, size_t b )
+                        { return list[a].offset < list[b].offset; } );
+
+    for( size_t i = 0; i < order.size(); ++i )
+    {
+      const ChunkInfo &chunk = list[order[i]];
+      if( canMerge && !segments.empty() )
+      {
+        Segment &seg = segments.back();
+        uint64_t end = std::max( seg.offset + seg.length,
+                                 chunk.offset + chunk.length );
+        if( chunk.offset < seg.offset + seg.length + gap &&
+            end - seg.offset <= maxMergedSize )
+        {
+          seg.length = end - seg.offset;
+          seg.members.push_back( order[i] );
+          merged = true;
+          continue;
+        }
+      }
+      segments.push_back( Segment( chunk.offset, chunk.length, order[i] ) );
+    }
+
+    //--------------------------------------------------------------------------
+    // Group the segments into requests, parts holds the first segment of each
+    // request followed by the end of the list
+    //--------------------------------------------------------------------------
+    std::vector<size_t> parts( 1, 0 );
+    uint64_t reqSize = 0;
+    for( size_t i = 0; i < segments.size(); ++i )
+    {
+      uint64_t segSize = segments[i].length + sizeof(readahead_list);
+      if( i > parts.back() &&
+          ( i - parts.back() >= (size_t)split || reqSize + segSize > maxReqSize ) )
+      {
+        parts.push_back( i );
+        reqSize = 0;
+      }
+      reqSize += segSize;
+    }
+    parts.push_back( segments.size() );
+
+    if( !merged && parts.size() <= 2 )
+      return SendVectorRead( list, handler, timeout );
+
+    Log *log = DefaultEnv::GetLog();
+    log->Debug( FileMsg, "[0x%x@%s] Vector read of %d chunks coalesced into %d "
+                "chunks sent in %d requests", this, pFileUrl->GetURL().c_str(),
+                (int)list.size(), (int)segments.size(), (int)parts.size() - 1 );
+
+    for( size_t i = 0; i < segments.size(); ++i )
+      if( segments[i].members.size() > 1 )
+        segments[i].scratch.reset( new char[segments[i].length] );
+
+    //--------------------------------------------------------------------------
+    // Send all of the requests right away so that they proceed in parallel
+    //--------------------------------------------------------------------------
+    int nparts = parts.size() - 1;
+    VectorReadCollector *collector = new VectorReadCollector( handler,
+                                           std::move( list ),
+                                           std::move( segments ), nparts );
+    for( int p = 0; p < nparts; ++p )
+    {
+      ChunkList subList;
+      subList.reserve( parts[p+1] - parts[p] );
+      for( size_t i = parts[p]; i < parts[p+1]; ++i )
+      {
+        Segment &seg = collector->segments[i];
+        void *segBuffer = ( seg.scratch ? seg.scratch.get() :
+                            collector->userChunks[seg.members[0]].buffer );
+        subList.push_back( ChunkInfo( seg.offset, seg.length, segBuffer ) );
+      }
+
+      VectorReadPartHandler *partHandler =
+        new VectorReadPartHandler( collector, parts[p], parts[p+1] );
+      XRootDStatus st = SendVectorRead( subList, partHandler, timeout );
+      if( !st.IsOK() )
+      {
+        delete partHandler;
+        if( p == 0 )
+        {
+          delete collector;
+          return st;
+        }
+        collector->Done( st, 0, nparts - p );
+        break;
+      }
+    }
+    return XRootDStatus();
   }
 
   //------------------------------------------------------------------------
@@ -1833,6 +2119,11 @@ namespace XrdCl
       { value =  pDataServer->GetURL(); return true; }
     else if( name == "WrtRecoveryRedir" && pWrtRecoveryRedir )
       { value = pWrtRecoveryRedir->GetHostId(); return true; }
+    else if( name == "ReadAheadInFlight" )
+    {
+      value = std::to_string( pReadAhead ? pReadAhead->InFlight() : 0 );
+      return true;
+    }
     value = "";
     return false;
   }
@@ -1970,6 +2261,17 @@ namespace XrdCl
         mon->Event( Monitor::EvOpen, &i );
       }
 
+      //------------------------------------------------------------------------
+      // Files opened for reading may prefetch data
+      //------------------------------------------------------------------------
+      if( !pReadAhead && IsReadOnly() )
+      {
+        pReadAhead = ReadAhead::Create( this, pStatInfo ? pStatInfo->GetSize() : 0 );
+        if( pReadAhead )
+          log->Debug( FileMsg, "[0x%x@%s] Read-ahead enabled", this,
+                      pFileUrl->GetURL().c_str() );
+      }
+
       //------------------------------------------------------------------------
       // Resend the queued messages if any
       //------------------------------------------------------------------------
@@ -1997,6 +2299,13 @@ namespace XrdCl
     MonitorClose( status );
     ResetMonitoringVars();
 
+    //--------------------------------------------------------------------------
+    // The close is issued once the last prefetch is back, the read-ahead has
+    // been stopped for good and a reopen needs a new one
+    //--------------------------------------------------------------------------
+    delete pReadAhead;
+    pReadAhead = 0;
+
     pStatus    = *status;
     pFileState = Closed;
   }
@@ -2716,6 +3025,57 @@ namespace XrdCl
                                       sendParams, pLFileHandler );
   }
 
+  //----------------------------------------------------------------------------
+  // Send a single kXR_readv request, the caller holds pMutex
+  //----------------------------------------------------------------------------
+  XRootDStatus FileStateHandler::SendVectorRead( const ChunkList &chunks,
+                                                 ResponseHandler *handler,
+                                                 uint16_t         timeout )
+  {
+    Log *log = DefaultEnv::GetLog();
+    log->Debug( FileMsg, "[0x%x@%s] Sending a vector read command for handle "
+                "0x%x to %s", this, pFileUrl->GetURL().c_str(),
+                *((uint32_t*)pFileHandle), pDataServer->GetHostId().c_str() );
+
+    //--------------------------------------------------------------------------
+    // Build the message
+    //--------------------------------------------------------------------------
+    Message            *msg;
+    ClientReadVRequest *req;
+    MessageUtils::CreateRequest( msg, req, sizeof(readahead_list)*chunks.size() );
+
+    req->requestid = kXR_readv;
+    req->dlen      = sizeof(readahead_list)*chunks.size();
+
+    ChunkList *list = new ChunkList( chunks );
+
+    //--------------------------------------------------------------------------
+    // Copy the chunk info
+    //--------------------------------------------------------------------------
+    readahead_list *dataChunk = (readahead_list*)msg->GetBuffer( 24 );
+    for( size_t i = 0; i < chunks.size(); ++i )
+    {
+      dataChunk[i].rlen   = chunks[i].length;
+      dataChunk[i].offset = chunks[i].offset;
+      memcpy( dataChunk[i].fhandle, pFileHandle, 4 );
+    }
+
+    //--------------------------------------------------------------------------
+    // Send the message
+    //--------------------------------------------------------------------------
+    MessageSendParams params;
+    params.timeout         = timeout;
+    params.followRedirects = false;
+    params.stateful        = true;
+    params.chunkList       = list;
+    MessageUtils::ProcessSendParams( params );
+
+    XRootDTransport::SetDescription( msg );
+    StatefulHandler *stHandler = new StatefulHandler( this, handler, msg, params );
+
+    return SendOrQueue( *pDataServer, msg, stHandler, params );
+  }
+
   //------------------------------------------------------------------------
   // Send a write request with payload being stored in a kernel buffer
   //------------------------------------------------------------------------
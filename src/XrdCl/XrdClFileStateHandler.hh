@@ -52,6 +52,7 @@ namespace XrdCl
 {
   class ResponseHandlerHolder;
   class Message;
+  class ReadAhead;
 
   //----------------------------------------------------------------------------
   //! PgRead flags
@@ -78,6 +79,7 @@ namespace XrdCl
       friend class ::PgReadHandler;
       friend class ::PgReadRetryHandler;
       friend class ::PgReadSubstitutionHandler;
+      friend class ReadAhead;
 
     public:
       //------------------------------------------------------------------------
@@ -665,6 +667,29 @@ namespace XrdCl
                                  ResponseHandler   *handler,
                                  MessageSendParams &sendParams );
 
+      //------------------------------------------------------------------------
+      //! Send a kXR_read request, the caller holds pMutex
+      //------------------------------------------------------------------------
+      XRootDStatus SendRead( uint64_t         offset,
+                             uint32_t         size,
+                             void            *buffer,
+                             ResponseHandler *handler,
+                             uint16_t         timeout );
+
+      //------------------------------------------------------------------------
+      //! Send a kXR_close request, the caller holds pMutex and has already
+      //! moved the file to CloseInProgress
+      //------------------------------------------------------------------------
+      XRootDStatus IssueClose( ResponseHandler *handler, uint16_t timeout );
+
+      //------------------------------------------------------------------------
+      //! Send a single kXR_readv request for the given chunks, the buffer
+      //! pointers in the chunk list must already be resolved
+      //------------------------------------------------------------------------
+      XRootDStatus SendVectorRead( const ChunkList &chunks,
+                                   ResponseHandler *handler,
+                                   uint16_t         timeout );
+
       //------------------------------------------------------------------------
       //! Send a write request with payload being stored in a kernel buffer
       //------------------------------------------------------------------------
@@ -721,6 +746,11 @@ namespace XrdCl
       // Responsible for file:// operations on the local filesystem
       //------------------------------------------------------------------------
       LocalFileHandler      *pLFileHandler;
+
+      //------------------------------------------------------------------------
+      // Prefetches data for sequential and strided reads, if enabled
+      //------------------------------------------------------------------------
+      ReadAhead             *pReadAhead;
   };
 }
 
@@ -17,6 +17,7 @@
 //------------------------------------------------------------------------------
 
 #include "XrdCl/XrdClFileTimer.hh"
+#include "XrdCl/XrdClBufferPool.hh"
 #include "XrdCl/XrdClDefaultEnv.hh"
 #include "XrdCl/XrdClConstants.hh"
 #include "XrdCl/XrdClFileStateHandler.hh"
@@ -33,6 +34,7 @@ namespace XrdCl
     for( it = pFileObjects.begin(); it != pFileObjects.end(); ++it )
       (*it)->Tick(now);
     pMutex.UnLock();
+    BufferPool::Report( now );
     Env *env = DefaultEnv::GetEnv();
     int timeoutResolution = DefaultTimeoutResolution;
     env->GetInt( "TimeoutResolution", timeoutResolution );
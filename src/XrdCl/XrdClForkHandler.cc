@@ -22,6 +22,7 @@
 #include "XrdCl/XrdClDefaultEnv.hh"
 #include "XrdCl/XrdClPostMaster.hh"
 #include "XrdCl/XrdClFileTimer.hh"
+#include "XrdCl/XrdClBufferPool.hh"
 #include "XrdCl/XrdClFileStateHandler.hh"
 
 namespace XrdCl
@@ -48,6 +49,7 @@ namespace XrdCl
     if( pPostMaster )
       pPostMaster->Stop();
     pFileTimer->Lock();
+    BufferPool::Lock();
 
     //--------------------------------------------------------------------------
     // Lock the user-level objects
@@ -89,6 +91,7 @@ namespace XrdCl
          ++itFs )
       (*itFs)->UnLock();
 
+    BufferPool::UnLock();
     pFileTimer->UnLock();
     if( pPostMaster )
       pPostMaster->Start();
@@ -122,6 +125,7 @@ namespace XrdCl
          ++itFs )
       (*itFs)->UnLock();
 
+    BufferPool::UnLock();
     pFileTimer->UnLock();
     if( pPostMaster )
     {
@@ -25,6 +25,86 @@
 
 namespace XrdCl
 {
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  InQueue::InQueue()
+  {
+    for( uint32_t i = 0; i < NumPages; ++i )
+      pPages[i].store( 0, std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  InQueue::~InQueue()
+  {
+    for( uint32_t i = 0; i < NumPages; ++i )
+      delete pPages[i].load( std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Page constructor, tie the slots to their occupancy bits
+  //----------------------------------------------------------------------------
+  InQueue::Page::Page()
+  {
+    for( uint32_t i = 0; i < PageSize / 64; ++i )
+      used[i].store( 0, std::memory_order_relaxed );
+    for( uint32_t i = 0; i < PageSize; ++i )
+    {
+      slots[i].used = &used[i / 64];
+      slots[i].mask = uint64_t( 1 ) << ( i % 64 );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Set the handler of a locked slot
+  //----------------------------------------------------------------------------
+  void InQueue::Slot::SetHandler( IncomingMsgHandler *h, time_t exp )
+  {
+    handler = h;
+    expires = exp;
+    used->fetch_or( mask, std::memory_order_release );
+  }
+
+  //----------------------------------------------------------------------------
+  // Clear the handler of a locked slot
+  //----------------------------------------------------------------------------
+  void InQueue::Slot::ClearHandler()
+  {
+    handler = 0;
+    used->fetch_and( ~mask, std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the slot of a SID, allocate the page if needed
+  //----------------------------------------------------------------------------
+  InQueue::Slot &InQueue::GetSlot( uint16_t sid )
+  {
+    std::atomic<Page*> &pp = pPages[sid / PageSize];
+    Page *page = pp.load( std::memory_order_acquire );
+    if( !page )
+    {
+      Page *newPage = new Page();
+      if( pp.compare_exchange_strong( page, newPage, std::memory_order_acq_rel,
+                                      std::memory_order_acquire ) )
+        page = newPage;
+      else
+        delete newPage;
+    }
+    return page->slots[sid % PageSize];
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the slot of a SID if its page exists
+  //----------------------------------------------------------------------------
+  InQueue::Slot *InQueue::FindSlot( uint16_t sid ) const
+  {
+    Page *page = pPages[sid / PageSize].load( std::memory_order_acquire );
+    if( !page ) return 0;
+    return &page->slots[sid % PageSize];
+  }
+
   //----------------------------------------------------------------------------
   // Filter messages
   //----------------------------------------------------------------------------
@@ -73,23 +153,23 @@ namespace XrdCl
       return true;
     }
 
-    // Lookup the sid in the map of handlers
-    pMutex.Lock();
-    HandlerMap::iterator it = pHandlers.find(msgSid);
+    // Lookup the sid in the table of handlers
+    Slot &slot = GetSlot( msgSid );
+    slot.mutex.Lock();
 
-    if (it != pHandlers.end())
+    if( slot.handler )
     {
-      handler = it->second.first;
+      handler = slot.handler;
       action  = handler->Examine( msg );
 
       if( action & IncomingMsgHandler::RemoveHandler )
-        pHandlers.erase( it );
+        slot.ClearHandler();
     }
 
     if( !(action & IncomingMsgHandler::Take) )
-      pMessages[msgSid] = msg;
+      slot.message = msg;
 
-    pMutex.UnLock();
+    slot.mutex.UnLock();
 
     if( handler && !(action & IncomingMsgHandler::NoProcess) )
       handler->Process( msg );
@@ -98,30 +178,48 @@ namespace XrdCl
   }
 
   //----------------------------------------------------------------------------
-  // Add a listener that should be notified about incoming messages
+  // Install a handler in a locked slot
   //----------------------------------------------------------------------------
-  void InQueue::AddMessageHandler( IncomingMsgHandler *handler, time_t expires )
+  Message *InQueue::Install( Slot               &slot,
+                             IncomingMsgHandler *handler,
+                             time_t              expires )
   {
-    uint16_t action = 0;
-    uint16_t handlerSid = handler->GetSid();
-    XrdSysMutexHelper scopedLock( pMutex );
-    MessageMap::iterator it = pMessages.find(handlerSid);
+    uint16_t  action = 0;
+    Message  *msg    = 0;
 
-    if (it != pMessages.end())
+    if( slot.message )
     {
-      action = handler->Examine( it->second );
+      action = handler->Examine( slot.message );
 
       if( action & IncomingMsgHandler::Take )
       {
         if( !(action & IncomingMsgHandler::NoProcess ) )
-          handler->Process( it->second );
+          msg = slot.message;
 
-        pMessages.erase( it );
+        slot.message = 0;
       }
     }
 
     if( !(action & IncomingMsgHandler::RemoveHandler) )
-      pHandlers[handlerSid] = HandlerAndExpire( handler, expires );
+      slot.SetHandler( handler, expires );
+
+    return msg;
+  }
+
+  //----------------------------------------------------------------------------
+  // Add a listener that should be notified about incoming messages
+  //----------------------------------------------------------------------------
+  void InQueue::AddMessageHandler( IncomingMsgHandler *handler, time_t expires )
+  {
+    uint16_t handlerSid = handler->GetSid();
+    Slot &slot = GetSlot( handlerSid );
+
+    slot.mutex.Lock();
+    Message *msg = Install( slot, handler, expires );
+    slot.mutex.UnLock();
+
+    if( msg )
+      handler->Process( msg );
   }
 
   //----------------------------------------------------------------------------
@@ -142,17 +240,20 @@ namespace XrdCl
       return handler;
     }
 
-    XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.find(msgSid);
+    Slot *slot = FindSlot( msgSid );
+    if( !slot )
+      return handler;
+
+    XrdSysMutexHelper scopedLock( slot->mutex );
 
-    if (it != pHandlers.end())
+    if( slot->handler )
     {
-      handler = it->second.first;
+      handler = slot->handler;
       act     = handler->Examine( msg );
-      exp     = it->second.second;
+      exp     = slot->expires;
 
       if( act & IncomingMsgHandler::RemoveHandler )
-        pHandlers.erase( it );
+        slot->ClearHandler();
     }
 
     if( handler )
@@ -171,8 +272,9 @@ namespace XrdCl
 				     time_t              expires )
   {
     uint16_t handlerSid = handler->GetSid();
-    XrdSysMutexHelper scopedLock( pMutex );
-    pHandlers[handlerSid] = HandlerAndExpire( handler, expires );
+    Slot &slot = GetSlot( handlerSid );
+    XrdSysMutexHelper scopedLock( slot.mutex );
+    slot.SetHandler( handler, expires );
   }
 
   //----------------------------------------------------------------------------
@@ -181,33 +283,85 @@ namespace XrdCl
   void InQueue::RemoveMessageHandler( IncomingMsgHandler *handler )
   {
     uint16_t handlerSid = handler->GetSid();
-    XrdSysMutexHelper scopedLock( pMutex );
-    pHandlers.erase(handlerSid);
+    Slot *slot = FindSlot( handlerSid );
+    if( !slot )
+      return;
+    XrdSysMutexHelper scopedLock( slot->mutex );
+    slot->ClearHandler();
+    if( slot->busy == handler )
+      slot->busy = 0;
   }
 
   //----------------------------------------------------------------------------
-  // Report an event to the handlers
+  // Notify the handlers of an event
   //----------------------------------------------------------------------------
-  void InQueue::ReportStreamEvent( IncomingMsgHandler::StreamEvent event,
-				   XRootDStatus                    status )
+  void InQueue::Notify( IncomingMsgHandler::StreamEvent  event,
+                        const XRootDStatus              &status,
+                        time_t                           now )
   {
-    uint8_t action = 0;
-    XrdSysMutexHelper scopedLock( pMutex );
-    for( HandlerMap::iterator it = pHandlers.begin(); it != pHandlers.end(); )
+    for( uint32_t p = 0; p < NumPages; ++p )
     {
-      action = it->second.first->OnStreamEvent( event, status );
-
-      if( action & IncomingMsgHandler::RemoveHandler )
+      Page *page = pPages[p].load( std::memory_order_acquire );
+      if( !page ) continue;
+      for( uint32_t w = 0; w < PageSize / 64; ++w )
       {
-        auto next = it; ++next;
-        pHandlers.erase( it );
-        it = next;
+        uint64_t bits = page->used[w].load( std::memory_order_acquire );
+        while( bits )
+        {
+          Slot &slot = page->slots[w * 64 + __builtin_ctzll( bits )];
+          bits &= bits - 1;
+
+          //--------------------------------------------------------------------
+          // Detach the handler so that nobody else can get to it while it
+          // is being notified
+          //--------------------------------------------------------------------
+          IncomingMsgHandler *handler;
+          time_t              expires;
+
+          slot.mutex.Lock();
+          handler = slot.handler;
+          expires = slot.expires;
+          if( !handler || ( now && expires > now ) )
+          {
+            slot.mutex.UnLock();
+            continue;
+          }
+          slot.ClearHandler();
+          slot.busy = handler;
+          slot.mutex.UnLock();
+
+          uint8_t action = handler->OnStreamEvent( event, status );
+
+          //--------------------------------------------------------------------
+          // Put back the handler if it wants to stay, unless it has been
+          // removed or replaced in the meantime
+          //--------------------------------------------------------------------
+          Message *msg = 0;
+          slot.mutex.Lock();
+          if( slot.busy == handler )
+          {
+            slot.busy = 0;
+            if( !(action & IncomingMsgHandler::RemoveHandler) && !slot.handler )
+              msg = Install( slot, handler, expires );
+          }
+          slot.mutex.UnLock();
+
+          if( msg )
+            handler->Process( msg );
+        }
       }
-      else
-        ++it;
     }
   }
 
+  //----------------------------------------------------------------------------
+  // Report an event to the handlers
+  //----------------------------------------------------------------------------
+  void InQueue::ReportStreamEvent( IncomingMsgHandler::StreamEvent event,
+				   XRootDStatus                    status )
+  {
+    Notify( event, status, 0 );
+  }
+
   //----------------------------------------------------------------------------
   // Timeout handlers
   //----------------------------------------------------------------------------
@@ -216,21 +370,7 @@ namespace XrdCl
     if( !now )
       now = ::time(0);
 
-    XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.begin();
-    while( it != pHandlers.end() )
-    {
-      if( it->second.second <= now )
-      {
-        uint8_t act = it->second.first->OnStreamEvent( IncomingMsgHandler::Timeout,
-                                         Status( stError, errOperationExpired ) );
-        auto next = it; ++next;
-        if( act & IncomingMsgHandler::RemoveHandler )
-          pHandlers.erase( it );
-        it = next;
-      }
-      else
-        ++it;
-    }
+    Notify( IncomingMsgHandler::Timeout,
+            XRootDStatus( stError, errOperationExpired ), now );
   }
 }
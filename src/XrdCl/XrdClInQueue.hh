@@ -19,11 +19,12 @@
 #ifndef __XRD_CL_IN_QUEUE_HH__
 #define __XRD_CL_IN_QUEUE_HH__
 
-#include <XrdSys/XrdSysPthread.hh>
-#include <map>
-#include <utility>
+#include <atomic>
+#include <stdint.h>
+#include <time.h>
 #include "XrdCl/XrdClXRootDResponses.hh"
 #include "XrdCl/XrdClPostMasterInterfaces.hh"
+#include "XrdSys/XrdSysPthread.hh"
 
 namespace XrdCl
 {
@@ -31,10 +32,25 @@ namespace XrdCl
 
   //----------------------------------------------------------------------------
   //! A synchronize queue for incoming data
+  //!
+  //! Handlers and cached messages are kept in a table indexed by the SID, each
+  //! entry guarded by its own lock, so that messages for different requests
+  //! are dispatched without contention. The table is split in pages that are
+  //! allocated when first used.
   //----------------------------------------------------------------------------
   class InQueue
   {
     public:
+      //------------------------------------------------------------------------
+      //! Constructor
+      //------------------------------------------------------------------------
+      InQueue();
+
+      //------------------------------------------------------------------------
+      //! Destructor
+      //------------------------------------------------------------------------
+      ~InQueue();
+
       //------------------------------------------------------------------------
       //! Add a fully reconstructed message to the queue
       //------------------------------------------------------------------------
@@ -97,12 +113,77 @@ namespace XrdCl
       //------------------------------------------------------------------------
       bool DiscardMessage(Message* msg, uint16_t& sid) const;
 
-      typedef std::pair<IncomingMsgHandler *, time_t> HandlerAndExpire;
-      typedef std::map<uint16_t, HandlerAndExpire> HandlerMap;
-      typedef std::map<uint16_t, Message*> MessageMap;
-      MessageMap pMessages;
-      HandlerMap pHandlers;
-      XrdSysRecMutex pMutex;
+      //------------------------------------------------------------------------
+      //! Handler and cached message of a SID. The lock is recursive as the
+      //! handler callbacks may call back into the queue. A handler that is
+      //! being notified outside of the lock is remembered as busy so that it
+      //! is not put back if it gets removed in the meantime.
+      //------------------------------------------------------------------------
+      struct Slot
+      {
+        Slot(): handler( 0 ), expires( 0 ), message( 0 ), busy( 0 ),
+                used( 0 ), mask( 0 ) {}
+
+        void SetHandler( IncomingMsgHandler *h, time_t exp );
+        void ClearHandler();
+
+        XrdSysRecMutex          mutex;
+        IncomingMsgHandler     *handler;
+        time_t                  expires;
+        Message                *message;
+        IncomingMsgHandler     *busy;     //!< handler detached for a callback
+        std::atomic<uint64_t>  *used;     //!< occupancy word of the page
+        uint64_t                mask;     //!< our bit in the occupancy word
+      };
+
+      static const uint32_t PageSize = 256;
+      static const uint32_t NumPages = 65536 / PageSize;
+
+      //------------------------------------------------------------------------
+      //! A page of slots with a bitmap of the slots that have a handler, so
+      //! that the timeout and event scans only lock slots that are in use
+      //------------------------------------------------------------------------
+      struct Page
+      {
+        Page();
+
+        Slot                  slots[PageSize];
+        std::atomic<uint64_t> used[PageSize / 64];
+      };
+
+      //------------------------------------------------------------------------
+      //! Get the slot of a SID, allocate the page if needed
+      //------------------------------------------------------------------------
+      Slot &GetSlot( uint16_t sid );
+
+      //------------------------------------------------------------------------
+      //! Get the slot of a SID if its page exists
+      //------------------------------------------------------------------------
+      Slot *FindSlot( uint16_t sid ) const;
+
+      //------------------------------------------------------------------------
+      //! Install a handler in a locked slot, letting it examine the cached
+      //! message first
+      //!
+      //! @return the message the handler wants to process, if any, to be
+      //!         passed to it once the slot is unlocked
+      //------------------------------------------------------------------------
+      Message *Install( Slot &slot, IncomingMsgHandler *handler,
+                        time_t expires );
+
+      //------------------------------------------------------------------------
+      //! Notify the handlers of an event, only the expired ones if now is
+      //! not zero. The handlers are detached from their slots and called
+      //! without holding any lock.
+      //------------------------------------------------------------------------
+      void Notify( IncomingMsgHandler::StreamEvent  event,
+                   const XRootDStatus              &status,
+                   time_t                           now );
+
+      InQueue( const InQueue& ) = delete;
+      InQueue& operator=( const InQueue& ) = delete;
+
+      std::atomic<Page*> pPages[NumPages];
   };
 }
 
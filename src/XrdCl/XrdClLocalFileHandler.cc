@@ -17,6 +17,7 @@
 // along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------------
 #include "XrdCl/XrdClLocalFileHandler.hh"
+#include "XrdCl/XrdClLocalFileUring.hh"
 #include "XrdCl/XrdClConstants.hh"
 #include "XrdCl/XrdClPostMaster.hh"
 #include "XrdCl/XrdClURL.hh"
@@ -343,6 +344,10 @@ namespace XrdCl
     resp->Set( chunk );
     return QueueTask( new XRootDStatus(), resp, handler );
 #else
+    LocalFileUring *uring = LocalFileUring::Instance();
+    if( uring && uring->Read( fd, offset, size, buffer, pHostList, handler ) )
+      return XRootDStatus();
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
     ctx->SetRead( fd, offset, size, buffer );
 
@@ -387,6 +392,10 @@ namespace XrdCl
     }
     return QueueTask( new XRootDStatus(), 0, handler );
 #else
+    LocalFileUring *uring = LocalFileUring::Instance();
+    if( uring && uring->Write( fd, offset, size, buffer, pHostList, handler ) )
+      return XRootDStatus();
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
     ctx->SetWrite( fd, offset, size, buffer );
 
@@ -422,6 +431,10 @@ namespace XrdCl
     }
     return QueueTask( new XRootDStatus(), 0, handler );
 #else
+    LocalFileUring *uring = LocalFileUring::Instance();
+    if( uring && uring->Sync( fd, pHostList, handler ) )
+      return XRootDStatus();
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
     ctx->SetFsync( fd );
     int rc = aio_fsync( O_SYNC, *ctx );
@@ -462,6 +475,13 @@ namespace XrdCl
   XRootDStatus LocalFileHandler::VectorRead( const ChunkList& chunks,
       void* buffer, ResponseHandler* handler, uint16_t timeout )
   {
+    //--------------------------------------------------------------------------
+    // Read all the chunks in parallel if we have a ring
+    //--------------------------------------------------------------------------
+    LocalFileUring *uring = LocalFileUring::Instance();
+    if( uring && uring->VectorRead( fd, chunks, buffer, pHostList, handler ) )
+      return XRootDStatus();
+
     std::unique_ptr<VectorReadInfo> info( new VectorReadInfo() );
     size_t totalSize = 0;
     bool useBuffer( buffer );
@@ -0,0 +1,483 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// This file is part of the XRootD software suite.
+//
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//
+// In applying this licence, CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClLocalFileUring.hh"
+#include "XrdCl/XrdClLocalFileTask.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClJobManager.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
+#include "XProtocol/XProtocol.hh"
+#include "XrdSys/XrdSysE2T.hh"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Submission queue depth, large enough to take a full size vector read
+  // (1024 chunks) in one go
+  //----------------------------------------------------------------------------
+  const unsigned int RingDepth = 1024;
+
+  //----------------------------------------------------------------------------
+  // Run the completion loop
+  //----------------------------------------------------------------------------
+  void *RunReaper( void *arg )
+  {
+    reinterpret_cast<XrdCl::LocalFileUring*>( arg )->Reap();
+    return 0;
+  }
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Get the engine, the ring is created at first use. It is never destroyed
+  // as the reaper may be blocked on it when the process exits. A forked
+  // child shares the parent's ring but not its reaper, so it falls back to
+  // the POSIX path.
+  //----------------------------------------------------------------------------
+  LocalFileUring *LocalFileUring::Instance()
+  {
+#ifdef HAVE_IO_URING
+    static LocalFileUring *engine = []() -> LocalFileUring*
+    {
+      Log *log = DefaultEnv::GetLog();
+      int  useUring = DefaultLocalFileUring;
+      DefaultEnv::GetEnv()->GetInt( "LocalFileUring", useUring );
+      if( !useUring )
+        return 0;
+
+      static const int ops[] = { IORING_OP_READ, IORING_OP_WRITE,
+                                 IORING_OP_FSYNC };
+      LocalFileUring *uring = new LocalFileUring();
+      int rc = uring->pRing.Setup( RingDepth, ops, sizeof( ops ) / sizeof( int ) );
+      if( rc )
+      {
+        log->Debug( FileMsg, "Unable to set up io_uring for local files, "
+                    "using POSIX AIO: %s", XrdSysE2T( rc ) );
+        delete uring;
+        return 0;
+      }
+
+      pthread_t      tid;
+      pthread_attr_t attr;
+      pthread_attr_init( &attr );
+      pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+      rc = ::pthread_create( &tid, &attr, ::RunReaper, uring );
+      pthread_attr_destroy( &attr );
+      if( rc )
+      {
+        log->Error( FileMsg, "Unable to start the io_uring completion thread, "
+                    "using POSIX AIO: %s", XrdSysE2T( rc ) );
+        delete uring;
+        return 0;
+      }
+
+      log->Debug( FileMsg, "Using io_uring for local files, queue depth %u",
+                  uring->pRing.sqSize() );
+      return uring;
+    }();
+
+    if( engine && engine->pPid != getpid() )
+      return 0;
+    return engine;
+#else
+    return 0;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Read
+  //----------------------------------------------------------------------------
+  bool LocalFileUring::Read( int fd, uint64_t offset, uint32_t size,
+                             void *buffer, const HostList &hosts,
+                             ResponseHandler *handler )
+  {
+#ifdef HAVE_IO_URING
+    Request *req = new Request{ IORING_OP_READ, fd, offset, size, 0,
+                                reinterpret_cast<char*>( buffer ),
+                                new HostList( hosts ), handler, 0, 0 };
+    int error = 0;
+    if( !Submit( &req, 1, error ) )
+    {
+      delete req->hosts;
+      delete req;
+      return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Write
+  //----------------------------------------------------------------------------
+  bool LocalFileUring::Write( int fd, uint64_t offset, uint32_t size,
+                              const void *buffer, const HostList &hosts,
+                              ResponseHandler *handler )
+  {
+#ifdef HAVE_IO_URING
+    Request *req = new Request{ IORING_OP_WRITE, fd, offset, size, 0,
+                                reinterpret_cast<char*>(
+                                    const_cast<void*>( buffer ) ),
+                                new HostList( hosts ), handler, 0, 0 };
+    int error = 0;
+    if( !Submit( &req, 1, error ) )
+    {
+      delete req->hosts;
+      delete req;
+      return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Sync
+  //----------------------------------------------------------------------------
+  bool LocalFileUring::Sync( int fd, const HostList &hosts,
+                             ResponseHandler *handler )
+  {
+#ifdef HAVE_IO_URING
+    Request *req = new Request{ IORING_OP_FSYNC, fd, 0, 0, 0, 0,
+                                new HostList( hosts ), handler, 0, 0 };
+    int error = 0;
+    if( !Submit( &req, 1, error ) )
+    {
+      delete req->hosts;
+      delete req;
+      return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // VectorRead
+  //----------------------------------------------------------------------------
+  bool LocalFileUring::VectorRead( int fd, const ChunkList &chunks,
+                                   void *buffer, const HostList &hosts,
+                                   ResponseHandler *handler )
+  {
+#ifdef HAVE_IO_URING
+    size_t n = chunks.size();
+    if( !n || n > pRing.sqSize() )
+      return false;
+
+    //--------------------------------------------------------------------------
+    // The chunks are laid out by their requested length, a short read leaves
+    // a gap rather than shifting the following chunks
+    //--------------------------------------------------------------------------
+    Vector *vec  = new Vector();
+    vec->info    = new VectorReadInfo();
+    vec->pending = n;
+    vec->size    = 0;
+    vec->error   = 0;
+    vec->hosts   = new HostList( hosts );
+    vec->handler = handler;
+
+    ChunkList            &info = vec->info->GetChunks();
+    std::vector<Request*> reqs;
+    info.reserve( n );
+    reqs.reserve( n );
+    char *cursor = reinterpret_cast<char*>( buffer );
+    for( size_t i = 0; i < n; ++i )
+    {
+      char *buff = cursor ? cursor : reinterpret_cast<char*>( chunks[i].buffer );
+      if( cursor )
+        cursor += chunks[i].length;
+      info.push_back( ChunkInfo( chunks[i].offset, chunks[i].length, buff ) );
+      reqs.push_back( new Request{ IORING_OP_READ, fd, chunks[i].offset,
+                                   chunks[i].length, 0, buff, 0, 0, vec, i } );
+    }
+
+    int    error = 0;
+    size_t sent  = Submit( reqs.data(), n, error );
+    if( !sent )
+    {
+      for( size_t i = 0; i < n; ++i )
+        delete reqs[i];
+      delete vec->hosts;
+      delete vec->info;
+      delete vec;
+      return false;
+    }
+
+    //--------------------------------------------------------------------------
+    // Fail the chunks that did not make it to the ring
+    //--------------------------------------------------------------------------
+    for( size_t i = sent; i < n; ++i )
+      Complete( reqs[i], error ? error : -EAGAIN );
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Completion loop
+  //----------------------------------------------------------------------------
+  void LocalFileUring::Reap()
+  {
+#ifdef HAVE_IO_URING
+    Log          *log = DefaultEnv::GetLog();
+    io_uring_cqe  cqe;
+
+    while( 1 )
+    {
+      while( pRing.Next( cqe ) )
+      {
+        {
+          XrdSysMutexHelper scopedLock( pMutex );
+          --pInFlight;
+        }
+        Complete( reinterpret_cast<Request*>( cqe.user_data ), cqe.res );
+      }
+
+      int rc = pRing.Enter( 0, 1 );
+      if( rc < 0 )
+      {
+        log->Error( FileMsg, "Unable to wait for io_uring completions: %s",
+                    XrdSysE2T( -rc ) );
+        sleep( 1 );
+      }
+    }
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  LocalFileUring::LocalFileUring():
+    pInFlight( 0 ),
+    pPid( getpid() )
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  LocalFileUring::~LocalFileUring()
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Handle the result of a request
+  //----------------------------------------------------------------------------
+  void LocalFileUring::Complete( Request *req, int result )
+  {
+#ifdef HAVE_IO_URING
+    Log *log = DefaultEnv::GetLog();
+
+    //--------------------------------------------------------------------------
+    // A chunk of a vector read, respond once all of them are back
+    //--------------------------------------------------------------------------
+    if( req->vector )
+    {
+      Vector *vec = req->vector;
+      size_t  idx = req->index;
+      delete req;
+
+      XrdSysMutexHelper scopedLock( vec->mutex );
+      if( result < 0 )
+      {
+        if( !vec->error )
+          vec->error = -result;
+      }
+      else
+      {
+        vec->info->GetChunks()[idx].length = result;
+        vec->size += result;
+      }
+
+      if( --vec->pending )
+        return;
+      scopedLock.UnLock();
+
+      if( vec->error )
+      {
+        log->Error( FileMsg, "VectorRead: failed %s", XrdSysE2T( vec->error ) );
+        XRootDStatus *error = new XRootDStatus( stError, errErrorResponse,
+                                                XProtocol::mapError( vec->error ),
+                                                XrdSysE2T( vec->error ) );
+        delete vec->info;
+        Respond( error, 0, vec->hosts, vec->handler );
+      }
+      else
+      {
+        vec->info->SetSize( vec->size );
+        AnyObject *resp = new AnyObject();
+        resp->Set( vec->info );
+        Respond( new XRootDStatus(), resp, vec->hosts, vec->handler );
+      }
+      delete vec;
+      return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Resume a short write, if the ring cannot take it finish it here
+    //--------------------------------------------------------------------------
+    if( req->opcode == IORING_OP_WRITE && result >= 0 )
+    {
+      if( result == 0 && req->done < req->size )
+        result = -EIO;
+      else
+      {
+        req->done += result;
+        int error = 0;
+        if( req->done < req->size && !Submit( &req, 1, error ) )
+        {
+          while( req->done < req->size )
+          {
+            ssize_t ret = pwrite( req->fd, req->buffer + req->done,
+                                  req->size - req->done,
+                                  req->offset + req->done );
+            if( ret <= 0 )
+            {
+              result = ( ret < 0 ? -errno : -EIO );
+              break;
+            }
+            req->done += ret;
+          }
+        }
+        else if( req->done < req->size )
+          return;
+      }
+    }
+
+    static const char *errmsg[] = { "Read:  failed %s", "Write: failed %s",
+                                    "Sync:  failed %s" };
+
+    if( result < 0 )
+    {
+      int idx = ( req->opcode == IORING_OP_READ  ? 0 :
+                  req->opcode == IORING_OP_WRITE ? 1 : 2 );
+      log->Error( FileMsg, errmsg[idx], XrdSysE2T( -result ) );
+      XRootDStatus *error = new XRootDStatus( stError, errErrorResponse,
+                                              XProtocol::mapError( -result ),
+                                              XrdSysE2T( -result ) );
+      Respond( error, 0, req->hosts, req->handler );
+    }
+    else
+    {
+      AnyObject *resp = 0;
+      if( req->opcode == IORING_OP_READ )
+      {
+        ChunkInfo *chunk = new ChunkInfo( req->offset, result, req->buffer );
+        resp = new AnyObject();
+        resp->Set( chunk );
+      }
+      Respond( new XRootDStatus(), resp, req->hosts, req->handler );
+    }
+    delete req;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Place a request in the submission queue, pMutex is held and there is
+  // room for it
+  //----------------------------------------------------------------------------
+  void LocalFileUring::Prep( Request *req )
+  {
+#ifdef HAVE_IO_URING
+    if( req->opcode == IORING_OP_FSYNC )
+      pRing.Prep( req->opcode, req->fd, 0, 0, 0, (unsigned long long)req );
+    else
+      pRing.Prep( req->opcode, req->fd, req->buffer + req->done,
+                  req->size - req->done, req->offset + req->done,
+                  (unsigned long long)req );
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Submit requests, returns how many of them made it to the ring. The
+  // requests in flight are capped by the completion queue size so that
+  // completions never overflow.
+  //----------------------------------------------------------------------------
+  size_t LocalFileUring::Submit( Request **reqs, size_t n, int &error )
+  {
+#ifdef HAVE_IO_URING
+    XrdSysMutexHelper scopedLock( pMutex );
+    if( n > pRing.sqSize() || pInFlight + n > pRing.cqSize() )
+      return 0;
+
+    for( size_t i = 0; i < n; ++i )
+      Prep( reqs[i] );
+
+    unsigned int toSubmit = n;
+    while( toSubmit )
+    {
+      int rc = pRing.Enter( toSubmit, 0 );
+      if( rc <= 0 )
+      {
+        pRing.Unprep( toSubmit );
+        error = ( rc < 0 ? rc : -EAGAIN );
+        break;
+      }
+      toSubmit -= rc;
+    }
+
+    pInFlight += n - toSubmit;
+    return n - toSubmit;
+#else
+    return 0;
+#endif
+  }
+
+  //----------------------------------------------------------------------------
+  // Pass the response to the handler
+  //----------------------------------------------------------------------------
+  void LocalFileUring::Respond( XRootDStatus *status, AnyObject *resp,
+                                HostList *hosts, ResponseHandler *handler )
+  {
+    //--------------------------------------------------------------------------
+    // The sync handler only posts a semaphore, call it right away
+    //--------------------------------------------------------------------------
+    SyncResponseHandler *syncHandler =
+        dynamic_cast<SyncResponseHandler*>( handler );
+    if( syncHandler )
+    {
+      syncHandler->HandleResponseWithHosts( status, resp, hosts );
+      return;
+    }
+
+    JobManager *jmngr = DefaultEnv::GetPostMaster()->GetJobManager();
+    jmngr->QueueJob( new LocalFileTask( status, resp, hosts, handler ) );
+  }
+}
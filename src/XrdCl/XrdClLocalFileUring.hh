@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// This file is part of the XRootD software suite.
+//
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//
+// In applying this licence, CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_LOCAL_FILE_URING_HH__
+#define __XRD_CL_LOCAL_FILE_URING_HH__
+
+#include "XrdCl/XrdClXRootDResponses.hh"
+#include "XrdSys/XrdSysIOUring.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <vector>
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  //! io_uring based I/O engine for local files
+  //!
+  //! A single ring is shared by all the local files of the process. Requests
+  //! are placed on the ring by the calling thread and completed by a
+  //! dedicated thread that reaps the completion queue, so no thread is
+  //! spawned and no signal is raised per request as with POSIX AIO. The
+  //! ring itself is driven by XrdSysIOUring.
+  //!
+  //! Every method returns false if the engine cannot take the request (ring
+  //! full or failed submission); the caller then uses the POSIX path. Once a
+  //! method returned true the handler is always called.
+  //----------------------------------------------------------------------------
+  class LocalFileUring
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Get the engine
+      //!
+      //! @return the engine or 0 if it is disabled (XRD_LOCALFILEURING) or
+      //!         not supported by the kernel
+      //------------------------------------------------------------------------
+      static LocalFileUring *Instance();
+
+      //------------------------------------------------------------------------
+      //! Read from a file, responds with a ChunkInfo
+      //------------------------------------------------------------------------
+      bool Read( int fd, uint64_t offset, uint32_t size, void *buffer,
+                 const HostList &hosts, ResponseHandler *handler );
+
+      //------------------------------------------------------------------------
+      //! Write to a file, short writes are resumed
+      //------------------------------------------------------------------------
+      bool Write( int fd, uint64_t offset, uint32_t size, const void *buffer,
+                  const HostList &hosts, ResponseHandler *handler );
+
+      //------------------------------------------------------------------------
+      //! Flush a file to the disk
+      //------------------------------------------------------------------------
+      bool Sync( int fd, const HostList &hosts, ResponseHandler *handler );
+
+      //------------------------------------------------------------------------
+      //! Read all the chunks at once, responds with a VectorReadInfo
+      //!
+      //! @param buffer if not null the chunks are placed one after another in
+      //!               this buffer, otherwise in the chunk buffers
+      //------------------------------------------------------------------------
+      bool VectorRead( int fd, const ChunkList &chunks, void *buffer,
+                       const HostList &hosts, ResponseHandler *handler );
+
+      //------------------------------------------------------------------------
+      //! Completion loop, run by the reaper thread
+      //------------------------------------------------------------------------
+      void Reap();
+
+    private:
+      struct Vector;
+
+      struct Request
+      {
+        int              opcode;
+        int              fd;
+        uint64_t         offset;
+        uint32_t         size;
+        uint32_t         done;      //!< bytes written so far
+        char            *buffer;
+        HostList        *hosts;
+        ResponseHandler *handler;
+        Vector          *vector;
+        size_t           index;     //!< chunk number within the vector
+      };
+
+      struct Vector
+      {
+        XrdSysMutex      mutex;
+        VectorReadInfo  *info;
+        size_t           pending;
+        uint32_t         size;      //!< bytes read by all chunks
+        int              error;
+        HostList        *hosts;
+        ResponseHandler *handler;
+      };
+
+      LocalFileUring();
+      ~LocalFileUring();
+
+      void   Complete( Request *req, int result );
+      void   Prep( Request *req );
+      size_t Submit( Request **reqs, size_t n, int &error );
+
+      static void Respond( XRootDStatus *status, AnyObject *resp,
+                           HostList *hosts, ResponseHandler *handler );
+
+      XrdSysMutex   pMutex;     //!< serializes submissions
+      unsigned int  pInFlight;
+      pid_t         pPid;
+      XrdSysIOUring pRing;
+  };
+}
+
+#endif // __XRD_CL_LOCAL_FILE_URING_HH__
@@ -39,6 +39,27 @@ namespace XrdCl
           Zero();
       }
 
+      //------------------------------------------------------------------------
+      //! Move constructor
+      //------------------------------------------------------------------------
+      Message( Message &&msg ):
+        Buffer( std::move( msg ) ), pIsMarshalled( msg.pIsMarshalled ),
+        pSessionId( msg.pSessionId ), pDescription( std::move( msg.pDescription ) )
+      {
+      }
+
+      //------------------------------------------------------------------------
+      //! Move assignment operator
+      //------------------------------------------------------------------------
+      Message& operator=( Message &&msg )
+      {
+        Buffer::operator=( std::move( msg ) );
+        pIsMarshalled = msg.pIsMarshalled;
+        pSessionId    = msg.pSessionId;
+        pDescription  = std::move( msg.pDescription );
+        return *this;
+      }
+
       //------------------------------------------------------------------------
       //! Destructor
       //------------------------------------------------------------------------
@@ -203,6 +203,17 @@ namespace XrdCl
         bool         isOK;      //!< True if checksum matched, false otherwise
       };
 
+      //------------------------------------------------------------------------
+      //! Describe the message buffer pool usage (cumulative counters)
+      //------------------------------------------------------------------------
+      struct BufferPoolInfo
+      {
+        BufferPoolInfo(): hits(0), misses(0), bytesKept(0) {}
+        uint64_t hits;       //!< Buffers served from the pool
+        uint64_t misses;     //!< Buffers that had to be allocated
+        uint64_t bytesKept;  //!< Bytes held in the pool's free lists
+      };
+
       //------------------------------------------------------------------------
       //! Event codes passed to the Event() method. Event code values not
       //! listed here, if encountered, should be ignored.
@@ -216,7 +227,8 @@ namespace XrdCl
         EvClose,          //!< CloseInfo: File closed
         EvErrIO,          //!< ErrorInfo: An I/O error occurred
         EvConnect,        //!< ConnectInfo: Login  into a server
-        EvDisconnect      //!< DisconnectInfo: Logout from a server
+        EvDisconnect,     //!< DisconnectInfo: Logout from a server
+        EvBufferPool      //!< BufferPoolInfo: Periodic buffer pool statistics
 
       };
 
@@ -0,0 +1,676 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// This file is part of the XRootD software suite.
+//
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//
+// In applying this licence, CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClReadAhead.hh"
+#include "XrdCl/XrdClFileStateHandler.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClJobManager.hh"
+#include "XrdCl/XrdClResponseJob.hh"
+#include "XrdCl/XrdClURL.hh"
+#include "XrdCl/XrdClXRootDResponses.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // A pattern must repeat this many times before we start prefetching
+  //----------------------------------------------------------------------------
+  const int      MinRun         = 2;
+
+  //----------------------------------------------------------------------------
+  // Upper limit of prefetch requests in flight
+  //----------------------------------------------------------------------------
+  const int      MaxInFlight    = 64;
+
+  //----------------------------------------------------------------------------
+  // The bandwidth is sampled over intervals of at least this many seconds and
+  // the round trip time is the minimum latency seen over this many prefetches
+  //----------------------------------------------------------------------------
+  const double   BWInterval     = 0.1;
+  const int      RTTSamples     = 32;
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Handles the response to a prefetch
+  //----------------------------------------------------------------------------
+  class PrefetchHandler: public ResponseHandler
+  {
+    public:
+      PrefetchHandler( ReadAhead *readAhead, ReadAhead::Block *block ):
+        pReadAhead( readAhead ), pBlock( block )
+      {
+      }
+
+      virtual void HandleResponseWithHosts( XRootDStatus *status,
+                                            AnyObject    *response,
+                                            HostList     *hostList )
+      {
+        bool      ok     = status->IsOK();
+        uint32_t  length = 0;
+        if( ok && response )
+        {
+          ChunkInfo *chunk = 0;
+          response->Get( chunk );
+          if( chunk ) length = chunk->length;
+        }
+        delete status;
+        delete response;
+        delete hostList;
+
+        //----------------------------------------------------------------------
+        // The read-ahead may issue the close of the file from Done(), nothing
+        // may touch it afterwards
+        //----------------------------------------------------------------------
+        ReadAhead        *readAhead = pReadAhead;
+        ReadAhead::Block *block     = pBlock;
+        delete this;
+        readAhead->Done( block, ok, length );
+      }
+
+    private:
+      ReadAhead        *pReadAhead;
+      ReadAhead::Block *pBlock;
+  };
+
+  //----------------------------------------------------------------------------
+  // Create the read-ahead for a file if it is enabled
+  //----------------------------------------------------------------------------
+  ReadAhead *ReadAhead::Create( FileStateHandler *stateHandler,
+                                uint64_t          fileSize )
+  {
+    Env *env       = DefaultEnv::GetEnv();
+    int  maxWindow = DefaultReadAheadWindow;
+    int  blockSize = DefaultReadAheadBlockSize;
+    env->GetInt( "ReadAheadWindow",    maxWindow );
+    env->GetInt( "ReadAheadBlockSize", blockSize );
+
+    if( maxWindow <= 0 )
+      return 0;
+    if( blockSize <= 0 )
+      blockSize = DefaultReadAheadBlockSize;
+    if( maxWindow < 2 * blockSize )
+      maxWindow = 2 * blockSize;
+
+    return new ReadAhead( stateHandler, fileSize, blockSize, maxWindow );
+  }
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  ReadAhead::ReadAhead( FileStateHandler *stateHandler, uint64_t fileSize,
+                        uint32_t blockSize, uint32_t maxWindow ):
+    pStateHandler( stateHandler ),
+    pHeld( 0 ),
+    pInFlight( 0 ),
+    pActive( 0 ),
+    pStopped( false ),
+    pCloseHandler( 0 ),
+    pCloseTimeout( 0 ),
+    pPattern( None ),
+    pRun( 0 ),
+    pLastOffset( 0 ),
+    pLastEnd( 0 ),
+    pLastSize( 0 ),
+    pLastDelta( 0 ),
+    pNext( 0 ),
+    pEOF( fileSize ? fileSize : UINT64_MAX ),
+    pBlockSize( blockSize ),
+    pMaxWindow( maxWindow ),
+    pBandwidth( 0 ),
+    pRTT( 0 ),
+    pRTTMin( 0 ),
+    pRTTSamples( 0 ),
+    pBWBytes( 0 )
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  ReadAhead::~ReadAhead()
+  {
+    while( !pBlocks.empty() )
+      Free( pBlocks.begin() );
+  }
+
+  //----------------------------------------------------------------------------
+  // Account for a read and serve it from the prefetched data if possible
+  //----------------------------------------------------------------------------
+  bool ReadAhead::Read( uint64_t         offset,
+                        uint32_t         size,
+                        void            *buffer,
+                        ResponseHandler *handler,
+                        const URL       &dataServer )
+  {
+    std::vector<Block*> pending;
+    XrdSysMutexHelper scopedLock( pMutex );
+
+    Account( offset, size );
+
+    switch( Cover( offset, size, &pending ) )
+    {
+      case Miss:
+        return false;
+
+      case Hit:
+      {
+        uint32_t length = Copy( offset, size, (char*)buffer );
+        Respond( handler, offset, length, (char*)buffer, dataServer );
+        return true;
+      }
+
+      case Pending:
+      {
+        Waiter *waiter     = new Waiter();
+        waiter->offset     = offset;
+        waiter->size       = size;
+        waiter->buffer     = (char*)buffer;
+        waiter->handler    = handler;
+        waiter->dataServer = new URL( dataServer );
+        waiter->pending    = pending.size();
+        for( size_t i = 0; i < pending.size(); ++i )
+          pending[i]->waiters.push_back( waiter );
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //----------------------------------------------------------------------------
+  // Issue prefetches until the window is full
+  //----------------------------------------------------------------------------
+  void ReadAhead::Refill()
+  {
+    std::vector<Block*> issue;
+
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+
+      if( pStopped || pRun < MinRun )
+        return;
+
+      //------------------------------------------------------------------------
+      // Sequential reads are prefetched in blocks, strided ones read by read
+      //------------------------------------------------------------------------
+      uint64_t from, step;
+      uint32_t size;
+      if( pPattern == Sequential )
+      {
+        from = std::max( pNext, pLastEnd );
+        step = pBlockSize;
+        size = pBlockSize;
+      }
+      else
+      {
+        from = std::max( pNext, pLastOffset + pLastDelta );
+        step = pLastDelta;
+        size = pLastSize;
+      }
+
+      uint32_t window = Window();
+      while( from < pEOF && pHeld + size <= window &&
+             pInFlight + (int)issue.size() < MaxInFlight )
+      {
+        //----------------------------------------------------------------------
+        // Skip what is already there
+        //----------------------------------------------------------------------
+        std::map<uint64_t, Block*>::iterator it = pBlocks.upper_bound( from );
+        if( it != pBlocks.begin() )
+        {
+          Block *prev = (--it)->second;
+          if( prev->offset + prev->size > from )
+          {
+            from = ( pPattern == Sequential ? prev->offset + prev->size
+                                            : from + step );
+            continue;
+          }
+        }
+
+        uint32_t len = size;
+        if( pEOF - from < len ) len = pEOF - from;
+
+        Block *block    = new Block();
+        block->buffer   = BufferPool::AllocateBlock( len );
+        if( !block->buffer.Get() )
+        {
+          delete block;
+          break;
+        }
+        block->offset   = from;
+        block->size     = len;
+        block->length   = 0;
+        block->done     = false;
+        block->failed   = false;
+        block->stale    = false;
+        block->issued   = Clock::now();
+        pBlocks[from]   = block;
+        pHeld          += len;
+        issue.push_back( block );
+        from += step;
+      }
+      pNext = from;
+
+      if( !pInFlight && !issue.empty() )
+      {
+        pBWMark  = Clock::now();
+        pBWBytes = 0;
+      }
+      pInFlight += issue.size();
+      pActive   += issue.size();
+    }
+
+    //--------------------------------------------------------------------------
+    // Send the requests, the responses cannot be processed before the state
+    // handler lock, which our caller holds, is released
+    //--------------------------------------------------------------------------
+    for( size_t i = 0; i < issue.size(); ++i )
+    {
+      Block           *block   = issue[i];
+      PrefetchHandler *handler = new PrefetchHandler( this, block );
+      XRootDStatus st = pStateHandler->SendRead( block->offset, block->size,
+                                                 block->buffer.Get(), handler,
+                                                 0 );
+      if( !st.IsOK() )
+      {
+        delete handler;
+        XrdSysMutexHelper scopedLock( pMutex );
+        for( size_t j = i; j < issue.size(); ++j )
+        {
+          Free( pBlocks.find( issue[j]->offset ) );
+          --pInFlight;
+          --pActive;
+        }
+        pNext = 0;
+        break;
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Stop prefetching and drop the prefetched data
+  //----------------------------------------------------------------------------
+  bool ReadAhead::DeferClose( ResponseHandler *handler, uint16_t timeout )
+  {
+    XrdSysMutexHelper scopedLock( pMutex );
+    pStopped = true;
+    Drop();
+    if( !pActive )
+      return false;
+
+    pCloseHandler = handler;
+    pCloseTimeout = timeout;
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Number of prefetch requests in flight
+  //----------------------------------------------------------------------------
+  int ReadAhead::InFlight()
+  {
+    XrdSysMutexHelper scopedLock( pMutex );
+    return pInFlight;
+  }
+
+  //----------------------------------------------------------------------------
+  // Update the access pattern with the given read
+  //----------------------------------------------------------------------------
+  void ReadAhead::Account( uint64_t offset, uint32_t size )
+  {
+    int64_t delta = offset - pLastOffset;
+
+    if( offset == pLastEnd )
+    {
+      if( pPattern != Sequential )
+      {
+        pPattern = Sequential;
+        pRun     = 0;
+        pNext    = 0;
+      }
+      ++pRun;
+    }
+    else if( delta > 0 && delta == pLastDelta && size == pLastSize )
+    {
+      if( pPattern != Strided )
+      {
+        pPattern = Strided;
+        pRun     = 1;
+        pNext    = 0;
+      }
+      ++pRun;
+    }
+    else
+    {
+      //------------------------------------------------------------------------
+      // The pattern is broken, whatever we have prefetched is most likely
+      // useless but the current read may still hit it
+      //------------------------------------------------------------------------
+      if( pRun >= MinRun )
+      {
+        Log *log = DefaultEnv::GetLog();
+        log->Dump( FileMsg, "[0x%x] Read-ahead: access pattern broken at "
+                   "%llu", pStateHandler, (unsigned long long)offset );
+      }
+      pPattern = None;
+      pRun     = 0;
+      pNext    = 0;
+      Drop();
+    }
+
+    pLastDelta  = delta;
+    pLastOffset = offset;
+    pLastSize   = size;
+    pLastEnd    = offset + size;
+
+    //--------------------------------------------------------------------------
+    // Let go of whatever the reader has left behind
+    //--------------------------------------------------------------------------
+    std::map<uint64_t, Block*>::iterator it = pBlocks.begin();
+    while( it != pBlocks.end() && it->second->offset + it->second->size <= offset )
+    {
+      Block *block = it->second;
+      if( block->done )
+        Free( it++ );
+      else
+      {
+        block->stale = true;
+        ++it;
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Check whether the given range is covered by prefetches, the ones still in
+  // flight are put in pending
+  //----------------------------------------------------------------------------
+  ReadAhead::Coverage ReadAhead::Cover( uint64_t offset, uint32_t size,
+                                        std::vector<Block*> *pending )
+  {
+    uint64_t end = std::min( offset + size, pEOF );
+    uint64_t pos = offset;
+
+    if( pos >= end )
+      return Miss;
+
+    std::map<uint64_t, Block*>::iterator it = pBlocks.upper_bound( pos );
+    if( it == pBlocks.begin() )
+      return Miss;
+    --it;
+
+    while( pos < end )
+    {
+      if( it == pBlocks.end() )
+        return Miss;
+      Block *block = it->second;
+      if( block->offset > pos || block->offset + block->size <= pos ||
+          block->failed )
+        return Miss;
+      if( !block->done )
+      {
+        if( !pending ) return Miss;
+        pending->push_back( block );
+      }
+      else if( block->offset + block->length <= pos )
+        return Miss;
+      pos = block->offset + block->size;
+      ++it;
+    }
+    return ( pending && !pending->empty() ) ? Pending : Hit;
+  }
+
+  //----------------------------------------------------------------------------
+  // Copy the prefetched data of a covered range to the user buffer
+  //----------------------------------------------------------------------------
+  uint32_t ReadAhead::Copy( uint64_t offset, uint32_t size, char *buffer )
+  {
+    uint64_t end = std::min( offset + size, pEOF );
+    uint64_t pos = offset;
+
+    std::map<uint64_t, Block*>::iterator it = pBlocks.upper_bound( pos );
+    --it;
+    while( pos < end )
+    {
+      Block   *block = it->second;
+      uint64_t bend  = std::min( end, block->offset + block->length );
+      memcpy( buffer + ( pos - offset ),
+              block->buffer.Get() + ( pos - block->offset ), bend - pos );
+      pos = bend;
+      ++it;
+    }
+    return pos - offset;
+  }
+
+  //----------------------------------------------------------------------------
+  // A prefetch has come back
+  //----------------------------------------------------------------------------
+  void ReadAhead::Done( Block *block, bool ok, uint32_t length )
+  {
+    std::vector<Waiter*> ready;
+    bool stopped;
+
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      --pInFlight;
+      block->done   = true;
+      block->failed = !ok;
+      block->length = ok ? length : 0;
+
+      //------------------------------------------------------------------------
+      // Estimate the bandwidth and the round trip time
+      //------------------------------------------------------------------------
+      if( ok )
+      {
+        Clock::time_point now = Clock::now();
+        double latency = std::chrono::duration<double>( now - block->issued ).count();
+        if( !pRTTSamples || latency < pRTTMin ) pRTTMin = latency;
+        if( ++pRTTSamples >= RTTSamples || !pRTT )
+        {
+          pRTT        = pRTTMin;
+          pRTTSamples = 0;
+        }
+
+        pBWBytes += length;
+        double elapsed = std::chrono::duration<double>( now - pBWMark ).count();
+        if( elapsed >= BWInterval )
+        {
+          double sample = pBWBytes / elapsed;
+          pBandwidth = ( pBandwidth ? 0.75 * pBandwidth + 0.25 * sample : sample );
+          pBWMark    = now;
+          pBWBytes   = 0;
+        }
+
+        //----------------------------------------------------------------------
+        // A short read marks the end of the file
+        //----------------------------------------------------------------------
+        if( length < block->size && block->offset + length < pEOF )
+        {
+          pEOF = block->offset + length;
+          std::map<uint64_t, Block*>::iterator it = pBlocks.lower_bound( pEOF );
+          while( it != pBlocks.end() )
+          {
+            if( it->second == block || !it->second->done ) (it++)->second->stale = true;
+            else Free( it++ );
+          }
+          block->stale = false;
+        }
+      }
+
+      //------------------------------------------------------------------------
+      // A block that is no longer wanted is kept only for the reads that
+      // already wait for it
+      //------------------------------------------------------------------------
+      bool wanted = !block->waiters.empty();
+      for( size_t i = 0; i < block->waiters.size(); ++i )
+        if( --block->waiters[i]->pending == 0 )
+          ready.push_back( block->waiters[i] );
+      block->waiters.clear();
+
+      if( block->failed || ( block->stale && !wanted ) )
+        Free( pBlocks.find( block->offset ) );
+      stopped = pStopped;
+    }
+
+    //--------------------------------------------------------------------------
+    // Serve the reads that waited for this block and keep the window full
+    //--------------------------------------------------------------------------
+    for( size_t i = 0; i < ready.size(); ++i )
+      Serve( ready[i] );
+
+    if( !stopped )
+    {
+      XrdSysMutexHelper scopedLock( pStateHandler->pMutex );
+      if( pStateHandler->pFileState == FileStateHandler::Opened )
+        Refill();
+    }
+
+    //--------------------------------------------------------------------------
+    // If the file is being closed, the last prefetch issues the close
+    //--------------------------------------------------------------------------
+    ResponseHandler *closeHandler = 0;
+    uint16_t         closeTimeout = 0;
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      if( --pActive == 0 && pCloseHandler )
+      {
+        closeHandler  = pCloseHandler;
+        closeTimeout  = pCloseTimeout;
+        pCloseHandler = 0;
+      }
+    }
+
+    if( closeHandler )
+    {
+      XRootDStatus st;
+      {
+        XrdSysMutexHelper scopedLock( pStateHandler->pMutex );
+        st = pStateHandler->IssueClose( closeHandler, closeTimeout );
+      }
+      if( !st.IsOK() )
+      {
+        JobManager *jobMan = DefaultEnv::GetPostMaster()->GetJobManager();
+        jobMan->QueueJob( new ResponseJob( closeHandler,
+                                           new XRootDStatus( st ), 0, 0 ) );
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Drop the prefetched data, what is still in flight goes when it comes back
+  //----------------------------------------------------------------------------
+  void ReadAhead::Drop()
+  {
+    std::map<uint64_t, Block*>::iterator it = pBlocks.begin();
+    while( it != pBlocks.end() )
+    {
+      if( it->second->done )
+        Free( it++ );
+      else
+        (it++)->second->stale = true;
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Remove a block and give its buffer back to the pool
+  //----------------------------------------------------------------------------
+  void ReadAhead::Free( std::map<uint64_t, Block*>::iterator it )
+  {
+    Block *block = it->second;
+    pHeld -= block->size;
+    delete block;
+    pBlocks.erase( it );
+  }
+
+  //----------------------------------------------------------------------------
+  // Call the user handler with the data of a read
+  //----------------------------------------------------------------------------
+  void ReadAhead::Respond( ResponseHandler *handler, uint64_t offset,
+                           uint32_t length, char *buffer,
+                           const URL &dataServer )
+  {
+    AnyObject *response = new AnyObject();
+    response->Set( new ChunkInfo( offset, length, buffer ) );
+    HostList *hostList = new HostList();
+    hostList->push_back( HostInfo( dataServer ) );
+
+    JobManager *jobMan = DefaultEnv::GetPostMaster()->GetJobManager();
+    jobMan->QueueJob( new ResponseJob( handler, new XRootDStatus(), response,
+                                       hostList ) );
+  }
+
+  //----------------------------------------------------------------------------
+  // Serve a read whose prefetches have all come back, or send it to the
+  // server if one of them failed
+  //----------------------------------------------------------------------------
+  void ReadAhead::Serve( Waiter *waiter )
+  {
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      if( Cover( waiter->offset, waiter->size, 0 ) == Hit )
+      {
+        uint32_t length = Copy( waiter->offset, waiter->size, waiter->buffer );
+        Respond( waiter->handler, waiter->offset, length, waiter->buffer,
+                 *waiter->dataServer );
+        delete waiter->dataServer;
+        delete waiter;
+        return;
+      }
+    }
+
+    XRootDStatus st;
+    {
+      XrdSysMutexHelper scopedLock( pStateHandler->pMutex );
+      if( pStateHandler->pFileState == FileStateHandler::Opened ||
+          pStateHandler->pFileState == FileStateHandler::Recovering )
+        st = pStateHandler->SendRead( waiter->offset, waiter->size,
+                                      waiter->buffer, waiter->handler, 0 );
+      else
+        st = XRootDStatus( stError, errInvalidOp );
+    }
+    if( !st.IsOK() )
+    {
+      JobManager *jobMan = DefaultEnv::GetPostMaster()->GetJobManager();
+      jobMan->QueueJob( new ResponseJob( waiter->handler,
+                                         new XRootDStatus( st ), 0, 0 ) );
+    }
+    delete waiter->dataServer;
+    delete waiter;
+  }
+
+  //----------------------------------------------------------------------------
+  // Size of the window: twice the bandwidth-delay product, at least two
+  // blocks and at most the configured maximum
+  //----------------------------------------------------------------------------
+  uint32_t ReadAhead::Window()
+  {
+    double window = 2 * pBandwidth * pRTT;
+    if( window < 2.0 * pBlockSize ) return 2 * pBlockSize;
+    if( window > pMaxWindow )       return pMaxWindow;
+    return (uint32_t)window;
+  }
+}
@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// This file is part of the XRootD software suite.
+//
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//
+// In applying this licence, CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_READ_AHEAD_HH__
+#define __XRD_CL_READ_AHEAD_HH__
+
+#include "XrdCl/XrdClBufferPool.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <stdint.h>
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace XrdCl
+{
+  class FileStateHandler;
+  class ResponseHandler;
+  class URL;
+
+  //----------------------------------------------------------------------------
+  //! Read-ahead for FileStateHandler
+  //!
+  //! Watches the reads issued on a file and, once they form a sequential or
+  //! a strided pattern, keeps a window of asynchronous reads in flight ahead
+  //! of the reader. Reads that fall on the prefetched data are served from
+  //! pooled buffers, or wait for the prefetch that covers them. The window is
+  //! sized from the measured bandwidth-delay product, bounded by the
+  //! ReadAheadWindow setting.
+  //!
+  //! Methods marked so must be called with the state handler lock held. The
+  //! close of the file is deferred until no prefetch is in flight, so that
+  //! the state handler outlives every prefetch.
+  //----------------------------------------------------------------------------
+  class ReadAhead
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Create the read-ahead for a file if it is enabled
+      //!
+      //! @param stateHandler the file
+      //! @param fileSize     size of the file if known, 0 otherwise
+      //! @return             the read-ahead object or 0 if disabled
+      //------------------------------------------------------------------------
+      static ReadAhead *Create( FileStateHandler *stateHandler,
+                                uint64_t          fileSize );
+
+      //------------------------------------------------------------------------
+      //! Destructor
+      //------------------------------------------------------------------------
+      ~ReadAhead();
+
+      //------------------------------------------------------------------------
+      //! Account for a read and serve it from the prefetched data if possible
+      //! (state handler lock held)
+      //!
+      //! @return true if the read has been taken care of, the handler will be
+      //!         called later; false if the read must be sent to the server
+      //------------------------------------------------------------------------
+      bool Read( uint64_t         offset,
+                 uint32_t         size,
+                 void            *buffer,
+                 ResponseHandler *handler,
+                 const URL       &dataServer );
+
+      //------------------------------------------------------------------------
+      //! Issue prefetches until the window is full (state handler lock held)
+      //------------------------------------------------------------------------
+      void Refill();
+
+      //------------------------------------------------------------------------
+      //! Stop prefetching and drop the prefetched data (state handler lock
+      //! held)
+      //!
+      //! @return true if prefetches are still in flight, the close is then
+      //!         issued with the given handler once the last one returns
+      //------------------------------------------------------------------------
+      bool DeferClose( ResponseHandler *handler, uint16_t timeout );
+
+      //------------------------------------------------------------------------
+      //! Number of prefetch requests in flight
+      //------------------------------------------------------------------------
+      int InFlight();
+
+    private:
+      typedef std::chrono::steady_clock Clock;
+
+      struct Waiter;
+
+      struct Block
+      {
+        uint64_t               offset;
+        uint32_t               size;      //!< bytes requested
+        uint32_t               length;    //!< bytes received
+        BufferPool::Block      buffer;
+        Clock::time_point      issued;
+        std::vector<Waiter*>   waiters;
+        bool                   done;
+        bool                   failed;
+        bool                   stale;     //!< drop once it comes back
+      };
+
+      struct Waiter
+      {
+        uint64_t         offset;
+        uint32_t         size;
+        char            *buffer;
+        ResponseHandler *handler;
+        URL             *dataServer;
+        int              pending;
+      };
+
+      enum Pattern { None, Sequential, Strided };
+      enum Coverage { Miss, Hit, Pending };
+
+      friend class PrefetchHandler;
+
+      ReadAhead( FileStateHandler *stateHandler, uint64_t fileSize,
+                 uint32_t blockSize, uint32_t maxWindow );
+
+      void     Account( uint64_t offset, uint32_t size );
+      Coverage Cover( uint64_t offset, uint32_t size,
+                      std::vector<Block*> *pending );
+      uint32_t Copy( uint64_t offset, uint32_t size, char *buffer );
+      void     Done( Block *block, bool ok, uint32_t length );
+      void     Drop();
+      void     Free( std::map<uint64_t, Block*>::iterator it );
+      void     Respond( ResponseHandler *handler, uint64_t offset,
+                        uint32_t length, char *buffer, const URL &dataServer );
+      void     Serve( Waiter *waiter );
+      uint32_t Window();
+
+      FileStateHandler            *pStateHandler;
+      XrdSysMutex                  pMutex;
+      std::map<uint64_t, Block*>   pBlocks;
+      uint64_t                     pHeld;       //!< bytes in pBlocks
+      int                          pInFlight;   //!< prefetches on the wire
+      int                          pActive;     //!< prefetches not yet done with
+      bool                         pStopped;
+      ResponseHandler             *pCloseHandler;
+      uint16_t                     pCloseTimeout;
+
+      //------------------------------------------------------------------------
+      // Access pattern
+      //------------------------------------------------------------------------
+      Pattern                      pPattern;
+      int                          pRun;
+      uint64_t                     pLastOffset;
+      uint64_t                     pLastEnd;
+      uint32_t                     pLastSize;
+      int64_t                      pLastDelta;
+      uint64_t                     pNext;       //!< next offset to prefetch
+      uint64_t                     pEOF;
+
+      //------------------------------------------------------------------------
+      // Window sizing
+      //------------------------------------------------------------------------
+      uint32_t                     pBlockSize;
+      uint32_t                     pMaxWindow;
+      double                       pBandwidth;  //!< bytes per second
+      double                       pRTT;        //!< seconds
+      double                       pRTTMin;
+      int                          pRTTSamples;
+      uint64_t                     pBWBytes;
+      Clock::time_point            pBWMark;
+  };
+}
+
+#endif // __XRD_CL_READ_AHEAD_HH__
@@ -21,32 +21,102 @@
 namespace XrdCl
 {
   //----------------------------------------------------------------------------
-  // Allocate a SID
-  //---------------------------------------------------------------------------
-  Status SIDManager::AllocateSID( uint8_t sid[2] )
+  // Get the slot of a SID, allocate the page if needed
+  //----------------------------------------------------------------------------
+  SIDManager::Slot &SIDManager::GetSlot( uint16_t sid )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
+    std::atomic<Page*> &pp = pPages[sid / PageSize];
+    Page *page = pp.load( std::memory_order_acquire );
+    if( !page )
+    {
+      Page *newPage = new Page();
+      if( pp.compare_exchange_strong( page, newPage, std::memory_order_acq_rel,
+                                      std::memory_order_acquire ) )
+        page = newPage;
+      else
+        delete newPage;
+    }
+    return page->slots[sid % PageSize];
+  }
 
-    uint16_t allocSID = 1;
+  //----------------------------------------------------------------------------
+  // Get the slot of a SID if its page exists
+  //----------------------------------------------------------------------------
+  SIDManager::Slot *SIDManager::FindSlot( uint16_t sid ) const
+  {
+    Page *page = pPages[sid / PageSize].load( std::memory_order_acquire );
+    if( !page ) return 0;
+    return &page->slots[sid % PageSize];
+  }
 
-    //--------------------------------------------------------------------------
-    // Get a SID from the list of free SIDs if it's not empty
-    //--------------------------------------------------------------------------
-    if( !pFreeSIDs.empty() )
+  //----------------------------------------------------------------------------
+  // Push a SID on the free stack
+  //----------------------------------------------------------------------------
+  void SIDManager::Push( uint16_t sid )
+  {
+    Slot     &slot = GetSlot( sid );
+    uint64_t  head = pFreeHead.load( std::memory_order_relaxed );
+    uint64_t  newHead;
+    do
     {
-      allocSID = pFreeSIDs.front();
-      pFreeSIDs.pop_front();
+      slot.next.store( head & 0xffff, std::memory_order_relaxed );
+      newHead = ( ( ( head >> 16 ) + 1 ) << 16 ) | sid;
     }
+    while( !pFreeHead.compare_exchange_weak( head, newHead,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed ) );
+  }
+
+  //----------------------------------------------------------------------------
+  // Pop a SID off the free stack, 0 if empty
+  //----------------------------------------------------------------------------
+  uint16_t SIDManager::Pop()
+  {
+    uint64_t head = pFreeHead.load( std::memory_order_acquire );
+    while( true )
+    {
+      uint16_t top = head & 0xffff;
+      if( !top )
+        return 0;
+      //------------------------------------------------------------------------
+      // The next pointer may be stale if somebody else popped the SID in the
+      // meantime, but then the tag has changed and the exchange fails
+      //------------------------------------------------------------------------
+      uint16_t next    = FindSlot( top )->next.load( std::memory_order_relaxed );
+      uint64_t newHead = ( ( ( head >> 16 ) + 1 ) << 16 ) | next;
+      if( pFreeHead.compare_exchange_weak( head, newHead,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire ) )
+        return top;
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Allocate a SID
+  //---------------------------------------------------------------------------
+  Status SIDManager::AllocateSID( uint8_t sid[2] )
+  {
     //--------------------------------------------------------------------------
-    // Allocate a new SID if possible
+    // Get a SID from the stack of free SIDs if it's not empty, otherwise
+    // allocate a new SID if possible
     //--------------------------------------------------------------------------
-    else
+    uint16_t allocSID = Pop();
+    if( !allocSID )
     {
-      if( pSIDCeiling == 0xffff )
-        return Status( stError, errNoMoreFreeSIDs );
-      allocSID = pSIDCeiling++;
+      uint32_t ceiling = pSIDCeiling.load( std::memory_order_relaxed );
+      do
+      {
+        if( ceiling >= 0xffff )
+          return Status( stError, errNoMoreFreeSIDs );
+      }
+      while( !pSIDCeiling.compare_exchange_weak( ceiling, ceiling + 1,
+                                                 std::memory_order_relaxed ) );
+      allocSID = ceiling;
     }
 
+    GetSlot( allocSID ).state.store( SlotInUse, std::memory_order_release );
+    pAllocated.fetch_add( 1, std::memory_order_relaxed );
+
     memcpy( sid, &allocSID, 2 );
     return Status();
   }
@@ -56,10 +126,18 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   void SIDManager::ReleaseSID( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t relSID = 0;
     memcpy( &relSID, sid, 2 );
-    pFreeSIDs.push_back( relSID );
+    Slot *slot = FindSlot( relSID );
+    if( !slot ) return;
+
+    uint8_t prev = slot->state.exchange( SlotFree, std::memory_order_acq_rel );
+    if( prev == SlotFree ) return;
+    if( prev == SlotTimedOut )
+      pTimedOut.fetch_sub( 1, std::memory_order_relaxed );
+    else
+      pAllocated.fetch_sub( 1, std::memory_order_relaxed );
+    Push( relSID );
   }
 
   //----------------------------------------------------------------------------
@@ -67,10 +145,18 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   void SIDManager::TimeOutSID( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    pTimeOutSIDs.insert( tiSID );
+    Slot *slot = FindSlot( tiSID );
+    if( !slot ) return;
+
+    uint8_t expected = SlotInUse;
+    if( slot->state.compare_exchange_strong( expected, SlotTimedOut,
+                                             std::memory_order_acq_rel ) )
+    {
+      pAllocated.fetch_sub( 1, std::memory_order_relaxed );
+      pTimedOut.fetch_add( 1, std::memory_order_relaxed );
+    }
   }
 
   //----------------------------------------------------------------------------
@@ -78,13 +164,11 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   bool SIDManager::IsTimedOut( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    std::set<uint16_t>::iterator it = pTimeOutSIDs.find( tiSID );
-    if( it != pTimeOutSIDs.end() )
-      return true;
-    return false;
+    Slot *slot = FindSlot( tiSID );
+    return slot &&
+           slot->state.load( std::memory_order_acquire ) == SlotTimedOut;
   }
 
   //----------------------------------------------------------------------------
@@ -92,11 +176,18 @@ namespace XrdCl
   //-----------------------------------------------------------------------------
   void SIDManager::ReleaseTimedOut( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    pTimeOutSIDs.erase( tiSID );
-    pFreeSIDs.push_back( tiSID );
+    Slot *slot = FindSlot( tiSID );
+    if( !slot ) return;
+
+    uint8_t expected = SlotTimedOut;
+    if( slot->state.compare_exchange_strong( expected, SlotFree,
+                                             std::memory_order_acq_rel ) )
+    {
+      pTimedOut.fetch_sub( 1, std::memory_order_relaxed );
+      Push( tiSID );
+    }
   }
 
   //------------------------------------------------------------------------
@@ -104,11 +195,17 @@ namespace XrdCl
   //------------------------------------------------------------------------
   void SIDManager::ReleaseAllTimedOut()
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-    std::set<uint16_t>::iterator it;
-    for( it = pTimeOutSIDs.begin(); it != pTimeOutSIDs.end(); ++it )
-      pFreeSIDs.push_back( *it );
-    pTimeOutSIDs.clear();
+    if( !pTimedOut.load( std::memory_order_relaxed ) )
+      return;
+
+    uint32_t ceiling = pSIDCeiling.load( std::memory_order_relaxed );
+    for( uint32_t i = 1; i < ceiling; ++i )
+    {
+      uint8_t sid[2];
+      uint16_t tiSID = i;
+      memcpy( sid, &tiSID, 2 );
+      ReleaseTimedOut( sid );
+    }
   }
 
   //----------------------------------------------------------------------------
@@ -116,8 +213,7 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   uint16_t SIDManager::GetNumberOfAllocatedSIDs() const
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-    return pSIDCeiling - pFreeSIDs.size() - pTimeOutSIDs.size() - 1;
+    return pAllocated.load( std::memory_order_relaxed );
   }
 
   //----------------------------------------------------------------------------
@@ -19,8 +19,7 @@
 #ifndef __XRD_CL_SID_MANAGER_HH__
 #define __XRD_CL_SID_MANAGER_HH__
 
-#include <list>
-#include <set>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -38,6 +37,11 @@ namespace XrdCl
 
   //----------------------------------------------------------------------------
   //! Handle XRootD stream IDs
+  //!
+  //! The state of every SID is kept in a slot of a table indexed by the SID
+  //! and the free SIDs are linked through the slots into a lock-free stack,
+  //! so allocating and releasing a SID never blocks. The table is split in
+  //! pages allocated when the SIDs in them are first handed out.
   //----------------------------------------------------------------------------
   class SIDManager
   {
@@ -48,7 +52,12 @@ namespace XrdCl
       //------------------------------------------------------------------------
       //! Constructor
       //------------------------------------------------------------------------
-      SIDManager(): pSIDCeiling(1), pRefCount(0) { }
+      SIDManager(): pFreeHead(0), pSIDCeiling(1), pAllocated(0),
+                    pTimedOut(0), pRefCount(0)
+      {
+        for( uint32_t i = 0; i < NumPages; ++i )
+          pPages[i].store( 0, std::memory_order_relaxed );
+      }
 
 #if __cplusplus < 201103L
     //------------------------------------------------------------------------
@@ -61,7 +70,11 @@ namespace XrdCl
       //------------------------------------------------------------------------
       //! Destructor
       //------------------------------------------------------------------------
-      ~SIDManager() { }
+      ~SIDManager()
+      {
+        for( uint32_t i = 0; i < NumPages; ++i )
+          delete pPages[i].load( std::memory_order_relaxed );
+      }
 
     public:
 
@@ -103,8 +116,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       uint32_t NumberOfTimedOutSIDs() const
       {
-        XrdSysMutexHelper scopedLock( pMutex );
-        return pTimeOutSIDs.size();
+        return pTimedOut.load( std::memory_order_relaxed );
       }
 
       //------------------------------------------------------------------------
@@ -113,11 +125,51 @@ namespace XrdCl
       uint16_t GetNumberOfAllocatedSIDs() const;
 
     private:
-      std::list<uint16_t>  pFreeSIDs;
-      std::set<uint16_t>   pTimeOutSIDs;
-      uint16_t             pSIDCeiling;
-      mutable XrdSysMutex  pMutex;
-      mutable size_t       pRefCount;
+
+      enum SlotState
+      {
+        SlotFree     = 0,
+        SlotInUse    = 1,
+        SlotTimedOut = 2
+      };
+
+      struct Slot
+      {
+        std::atomic<uint16_t> next;   //!< next free SID if on the free stack
+        std::atomic<uint8_t>  state;  //!< one of SlotState
+      };
+
+      static const uint32_t PageSize = 256;
+      static const uint32_t NumPages = 65536 / PageSize;
+
+      struct Page
+      {
+        Slot slots[PageSize];
+      };
+
+      //------------------------------------------------------------------------
+      //! Get the slot of a SID, allocate the page if needed
+      //------------------------------------------------------------------------
+      Slot &GetSlot( uint16_t sid );
+
+      //------------------------------------------------------------------------
+      //! Get the slot of a SID if its page exists
+      //------------------------------------------------------------------------
+      Slot *FindSlot( uint16_t sid ) const;
+
+      //------------------------------------------------------------------------
+      //! Push / pop a SID on / off the free stack
+      //------------------------------------------------------------------------
+      void     Push( uint16_t sid );
+      uint16_t Pop();
+
+      std::atomic<Page*>     pPages[NumPages];
+      std::atomic<uint64_t>  pFreeHead;   //!< ABA tag << 16 | top SID (0: empty)
+      std::atomic<uint32_t>  pSIDCeiling;
+      std::atomic<uint32_t>  pAllocated;
+      std::atomic<uint32_t>  pTimedOut;
+      mutable XrdSysMutex    pMutex;      //!< protects the reference counter
+      mutable size_t         pRefCount;
   };
 
   //----------------------------------------------------------------------------
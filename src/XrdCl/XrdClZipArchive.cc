@@ -36,6 +36,15 @@ namespace XrdCl
 
   using namespace XrdZip;
 
+  namespace
+  {
+    //-------------------------------------------------------------------------
+    // Bounds of a chunk of compressed data read in order to inflate a request
+    //-------------------------------------------------------------------------
+    static const uint64_t InflateChunkMin = 64 * 1024;
+    static const uint64_t InflateChunkMax = 16 * 1024 * 1024;
+  }
+
   //---------------------------------------------------------------------------
   // Constructor
   //---------------------------------------------------------------------------
@@ -72,6 +81,7 @@ namespace XrdCl
                              if( st.IsOK() )
                              {
                                archsize  = info.GetSize();
+                               archloc   = URL( url ).GetLocation();
                                openstage = NotParsed;
                                log->Debug( ZipMsg, "[0x%x] Opened (only) a ZIP archive (%s).",
                                            this, url.c_str() );
@@ -113,6 +123,7 @@ namespace XrdCl
                                  if( !status.IsOK() ) return;
 
                                  archsize = info.GetSize();
+                                 archloc  = URL( url ).GetLocation();
                                  // if it is an empty file (possibly a new file) there's nothing more to do
                                  if( archsize == 0 )
                                  {
@@ -417,6 +428,13 @@ namespace XrdCl
   {
     Log *log = DefaultEnv::GetLog();
 
+    //-------------------------------------------------------------------------
+    // Keep the seek points of the compressed files we have read for the
+    // next readers (if configured)
+    //-------------------------------------------------------------------------
+    for( auto &itr : zipcache )
+      itr.second.SaveIndex();
+
     //-------------------------------------------------------------------------
     // If the file was updated, we need to write the Central Directory before
     // closing the file.
@@ -526,82 +544,52 @@ namespace XrdCl
       // if the entry does not exist, it will be created using
       // default constructor
       ZipCache &cache = zipcache[fn];
+      // pick up the seek points recorded by the previous readers
+      if( empty )
+        cache.LoadIndex( archloc + '\n' + fn, cdfh->ZCRC32, filesize,
+                         cdfh->uncompressedSize );
+
+      // set up the request, the cache resumes inflating from the closest
+      // seek point preceding the requested offset
+      XRootDStatus st = cache.Output( usrbuff, size, relativeOffset );
+      if( !st.IsOK() ) return st;
+
+      uint32_t bytesRead = 0;
+      st = cache.Read( bytesRead );
+      // propagate errors to the end-user
+      if( !st.IsOK() ) return st;
+
       // if we have the whole ZIP archive we can populate the cache
       // straight away
-      if( empty && buffer)
+      while( buffer && st.code != suDone )
       {
-        XRootDStatus st = cache.Input( buffer.get() + offset, filesize - fileoff, relativeOffset );
+        uint64_t rawOffset = cache.NextChunkOffset();
+        if( rawOffset >= filesize )
+          return XRootDStatus( stError, errDataError, 0,
+                               "The compressed data are truncated." );
+        uint64_t chunkSize = std::min( filesize - rawOffset, InflateChunkMax );
+        st = cache.Input( buffer.get() + fileoff + rawOffset, chunkSize, rawOffset );
+        if( !st.IsOK() ) return st;
+        st = cache.Read( bytesRead );
         if( !st.IsOK() ) return st;
       }
 
-      XRootDStatus st = cache.Output( usrbuff, size, relativeOffset );
-
-      // read from cache
-      if( !empty || buffer )
+      // we have all the data ...
+      if( st.code == suDone )
       {
-        uint32_t bytesRead = 0;
-        st = cache.Read( bytesRead );
-        // propagate errors to the end-user
-        if( !st.IsOK() ) return st;
-        log->Dump( ZipMsg, "[0x%x] Read %d bytes from ZipCache.", this, bytesRead );
-        // we have all the data ...
-        if( st.code == suDone )
+        log->Dump( ZipMsg, "[0x%x] Read %d bytes from ZipCache.", this, size );
+        if( usrHandler )
         {
-          if( usrHandler )
-          {
-            XRootDStatus *st = make_status();
-            ChunkInfo    *ch = new ChunkInfo( relativeOffset, size, usrbuff );
-            Schedule( usrHandler, st, ch );
-          }
-          return XRootDStatus();
+          XRootDStatus *st = make_status();
+          ChunkInfo    *ch = new ChunkInfo( relativeOffset, size, usrbuff );
+          Schedule( usrHandler, st, ch );
         }
+        return XRootDStatus();
       }
 
-      // the raw offset of the next chunk within the file
-      uint64_t rawOffset = cache.NextChunkOffset();
-      // if this is the first time we are setting an input chunk
-      // use the user-specified offset
-      if( !rawOffset )
-        rawOffset = relativeOffset;
-      // size of the next chunk of raw (compressed) data
-      uint32_t chunkSize = size;
-      // make sure we are not reading passed the end of the file
-      if( rawOffset + chunkSize > filesize )
-        chunkSize = filesize - rawOffset;
-      // allocate the buffer for the compressed data
-      buffer.reset( new char[chunkSize] );
-      Fwd<ChunkInfo> chunk;
-      Pipeline p = XrdCl::Read( archive, fileoff + rawOffset, chunkSize, buffer.get() ) >>
-                     [=, &cache]( XRootDStatus &st, ChunkInfo &ch )
-                     {
-                       if( !st.IsOK() ) return;
-                       log->Dump( ZipMsg, "[0x%x] Read %d bytes of remote data at offset %d.",
-                                          this, ch.length, ch.offset );
-
-                       st = cache.Input( ch.buffer, ch.length, rawOffset );
-                       if( !st.IsOK() ) Pipeline::Stop( st );
-
-                       // at this point we can be sure that all the needed data are in the cache
-                       // (we requested as much data as the user asked for so in the worst case
-                       // we have exactly as much data as the user needs, most likely we have
-                       // more because the data are compressed)
-                       uint32_t bytesRead = 0;
-                       st = cache.Read( bytesRead );
-                       if( !st.IsOK() ) Pipeline::Stop( st );
-
-                       // forward server response to the final operation
-                       chunk->buffer = usrbuff;
-                       chunk->length = size;
-                       chunk->offset = relativeOffset;
-                     }
-                 | XrdCl::Final( [=]( const XRootDStatus &st ) mutable
-                     {
-                       buffer.reset();
-                       AnyObject *rsp = nullptr;
-                       if( st.IsOK() ) rsp = PkgRsp( new ChunkInfo( *chunk ) );
-                       if( usrHandler ) usrHandler->HandleResponse( make_status( st ), rsp );
-                     } );
-      Async( std::move( p ), timeout );
+      // otherwise fetch the compressed data
+      InflateFrom( cache, fileoff, filesize, cdfh->uncompressedSize, relativeOffset,
+                   size, usrbuff, usrHandler, timeout );
       return XRootDStatus();
     }
 
@@ -641,6 +629,84 @@ namespace XrdCl
     return XRootDStatus();
   }
 
+  //---------------------------------------------------------------------------
+  // Read compressed data and inflate them until the request is complete
+  //---------------------------------------------------------------------------
+  void ZipArchive::InflateFrom( ZipCache        &cache,
+                                uint64_t         fileoff,
+                                uint64_t         filesize,
+                                uint64_t         usize,
+                                uint64_t         offset,
+                                uint32_t         size,
+                                void            *usrbuff,
+                                ResponseHandler *usrHandler,
+                                uint16_t         timeout )
+  {
+    Log *log = DefaultEnv::GetLog();
+
+    // the raw offset of the next chunk within the file
+    uint64_t rawOffset = cache.NextChunkOffset();
+    if( rawOffset >= filesize )
+    {
+      if( usrHandler )
+      {
+        XRootDStatus *st = make_status( XRootDStatus( stError, errDataError, 0,
+                                        "The compressed data are truncated." ) );
+        Schedule( usrHandler, st, (ChunkInfo*)nullptr );
+      }
+      return;
+    }
+
+    // size of the next chunk of raw (compressed) data, estimated from the
+    // compression ratio of the file (if it is not enough we will come back),
+    // the product of the two sizes may not fit in 64 bits so clamp first
+    long double estimate = usize ? (long double)cache.Remaining() * filesize / usize : 0;
+    estimate += 4096;
+    uint64_t chunkSize = estimate < InflateChunkMax ? uint64_t( estimate )
+                                                    : InflateChunkMax;
+    if( chunkSize < InflateChunkMin ) chunkSize = InflateChunkMin;
+    // make sure we are not reading passed the end of the file
+    if( rawOffset + chunkSize > filesize )
+      chunkSize = filesize - rawOffset;
+
+    // allocate the buffer for the compressed data, the cache keeps
+    // a copy of the data it did not consume
+    std::shared_ptr<char> rawbuff( new char[chunkSize], std::default_delete<char[]>() );
+    Pipeline p = XrdCl::Read( archive, fileoff + rawOffset, chunkSize, rawbuff.get() ) >>
+                   [=, &cache]( XRootDStatus &st, ChunkInfo &ch )
+                   {
+                     if( !st.IsOK() ) return;
+                     log->Dump( ZipMsg, "[0x%x] Read %d bytes of remote data at offset %d.",
+                                        this, ch.length, ch.offset );
+                     // the archive ends before the compressed data do
+                     if( !ch.length )
+                       Pipeline::Stop( XRootDStatus( stError, errDataError, 0,
+                                       "The compressed data are truncated." ) );
+
+                     st = cache.Input( ch.buffer, ch.length, rawOffset );
+                     if( !st.IsOK() ) Pipeline::Stop( st );
+
+                     uint32_t bytesRead = 0;
+                     st = cache.Read( bytesRead );
+                     if( !st.IsOK() ) Pipeline::Stop( st );
+                   }
+               | XrdCl::Final( [=, &cache]( const XRootDStatus &st ) mutable
+                   {
+                     rawbuff.reset();
+                     // we need more compressed data
+                     if( st.IsOK() && !cache.Done() )
+                     {
+                       InflateFrom( cache, fileoff, filesize, usize, offset,
+                                    size, usrbuff, usrHandler, timeout );
+                       return;
+                     }
+                     AnyObject *rsp = nullptr;
+                     if( st.IsOK() ) rsp = PkgRsp( new ChunkInfo( offset, size, usrbuff ) );
+                     if( usrHandler ) usrHandler->HandleResponse( make_status( st ), rsp );
+                   } );
+    Async( std::move( p ), timeout );
+  }
+
   //---------------------------------------------------------------------------
   // List files in the ZIP archive
   //---------------------------------------------------------------------------
@@ -297,6 +297,30 @@ namespace XrdCl
                               ResponseHandler       *handler,
                               uint16_t               timeout );
 
+      //-----------------------------------------------------------------------
+      //! Read compressed data from the archive and inflate them until the
+      //! read request set up in the cache is complete
+      //!
+      //! @param cache      : the inflating cache of the file
+      //! @param fileoff    : offset of the compressed file in the archive
+      //! @param filesize   : size of the compressed file
+      //! @param usize      : size of the uncompressed file
+      //! @param offset     : offset of the request in the uncompressed file
+      //! @param size       : size of the request
+      //! @param usrbuff    : the buffer for the data
+      //! @param usrHandler : user callback
+      //! @param timeout    : operation timeout
+      //-----------------------------------------------------------------------
+      void InflateFrom( ZipCache        &cache,
+                        uint64_t         fileoff,
+                        uint64_t         filesize,
+                        uint64_t         usize,
+                        uint64_t         offset,
+                        uint32_t         size,
+                        void            *usrbuff,
+                        ResponseHandler *usrHandler,
+                        uint16_t         timeout );
+
       //-----------------------------------------------------------------------
       //! Open the ZIP archive in read-only mode without parsing the central
       //! directory.
@@ -423,6 +447,7 @@ namespace XrdCl
         cdvec.clear();
         cdmap.clear();
         zip64eocd.reset();
+        zipcache.clear();
         openstage = None;
       }
 
@@ -447,6 +472,7 @@ namespace XrdCl
       typedef std::unordered_map<std::string, ZipCache> zipcache_t;
 
       File                        archive;   //> File object for handling the ZIP archive
+      std::string                 archloc;   //> location of the ZIP archive (names the ZIP indexes)
       uint64_t                    archsize;  //> size of the ZIP archive
       bool                        cdexists;  //> true if Central Directory exists, false otherwise
       bool                        updated;   //> true if the ZIP archive has been updated, false otherwise
@@ -0,0 +1,421 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// This file is part of the XRootD software suite.
+//
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//
+// In applying this licence, CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClZipCache.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClLog.hh"
+
+#include <algorithm>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace
+{
+  //---------------------------------------------------------------------------
+  // Stored index layout (native byte order, the index is a local cache):
+  //   magic, crc32, compressed size, uncompressed size, number of points,
+  //   then for each point: in, out, bits, window size, window crc32, window
+  //---------------------------------------------------------------------------
+  const char IndexMagic[8] = { 'X', 'R', 'D', 'Z', 'I', 'D', 'X', '1' };
+
+  template<typename T>
+  inline bool Get( FILE *f, T &value )
+  {
+    return fread( &value, sizeof( T ), 1, f ) == 1;
+  }
+
+  template<typename T>
+  inline bool Put( FILE *f, const T &value )
+  {
+    return fwrite( &value, sizeof( T ), 1, f ) == 1;
+  }
+
+  inline uint32_t Checksum( const std::string &window )
+  {
+    return ::crc32( 0, (const Bytef*)window.data(), window.size() );
+  }
+}
+
+namespace XrdCl
+{
+  //---------------------------------------------------------------------------
+  // Constructor
+  //---------------------------------------------------------------------------
+  ZipCache::ZipCache() : inPos( 0 ), inOffset( 0 ), primeBits( 0 ), totalOut( 0 ),
+                         streamEnd( false ), window( WindowSize ), reqBuff( 0 ),
+                         reqOffset( 0 ), reqSize( 0 ), reqDone( 0 ), saved( 0 ),
+                         fileCrc32( 0 ), fileCSize( 0 ), fileUSize( 0 )
+  {
+    strm.zalloc   = Z_NULL;
+    strm.zfree    = Z_NULL;
+    strm.opaque   = Z_NULL;
+    strm.avail_in = 0;
+    strm.next_in  = Z_NULL;
+
+    // make sure zlib doesn't look for gzip headers, in order to do so
+    // pass negative window bits !!!
+    int rc = inflateInit2( &strm, -MAX_WBITS );
+    XrdCl::XRootDStatus st = ToXRootDStatus( rc, "inflateInit2" );
+    if( !st.IsOK() ) throw ZipError( st );
+
+    int mib = DefaultZipIndexSpacing;
+    DefaultEnv::GetEnv()->GetInt( "ZipIndexSpacing", mib );
+    spacing = mib > 0 ? uint64_t( mib ) << 20 : 0;
+  }
+
+  //---------------------------------------------------------------------------
+  // Destructor
+  //---------------------------------------------------------------------------
+  ZipCache::~ZipCache()
+  {
+    inflateEnd( &strm );
+  }
+
+  //---------------------------------------------------------------------------
+  // Add compressed data
+  //---------------------------------------------------------------------------
+  XrdCl::XRootDStatus ZipCache::Input( const void *inbuff, size_t insize, uint64_t rawoff )
+  {
+    // the input has to be contiguous
+    if( rawoff != NextChunkOffset() )
+      return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errInternal );
+
+    // drop what has been inflated already
+    input.erase( input.begin(), input.begin() + inPos );
+    inOffset += inPos;
+    inPos     = 0;
+
+    const char *buff = reinterpret_cast<const char*>( inbuff );
+    input.insert( input.end(), buff, buff + insize );
+    return XrdCl::XRootDStatus();
+  }
+
+  //---------------------------------------------------------------------------
+  // Set up a read request
+  //---------------------------------------------------------------------------
+  XrdCl::XRootDStatus ZipCache::Output( void *outbuff, size_t outsize, uint64_t offset )
+  {
+    reqBuff   = reinterpret_cast<char*>( outbuff );
+    reqOffset = offset;
+    reqSize   = outsize;
+    reqDone   = 0;
+    if( !outsize ) return XrdCl::XRootDStatus();
+
+    // the beginning of the request is still in the window (typically a
+    // sequential read), take it from there and carry on inflating
+    uint64_t winStart = totalOut > WindowSize ? totalOut - WindowSize : 0;
+    if( offset >= winStart && offset <= totalOut )
+    {
+      Deliver( offset, totalOut - offset );
+      return XrdCl::XRootDStatus();
+    }
+
+    // find the closest seek point preceding the requested offset
+    auto itr = std::upper_bound( index.begin(), index.end(), offset,
+                                 []( uint64_t off, const SeekPoint &point )
+                                 {
+                                   return off < point.out;
+                                 } );
+    const SeekPoint *point = itr == index.begin() ? nullptr : &*( itr - 1 );
+
+    // carry on if the stream is ahead of the closest seek point
+    if( offset > totalOut && ( !point || point->out <= totalOut ) )
+      return XrdCl::XRootDStatus();
+
+    return Reset( point );
+  }
+
+  //---------------------------------------------------------------------------
+  // Inflate the available input
+  //---------------------------------------------------------------------------
+  XrdCl::XRootDStatus ZipCache::Read( uint32_t &bytesRead )
+  {
+    uint32_t before = reqDone;
+
+    while( reqDone < reqSize )
+    {
+      if( streamEnd )
+        return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errDataError, Z_DATA_ERROR,
+                                    "[zlib] inflate : unexpected end of stream." );
+
+      size_t avail = input.size() - inPos;
+
+      // resuming from a seek point in the middle of a byte
+      if( primeBits && avail )
+      {
+        unsigned char ch = input[inPos];
+        int rc = inflatePrime( &strm, primeBits, ch >> ( 8 - primeBits ) );
+        XrdCl::XRootDStatus st = ToXRootDStatus( rc, "inflatePrime" );
+        if( !st.IsOK() ) return st;
+        ++inPos;
+        --avail;
+        primeBits = 0;
+      }
+
+      if( !avail ) break;
+
+      // inflate into the window, stopping at the beginning and at the end
+      // of the request so that the stream is left exactly where the next
+      // sequential read starts
+      uint32_t pos    = totalOut % WindowSize;
+      uint64_t target = totalOut < reqOffset ? reqOffset : reqOffset + reqSize;
+      uint32_t room   = std::min<uint64_t>( WindowSize - pos, target - totalOut );
+      uInt     inlen  = std::min<size_t>( avail, UINT32_MAX );
+
+      strm.next_in   = (Bytef*)input.data() + inPos;
+      strm.avail_in  = inlen;
+      strm.next_out  = (Bytef*)window.data() + pos;
+      strm.avail_out = room;
+
+      int rc = inflate( &strm, Z_BLOCK );
+      if( rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR )
+        return ToXRootDStatus( rc, "inflate" );
+
+      uint32_t consumed = inlen - strm.avail_in;
+      uint32_t produced = room - strm.avail_out;
+      inPos += consumed;
+      Deliver( totalOut, produced );
+      totalOut += produced;
+
+      if( rc == Z_STREAM_END )
+        streamEnd = true;
+      else
+        AddSeekPoint();
+
+      if( !consumed && !produced ) break;
+    }
+
+    bytesRead = reqDone - before;
+    if( reqDone == reqSize ) return XrdCl::XRootDStatus();
+    return XrdCl::XRootDStatus( XrdCl::stOK, XrdCl::suContinue );
+  }
+
+  //---------------------------------------------------------------------------
+  // Load the seek points from the index directory
+  //---------------------------------------------------------------------------
+  void ZipCache::LoadIndex( const std::string &key, uint32_t crc32,
+                            uint64_t csize, uint64_t usize )
+  {
+    std::string dir = DefaultZipIndexDir;
+    DefaultEnv::GetEnv()->GetString( "ZipIndexDir", dir );
+    if( dir.empty() || !spacing ) return;
+
+    fileCrc32 = crc32;
+    fileCSize = csize;
+    fileUSize = usize;
+
+    // the name of the index is derived from the archive and the file name
+    const Bytef *kptr = (const Bytef*)key.data();
+    char name[32];
+    snprintf( name, sizeof( name ), "/%08lx%08lx.zidx",
+              ::crc32( 0, kptr, key.size() ), ::adler32( 1, kptr, key.size() ) );
+    indexPath = dir + name;
+
+    FILE *f = fopen( indexPath.c_str(), "rb" );
+    if( !f ) return;
+
+    char     magic[sizeof( IndexMagic )];
+    uint32_t fcrc, count;
+    uint64_t fcsize, fusize;
+    bool ok = fread( magic, sizeof( magic ), 1, f ) == 1 &&
+              !memcmp( magic, IndexMagic, sizeof( magic ) ) &&
+              Get( f, fcrc ) && Get( f, fcsize ) && Get( f, fusize ) &&
+              Get( f, count ) &&
+              fcrc == crc32 && fcsize == csize && fusize == usize;
+
+    std::vector<SeekPoint> points;
+    for( uint32_t i = 0; ok && i < count; ++i )
+    {
+      SeekPoint point;
+      int32_t   bits;
+      uint32_t  wsize, wcrc;
+      ok = Get( f, point.in ) && Get( f, point.out ) && Get( f, bits ) &&
+           Get( f, wsize ) && Get( f, wcrc ) && bits >= 0 && bits < 8 && wsize <= WindowSize &&
+           point.in <= csize && point.out <= usize &&
+           ( points.empty() || point.out > points.back().out );
+      if( !ok ) break;
+      point.bits = bits;
+      point.window.resize( wsize );
+      ok = !wsize || fread( &point.window[0], wsize, 1, f ) == 1;
+      // a corrupted window would silently yield wrong data
+      ok = ok && wcrc == Checksum( point.window );
+      if( ok ) points.push_back( std::move( point ) );
+    }
+    fclose( f );
+
+    Log *log = DefaultEnv::GetLog();
+    if( !ok )
+    {
+      log->Debug( ZipMsg, "Ignoring invalid ZIP index %s.", indexPath.c_str() );
+      return;
+    }
+
+    index.swap( points );
+    saved = index.size();
+    log->Dump( ZipMsg, "Loaded %d seek points from ZIP index %s.", (int)saved,
+               indexPath.c_str() );
+  }
+
+  //---------------------------------------------------------------------------
+  // Store the seek points in the index directory
+  //---------------------------------------------------------------------------
+  void ZipCache::SaveIndex()
+  {
+    if( indexPath.empty() || index.size() <= saved ) return;
+
+    // write a temporary file and rename it so readers never see a partial
+    // index
+    Log *log = DefaultEnv::GetLog();
+    std::string tmp = indexPath + ".tmp." + std::to_string( getpid() );
+    FILE *f = fopen( tmp.c_str(), "wb" );
+    if( !f )
+    {
+      log->Debug( ZipMsg, "Unable to store ZIP index %s: %s", tmp.c_str(),
+                  strerror( errno ) );
+      return;
+    }
+
+    uint32_t count = index.size();
+    bool ok = fwrite( IndexMagic, sizeof( IndexMagic ), 1, f ) == 1 &&
+              Put( f, fileCrc32 ) && Put( f, fileCSize ) && Put( f, fileUSize ) &&
+              Put( f, count );
+    for( size_t i = 0; ok && i < index.size(); ++i )
+    {
+      const SeekPoint &point = index[i];
+      int32_t  bits  = point.bits;
+      uint32_t wsize = point.window.size();
+      uint32_t wcrc  = Checksum( point.window );
+      ok = Put( f, point.in ) && Put( f, point.out ) && Put( f, bits ) &&
+           Put( f, wsize ) && Put( f, wcrc ) &&
+           ( !wsize || fwrite( point.window.data(), wsize, 1, f ) == 1 );
+    }
+    if( fclose( f ) ) ok = false;
+
+    if( !ok || rename( tmp.c_str(), indexPath.c_str() ) )
+    {
+      log->Debug( ZipMsg, "Unable to store ZIP index %s: %s", indexPath.c_str(),
+                  strerror( errno ) );
+      unlink( tmp.c_str() );
+      return;
+    }
+
+    saved = index.size();
+    log->Dump( ZipMsg, "Stored %d seek points in ZIP index %s.", (int)saved,
+               indexPath.c_str() );
+  }
+
+  //---------------------------------------------------------------------------
+  // Restart inflating at a seek point (or at the beginning)
+  //---------------------------------------------------------------------------
+  XrdCl::XRootDStatus ZipCache::Reset( const SeekPoint *point )
+  {
+    int rc = inflateReset( &strm );
+    XrdCl::XRootDStatus st = ToXRootDStatus( rc, "inflateReset" );
+    if( !st.IsOK() ) return st;
+
+    input.clear();
+    inPos     = 0;
+    streamEnd = false;
+
+    if( !point )
+    {
+      inOffset  = 0;
+      primeBits = 0;
+      totalOut  = 0;
+      return XrdCl::XRootDStatus();
+    }
+
+    // the byte preceding the seek point is needed if some of its bits
+    // have not been used yet
+    inOffset  = point->in - ( point->bits ? 1 : 0 );
+    primeBits = point->bits;
+    totalOut  = point->out;
+
+    const std::string &win = point->window;
+    rc = inflateSetDictionary( &strm, (const Bytef*)win.data(), win.size() );
+    st = ToXRootDStatus( rc, "inflateSetDictionary" );
+    if( !st.IsOK() ) return st;
+
+    // restore our window as well, the output preceding the seek point can
+    // be served from it
+    uint64_t start = totalOut - win.size();
+    for( size_t i = 0; i < win.size(); )
+    {
+      uint32_t pos = ( start + i ) % WindowSize;
+      size_t   len = std::min<size_t>( win.size() - i, WindowSize - pos );
+      memcpy( window.data() + pos, win.data() + i, len );
+      i += len;
+    }
+    return XrdCl::XRootDStatus();
+  }
+
+  //---------------------------------------------------------------------------
+  // Record a seek point if we are at a block boundary and far enough from
+  // the last one
+  //---------------------------------------------------------------------------
+  void ZipCache::AddSeekPoint()
+  {
+    if( !spacing ) return;
+    if( !( strm.data_type & 128 ) || ( strm.data_type & 64 ) ) return;
+    uint64_t last = index.empty() ? 0 : index.back().out;
+    if( totalOut < last + spacing ) return;
+
+    SeekPoint point;
+    point.in   = inOffset + inPos;
+    point.out  = totalOut;
+    point.bits = strm.data_type & 7;
+
+    uint32_t wsize = std::min<uint64_t>( totalOut, WindowSize );
+    point.window.resize( wsize );
+    uint64_t start = totalOut - wsize;
+    for( uint32_t i = 0; i < wsize; )
+    {
+      uint32_t pos = ( start + i ) % WindowSize;
+      uint32_t len = std::min( wsize - i, WindowSize - pos );
+      memcpy( &point.window[i], window.data() + pos, len );
+      i += len;
+    }
+    index.push_back( std::move( point ) );
+  }
+
+  //---------------------------------------------------------------------------
+  // Copy the part of freshly inflated data (still in the window) that falls
+  // into the request to the user buffer
+  //---------------------------------------------------------------------------
+  void ZipCache::Deliver( uint64_t outoff, uint32_t size )
+  {
+    uint64_t begin = std::max( outoff, reqOffset + reqDone );
+    uint64_t end   = std::min( outoff + size, reqOffset + reqSize );
+    while( begin < end )
+    {
+      uint32_t pos = begin % WindowSize;
+      uint32_t len = std::min<uint64_t>( end - begin, WindowSize - pos );
+      memcpy( reqBuff + ( begin - reqOffset ), window.data() + pos, len );
+      begin   += len;
+      reqDone += len;
+    }
+  }
+}
@@ -12,6 +12,7 @@
 #include <zlib.h>
 #include <exception>
 #include <string>
+#include <vector>
 
 namespace XrdCl
 {
@@ -29,79 +30,113 @@ namespace XrdCl
 
   //---------------------------------------------------------------------------
   //! Utility class for inflating a compressed buffer
+  //!
+  //! The data are inflated through a window holding the last 32KiB of the
+  //! output. While inflating, a seek point (the position in both streams,
+  //! the bit offset and the window) is recorded at a deflate block boundary
+  //! every XRD_ZIPINDEXSPACING MiB, so that a read at any offset resumes
+  //! from the nearest seek point instead of the beginning of the file. The
+  //! seek points may be kept in XRD_ZIPINDEXDIR to be reused by later
+  //! readers of the same file.
+  //!
+  //! Usage: Output() sets up a read request, then Read() inflates as much
+  //! as the input allows; as long as it returns suContinue more compressed
+  //! data, starting at NextChunkOffset(), have to be passed to Input().
   //---------------------------------------------------------------------------
   class ZipCache
   {
     public:
 
-      ZipCache() : rawOffset( 0 ), rawSize( 0 ), totalRead( 0 )
+      ZipCache();
+
+      ~ZipCache();
+
+      //-----------------------------------------------------------------------
+      //! Add compressed data
+      //!
+      //! @param rawoff : offset of the data in the compressed file, must be
+      //!                 equal to NextChunkOffset()
+      //-----------------------------------------------------------------------
+      XrdCl::XRootDStatus Input( const void *inbuff, size_t insize, uint64_t rawoff );
+
+      //-----------------------------------------------------------------------
+      //! Set up a read request of outsize bytes at the given offset of the
+      //! uncompressed file
+      //-----------------------------------------------------------------------
+      XrdCl::XRootDStatus Output( void *outbuff, size_t outsize, uint64_t offset );
+
+      //-----------------------------------------------------------------------
+      //! Inflate the available input into the output buffer
+      //!
+      //! @param bytesRead : number of bytes added to the output buffer
+      //! @return          : suDone if the request is complete, suContinue if
+      //!                    more input is needed, error otherwise
+      //-----------------------------------------------------------------------
+      XrdCl::XRootDStatus Read( uint32_t &bytesRead );
+
+      //-----------------------------------------------------------------------
+      //! Offset in the compressed file of the next chunk for Input()
+      //-----------------------------------------------------------------------
+      uint64_t NextChunkOffset()
       {
-        strm.zalloc   = Z_NULL;
-        strm.zfree    = Z_NULL;
-        strm.opaque   = Z_NULL;
-        strm.avail_in = 0;
-        strm.next_in  = Z_NULL;
-
-        // make sure zlib doesn't look for gzip headers, in order to do so
-        // pass negative window bits !!!
-        int rc = inflateInit2( &strm, -MAX_WBITS );
-        XrdCl::XRootDStatus st = ToXRootDStatus( rc, "inflateInit2" );
-        if( !st.IsOK() ) throw ZipError( st );
+        return inOffset + input.size();
       }
 
-      ~ZipCache()
+      //-----------------------------------------------------------------------
+      //! Number of bytes the current request still has to inflate, including
+      //! the ones preceding the requested offset
+      //-----------------------------------------------------------------------
+      uint64_t Remaining()
       {
-        inflateEnd( &strm );
+        return reqOffset + reqSize - totalOut;
       }
 
-      XrdCl::XRootDStatus Input( void *inbuff, size_t insize, uint64_t rawoff )
+      //-----------------------------------------------------------------------
+      //! @return : true if the current request is complete
+      //-----------------------------------------------------------------------
+      bool Done()
       {
-        // we only support streaming for compressed files
-        if( rawoff != rawOffset + rawSize )
-          return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errInternal );
-
-        strm.avail_in = insize;
-        strm.next_in  = (Bytef*)inbuff;
-        rawOffset     = rawoff;
-        rawSize       = insize;
-
-        return XrdCl::XRootDStatus();
+        return reqDone == reqSize;
       }
 
-      XrdCl::XRootDStatus Output( void *outbuff, size_t outsize, uint64_t offset )
-      {
-        // we only support streaming for compressed files
-        if( offset != totalRead )
-          return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errInternal );
+      //-----------------------------------------------------------------------
+      //! Load the seek points of a file from the index directory (if any),
+      //! the identity of the file is used to validate the index
+      //!
+      //! @param key   : unique name of the file (archive and file name)
+      //! @param crc32 : CRC32 of the uncompressed file
+      //! @param csize : compressed size
+      //! @param usize : uncompressed size
+      //-----------------------------------------------------------------------
+      void LoadIndex( const std::string &key, uint32_t crc32,
+                      uint64_t csize, uint64_t usize );
+
+      //-----------------------------------------------------------------------
+      //! Store the seek points in the index directory if new ones have been
+      //! recorded since they were loaded
+      //-----------------------------------------------------------------------
+      void SaveIndex();
 
-        strm.avail_out = outsize;
-        strm.next_out  = (Bytef*)outbuff;
-
-        return XrdCl::XRootDStatus();
-      }
+    private:
 
-      XrdCl::XRootDStatus Read( uint32_t &bytesRead )
+      //-----------------------------------------------------------------------
+      //! A position in the deflate stream we can resume inflating from
+      //-----------------------------------------------------------------------
+      struct SeekPoint
       {
-        // the available space in output buffer before inflating
-        uInt avail_before = strm.avail_out;
+        uint64_t    in;     // offset in the compressed data
+        uint64_t    out;    // offset in the uncompressed data
+        int         bits;   // bits of the byte preceding 'in' that are still to be used
+        std::string window; // the 32KiB of output preceding 'out'
+      };
 
-        int rc = inflate( &strm, Z_SYNC_FLUSH );
-        XrdCl::XRootDStatus st = ToXRootDStatus( rc, "inflate" );
-        if( !st.IsOK() ) return st;
+      static const uint32_t WindowSize = 32768;
 
-        bytesRead = avail_before - strm.avail_out;
-        totalRead += bytesRead;
-        if( strm.avail_out ) return XrdCl::XRootDStatus( XrdCl::stOK, XrdCl::suPartial );
+      XrdCl::XRootDStatus Reset( const SeekPoint *point );
 
-        return XrdCl::XRootDStatus();
-      }
-
-      uint64_t NextChunkOffset()
-      {
-        return rawOffset + rawSize;
-      }
+      void AddSeekPoint();
 
-    private:
+      void Deliver( uint64_t outoff, uint32_t size );
 
       XrdCl::XRootDStatus ToXRootDStatus( int rc, const std::string &func )
       {
@@ -121,10 +156,27 @@ namespace XrdCl
         }
       }
 
-      uint64_t  rawOffset; // offset of the raw data chunk in the compressed file (not archive)
-      uint32_t  rawSize;   // size of the raw data chunk
-      uint64_t  totalRead; // total number of bytes read so far
-      z_stream  strm;      // the zlib stream we will use for reading
+      z_stream                strm;      // the zlib stream we will use for reading
+      std::vector<char>       input;     // compressed data not inflated yet
+      size_t                  inPos;     // position of the first unused byte in input
+      uint64_t                inOffset;  // offset of input[0] in the compressed file
+      int                     primeBits; // bits to prime the stream with before inflating
+      uint64_t                totalOut;  // number of bytes inflated so far
+      bool                    streamEnd; // true if the end of the deflate stream was reached
+      std::vector<char>       window;    // circular buffer with the last 32KiB of output
+
+      char                   *reqBuff;   // the user buffer
+      uint64_t                reqOffset; // offset of the request in the uncompressed file
+      uint32_t                reqSize;   // size of the request
+      uint32_t                reqDone;   // number of bytes delivered so far
+
+      uint64_t                spacing;   // distance between seek points (0 - none)
+      std::vector<SeekPoint>  index;     // seek points sorted by output offset
+      size_t                  saved;     // number of seek points in the stored index
+      std::string             indexPath; // the file keeping the index (if any)
+      uint32_t                fileCrc32; // identity of the inflated file
+      uint64_t                fileCSize;
+      uint64_t                fileUSize;
   };
 
 }
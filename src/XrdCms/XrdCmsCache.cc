@@ -29,6 +29,7 @@
 /******************************************************************************/
   
 #include <stdio.h>
+#include <time.h>
 #include <sys/types.h>
 
 #include "XrdCms/XrdCmsCache.hh"
@@ -61,15 +62,16 @@ class XrdCmsCacheJob : XrdJob
 {
 public:
 
-void   DoIt() {Cache.Recycle(myList); delete this;}
+void   DoIt() {Cache.Recycle(myShard, myList); delete this;}
 
-       XrdCmsCacheJob(XrdCmsKeyItem *List)
-                     : XrdJob("cache scrubber"), myList(List) {}
+       XrdCmsCacheJob(int sNum, XrdCmsKeyItem *List)
+                     : XrdJob("cache scrubber"), myList(List), myShard(sNum) {}
       ~XrdCmsCacheJob() {}
 
 private:
 
 XrdCmsKeyItem *myList;
+int            myShard;
 };
 
 /******************************************************************************/
@@ -116,18 +118,22 @@ void *XrdCmsStartTickTock(void *carg)
   
 int XrdCmsCache::AddFile(XrdCmsSelect &Sel, SMask_t mask)
 {
+   Shard &sP = getShard(Sel.Path);
    XrdCmsKeyItem *iP;
    SMask_t xmask;
+   unsigned int curEpoch;
    int isrw = (Sel.Opts & XrdCmsSelect::Write), isnew = 0;
 
 // Serialize processing
 //
-   myMutex.Lock();
+   sP.Lock();
+   curEpoch = Epoch.load(std::memory_order_relaxed);
 
 // Check for fast path processing
 //
-   if (  !(iP = Sel.Path.TODRef) || !(iP->Key.Equiv(Sel.Path)))
-      if ((iP = Sel.Path.TODRef = CTable.Find(Sel.Path)))
+   if (  !(iP = Sel.Path.TODRef) || !(iP->Key.Equiv(Sel.Path))
+   ||  iP->Expired(curEpoch))
+      if ((iP = Sel.Path.TODRef = Find(sP, Sel.Path)))
          Sel.Path.Ref = iP->Key.Ref;
 
 // Add/Modify the entry
@@ -137,8 +143,8 @@ int XrdCmsCache::AddFile(XrdCmsSelect &Sel, SMask_t mask)
           {iP->Loc.deadline = QDelay + time(0);
            iP->Loc.lifeline = nilTMO + iP->Loc.deadline;
            iP->Loc.hfvec = 0; iP->Loc.pfvec = 0; iP->Loc.qfvec = 0;
-           iP->Loc.TOD_B = BClock;
-           iP->Key.TOD = Tock;
+           iP->Loc.TOD_B = sP.BClock;
+           iP->SetEpoch(curEpoch);
           } else {
            xmask = iP->Loc.pfvec;
            if (Sel.Opts & XrdCmsSelect::Pending) iP->Loc.pfvec |= mask;
@@ -155,11 +161,11 @@ int XrdCmsCache::AddFile(XrdCmsSelect &Sel, SMask_t mask)
                      }
           }
       } else if (!(Sel.Opts & XrdCmsSelect::Advisory))
-                {Sel.Path.TOD = Tock;
-                 if ((iP = CTable.Add(Sel.Path)))
-                    {iP->Loc.pfvec    = (Sel.Opts&XrdCmsSelect::Pending?mask:0);
+                {if ((iP = sP.CTable.Add(Sel.Path)))
+                    {iP->SetEpoch(curEpoch);
+                     iP->Loc.pfvec    = (Sel.Opts&XrdCmsSelect::Pending?mask:0);
                      iP->Loc.hfvec    = mask;
-                     iP->Loc.TOD_B    = BClock;
+                     iP->Loc.TOD_B    = sP.BClock;
                      iP->Loc.qfvec    = 0;
                      iP->Loc.deadline = QDelay + time(0);
                      iP->Loc.lifeline = nilTMO + iP->Loc.deadline;
@@ -170,7 +176,7 @@ int XrdCmsCache::AddFile(XrdCmsSelect &Sel, SMask_t mask)
 
 // All done
 //
-   myMutex.UnLock();
+   sP.UnLock();
    return isnew;
 }
   
@@ -190,29 +196,30 @@ int XrdCmsCache::AddFile(XrdCmsSelect &Sel, SMask_t mask)
   
 int XrdCmsCache::DelFile(XrdCmsSelect &Sel, SMask_t mask)
 {
+   Shard &sP = getShard(Sel.Path);
    XrdCmsKeyItem *iP;
    int gone4good;
 
 // Lock the hash table
 //
-   myMutex.Lock();
+   sP.Lock();
 
 // Look up the entry and remove server
 //
-   if ((iP = CTable.Find(Sel.Path)))
+   if ((iP = Find(sP, Sel.Path)))
       {iP->Loc.hfvec &= ~mask;
        iP->Loc.pfvec &= ~mask;
        if ((gone4good = (iP->Loc.hfvec == 0)))
           {if (nilTMO) iP->Loc.lifeline = nilTMO + time(0);
            if (!(Sel.Opts & XrdCmsSelect::Advisory)
-           &&  XrdCmsKeyItem::Unload(iP) && !CTable.Recycle(iP))
+           &&  !sP.CTable.Recycle(iP))
               Say.Emsg("DelFile", "Delete failed for", iP->Key.Val);
           }
       } else gone4good = 0;
 
 // All done
 //
-   myMutex.UnLock();
+   sP.UnLock();
    return gone4good;
 }
   
@@ -231,19 +238,23 @@ int XrdCmsCache::DelFile(XrdCmsSelect &Sel, SMask_t mask)
   
 int  XrdCmsCache::GetFile(XrdCmsSelect &Sel, SMask_t mask)
 {
+   Shard &sP = getShard(Sel.Path);
    XrdCmsKeyItem *iP;
    SMask_t bVec;
+   struct timespec tBeg, tEnd;
    int retc;
 
-// Lock the hash table
+// Lock the hash table. The time spent, including any wait for the lock, is
+// accounted as the lookup latency.
 //
-   myMutex.Lock();
+   clock_gettime(CLOCK_MONOTONIC, &tBeg);
+   sP.Lock();
 
 // Look up the entry and return location information
 //
-   if ((iP = CTable.Find(Sel.Path)))
-      {if ((bVec = (iP->Loc.TOD_B < BClock 
-                 ? getBVec(iP->Key.TOD, iP->Loc.TOD_B) & mask : 0)))
+   if ((iP = Find(sP, Sel.Path)))
+      {if ((bVec = (iP->Loc.TOD_B < sP.BClock
+                 ? getBVec(sP, iP->Key.TOD, iP->Loc.TOD_B) & mask : 0)))
           {iP->Loc.hfvec &= ~bVec; 
            iP->Loc.pfvec &= ~bVec;
            iP->Loc.qfvec &= ~mask;
@@ -258,15 +269,20 @@ int  XrdCmsCache::GetFile(XrdCmsSelect &Sel, SMask_t mask)
        if (nilTMO && retc == 1 && iP->Loc.hfvec == 0
        &&  iP->Loc.lifeline <= time(0)) retc = 0;
 
-       Sel.Vec.hf      = okVec & iP->Loc.hfvec;
-       Sel.Vec.pf      = okVec & iP->Loc.pfvec;
-       Sel.Vec.bf      = okVec & (bVec | iP->Loc.qfvec); iP->Loc.qfvec = 0;
+       Sel.Vec.hf      = sP.okVec & iP->Loc.hfvec;
+       Sel.Vec.pf      = sP.okVec & iP->Loc.pfvec;
+       Sel.Vec.bf      = sP.okVec & (bVec | iP->Loc.qfvec); iP->Loc.qfvec = 0;
        Sel.Path.Ref    = iP->Key.Ref;
+       sP.Hits++;
       } else retc = 0;
 
 // All done
 //
-   myMutex.UnLock();
+   sP.Lookups++;
+   clock_gettime(CLOCK_MONOTONIC, &tEnd);
+   sP.LookupNs += (tEnd.tv_sec - tBeg.tv_sec) * 1000000000LL
+                + (tEnd.tv_nsec - tBeg.tv_nsec);
+   sP.UnLock();
    Sel.Path.TODRef = iP;
    return retc;
 }
@@ -278,23 +294,26 @@ int  XrdCmsCache::GetFile(XrdCmsSelect &Sel, SMask_t mask)
 int XrdCmsCache::UnkFile(XrdCmsSelect &Sel, SMask_t mask)
 {
    EPNAME("UnkFile");
+   Shard &sP = getShard(Sel.Path);
    XrdCmsKeyItem *iP;
 
 // Make sure we have the proper information. If so, lock the hash table
 //
-   myMutex.Lock();
+   sP.Lock();
 
 // Look up the entry and if valid update the unqueried vector. Note that
 // this method may only be called after GetFile() or AddFile() for a new entry
 //
    if ((iP = Sel.Path.TODRef))
-      {if (iP->Key.Equiv(Sel.Path)) iP->Loc.qfvec = mask;
+      {if (iP->Key.Equiv(Sel.Path)
+       &&  !iP->Expired(Epoch.load(std::memory_order_relaxed)))
+          iP->Loc.qfvec = mask;
           else iP = 0;
       }
 
 // Return result
 //
-   myMutex.UnLock();
+   sP.UnLock();
    DEBUG("rc=" <<(iP ? 1 : 0) <<" path=" <<Sel.Path.Val);
    return (iP ? 1 : 0);
 }
@@ -313,12 +332,14 @@ int XrdCmsCache::WT4File(XrdCmsSelect &Sel, SMask_t mask)
 // Make sure we have the proper information. If so, lock the hash table
 //
    if (!Sel.InfoP) return DLTime;
-   myMutex.Lock();
+   Shard &sP = getShard(Sel.Path);
+   sP.Lock();
 
 // Look up the entry and if valid add it to the callback queue. Note that
 // this method may only be called after GetFile() or AddFile() for a new entry
 //
-   if (!(iP = Sel.Path.TODRef) || !(iP->Key.Equiv(Sel.Path))) retc = DLTime;
+   if (!(iP = Sel.Path.TODRef) || !(iP->Key.Equiv(Sel.Path))
+   ||  iP->Expired(Epoch.load(std::memory_order_relaxed)))    retc = DLTime;
       else if (iP->Loc.hfvec != mask)                         retc = 1;
               else {Now = time(0);                            retc = 0;
                     if (iP->Loc.deadline && iP->Loc.deadline <= Now)
@@ -328,7 +349,7 @@ int XrdCmsCache::WT4File(XrdCmsSelect &Sel, SMask_t mask)
 
 // Return result
 //
-   myMutex.UnLock();
+   sP.UnLock();
    DEBUG("rc=" <<retc <<" path=" <<Sel.Path.Val);
    return retc;
 }
@@ -342,14 +363,22 @@ int XrdCmsCache::WT4File(XrdCmsSelect &Sel, SMask_t mask)
 
 void XrdCmsCache::Bounce(SMask_t smask, int SNum)
 {
-
-// Simply indicate that this server bounced
-//
-   myMutex.Lock();
-   Bounced[SNum] = ++BClock;
-   okVec |= smask;
-   if (SNum > vecHi) vecHi = SNum;
-   myMutex.UnLock();
+   unsigned int bClock;
+
+// Simply indicate that this server bounced. Each shard has a copy of the
+// bounce state so this is done for every one of them.
+//
+   admMutex.Lock();
+   bClock = ++BClock;
+   for (int i = 0; i < numShards; i++)
+       {Shard &sP = Shards[i];
+        sP.Lock();
+        sP.Bounced[SNum] = sP.BClock = bClock;
+        sP.okVec |= smask;
+        if (SNum > sP.vecHi) sP.vecHi = SNum;
+        sP.UnLock();
+       }
+   admMutex.UnLock();
 }
 
 /******************************************************************************/
@@ -366,11 +395,16 @@ void XrdCmsCache::Drop(SMask_t smask, int SNum, int xHi)
 
 // Remove the node from the list of valid nodes
 //
-   myMutex.Lock();
-   Bounced[SNum] = 0;
-   okVec &= nmask;
-   vecHi = xHi;
-   myMutex.UnLock();
+   admMutex.Lock();
+   for (int i = 0; i < numShards; i++)
+       {Shard &sP = Shards[i];
+        sP.Lock();
+        sP.Bounced[SNum] = 0;
+        sP.okVec &= nmask;
+        sP.vecHi = xHi;
+        sP.UnLock();
+       }
+   admMutex.UnLock();
 }
 
 /******************************************************************************/
@@ -379,7 +413,6 @@ void XrdCmsCache::Drop(SMask_t smask, int SNum, int xHi)
   
 int XrdCmsCache::Init(int fxHold, int fxDelay, int fxQuery, int seFS, int nxHold)
 {
-   XrdCmsKeyItem *iP;
    pthread_t tid;
 
 // Indicate whether we are a shared-everything setup as this changes how we
@@ -411,15 +444,42 @@ int XrdCmsCache::Init(int fxHold, int fxDelay, int fxQuery, int seFS, int nxHold
 
 // Get the first reserve of cache items
 //
-   iP = XrdCmsKeyItem::Alloc(0);
-   XrdCmsKeyItem::Unload((unsigned int)0);
-   iP->Recycle();
+   for (int i = 0; i < numShards; i++)
+       {Shards[i].Lock();
+        Shards[i].CTable.Replenish();
+        Shards[i].UnLock();
+       }
 
 // All done
 //
    return 1;
 }
 
+/******************************************************************************/
+/* public                     S t a t i s t i c s                             */
+/******************************************************************************/
+
+void XrdCmsCache::Statistics(Info &Data)
+{
+   int numHave, numFree, numNull;
+
+   memset(&Data, 0, sizeof(Data));
+   Data.Shards = numShards;
+
+   for (int i = 0; i < numShards; i++)
+       {Shard &sP = Shards[i];
+        sP.Mutex.Lock();
+        Data.Lookups  += sP.Lookups;
+        Data.Hits     += sP.Hits;
+        Data.LookupNs += sP.LookupNs;
+        Data.Locks    += sP.Locks;
+        Data.Waits    += sP.Waits;
+        sP.CTable.Stats(numHave, numFree, numNull);
+        Data.Items    += numHave - numFree;
+        sP.Mutex.UnLock();
+       }
+}
+
 /******************************************************************************/
 /* public                       T i c k T o c k                               */
 /******************************************************************************/
@@ -427,16 +487,23 @@ int XrdCmsCache::Init(int fxHold, int fxDelay, int fxQuery, int seFS, int nxHold
 void *XrdCmsCache::TickTock()
 {
    XrdCmsKeyItem *iP;
+   unsigned int curEpoch, Tock;
 
-// Simply adjust the clock and trim old entries
+// Simply adjust the clock and trim old entries. Entries are checked for expiry
+// when they are looked up, so the trimming only reclaims the storage of those
+// that were not. Each shard is trimmed under its own lock.
 //
    do {XrdSysTimer::Snooze(Tick);
-       myMutex.Lock();
-       Tock = (Tock+1) & XrdCmsKeyItem::TickMask;
-       Bhistory[Tock].Start = Bhistory[Tock].End = 0;
-       iP = XrdCmsKeyItem::Unload(Tock);
-       myMutex.UnLock();
-       if (iP) Sched->Schedule((XrdJob *)new XrdCmsCacheJob(iP));
+       curEpoch = Epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+       Tock     = curEpoch & XrdCmsKeyItem::TickMask;
+       for (int i = 0; i < numShards; i++)
+           {Shard &sP = Shards[i];
+            sP.Lock();
+            sP.Bhistory[Tock].Start = sP.Bhistory[Tock].End = 0;
+            iP = sP.CTable.Unload(curEpoch);
+            sP.UnLock();
+            if (iP) Sched->Schedule((XrdJob *)new XrdCmsCacheJob(i, iP));
+           }
       } while(1);
 
 // Keep compiler happy
@@ -498,11 +565,29 @@ void XrdCmsCache::Dispatch(XrdCmsSelect &Sel, XrdCmsKeyItem *iP,
       iP->Loc.rwPend = 0;
 }
 
+/******************************************************************************/
+/*                                  F i n d                                   */
+/******************************************************************************/
+
+// The shard lock must be held. Entries that expired are retired on the spot so
+// a lookup never returns stale location information even when the periodic
+// sweep has not yet reached the entry.
+//
+XrdCmsKeyItem *XrdCmsCache::Find(Shard &sP, XrdCmsKey &Key)
+{
+   XrdCmsKeyItem *iP;
+
+   if ((iP = sP.CTable.Find(Key))
+   &&  iP->Expired(Epoch.load(std::memory_order_relaxed)))
+      {Retire(sP, iP); iP = 0;}
+   return iP;
+}
+
 /******************************************************************************/
 /*                               g e t B V e c                                */
 /******************************************************************************/
   
-SMask_t XrdCmsCache::getBVec(unsigned int TODa, unsigned int &TODb)
+SMask_t XrdCmsCache::getBVec(Shard &sP, unsigned int TODa, unsigned int &TODb)
 {
    EPNAME("getBVec");
    SMask_t BVec(0);
@@ -510,20 +595,20 @@ SMask_t XrdCmsCache::getBVec(unsigned int TODa, unsigned int &TODb)
 
 // See if we can use a previously calculated bVec
 //
-   if (Bhistory[TODa].End == BClock && Bhistory[TODa].Start <= TODb)
-      {Bhits++; TODb = BClock; return Bhistory[TODa].Vec;}
+   if (sP.Bhistory[TODa].End == sP.BClock && sP.Bhistory[TODa].Start <= TODb)
+      {sP.Bhits++; TODb = sP.BClock; return sP.Bhistory[TODa].Vec;}
 
 // Calculate the new vector
 //
-   for (i = 0; i <= vecHi; i++)
-       if (TODb < Bounced[i]) BVec |= 1ULL << i;
+   for (i = 0; i <= sP.vecHi; i++)
+       if (TODb < sP.Bounced[i]) BVec.Set(i);
 
-   Bhistory[TODa].Vec   = BVec;
-   Bhistory[TODa].Start = TODb;
-   Bhistory[TODa].End   = BClock;
-   TODb                 = BClock;
-   Bmiss++;
-   if (!(Bmiss & 0xff)) DEBUG("hits=" <<Bhits <<" miss=" <<Bmiss);
+   sP.Bhistory[TODa].Vec   = BVec;
+   sP.Bhistory[TODa].Start = TODb;
+   sP.Bhistory[TODa].End   = sP.BClock;
+   TODb                    = sP.BClock;
+   sP.Bmiss++;
+   if (!(sP.Bmiss & 0xff)) DEBUG("hits=" <<sP.Bhits <<" miss=" <<sP.Bmiss);
    return BVec;
 }
 
@@ -531,36 +616,33 @@ SMask_t XrdCmsCache::getBVec(unsigned int TODa, unsigned int &TODb)
 /*                               R e c y c l e                                */
 /******************************************************************************/
   
-void XrdCmsCache::Recycle(XrdCmsKeyItem *theList)
+void XrdCmsCache::Recycle(int sNum, XrdCmsKeyItem *theList)
 {
+   Shard &sP = Shards[sNum];
    XrdCmsKeyItem *iP;
    char msgBuff[100];
    int numNull, numHave, numFree, numRecycled = 0;
 
 // Recycle the list of cache items, as needed
 //
+   sP.Lock();
    while((iP = theList))
-        {theList = iP->Key.TODRef;
+        {theList = iP->Next;
          if (iP->Loc.roPend) RRQ.Del(iP->Loc.roPend, iP);
          if (iP->Loc.rwPend) RRQ.Del(iP->Loc.rwPend, iP);
-         myMutex.Lock(); CTable.Recycle(iP); myMutex.UnLock();
+         sP.CTable.Free(iP);
          numRecycled++;
         }
 
 // See if we have enough items in reserve
 //
-   myMutex.Lock();
-   XrdCmsKeyItem::Stats(numHave, numFree, numNull);
+   sP.CTable.Stats(numHave, numFree, numNull);
    if (numFree < XrdCmsKeyItem::minFree)
-      {myMutex.UnLock();
-       if (!(numNull /= 4)) numNull = 1;
+      {if (!(numNull /= 4)) numNull = 1;
        numHave += XrdCmsKeyItem::minAlloc * numNull;
-       while(numNull--)
-            {myMutex.Lock();
-             numFree = XrdCmsKeyItem::Replenish();
-             myMutex.UnLock();
-            }
-      } else myMutex.UnLock();
+       while(numNull--) numFree = sP.CTable.Replenish();
+      }
+   sP.UnLock();
 
 // Log the stats
 //
@@ -568,3 +650,16 @@ void XrdCmsCache::Recycle(XrdCmsKeyItem *theList)
            numRecycled, numHave, numFree);
    Say.Emsg("Recycle", msgBuff);
 }
+
+/******************************************************************************/
+/*                                R e t i r e                                 */
+/******************************************************************************/
+
+// The shard lock must be held.
+//
+void XrdCmsCache::Retire(Shard &sP, XrdCmsKeyItem *iP)
+{
+   if (iP->Loc.roPend) RRQ.Del(iP->Loc.roPend, iP);
+   if (iP->Loc.rwPend) RRQ.Del(iP->Loc.rwPend, iP);
+   sP.CTable.Recycle(iP);
+}
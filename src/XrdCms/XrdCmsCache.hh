@@ -30,6 +30,7 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <atomic>
 #include <string.h>
   
 #include "Xrd/XrdJob.hh"
@@ -76,45 +77,88 @@ void        Drop(SMask_t mask, int SNum, int xHi);
 
 int         Init(int fxHold, int fxDelay, int fxQuery, int seFS, int nxHold);
 
+struct Info
+      {long long Lookups;  // Number of GetFile() calls
+       long long Hits;     // Number of those that found the path
+       long long LookupNs; // Total time spent in GetFile() in nanoseconds
+       long long Locks;    // Number of times a shard was locked
+       long long Waits;    // Number of those that had to wait for the lock
+       int       Items;    // Number of paths in the cache
+       int       Shards;   // Number of shards
+      };
+
+void        Statistics(Info &Data);
+
 void       *TickTock();
 
 static const int min_nxTime = 60;
 
-            XrdCmsCache() : okVec(0), Tick(8*60*60), Tock(0), BClock(0), 
-                            nilTMO(0),
-                            DLTime(5), QDelay(5), Bhits(0), Bmiss(0), vecHi(-1),
-                            isDFS(0)
-                          {memset(Bounced,  0, sizeof(Bounced));
-                           memset(Bhistory, 0, sizeof(Bhistory));
-                          }
+            XrdCmsCache() : Tick(8*60*60), Epoch(0), BClock(0), nilTMO(0),
+                            DLTime(5), QDelay(5), isDFS(0) {}
            ~XrdCmsCache() {}   // Never gets deleted
 
 private:
 
+// The cache is split into shards by path hash, each with its own lock, table
+// and copy of the server bounce state. Administrative changes to the bounce
+// state (Bounce() and Drop()) are rare and update every shard.
+//
+static const int ShardBits = 4;
+static const int numShards = 1 << ShardBits;
+
+struct alignas(64) Shard
+      {XrdSysMutex   Mutex;
+       XrdCmsNash    CTable;
+       struct {SMask_t      Vec;
+               unsigned int Start;
+               unsigned int End;
+              }      Bhistory[XrdCmsKeyItem::TickRate];
+       unsigned int  Bounced[STMax];
+       SMask_t       okVec;
+       unsigned int  BClock;
+                int  vecHi;
+                int  Bhits;
+                int  Bmiss;
+       long long     Lookups;
+       long long     Hits;
+       long long     LookupNs;
+       long long     Locks;
+       long long     Waits;
+
+inline void          Lock() {if (!Mutex.CondLock()) {Mutex.Lock(); Waits++;}
+                             Locks++;
+                            }
+inline void          UnLock() {Mutex.UnLock();}
+
+                     Shard() : CTable(1597, 2584), okVec(0), BClock(0),
+                               vecHi(-1), Bhits(0), Bmiss(0), Lookups(0),
+                               Hits(0), LookupNs(0), Locks(0), Waits(0)
+                             {memset(Bounced,  0, sizeof(Bounced));
+                              memset(Bhistory, 0, sizeof(Bhistory));
+                             }
+      };
+
+inline Shard &getShard(XrdCmsKey &Key)
+              {if (!Key.Hash) Key.setHash();
+               return Shards[Key.Hash >> (32 - ShardBits)];
+              }
+
 void          Add2Q(XrdCmsRRQInfo *Info, XrdCmsKeyItem *cp, int selOpts);
 void          Dispatch(XrdCmsSelect &Sel, XrdCmsKeyItem *cinfo,
                        short roQ, short rwQ);
-SMask_t       getBVec(unsigned int todA, unsigned int &todB);
-void          Recycle(XrdCmsKeyItem *theList);
-
-struct  {SMask_t      Vec;
-         unsigned int Start;
-         unsigned int End;
-        }             Bhistory[XrdCmsKeyItem::TickRate];
-
-XrdSysMutex   myMutex;
-XrdCmsNash    CTable;
-unsigned int  Bounced[STMax];
-SMask_t       okVec;
+XrdCmsKeyItem*Find(Shard &sP, XrdCmsKey &Key);
+SMask_t       getBVec(Shard &sP, unsigned int todA, unsigned int &todB);
+void          Recycle(int sNum, XrdCmsKeyItem *theList);
+void          Retire(Shard &sP, XrdCmsKeyItem *iP);
+
+Shard         Shards[numShards];
+XrdSysMutex   admMutex;
 unsigned int  Tick;
-unsigned int  Tock;
+std::atomic<unsigned int> Epoch;
 unsigned int  BClock;
          int  nilTMO;
          int  DLTime;
          int  QDelay;
-         int  Bhits;
-         int  Bmiss;
-         int  vecHi;
          int  isDFS;
 };
 
@@ -542,7 +542,7 @@ XrdCmsSelected *XrdCmsCluster::List(SMask_t mask, CmsLSOpts opts, bool &oksel)
    oksel = false;
    STMutex.Lock();
    for (i = 0; i <= STHi; i++)
-        if ((nP=NodeTab[i]) && (nP->NodeMask & mask))
+        if ((nP=NodeTab[i]) && nP->isNode(mask))
            {oksel = true;
             if (retDest)
                {     if (nP->netIF.HasDest(ifType)) ifGet = ifType;
@@ -1070,11 +1070,9 @@ int XrdCmsCluster::Select(XrdCmsSelect &Sel)
 int XrdCmsCluster::Select(SMask_t pmask, int &port, char *hbuff, int &hlen,
                           int isrw, int isMulti, int ifWant)
 {
-   static const SMask_t smLow(255);
    XrdCmsSelector selR;
    XrdCmsNode *nP = 0;
-   SMask_t tmask;
-   int Snum = 0;
+   int Snum;
    XrdNetIF::ifType nType = static_cast<XrdNetIF::ifType>(ifWant);
 
 // If there is nothing to select from, return failure
@@ -1110,9 +1108,7 @@ int XrdCmsCluster::Select(SMask_t pmask, int &port, char *hbuff, int &hlen,
 // In shared-nothing systems the incomming mask will only have a single node.
 // Compute the a single node number that is contained in the mask.
 //
-   do {if (!(tmask = pmask & smLow)) Snum += 8;
-         else {while((tmask = tmask>>1)) Snum++; break;}
-      } while((pmask = pmask >> 8));
+   Snum = pmask.First();
 
 // See if the node passes muster
 //
@@ -1269,12 +1265,17 @@ int XrdCmsCluster::Statt(char *bfr, int bln)
    static const char statfmt5[] =
           "<frq><add>%lld<d>%lld</d></add><rsp>%lld<m>%lld</m></rsp>"
           "<lf>%lld</lf><ls>%lld</ls><rf>%lld</rf><rs>%lld</rs></frq>";
+   static const char statfmt6[] =
+          "<cch><lk>%lld<hit>%lld</hit><ns>%lld</ns></lk>"
+          "<lck>%lld<w>%lld</w></lck><n>%d</n><sh>%d</sh></cch>";
 
+   static int AddCch = (Config.RepStats & XrdCmsConfig::RepStat_cch);
    static int AddFrq = (Config.RepStats & XrdCmsConfig::RepStat_frq);
    static int AddShr = (Config.RepStats & XrdCmsConfig::RepStat_shr)
                        && Config.asMetaMan();
 
    XrdCmsRRQ::Info Frq;
+   XrdCmsCache::Info Cch;
    XrdCmsSelected *sp;
    long long SelRnum, SelWnum;
    int mlen, tlen, n = 0;
@@ -1298,12 +1299,14 @@ int XrdCmsCluster::Statt(char *bfr, int bln)
           (sizeof(statfmt2) + 10*2 + 256 + 16) * STMax + sizeof(statfmt4);
        if (AddShr) n += sizeof(statfmt3) + 12;
        if (AddFrq) n += sizeof(statfmt4) + (10*8);
+       if (AddCch) n += sizeof(statfmt6) + (20*5) + (10*2);
        return n;
       }
 
 // Get the statistics
 //
    if (AddFrq) RRQ.Statistics(Frq);
+   if (AddCch) Cache.Statistics(Cch);
    mngrsp.sp = sp = List(FULLMASK, LS_NULL, oksel);
 
 // Count number of nodes we have
@@ -1354,6 +1357,12 @@ int XrdCmsCluster::Statt(char *bfr, int bln)
        bfr += mlen; bln -= mlen; tlen += mlen;
       }
 
+   if (AddCch && bln > 0)
+      {mlen = snprintf(bfr, bln, statfmt6, Cch.Lookups, Cch.Hits, Cch.LookupNs,
+              Cch.Locks, Cch.Waits, Cch.Items, Cch.Shards);
+       bfr += mlen; bln -= mlen; tlen += mlen;
+      }
+
 // See if we overflowed. otherwise finish up
 //
    if (sp || bln < (int)sizeof(statfmt0)) return 0;
@@ -1484,53 +1493,20 @@ int XrdCmsCluster::Drop(int sent, int sinst, XrdCmsDrop *djp)
 /*                              M u l t i p l e                               */
 /******************************************************************************/
 
-int XrdCmsCluster::Multiple(SMask_t mVec)
+int XrdCmsCluster::Multiple(const SMask_t &mVec)
 {
-   static const unsigned long long Left32  = 0xffffffff00000000LL;
-   static const unsigned long long Right32 = 0x00000000ffffffffLL;
-   static const unsigned long long Left16  = 0x00000000ffff0000LL;
-   static const unsigned long long Right16 = 0x000000000000ffffLL;
-   static const unsigned long long Left08  = 0x000000000000ff00LL;
-   static const unsigned long long Right08 = 0x00000000000000ffLL;
-   static const unsigned long long Left04  = 0x00000000000000f0LL;
-   static const unsigned long long Right04 = 0x000000000000000fLL;
-//                                0 1 2 3 4 5 6 7 8 9 A B C D E F
-   static const int isMult[16] = {0,0,0,1,0,1,1,1,0,1,1,1,1,1,1,1};
-
-   if (mVec & Left32) {if (mVec & Right32) return 1;
-                          else mVec = mVec >> 32LL;
-                      }
-   if (mVec & Left16) {if (mVec & Right16) return 1;
-                          else mVec = mVec >> 16LL;
-                      }
-   if (mVec & Left08) {if (mVec & Right08) return 1;
-                          else mVec = mVec >>  8LL;
-                      }
-   if (mVec & Left04) {if (mVec & Right04) return 1;
-                          else mVec = mVec >>  4LL;
-                      }
-   return isMult[mVec];
+   return mVec.Multiple();
 }
   
 /******************************************************************************/
 /*                               m a x B i t s                                */
 /******************************************************************************/
   
-bool XrdCmsCluster::maxBits(SMask_t mVec, int mbits)
+bool XrdCmsCluster::maxBits(const SMask_t &mVec, int mbits)
 {
-   int count = 0;
-
-// Count bits. This is the fastest way assuming few bits are set
-//
-   while(mVec)
-        {mVec &= (mVec - 1);
-         count++;
-         if (count >= mbits) return true;
-        }
-
-// Indicate we have not reached the maximum bits set
+// Count bits, each word is a single population count instruction
 //
-   return false;
+   return mVec.Count() >= mbits;
 }
 
 /******************************************************************************/
@@ -1573,8 +1549,7 @@ int XrdCmsCluster::SelNode(XrdCmsSelect &Sel, SMask_t pmask, SMask_t amask)
 // Indicate whether or not stable selection is required
 //
    if (!(Sel.Opts & XrdCmsSelect::Pack)) selR.selPack = 0;
-      else {SMask_t sVec = pmask;
-            for (count = 0; sVec; count++) sVec &= (sVec - 1);
+      else {count = pmask.Count();
             if (count > 1) selR.selPack = affsel = (Sel.Path.Hash % count) + 1;
                else        selR.selPack = 0;
            }
@@ -1735,7 +1710,7 @@ XrdCmsNode *XrdCmsCluster::SelbyCost(SMask_t mask, XrdCmsSelector &selR)
 //
    selR.Reset(); SelTcnt++;
    for (int i = 0; i <= STHi; i++)
-       if ((np = NodeTab[i]) && (np->NodeMask & mask))
+       if ((np = NodeTab[i]) && np->isNode(mask))
           {if (!(selR.needNet &  np->hasNet))    {selR.xNoNet= true; continue;}
            selR.nPick++;
            if (np->isOffline)                    {selR.xOff  = true; continue;}
@@ -1780,7 +1755,7 @@ XrdCmsNode *XrdCmsCluster::SelbyLoad(SMask_t mask, XrdCmsSelector &selR)
 //
    selR.Reset(); SelTcnt++;
    for (int i = 0; i <= STHi; i++)
-       if ((np = NodeTab[i]) && (np->NodeMask & mask))
+       if ((np = NodeTab[i]) && np->isNode(mask))
           {if (!(selR.needNet & np->hasNet))      {selR.xNoNet= true; continue;}
            selR.nPick++;
            if (np->isOffline)                     {selR.xOff  = true; continue;}
@@ -1830,7 +1805,7 @@ XrdCmsNode *XrdCmsCluster::SelbyRef(SMask_t mask, XrdCmsSelector &selR)
 //
    selR.Reset(); SelTcnt++;
    for (int i = 0; i <= STHi; i++)
-       if ((np = NodeTab[i]) && (np->NodeMask & mask))
+       if ((np = NodeTab[i]) && np->isNode(mask))
           {if (!(selR.needNet & np->hasNet))    {selR.xNoNet= true; continue;}
            selR.nPick++;
            if (np->isOffline)                   {selR.xOff  = true; continue;}
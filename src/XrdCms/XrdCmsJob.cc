@@ -99,7 +99,7 @@ void XrdCmsJob::DoIt()
 //
    if ((rc = theProto->Execute(*theData)))
       if (rc == -EINPROGRESS)
-         {Sched->Schedule((XrdJob *)this, theData->waitVal+time(0)); return;}
+         {Sched->ScheduleMS((XrdJob *)this, theData->waitVal*1000); return;}
    theProto->Ref(-1);
    Recycle();
 }
@@ -60,17 +60,12 @@ void              setHash();
 inline int        Equiv(XrdCmsKey &oth)
                        {return Hash == oth.Hash && Ref == oth.Ref;}
 
-inline XrdCmsKey& operator=(const XrdCmsKey &rhs)
-                           {Val = strdup(rhs.Val); Hash = rhs.Hash; 
-                            Len = rhs.Len;
-                            return *this;
-                           }
-
 inline int        operator==(const XrdCmsKey &oth)
-                          {return Hash == oth.Hash && !strcmp(Val, oth.Val);}
+                          {return Hash == oth.Hash && Len == oth.Len
+                               && !memcmp(Val, oth.Val, Len);}
 
 inline int        operator!=(const XrdCmsKey &oth)
-                          {return Hash != oth.Hash || strcmp(Val, oth.Val);}
+                          {return !(*this == oth);}
 
          XrdCmsKey(char *key=0, int klen=0)
                       : TODRef(0), Val(key), Hash(0), Len(klen), Ref('\0') {}
@@ -94,10 +89,7 @@ SMask_t        pfvec;    // Servers that are staging         the file
 SMask_t        qfvec;    // Servers that are not yet queried
 unsigned int   TOD_B;    // Server currency clock
 int            lifeline; // TOD when nil entry should expire
-union {
-unsigned int   HashSave; // Where hash goes upon item unload
 int            deadline;
-      };
 short          roPend;   // Redirectors waiting for R/O response
 short          rwPend;   // Redirectors waiting for R/W response
 
@@ -120,7 +112,10 @@ XrdCmsKeyLoc&  operator=(const XrdCmsKeyLoc &rhs)
   
 // The XrdCmsKeyItem object marries the XrdCmsKey and XrdCmsKeyLoc objects in
 // the key cache. It is only used by logical manipulator, XrdCmsCache, which
-// always front-ends the physical manipulator, XrdCmsNash.
+// always front-ends the physical manipulator, XrdCmsNash. Items are never
+// freed; each one keeps the storage for its path so that reusing an item
+// rarely needs a memory allocation. An item expires TickRate clock ticks
+// after its epoch was last set.
 //
 class XrdCmsKeyItem
 {
@@ -129,35 +124,32 @@ public:
        XrdCmsKeyLoc   Loc;
        XrdCmsKey      Key;
        XrdCmsKeyItem *Next;
+       unsigned int   Epoch;    // Clock tick when the entry was last refreshed
 
-static XrdCmsKeyItem *Alloc(unsigned int theTock);
+inline bool           Expired(unsigned int theEpoch)
+                             {return theEpoch - Epoch >= TickRate;}
 
        void           Recycle();
 
-       void           Reload();
-
-static int            Replenish();
-
-static void           Stats(int &isAlloc, int &isFree, int &wasEmpty);
-
-static XrdCmsKeyItem *Unload(unsigned int   theTock);
+inline void           SetEpoch(unsigned int theEpoch)
+                              {Epoch   = theEpoch;
+                               Key.TOD = static_cast<unsigned char>
+                                         (theEpoch & TickMask);
+                              }
 
-static XrdCmsKeyItem *Unload(XrdCmsKeyItem *theItem);
+       bool           SetKey(XrdCmsKey &theKey);
 
-       XrdCmsKeyItem() {}  // Warning see the constructor!
+       XrdCmsKeyItem() : Next(0), Epoch(0), KeyBuff(0), KeyBLen(0) {}
       ~XrdCmsKeyItem() {}  // These are usually never deleted
 
 static const unsigned int TickRate =   64;
 static const unsigned int TickMask =   63;
-static const          int minAlloc = 4096;
-static const          int minFree  = 1024;
+static const          int minAlloc =  512;
+static const          int minFree  =  128;
 
 private:
 
-static XrdCmsKeyItem *TockTable[TickRate];
-static XrdCmsKeyItem *Free;
-static int            numFree;
-static int            numHave;
-static int            numNull;
+char                 *KeyBuff;
+int                   KeyBLen;
 };
 #endif
@@ -28,9 +28,14 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <errno.h>
 #include <stdlib.h>
 
 #include "XrdCms/XrdCmsNash.hh"
+#include "XrdCms/XrdCmsTrace.hh"
+#include "XrdSys/XrdSysError.hh"
+
+using namespace XrdCms;
 
 /******************************************************************************/
 /*                           C o n s t r u c t o r                            */
@@ -42,6 +47,10 @@ XrdCmsNash::XrdCmsNash(int psize, int csize)
      nashtablesize = csize;
      Threshold     = (csize * LoadMax) / 100;
      nashnum       = 0;
+     freeList      = 0;
+     numFree       = 0;
+     numHave       = 0;
+     numNull       = 0;
      nashtable     = (XrdCmsKeyItem **)
                      malloc( (size_t)(csize*sizeof(XrdCmsKeyItem *)) );
      memset((void *)nashtable, 0, (size_t)(csize*sizeof(XrdCmsKeyItem *)));
@@ -58,16 +67,21 @@ XrdCmsKeyItem *XrdCmsNash::Add(XrdCmsKey &Key)
 
 // Allocate the entry
 //
-   if (!(hip = XrdCmsKeyItem::Alloc(Key.TOD))) return (XrdCmsKeyItem *)0;
-
-// Check if we should expand the table
-//
-   if (++nashnum > Threshold) Expand();
+   if (!(hip = Alloc())) return (XrdCmsKeyItem *)0;
 
 // Fill out the key data
 //
    if (!Key.Hash) Key.setHash();
-   hip->Key = Key;
+   if (!hip->SetKey(Key))
+      {Free(hip);
+       Say.Emsg("Nash", ENOMEM, "create key item");
+       return (XrdCmsKeyItem *)0;
+      }
+   hip->Loc.roPend = hip->Loc.rwPend = 0;
+
+// Check if we should expand the table
+//
+   if (++nashnum > Threshold) Expand();
 
 // Add the entry to the table
 //
@@ -77,6 +91,30 @@ XrdCmsKeyItem *XrdCmsNash::Add(XrdCmsKey &Key)
    return hip;
 }
   
+/******************************************************************************/
+/* private                         A l l o c                                  */
+/******************************************************************************/
+  
+XrdCmsKeyItem *XrdCmsNash::Alloc()
+{
+  XrdCmsKeyItem *kP;
+
+// Try to allocate an existing item or replenish the list
+//
+   do {if ((kP = freeList))
+          {freeList = kP->Next;
+           numFree--;
+           return kP;
+          }
+       numNull++;
+       } while(Replenish());
+
+// We failed
+//
+   Say.Emsg("Nash", ENOMEM, "create key item");
+   return (XrdCmsKeyItem *)0;
+}
+
 /******************************************************************************/
 /* private                        E x p a n d                                 */
 /******************************************************************************/
@@ -147,12 +185,22 @@ XrdCmsKeyItem *XrdCmsNash::Find(XrdCmsKey &Key)
 }
 
 /******************************************************************************/
-/* public                        R e c y c l e                                */
+/* public                           F r e e                                   */
 /******************************************************************************/
   
-// The item must have been previously unload which will place the original
-// hash value in Loc.HashSave. Yes, not very OO but very fast.
+// The item must no longer be in the table (see Unload()).
 //
+void XrdCmsNash::Free(XrdCmsKeyItem *rip)
+{
+   rip->Recycle();
+   rip->Next = freeList; freeList = rip;
+   numFree++;
+}
+
+/******************************************************************************/
+/* public                        R e c y c l e                                */
+/******************************************************************************/
+  
 int XrdCmsNash::Recycle(XrdCmsKeyItem *rip)
 {
    XrdCmsKeyItem *nip, *pip = 0;
@@ -160,7 +208,7 @@ int XrdCmsNash::Recycle(XrdCmsKeyItem *rip)
 
 // Compute position of the hash table entry
 //
-   kent = rip->Loc.HashSave%nashtablesize;
+   kent = rip->Key.Hash%nashtablesize;
 
 // Find the entry
 //
@@ -172,8 +220,73 @@ int XrdCmsNash::Recycle(XrdCmsKeyItem *rip)
    if (nip)
       {if (pip) pip->Next = nip->Next;
           else nashtable[kent] = nip->Next;
-          rip->Recycle();
+          Free(rip);
           nashnum--;
       }
    return nip != 0;
 }
+
+/******************************************************************************/
+/* public                      R e p l e n i s h                              */
+/******************************************************************************/
+
+int XrdCmsNash::Replenish()
+{
+   EPNAME("Replenish");
+   XrdCmsKeyItem *kP;
+   int i;
+
+// Allocate a quantum of free elements and chain them into the free list
+//
+   if (!(kP = new XrdCmsKeyItem[XrdCmsKeyItem::minAlloc])) return 0;
+   DEBUG("old free " <<numFree <<" + " <<XrdCmsKeyItem::minAlloc
+         <<" = " <<numHave+XrdCmsKeyItem::minAlloc);
+
+   i = XrdCmsKeyItem::minAlloc;
+   while(i--) {kP->Next = freeList; freeList = kP; kP++;}
+
+// Return the number we have free
+//
+   numHave += XrdCmsKeyItem::minAlloc;
+   numFree += XrdCmsKeyItem::minAlloc;
+   return numFree;
+}
+
+/******************************************************************************/
+/* public                          S t a t s                                  */
+/******************************************************************************/
+
+void XrdCmsNash::Stats(int &isAlloc, int &isFree, int &wasNull)
+{
+
+   isAlloc  = numHave;
+   isFree   = numFree;
+   wasNull  = numNull;
+   numNull  = 0;
+}
+
+/******************************************************************************/
+/* public                         U n l o a d                                 */
+/******************************************************************************/
+  
+XrdCmsKeyItem *XrdCmsNash::Unload(unsigned int theEpoch)
+{
+   XrdCmsKeyItem *nip, **pipP, *uList = 0;
+   int i;
+
+// Remove every expired entry from the table. The hash code is cleared so that
+// any outstanding reference to the entry no longer matches it.
+//
+   for (i = 0; i < nashtablesize; i++)
+       {pipP = &nashtable[i];
+        while((nip = *pipP))
+             {if (nip->Expired(theEpoch))
+                 {*pipP = nip->Next;
+                  nip->Key.Hash = 0;
+                  nip->Next = uList; uList = nip;
+                  nashnum--;
+                 } else pipP = &(nip->Next);
+             }
+       }
+   return uList;
+}
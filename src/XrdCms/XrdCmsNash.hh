@@ -39,8 +39,19 @@ XrdCmsKeyItem *Add(XrdCmsKey &Key);
 
 XrdCmsKeyItem *Find(XrdCmsKey &Key);
 
+void           Free(XrdCmsKeyItem *rip);
+
 int            Recycle(XrdCmsKeyItem *rip);
 
+int            Replenish();
+
+void           Stats(int &isAlloc, int &isFree, int &wasEmpty);
+
+// Unload() removes all entries that expired as of theEpoch and returns them
+//          chained via Next. They must be given back via Free().
+//
+XrdCmsKeyItem *Unload(unsigned int theEpoch);
+
 // When allocateing a new nash, specify the required starting size. Make
 // sure that the previous number is the correct Fibonocci antecedent. The
 // series is simply n[j] = n[j-1] + n[j-2].
@@ -52,12 +63,17 @@ private:
 
 static const int LoadMax = 80;
 
+XrdCmsKeyItem     *Alloc();
 void               Expand();
 
 XrdCmsKeyItem  **nashtable;
+XrdCmsKeyItem   *freeList;
 int              prevtablesize;
 int              nashtablesize;
 int              nashnum;
 int              Threshold;
+int              numFree;
+int              numHave;
+int              numNull;
 };
 #endif
@@ -97,11 +97,11 @@ XrdCmsNode::XrdCmsNode(XrdLink *lnkp, const char *theIF, const char *nid,
                        int port, int lvl, int id) : nodeMutex(0, "nodeCV")
 {
     static XrdSysMutex   iMutex;
-    static const SMask_t smask_1(1);
     static int           iNum = 1;
 
     Link     =  lnkp;
-    NodeMask =  (id < 0 ? 0 : smask_1 << id);
+    NodeMask =  0;
+    if (id >= 0) NodeMask.Set(id);
     NodeID   = id;
     cidP     =  0;
     hasNet   =  0;
@@ -585,7 +585,7 @@ const char *XrdCmsNode::do_Locate(XrdCmsRRData &Arg)
    XrdCmsSelect    Sel(0, Arg.Path, Arg.PathLen-1);
    XrdCmsSelected *sP = 0;
    struct {kXR_unt32 Val; 
-           char outbuff[CmsLocateRequest::RHLen*STMax];} Resp;
+           char outbuff[XrdCmsRRQ::locBSize];} Resp;
    struct iovec ioV[2] = {{(char *)&Arg.Request, sizeof(Arg.Request)},
                           {(char *)&Resp,        0}};
    const char *Why;
@@ -705,13 +705,14 @@ const char *XrdCmsNode::do_Locate(XrdCmsRRData &Arg)
 /******************************************************************************/
   
 int XrdCmsNode::do_LocFmt(char *buff, XrdCmsSelected *sP,
-                          SMask_t pfVec, SMask_t wfVec, bool lsall, bool lsuniq)
+                          const SMask_t &pfVec, const SMask_t &wfVec,
+                          bool lsall, bool lsuniq)
 {
    static const int Skip = (XrdCmsSelected::Disable | XrdCmsSelected::Offline);
    static const int Hung = (XrdCmsSelected::Disable | XrdCmsSelected::Offline
                          |  XrdCmsSelected::Suspend);
    XrdCmsSelected *pP;
-   char *oP = buff;
+   char *oP = buff, *oEnd = buff + XrdCmsRRQ::locBSize - 1;
 
 // If only unique entries are wanted then we need to only let through
 // all non-servers and one server (prefereably a r/w one)
@@ -735,19 +736,22 @@ if (!lsall && lsuniq)
 // format out the request as follows:                   
 // 01234567810123456789212345678
 // xy[::123.123.123.123]:123456
+// Entries that would not fit in the response are dropped (wide cells only).
 //
 if (lsall)
    while(sP)
-        {*oP = (sP->Status & XrdCmsSelected::isMangr ? 'M' : 'S');
-         if (sP->Status & Hung) *oP = tolower(*oP);
-         *(oP+1) = (sP->Mask   & wfVec               ? 'w' : 'r');
-         strcpy(oP+2, sP->Ident); oP += sP->IdentLen + 2;
-         if (sP->next) *oP++ = ' ';
+        {if (oP + sP->IdentLen + 3 <= oEnd)
+            {*oP     = (sP->Status & XrdCmsSelected::isMangr ? 'M' : 'S');
+             if (sP->Status & Hung) *oP = tolower(*oP);
+             *(oP+1) = (sP->Mask   & wfVec               ? 'w' : 'r');
+             strcpy(oP+2, sP->Ident); oP += sP->IdentLen + 2;
+             if (sP->next) *oP++ = ' ';
+            }
          pP = sP; sP = sP->next; delete pP;
         }
    else
    while(sP)
-        {if (!(sP->Status & Skip))
+        {if (!(sP->Status & Skip) && oP + sP->IdentLen + 3 <= oEnd)
             {*oP     = (sP->Status & XrdCmsSelected::isMangr ? 'M' : 'S');
              if (sP->Mask & pfVec) *oP = tolower(*oP);
              *(oP+1) = (sP->Mask   & wfVec                   ? 'w' : 'r');
@@ -759,6 +763,7 @@ if (lsall)
 
 // Send of the result
 //
+   if (oP > buff && *(oP-1) == ' ') oP--;
    *oP = '\0';
    return (oP - buff);
 }
@@ -1266,7 +1271,7 @@ int XrdCmsNode::do_SelPrep(XrdCmsPrepArgs &Arg) // Static!!!
        Scl.iovP = 0; Scl.iovN  = 0; Scl.InfoP = 0; Scl.nmask = SMask_t(0);
        DEBUGR("colocating " <<Arg.path <<" w.r.t. " <<Arg.clPath);
        rc = Cluster.Select(Scl);
-       if (rc > 0) {Sched->Schedule((XrdJob *)&Arg, rc+time(0));
+       if (rc > 0) {Sched->ScheduleMS((XrdJob *)&Arg, rc*1000);
                     DEBUGR("coloc to " <<Arg.clPath <<" delayed " <<rc <<" seconds");
                     return 1;
                    }
@@ -1279,7 +1284,7 @@ int XrdCmsNode::do_SelPrep(XrdCmsPrepArgs &Arg) // Static!!!
    if ((rc = Cluster.Select(Sel)))
       {if (rc > 0)
           {if (!(Arg.options & CmsPrepAddRequest::kYR_stage)) return 0;
-           Sched->Schedule((XrdJob *)&Arg, rc+time(0));
+           Sched->ScheduleMS((XrdJob *)&Arg, rc*1000);
            DEBUGR("prep delayed " <<rc <<" seconds");
            return 1;
           }
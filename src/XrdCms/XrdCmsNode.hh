@@ -98,7 +98,7 @@ const  char  *do_Have(XrdCmsRRData &Arg);
 const  char  *do_Load(XrdCmsRRData &Arg);
 const  char  *do_Locate(XrdCmsRRData &Arg);
 static int    do_LocFmt(char *buff, XrdCmsSelected *sP,
-                        SMask_t pf, SMask_t wf,
+                        const SMask_t &pf, const SMask_t &wf,
                         bool lsall=false, bool lsuniq=false);
 const  char  *do_Mkdir(XrdCmsRRData &Arg);
 const  char  *do_Mkpath(XrdCmsRRData &Arg);
@@ -135,7 +135,7 @@ inline int    Inst() {return Instance;}
 
        bool   inDomain() {return netIF.InDomain(&netID);}
 
-inline int    isNode(SMask_t smask) {return (smask & NodeMask) != 0;}
+inline int    isNode(const SMask_t &smask) {return smask.Test(NodeID);}
 
 inline int    isNode(const XrdNetAddr *addr) // Only for avoid processing!
                     {return netID.Same(addr);}
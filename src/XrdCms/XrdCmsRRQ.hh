@@ -145,6 +145,13 @@ void  Statistics(Info &Data) {myMutex.Lock(); Data = Stats; myMutex.UnLock();}
 
 void *TimeOut();
 
+// A locate response has an entry per node but its length must fit in the
+// 16-bit datalen of a response; this only matters when STMax is raised.
+//
+static const int locBSize =
+                 (XrdCms::CmsLocateRequest::RHLen*STMax < 65000
+               ?  XrdCms::CmsLocateRequest::RHLen*STMax : 65000);
+
       XrdCmsRRQ() : isWaiting(0), isReady(0),
                     luFast(0),    luSlow(0),  rdFast(0), rdSlow(0),
                     Tslice(178),  Tdelay(5),  myClock(0) {}
@@ -170,8 +177,7 @@ static   const int                     iov_cnt = 2;
          XrdCms::CmsResponse           redrResp;
          XrdCms::CmsResponse           waitResp;
 union   {char                          hostbuff[288];
-         char                          databuff[XrdCms::CmsLocateRequest::RHLen
-                                               *STMax];
+         char                          databuff[locBSize];
         };
          Info                          Stats;
          int                           luFast;
@@ -0,0 +1,167 @@
+#ifndef XRDCMSSMASK__H
+#define XRDCMSSMASK__H
+/******************************************************************************/
+/*                                                                            */
+/*                        X r d C m s S M a s k . h h                         */
+/*                                                                            */
+/* (c) 2026 by European Organization for Nuclear Research (CERN)              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <iomanip>
+#include <ostream>
+
+/******************************************************************************/
+/*                      C l a s s   X r d C m s S M a s k                     */
+/******************************************************************************/
+
+// A server mask has one bit per node slot in the cluster table. Historically
+// this was a single 64-bit integer and the class keeps integer-like semantics
+// so that mask expressions read the same. The width is a build time constant
+// (see STMax). Every operation is a loop over a fixed number of 64-bit words
+// which the compiler fully unrolls for the default single word mask and
+// vectorizes for wide masks. Masks never go on the wire; peers only ever see
+// host names so the width does not affect protocol compatibility.
+//
+template<int nBits>
+class XrdCmsSMask
+{
+public:
+
+static const int Words = (nBits + 63) / 64;
+
+// Bit level operations
+//
+inline bool  Any() const
+                {unsigned long long v = 0;
+                 for (int i = 0; i < Words; i++) v |= Bits[i];
+                 return v != 0;
+                }
+
+inline void  Clr(int n) {Bits[n >> 6] &= ~(1ULL << (n & 63));}
+
+inline int   Count() const
+                {int n = 0;
+                 for (int i = 0; i < Words; i++) n += __builtin_popcountll(Bits[i]);
+                 return n;
+                }
+
+// Return the lowest numbered bit that is set or -1 if none are set
+//
+inline int   First() const
+                {for (int i = 0; i < Words; i++)
+                     if (Bits[i]) return (i << 6) + __builtin_ctzll(Bits[i]);
+                 return -1;
+                }
+
+// Return true if more than one bit is set
+//
+inline bool  Multiple() const
+                {bool one = false;
+                 for (int i = 0; i < Words; i++)
+                     if (Bits[i])
+                        {if (one || (Bits[i] & (Bits[i]-1))) return true;
+                         one = true;
+                        }
+                 return false;
+                }
+
+inline void  Set(int n) {Bits[n >> 6] |=  (1ULL << (n & 63));}
+
+inline bool  Test(int n) const
+                {return n >= 0 && n < nBits
+                     && (Bits[n >> 6] & (1ULL << (n & 63))) != 0;
+                }
+
+// Integer-like operators
+//
+inline XrdCmsSMask &operator&=(const XrdCmsSMask &rhs)
+                   {for (int i = 0; i < Words; i++) Bits[i] &= rhs.Bits[i];
+                    return *this;
+                   }
+
+inline XrdCmsSMask &operator|=(const XrdCmsSMask &rhs)
+                   {for (int i = 0; i < Words; i++) Bits[i] |= rhs.Bits[i];
+                    return *this;
+                   }
+
+inline XrdCmsSMask &operator^=(const XrdCmsSMask &rhs)
+                   {for (int i = 0; i < Words; i++) Bits[i] ^= rhs.Bits[i];
+                    return *this;
+                   }
+
+inline XrdCmsSMask  operator~() const
+                   {XrdCmsSMask r;
+                    for (int i = 0; i < Words; i++) r.Bits[i] = ~Bits[i];
+                    return r;
+                   }
+
+inline bool         operator==(const XrdCmsSMask &rhs) const
+                   {unsigned long long v = 0;
+                    for (int i = 0; i < Words; i++) v |= Bits[i] ^ rhs.Bits[i];
+                    return v == 0;
+                   }
+
+inline bool         operator!=(const XrdCmsSMask &rhs) const
+                   {return !(*this == rhs);}
+
+friend XrdCmsSMask  operator&(XrdCmsSMask lhs, const XrdCmsSMask &rhs)
+                   {return lhs &= rhs;}
+
+friend XrdCmsSMask  operator|(XrdCmsSMask lhs, const XrdCmsSMask &rhs)
+                   {return lhs |= rhs;}
+
+friend XrdCmsSMask  operator^(XrdCmsSMask lhs, const XrdCmsSMask &rhs)
+                   {return lhs ^= rhs;}
+
+inline bool         operator!() const {return !Any();}
+
+explicit inline     operator bool() const {return Any();}
+
+// Printing is only used for tracing; words are listed high to low in hex.
+//
+friend std::ostream &operator<<(std::ostream &os, const XrdCmsSMask &m)
+                   {std::ios_base::fmtflags oldFlags = os.flags();
+                    char oldFill = os.fill('0');
+                    os <<std::hex <<m.Bits[Words-1];
+                    for (int i = Words-2; i >= 0; i--)
+                        os <<'.' <<std::setw(16) <<m.Bits[i];
+                    os.fill(oldFill); os.flags(oldFlags);
+                    return os;
+                   }
+
+// A value converts as a sign extended integer so that 0 is the empty mask
+// and ~0 (or -1) is the full mask, exactly as for the original integer.
+//
+                    XrdCmsSMask(long long v)
+                   {Bits[0] = static_cast<unsigned long long>(v);
+                    for (int i = 1; i < Words; i++) Bits[i] = (v < 0 ? ~0ULL : 0);
+                   }
+
+                    XrdCmsSMask() = default; // Uninitialized, like an integer
+
+private:
+
+unsigned long long Bits[Words];
+};
+
+#endif
@@ -30,13 +30,27 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
   
-typedef unsigned long long SMask_t;
+// The following defines our cell size (maximum subscribers). It may be raised
+// at build time to any multiple of 64 (e.g. -DXRDCMS_STMAX=256) so that a
+// single cmsd can handle larger clusters without a supervisor layer. The value
+// is local to each cmsd and need not match that of its peers. It is set for
+// the whole build (CMSD_MAX_NODES) as libXrdServer shares these classes.
+//
+#ifndef XRDCMS_STMAX
+#define XRDCMS_STMAX 64
+#endif
 
-#define FULLMASK 0xFFFFFFFFFFFFFFFFULL
+#if XRDCMS_STMAX < 64 || XRDCMS_STMAX > 4096 || XRDCMS_STMAX % 64
+#error "XRDCMS_STMAX must be a multiple of 64 between 64 and 4096"
+#endif
 
-// The following defines our cell size (maximum subscribers)
-//
-#define STMax 64
+#define STMax XRDCMS_STMAX
+
+#include "XrdCms/XrdCmsSMask.hh"
+
+typedef XrdCmsSMask<STMax> SMask_t;
+
+#define FULLMASK SMask_t(~0)
 
 // The following defines the maximum number of redirectors. It is one greater
 // than the actual maximum as the zeroth is never used.
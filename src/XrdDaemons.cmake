@@ -50,6 +50,7 @@ add_executable(
   XrdCms/XrdCmsRouting.cc         XrdCms/XrdCmsRouting.hh
   XrdCms/XrdCmsRRQ.cc             XrdCms/XrdCmsRRQ.hh
                                   XrdCms/XrdCmsSelect.hh
+                                  XrdCms/XrdCmsSMask.hh
   XrdCms/XrdCmsState.cc           XrdCms/XrdCmsState.hh
   XrdCms/XrdCmsSupervisor.cc      XrdCms/XrdCmsSupervisor.hh
                                   XrdCms/XrdCmsTrace.hh )
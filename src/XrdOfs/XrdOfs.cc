@@ -36,6 +36,7 @@
 #include <stdio.h>
 #include <time.h>
 #include <netdb.h>
+#include <arpa/inet.h>
 #include <stdlib.h>
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -54,6 +55,7 @@
 
 #include "XrdOfs/XrdOfs.hh"
 #include "XrdOfs/XrdOfsChkPnt.hh"
+#include "XrdOfs/XrdOfsCksStream.hh"
 #include "XrdOfs/XrdOfsConfigCP.hh"
 #include "XrdOfs/XrdOfsEvs.hh"
 #include "XrdOfs/XrdOfsHandle.hh"
@@ -71,10 +73,12 @@
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysHeaders.hh"
 #include "XrdSys/XrdSysLogger.hh"
+#include "XrdSys/XrdSysPageSize.hh"
 #include "XrdSys/XrdSysPlatform.hh"
 #include "XrdSys/XrdSysPthread.hh"
 
 #include "XrdOuc/XrdOuca2x.hh"
+#include "XrdOuc/XrdOucCRC.hh"
 #include "XrdOuc/XrdOucEnv.hh"
 #include "XrdOuc/XrdOucERoute.hh"
 #include "XrdOuc/XrdOucLock.hh"
@@ -175,6 +179,7 @@ XrdOfs::XrdOfs() : tpcRdrHost{}, tpcRdrPort{}
    Cks       = 0;
    CksPfn    = true;
    CksRdr    = true;
+   CksWrite  = false;
 
 // Prepare handling
 //
@@ -636,6 +641,7 @@ int XrdOfsFile::open(const char          *path,      // In
           return XrdOfsFS->Emsg(epname, error, EALREADY, "tpc", path);
        XrdOfsFS->ocMutex.Lock(); oh = oP.hP; XrdOfsFS->ocMutex.UnLock();
        FTRACE(open, "attach use=" <<oh->Usage());
+       if (oh->CksRun() && (open_flag & O_TRUNC)) oh->CksRun()->Truncate(0);
        if (oP.poscNum > 0) XrdOfsFS->poscQ->Commit(path, oP.poscNum);
        oP.hP->UnLock(); 
        OfsStats.sdMutex.Lock();
@@ -692,6 +698,11 @@ int XrdOfsFile::open(const char          *path,      // In
        dorawio = (open_mode & SFS_O_RAWIO ? 1 : 0);
       }
    oP.hP->Activate(oP.fP);
+
+// If the file starts out empty we can checksum it as it is being written
+//
+   if (XrdOfsFS->CksWrite && (open_flag & (O_CREAT | O_TRUNC)))
+      oP.hP->SetCksRun(XrdOfsCksStream::Alloc(XrdOfsFS->Cks));
    oP.hP->UnLock();
 
 // Send an open event if we must
@@ -799,6 +810,12 @@ int XrdOfsFile::close()  // In
        myCKP = 0;
       }
 
+// If this is the last close of a file whose checksum was computed as it was
+// written, record the checksum. Failures here only mean that the checksum
+// will need to be computed when it is asked for.
+//
+   if (hP->CksRun() && !viaDel && hP->Usage() == 1) CksStore(hP);
+
 // We need to handle the cunudrum that an event may have to be sent upon
 // the final close. However, that would cause the path name to be destroyed.
 // So, we have two modes of logic where we copy out the pathname if a final
@@ -949,6 +966,11 @@ int            XrdOfsFile::CreateCKP()
        myCKP = (XrdOucChkPnt *)resp;
       } else myCKP = new XrdOfsChkPnt(oh->Select(), oh->Name());
 
+// Checkpointed updates may be rolled back so we can no longer rely on a
+// running checksum.
+//
+   if (oh->CksRun()) oh->CksRun()->Invalidate();
+
 // All done
 //
    return 0;
@@ -1170,6 +1192,95 @@ int XrdOfsFile::read(XrdSfsAio *aiop)
    return SFS_OK;
 }
 
+/******************************************************************************/
+/*                            p g R e a d   A I O                             */
+/******************************************************************************/
+
+namespace
+{
+// Page reads are done as an ordinary asynchronous read with the checksums
+// computed upon completion, exactly as the synchronous pgRead() does it. This
+// object stands in for the caller's aio object while the read is in flight.
+//
+class PgReadAio : public XrdSfsAio
+{
+public:
+
+void doneRead()
+        {if (Result > 0)
+            {XrdOucCRC::Calc32C((const void *)sfsAio.aio_buf, Result, callerP->cksVec);
+             if (netOrder)
+                {int n = (Result + XrdSys::PageSize - 1) / XrdSys::PageSize;
+                 for (int i = 0; i < n; i++)
+                     callerP->cksVec[i] = htonl(callerP->cksVec[i]);
+                }
+            }
+         callerP->Result = Result;
+         callerP->doneRead();
+         delete this;
+        }
+
+void doneWrite() {}
+
+void Recycle() {delete this;}
+
+     PgReadAio(XrdSfsAio *aiop, bool netord)
+              : callerP(aiop), netOrder(netord)
+              {sfsAio.aio_buf    = aiop->sfsAio.aio_buf;
+               sfsAio.aio_nbytes = aiop->sfsAio.aio_nbytes;
+               sfsAio.aio_offset = aiop->sfsAio.aio_offset;
+               TIdent            = aiop->TIdent;
+              }
+    ~PgReadAio() {}
+
+private:
+
+XrdSfsAio *callerP;
+bool       netOrder;
+};
+}
+
+/*
+  Function: Read file pages and compute their checksums using asynchronous
+            I/O, if possible.
+
+  Input:    aiop      - A aio request object.
+            opts      - pgRead() processing options.
+
+  Output:   Returns the 0 if successfullt queued, otherwise returns an error.
+            The request is handled synchronously when the request is not page
+            aligned or the file is compressed.
+*/
+
+int XrdOfsFile::pgRead(XrdSfsAio *aiop, uint64_t opts)
+{
+   EPNAME("aiopgread");
+   PgReadAio *pgaP;
+   int rc;
+
+// Let the synchronous path deal with anything out of the ordinary
+//
+   if (oh->isCompressed || (aiop->sfsAio.aio_offset & XrdSys::PageMask)
+   ||  !aiop->cksVec)
+      return XrdSfsFile::pgRead(aiop, opts);
+
+// Perform required tracing
+//
+   FTRACE(aio, aiop->sfsAio.aio_nbytes <<"@" <<aiop->sfsAio.aio_offset);
+
+// Issue the read. Only true errors are returned here.
+//
+   pgaP = new PgReadAio(aiop, (opts & XrdSfsFile::NetOrder) != 0);
+   if ((rc = oh->Select().Read(pgaP)) < 0)
+      {delete pgaP;
+       return XrdOfsFS->Emsg(epname, error, rc, "read", oh->Name());
+      }
+
+// All done
+//
+   return SFS_OK;
+}
+
 /******************************************************************************/
 /*                                 w r i t e                                  */
 /******************************************************************************/
@@ -1219,6 +1330,10 @@ XrdSfsXferSize XrdOfsFile::write(XrdSfsFileOffset  offset,    // In
    if (nbytes < 0)
       return XrdOfsFS->Emsg(epname, error, (int)nbytes, "write", oh);
 
+// Fold the data into the running checksum, if any
+//
+   if (oh->CksRun()) oh->CksRun()->Update((off_t)offset, buff, (int)nbytes);
+
 // Return number of bytes written
 //
    return nbytes;
@@ -1241,8 +1356,10 @@ int XrdOfsFile::write(XrdSfsAio *aiop)
 
 // If this is a POSC file, we must convert the async call to a sync call as we
 // must trap any errors that unpersist the file. We can't do that via aio i/f.
+// The same holds when the checksum is computed as the file is written as we
+// need to see the data in the order it was successfully written.
 //
-   if (oh->isRW == XrdOfsHandle::opPC)
+   if (oh->isRW == XrdOfsHandle::opPC || oh->CksRun())
       {aiop->Result = this->write(aiop->sfsAio.aio_offset,
                                   (const char *)aiop->sfsAio.aio_buf,
                                   aiop->sfsAio.aio_nbytes);
@@ -1425,6 +1542,10 @@ int XrdOfsFile::truncate(XrdSfsFileOffset  flen)  // In
    if ((retc = oh->Select().Ftruncate(flen)))
       return XrdOfsFS->Emsg(epname, error, retc, "truncate", oh);
 
+// Account for the truncation in the running checksum, if any
+//
+   if (oh->CksRun()) oh->CksRun()->Truncate((off_t)flen);
+
 // Indicate Success
 //
    return SFS_OK;
@@ -1456,6 +1577,34 @@ int XrdOfsFile::getCXinfo(char cxtype[4], int &cxrsz)
 /******************************************************************************/
 /*                  P r i v a t e   F i l e   M e t h o d s                   */
 /******************************************************************************/
+/******************************************************************************/
+/* private                      C k s S t o r e                               */
+/******************************************************************************/
+
+// The handle must be locked upon entry!
+
+void XrdOfsFile::CksStore(XrdOfsHandle *hP)
+{
+   EPNAME("close");
+   XrdCksData cksData;
+   const char *Path = hP->Name();
+   char buff[MAXPATHLEN+8];
+   int rc;
+
+// Obtain the checksum that was computed as the file was written
+//
+   if (!(hP->CksRun()->Finish(cksData))) return;
+
+// Convert the lfn to a pfn if need be and record the checksum
+//
+   if (XrdOfsFS->CksPfn && !(Path = XrdOfsOss->Lfn2Pfn(Path,buff,MAXPATHLEN,rc)))
+      {OfsEroute.Emsg(epname, rc, "set checksum for", hP->Name());
+       return;
+      }
+   if ((rc = XrdOfsFS->Cks->Set(Path, cksData)))
+      OfsEroute.Emsg(epname, rc, "set checksum for", hP->Name());
+}
+
 /******************************************************************************/
 /* protected                  G e n F W E v e n t                             */
 /******************************************************************************/
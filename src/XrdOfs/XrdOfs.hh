@@ -153,6 +153,8 @@ public:
 
         int            read(XrdSfsAio *aioparm);
 
+        int            pgRead(XrdSfsAio *aioparm, uint64_t opts=0);
+
         XrdSfsXferSize write(XrdSfsFileOffset   fileOffset,
                              const char        *buffer,
                              XrdSfsXferSize     buffer_size);
@@ -185,6 +187,7 @@ bool           ckpBad;
 
 private:
 
+void           CksStore(XrdOfsHandle *hP);
 void           GenFWEvent();
 int            CreateCKP();
 };
@@ -442,6 +445,7 @@ XrdOfsPrepare    *prepHandler;    // Plugin   prepare
 XrdCks           *Cks;            // Checksum manager
 bool              CksPfn;         // Checksum needs a pfn
 bool              CksRdr;         // Checksum may be redirected (i.e. not local)
+bool              CksWrite;       // Checksum computed as file is written
 bool              prepAuth;       // Prepare requires authorization
 char              OssIsProxy;     // !0 if we detect the oss plugin is a proxy
 char              myRType[4];     // Role type for consistency with the cms
@@ -487,6 +491,7 @@ int           FSctl(XrdOfsFile &file, int cmd, int alen, const char *args,
                     const XrdSecEntity *client);
 int           Reformat(XrdOucErrInfo &);
 const char   *theRole(int opts);
+int           xckw(XrdOucStream &, XrdSysError &);
 int           xcrds(XrdOucStream &, XrdSysError &);
 int           xdirl(XrdOucStream &, XrdSysError &);
 int           xexp(XrdOucStream &, XrdSysError &, bool);
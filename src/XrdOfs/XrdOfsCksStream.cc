@@ -0,0 +1,114 @@
+/******************************************************************************/
+/*                                                                            */
+/*                    X r d O f s C k s S t r e a m . c c                     */
+/*                                                                            */
+/* (c) 2026 by European Organization for Nuclear Research (CERN)              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <fcntl.h>
+
+#include "XrdCks/XrdCks.hh"
+#include "XrdCks/XrdCksCalc.hh"
+#include "XrdCks/XrdCksData.hh"
+#include "XrdOfs/XrdOfsCksStream.hh"
+
+/******************************************************************************/
+/*                            D e s t r u c t o r                             */
+/******************************************************************************/
+
+XrdOfsCksStream::~XrdOfsCksStream()
+{
+   if (csCalc) csCalc->Recycle();
+}
+
+/******************************************************************************/
+/*                                 A l l o c                                  */
+/******************************************************************************/
+  
+XrdOfsCksStream *XrdOfsCksStream::Alloc(XrdCks *cksP)
+{
+   XrdCksCalc *cP;
+
+// Get a calculator for the default checksum
+//
+   if (!cksP || !(cP = cksP->Object(0))) return 0;
+   cP->Init();
+   return new XrdOfsCksStream(cP);
+}
+
+/******************************************************************************/
+/*                                F i n i s h                                 */
+/******************************************************************************/
+  
+bool XrdOfsCksStream::Finish(XrdCksData &cksData)
+{
+   XrdSysMutexHelper mHelp(csMutex);
+   const char *csName;
+   char *csVal;
+   int csLen;
+
+// Only a valid checksum may be returned
+//
+   if (!isValid) return false;
+
+// Fill out the checksum data
+//
+   if (!(csName = csCalc->Type(csLen)) || !cksData.Set(csName)
+   ||  !(csVal  = csCalc->Final())
+   ||  !cksData.Set(static_cast<const void *>(csVal), csLen)) return false;
+
+// The calculation is now finished
+//
+   isValid = false;
+   return true;
+}
+
+/******************************************************************************/
+/*                              T r u n c a t e                               */
+/******************************************************************************/
+  
+void XrdOfsCksStream::Truncate(off_t flen)
+{
+   XrdSysMutexHelper mHelp(csMutex);
+
+// We can only account for a truncate that does not change the data seen
+//
+   if (flen != csNext) isValid = false;
+}
+
+/******************************************************************************/
+/*                                U p d a t e                                 */
+/******************************************************************************/
+  
+void XrdOfsCksStream::Update(off_t offset, const char *buff, int blen)
+{
+   XrdSysMutexHelper mHelp(csMutex);
+
+// Fold in the data only if it directly follows what we have seen. Otherwise,
+// the checksum will have to be computed the hard way.
+//
+   if (!isValid || blen <= 0) return;
+   if (offset != csNext) {isValid = false; return;}
+   csCalc->Update(buff, blen);
+   csNext += blen;
+}
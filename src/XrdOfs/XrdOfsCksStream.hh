@@ -0,0 +1,106 @@
+#ifndef __XRDOFSCKSSTREAM_HH__
+#define __XRDOFSCKSSTREAM_HH__
+/******************************************************************************/
+/*                                                                            */
+/*                    X r d O f s C k s S t r e a m . h h                     */
+/*                                                                            */
+/* (c) 2026 by European Organization for Nuclear Research (CERN)              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <sys/types.h>
+
+#include "XrdSys/XrdSysPthread.hh"
+
+//-----------------------------------------------------------------------------
+//! The XrdOfsCksStream class maintains a running checksum for a file that is
+//! being written sequentially. It is attached to the file handle so that all
+//! writers of the file feed the same state. Data is folded in only as long as
+//! it arrives in order; any gap, overwrite, or shortening of the file turns
+//! the object invalid and the checksum is then left to be computed on demand.
+//-----------------------------------------------------------------------------
+
+class XrdCks;
+class XrdCksCalc;
+class XrdCksData;
+
+class XrdOfsCksStream
+{
+public:
+
+//-----------------------------------------------------------------------------
+//! Allocate a running checksum for the default checksum algorithm.
+//!
+//! @param  cksP    - Pointer to the checksum manager.
+//!
+//! @return Pointer to the object or nil if the default algorithm cannot be
+//!         calculated on the fly.
+//-----------------------------------------------------------------------------
+
+static XrdOfsCksStream *Alloc(XrdCks *cksP);
+
+//-----------------------------------------------------------------------------
+//! Obtain the final checksum.
+//!
+//! @param  cksData - Where the checksum name, length, and value are placed.
+//!
+//! @return True if the checksum is valid and false otherwise.
+//-----------------------------------------------------------------------------
+
+        bool  Finish(XrdCksData &cksData);
+
+//-----------------------------------------------------------------------------
+//! Invalidate the running checksum (e.g. the data was changed out of band).
+//-----------------------------------------------------------------------------
+
+        void  Invalidate() {csMutex.Lock(); isValid = false; csMutex.UnLock();}
+
+//-----------------------------------------------------------------------------
+//! Account for a truncation of the file.
+//!
+//! @param  flen    - The new length of the file.
+//-----------------------------------------------------------------------------
+
+        void  Truncate(off_t flen);
+
+//-----------------------------------------------------------------------------
+//! Account for data that has been successfully written to the file.
+//!
+//! @param  offset  - The file offset at which the data was written.
+//! @param  buff    - Pointer to the data.
+//! @param  blen    - The number of bytes written.
+//-----------------------------------------------------------------------------
+
+        void  Update(off_t offset, const char *buff, int blen);
+
+              XrdOfsCksStream(XrdCksCalc *cP) : csCalc(cP), csNext(0),
+                                                isValid(true) {}
+             ~XrdOfsCksStream();
+
+private:
+
+XrdSysMutex  csMutex;
+XrdCksCalc  *csCalc;
+off_t        csNext;
+bool         isValid;
+};
+#endif
@@ -337,6 +337,19 @@ int XrdOfs::Configure(XrdSysError &Eroute, XrdOucEnv *EnvInfo) {
        FeatureSet |= XrdSfs::hasPRXY;
       } else if (!(Options & isManager) && !XrdOfsConfigCP::Init()) NoGo = 1;
 
+// Checksums can only be computed while writing on a real data server
+//
+   if (CksWrite)
+      {const char *why = 0;
+       if (!Cks) why = "checksums are not enabled";
+          else if (OssIsProxy) why = "the osslib plugin is a proxy";
+          else if (Options & isManager) why = "not a data server";
+       if (why)
+          {Eroute.Say("Config warning: ckswrite turned off; ", why);
+           CksWrite = false;
+          }
+      }
+
 // If POSC processing is enabled (as by default) do it. Warning! This must be
 // the last item in the configuration list as we need a working filesystem.
 // Note that in proxy mode we always disable posc!
@@ -383,11 +396,13 @@ void XrdOfs::Config_Display(XrdSysError &Eroute)
                                   "       all.role %s\n"
                                   "%s"
                                   "       ofs.maxdelay   %d\n"
+                                  "%s"
                                   "       ofs.persist    %s hold %d%s%s\n"
                                   "       ofs.trace      %x",
               cloc, myRole,
               (Options & Authorize ? "       ofs.authorize\n" : ""),
                MaxDelay,
+              (CksWrite ? "       ofs.ckswrite   on\n" : ""),
                pval, poscHold, (poscLog ? " logdir " : ""),
                (poscLog ? poscLog    : ""), OfsTrace.What);
 
@@ -725,6 +740,7 @@ int XrdOfs::ConfigXeq(char *var, XrdOucStream &Config,
     TS_XPI("authlib",       theAutLib);
     TS_XPI("ckslib",        theCksLib);
     TS_Xeq("cksrdsz",       xcrds);
+    TS_Xeq("ckswrite",      xckw);
     TS_XPI("cmslib",        theCmsLib);
     TS_XPI("ctllib",        theCtlLib);
     TS_Xeq("dirlist",       xdirl);
@@ -762,18 +778,58 @@ int XrdOfs::ConfigXeq(char *var, XrdOucStream &Config,
     return 0;
 }
 
+/******************************************************************************/
+/*                                  x c k w                                   */
+/******************************************************************************/
+  
+/* Function: xckw
+
+   Purpose:  To parse the directive: ckswrite {off | on}
+
+             off     checksums are only computed when they are requested. This
+                     is the default.
+             on      the default checksum of a newly created or truncated file
+                     is computed as the file is written and is recorded when
+                     the file is closed. This only succeeds if the file was
+                     written sequentially; otherwise, the checksum is computed
+                     when it is requested.
+
+  Output: 0 upon success or !0 upon failure.
+*/
+
+int XrdOfs::xckw(XrdOucStream &Config, XrdSysError &Eroute)
+{
+   char *val;
+
+// Get the parameter
+//
+   if (!(val = Config.GetWord()) || !val[0])
+      {Eroute.Emsg("Config", "ckswrite parameter not specified"); return 1;}
+
+// Set appropriate option
+//
+        if (!strcmp(val, "on"))  CksWrite = true;
+   else if (!strcmp(val, "off")) CksWrite = false;
+   else {Eroute.Emsg("Config", "Invalid ckswrite parameter -", val); return 1;}
+
+   return 0;
+}
+
 /******************************************************************************/
 /*                                 x c r d s                                  */
 /******************************************************************************/
   
 /* Function: xcrds
 
-   Purpose:  To parse the directive: cksrdsz <size>
+   Purpose:  To parse the directive: cksrdsz <size> [threads <n>]
 
              <size>  number of bytes to segment reads when calclulating a
                      checksum. Can be suffixed by k,m,g. Maximum is 1g and
                      is automatically set to be atleast 64k and to be a
                      multiple of 64k.
+             <n>     maximum number of threads used to checksum a large file
+                     in parallel segments (adler32 and crc32 only). The
+                     default is the number of cpus up to 4.
 
   Output: 0 upon success or !0 upon failure.
 */
@@ -783,6 +839,7 @@ int XrdOfs::xcrds(XrdOucStream &Config, XrdSysError &Eroute)
    static const long long maxRds = 1024*1024*1024;
    char *val;
    long long rdsz;
+   int nthr = 0;
 
 // Get the size
 //
@@ -792,7 +849,18 @@ int XrdOfs::xcrds(XrdOucStream &Config, XrdSysError &Eroute)
 // Now convert it
 //
    if (XrdOuca2x::a2sz(Eroute, "cksrdsz size", val, &rdsz, 1, maxRds)) return 1;
-   ofsConfig->SetCksRdSz(static_cast<int>(rdsz));
+
+// Get optional thread count
+//
+   if ((val = Config.GetWord()) && val[0])
+      {if (strcmp(val, "threads"))
+          {Eroute.Emsg("Config", "invalid cksrdsz option -", val); return 1;}
+       if (!(val = Config.GetWord()) || !val[0])
+          {Eroute.Emsg("Config", "cksrdsz threads not specified"); return 1;}
+       if (XrdOuca2x::a2i(Eroute, "cksrdsz threads", val, &nthr, 1, 64))
+          return 1;
+      }
+   ofsConfig->SetCksRdSz(static_cast<int>(rdsz), nthr);
    return 0;
 }
   
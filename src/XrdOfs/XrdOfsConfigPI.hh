@@ -224,9 +224,10 @@ bool   Push(TheLib what, const char *plugP, const char *parmP=0);
 //! Set the checksum read size
 //!
 //! @param   rdsz    The chesum read size buffer.
+//! @param   nthr    The maximum threads for a checksum (0 -> default).
 //-----------------------------------------------------------------------------
 
-void   SetCksRdSz(int rdsz);
+void   SetCksRdSz(int rdsz, int nthr=0);
 
 //-----------------------------------------------------------------------------
 //! Destructor
@@ -310,6 +311,7 @@ std::vector<ctlLP> ctlVec;
 
 char         *CksAlg;
 int           CksRdsz;
+int           CksThrds;
 bool          pushOK[maxXXXLib];
 bool          defLib[maxXXXLib];
 bool          ossXAttr;
@@ -33,6 +33,9 @@
 #include <sys/errno.h>
 #include <sys/types.h>
 
+#include <atomic>
+
+#include "XrdOfs/XrdOfsCksStream.hh"
 #include "XrdOfs/XrdOfsHandle.hh"
 #include "XrdOfs/XrdOfsStats.hh"
 #include "XrdOss/XrdOss.hh"
@@ -226,6 +229,63 @@ static XrdOfsHanPsc  *Free;
 XrdSysMutex    XrdOfsHanPsc::pscMutex;
 XrdOfsHanPsc  *XrdOfsHanPsc::Free = 0;
 
+/******************************************************************************/
+/*                          X r d O f s H a n E x t                           */
+/******************************************************************************/
+
+// Handles are only allocated by XrdOfsHandle::Alloc() and so are really of
+// this class. It holds what lock-free lookups need without changing the
+// layout of XrdOfsHandle, which plugins see.
+//
+class XrdOfsHanExt : public XrdOfsHandle
+{
+public:
+
+std::atomic<XrdOfsHandle *> hashNext; // Next handle in the hash chain
+std::atomic<unsigned int>   peekHash; // Path hash if Peek() may find it or 0
+XrdOfsCksStream            *cksRun;   // -> Running checksum for writes
+
+static XrdOfsHanExt *Of(XrdOfsHandle *hP)
+                       {return static_cast<XrdOfsHanExt *>(hP);}
+
+               XrdOfsHanExt() : hashNext(0), peekHash(0), cksRun(0) {}
+              ~XrdOfsHanExt() {}
+};
+
+/******************************************************************************/
+/*                       X r d O f s H a n S t r i p e                        */
+/******************************************************************************/
+
+// The r/o and r/w handle spaces are each split into stripes by the top bits
+// of the path hash so that opens and closes of unrelated files rarely contend.
+//
+class XrdOfsHanStripe
+{
+public:
+
+static const int tabShift = 27;                  // Top 5 bits of the hash
+static const int tabNum   = 1 << (32 - tabShift);
+
+inline void    Lock()   {tabMutex.Lock();}
+inline void    UnLock() {tabMutex.UnLock();}
+
+XrdOfsHanTab   Table;
+
+               XrdOfsHanStripe() : Table(34, 55) {}
+              ~XrdOfsHanStripe() {} // Never gets deleted
+private:
+
+XrdSysMutex    tabMutex;
+};
+
+namespace
+{
+XrdOfsHanStripe roStripe[XrdOfsHanStripe::tabNum]; // File handles open r/o
+XrdOfsHanStripe rwStripe[XrdOfsHanStripe::tabNum]; // File Handles open r/w
+
+const int       MaxHops = 64;  // Longest chain Peek() will follow
+}
+
 /******************************************************************************/
 /*                     E x t e r n a l   L i n k a g e s                      */
 /******************************************************************************/
@@ -245,8 +305,6 @@ extern XrdOfsStats OfsStats;
 /******************************************************************************/
   
 XrdSysMutex   XrdOfsHandle::myMutex;
-XrdOfsHanTab  XrdOfsHandle::roTable;
-XrdOfsHanTab  XrdOfsHandle::rwTable;
 XrdOssDF     *XrdOfsHandle::ossDF = (XrdOssDF *)new XrdOfsHanOss;
 XrdOfsHandle *XrdOfsHandle::Free = 0;
 
@@ -260,33 +318,43 @@ XrdOfsHandle *XrdOfsHandle::Free = 0;
 int XrdOfsHandle::Alloc(const char *thePath, int Opts, XrdOfsHandle **Handle)
 {
    XrdOfsHandle *hP;
-   XrdOfsHanTab *theTable = (Opts & opRW ? &rwTable : &roTable);
    XrdOfsHanKey theKey(thePath, (int)strlen(thePath));
+   XrdOfsHanStripe &theStripe = Stripe(Opts & opRW, theKey.Hash);
    int          retc;
 
-// Lock the search table and try to find the key. If found, increment the
-// the link count (can only be done with the global lock) then release the
+// Files opened r/o are usually shared, so first try to find the handle without
+// taking any lock. If found, Peek() has already added our reference.
+//
+   if (!(Opts & opRW) && (hP = theStripe.Table.Peek(theKey)))
+      {if (hP->WaitLock()) {*Handle = hP; return 0;}
+       hP->Drop();
+       return nolokDelay;
+      }
+
+// Lock the table stripe and try to find the key. If found, increment the
+// the link count (can only be done with the stripe lock) then release the
 // lock and try to lock the handle. It can't escape between lock calls because
 // the link count is positive. If we can't lock the handle then it must be the
 // that a long running operation is occuring. Return the handle to its former
 // state and return a delay. Otherwise, return the handle.
 //
-   myMutex.Lock();
-   if ((hP = theTable->Find(theKey)))
-      {hP->Path.Links++; myMutex.UnLock();
+   theStripe.Lock();
+   if ((hP = theStripe.Table.Find(theKey)))
+      {__atomic_add_fetch(&hP->Path.Links, 1, __ATOMIC_RELAXED);
+       theStripe.UnLock();
        if (hP->WaitLock()) {*Handle = hP; return 0;}
-       myMutex.Lock(); hP->Path.Links--; myMutex.UnLock();
+       hP->Drop();
        return nolokDelay;
       }
 
 // Get a new handle
 //
-   if (!(retc = Alloc(theKey, Opts, Handle))) theTable->Add(*Handle);
+   if (!(retc = Alloc(theKey, Opts, Handle))) theStripe.Table.Add(*Handle);
+   theStripe.UnLock();
    OfsStats.Add(OfsStats.Data.numHandles);
 
 // All done
 //
-   myMutex.UnLock();
    return retc;
 }
 
@@ -299,10 +367,10 @@ int XrdOfsHandle::Alloc(XrdOfsHandle **Handle)
     XrdOfsHanKey myKey("dummy", 5);
     int retc;
 
-    myMutex.Lock();
-    if (!(retc = Alloc(myKey, 0, Handle))) 
-       {(*Handle)->Path.Links = 0; (*Handle)->UnLock();}
-    myMutex.UnLock();
+    if (!(retc = Alloc(myKey, 0, Handle)))
+       {__atomic_store_n(&(*Handle)->Path.Links, 0, __ATOMIC_RELAXED);
+        (*Handle)->UnLock();
+       }
     return retc;
 }
 
@@ -317,15 +385,20 @@ int XrdOfsHandle::Alloc(XrdOfsHanKey theKey, int Opts, XrdOfsHandle **Handle)
 
 // No handle currently in the table. Get a new one off the free list
 //
-   if (!Free && (hP = new XrdOfsHandle[minAlloc]))
-      {int i = minAlloc; while(i--) {hP->Next = Free; Free = hP; hP++;}}
+   myMutex.Lock();
+   if (!Free)
+      {XrdOfsHanExt *xP = new XrdOfsHanExt[minAlloc];
+       int i = minAlloc; while(i--) {xP->Next = Free; Free = xP; xP++;}
+      }
    if ((hP = Free)) Free = hP->Next;
+   myMutex.UnLock();
 
-// Initialize the new handle, if we have one, and add it to the table
+// Initialize the new handle, if we have one, and add it to the table. The
+// link count is set last as a non-zero count makes the handle visible to
+// Peek() (hence, it must be fully set up and locked at that point).
 //
    if (hP)
       {hP->Path         = theKey;
-       hP->Path.Links   = 1;
        hP->isChanged    = 0;                       // File changed
        hP->isCompressed = 0;                       // Compression
        hP->isPending    = 0;                       // Pending output
@@ -333,12 +406,25 @@ int XrdOfsHandle::Alloc(XrdOfsHanKey theKey, int Opts, XrdOfsHandle **Handle)
        hP->ssi          = ossDF;                   // No storage system yet
        hP->Posc         = 0;                       // No creator
        hP->Lock();                                 // Wait is not possible
+       XrdOfsHanExt::Of(hP)->cksRun = 0;           // No running checksum
+       XrdOfsHanExt::Of(hP)->peekHash.store((Opts & opRW ? 0 : theKey.Hash),
+                                            std::memory_order_relaxed);
+       __atomic_store_n(&hP->Path.Links, 1, __ATOMIC_RELEASE);
        *Handle = hP;
        return 0;
       }
    return nomemDelay;                              // Delay client
 }
   
+/******************************************************************************/
+/* public                         C k s R u n                                 */
+/******************************************************************************/
+
+XrdOfsCksStream *XrdOfsHandle::CksRun()
+{
+   return XrdOfsHanExt::Of(this)->cksRun;
+}
+
 /******************************************************************************/
 /* static public                    H i d e                                   */
 /******************************************************************************/
@@ -351,10 +437,13 @@ void XrdOfsHandle::Hide(const char *thePath)
 // Lock the search table and try to find the key in each table. If found,
 // clear the length field to effectively hide the item.
 //
-   myMutex.Lock();
-   if ((hP = roTable.Find(theKey))) hP->Path.Len = 0;
-   if ((hP = rwTable.Find(theKey))) hP->Path.Len = 0;
-   myMutex.UnLock();
+   for (int i = 0; i < 2; i++)
+       {XrdOfsHanStripe &theStripe = Stripe(i, theKey.Hash);
+        theStripe.Lock();
+        if ((hP = theStripe.Table.Find(theKey)))
+           {XrdOfsHanExt::Of(hP)->peekHash = 0; hP->Path.Len = 0;}
+        theStripe.UnLock();
+       }
 }
 
 /******************************************************************************/
@@ -373,7 +462,7 @@ int XrdOfsHandle::PoscGet(short &Mode, int Done)
        Mode = Posc->Mode;
        if (Done)
           {pP = Posc; Posc = 0;
-           if (pP->xprP) {myMutex.Lock(); Path.Links--; myMutex.UnLock();}
+           if (pP->xprP) __atomic_sub_fetch(&Path.Links, 1, __ATOMIC_RELAXED);
            pP->Recycle();
           }
        return pnum;
@@ -454,30 +543,35 @@ const char *XrdOfsHandle::PoscUsr()
 
 int XrdOfsHandle::Retire(int &retc, long long *retsz, char *buff, int blen)
 {
+   XrdOfsHanStripe &theStripe = Stripe(isRW, Path.Hash);
    XrdOssDF *mySSI;
    int numLeft;
 
-// Get the global lock as the links field can only be manipulated with it.
-// Decrement the links count and if zero, remove it from the table and
-// place it on the free list. Otherwise, it is still in use.
+// Get the stripe lock as the handle can only be removed with it. Decrement
+// the links count and if zero, remove it from the table and place it on the
+// free list. Otherwise, it is still in use.
 //
    retc = 0;
-   myMutex.Lock();
-   if (Path.Links == 1)
+   theStripe.Lock();
+   if (!(numLeft = __atomic_sub_fetch(&Path.Links, 1, __ATOMIC_ACQ_REL)))
       {if (buff) strlcpy(buff, Path.Val, blen);
-       numLeft = 0; OfsStats.Dec(OfsStats.Data.numHandles);
-       if ( (isRW ? rwTable.Remove(this) : roTable.Remove(this)) )
-         {if (Posc) {Posc->Recycle(); Posc = 0;}
+       OfsStats.Dec(OfsStats.Data.numHandles);
+       if (theStripe.Table.Remove(this))
+         {theStripe.UnLock();
+          if (Posc) {Posc->Recycle(); Posc = 0;}
+          XrdOfsHanExt *xP = XrdOfsHanExt::Of(this);
+          if (xP->cksRun) {delete xP->cksRun; xP->cksRun = 0;}
+          xP->peekHash.store(0, std::memory_order_relaxed);
           if (Path.Val) {free((void *)Path.Val); Path.Val = (char *)"";}
-          Path.Len = 0; mySSI = ssi; ssi = ossDF;
-          Next = Free; Free = this; UnLock(); myMutex.UnLock();
+          Path.Len = 0; mySSI = ssi; ssi = ossDF; UnLock();
+          myMutex.Lock(); Next = Free; Free = this; myMutex.UnLock();
           if (mySSI && mySSI != ossDF)
              {retc = mySSI->Close(retsz); delete mySSI;}
          } else {
-          UnLock(); myMutex.UnLock();
+          UnLock(); theStripe.UnLock();
           OfsEroute.Emsg("Retire", "Lost handle to", buff);
         }
-      } else {numLeft = --Path.Links; UnLock(); myMutex.UnLock();}
+      } else {UnLock(); theStripe.UnLock();}
    return numLeft;
 }
 
@@ -492,14 +586,11 @@ int XrdOfsHandle::Retire(XrdOfsHanCB *cbP, int hTime)
 // The handle can only be held by one reference and only if it's a POSC and
 // defered handling was properly set up.
 //
-   myMutex.Lock();
    if (!Posc || !allOK)
       {OfsEroute.Emsg("Retire", "ignoring deferred retire of", Path.Val);
-       if (Path.Links != 1 || !Posc || !cbP) myMutex.UnLock();
-          else {myMutex.UnLock(); cbP->Retired(this);}
+       if (Usage() == 1 && Posc && cbP) cbP->Retired(this);
        return Retire(retc);
       }
-   myMutex.UnLock();
 
 // If this object already has an xpr object (happens for bouncing connections)
 // then reuse that object. Otherwise create a new one and put it on the queue.
@@ -512,6 +603,15 @@ int XrdOfsHandle::Retire(XrdOfsHanCB *cbP, int hTime)
    return 0;
 }
 
+/******************************************************************************/
+/* public                      S e t C k s R u n                              */
+/******************************************************************************/
+
+void XrdOfsHandle::SetCksRun(XrdOfsCksStream *csP)
+{
+   XrdOfsHanExt::Of(this)->cksRun = csP;
+}
+
 /******************************************************************************/
 /* public                       S t a r t X p r                               */
 /******************************************************************************/
@@ -551,16 +651,11 @@ do{xP = XrdOfsHanXpr::Get(); hP = xP->Handle;
             hP->UnLock(); delete xP; continue;
            }
 
-// As the handle is locked we can get the global handle lock to prevent
-// additions and removals of handles as we need a stable reference count to
-// effect the callout, if any. Do so only if the reference count is one (for us)
-// and the handle is active. In all cases, drop the global lock.
+// As the handle is locked, effect the callout, if any, only if the reference
+// count is one (for us) and the handle is active. POSC handles are r/w and so
+// can only gain a reference via the locked path, which waits for our lock.
 //
-   myMutex.Lock();
-   if (hP->Path.Links != 1 || !xP->Call) myMutex.UnLock();
-      else {myMutex.UnLock();
-            xP->Call->Retired(hP);
-           }
+   if (hP->Usage() == 1 && xP->Call) xP->Call->Retired(hP);
 
 // We can now officially retire the handle and delete the xpr object
 //
@@ -583,7 +678,52 @@ void XrdOfsHandle::Suppress(int rrc, int wrc)
 }
 
 /******************************************************************************/
-/* public                       W a i t L o c k                               */
+/* private                         D r o p                                    */
+/******************************************************************************/
+
+// Undo a reference added by Alloc() when the handle could not be used. If the
+// owner retired in the meantime ours is the last reference and we must retire.
+
+void XrdOfsHandle::Drop()
+{
+   unsigned int n = __atomic_load_n(&Path.Links, __ATOMIC_RELAXED);
+   int retc;
+
+   while(n > 1) if (__atomic_compare_exchange_n(&Path.Links, &n, n-1, true,
+                                                __ATOMIC_ACQ_REL,
+                                                __ATOMIC_RELAXED)) return;
+   Lock(); Retire(retc);
+}
+
+/******************************************************************************/
+/* private                          P i n                                     */
+/******************************************************************************/
+
+// Add a reference without any lock. This fails if the handle is free or being
+// retired as only Retire() may take the count from one to zero.
+
+bool XrdOfsHandle::Pin()
+{
+   unsigned int n = __atomic_load_n(&Path.Links, __ATOMIC_RELAXED);
+
+   while(n) if (__atomic_compare_exchange_n(&Path.Links, &n, n+1, true,
+                                            __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED))
+               return true;
+   return false;
+}
+
+/******************************************************************************/
+/* static private                 S t r i p e                                 */
+/******************************************************************************/
+
+XrdOfsHanStripe &XrdOfsHandle::Stripe(int rw, unsigned int hash)
+{
+   return (rw ? rwStripe : roStripe)[hash >> XrdOfsHanStripe::tabShift];
+}
+
+/******************************************************************************/
+/* private                      W a i t L o c k                               */
 /******************************************************************************/
   
 int XrdOfsHandle::WaitLock(void)
@@ -668,11 +808,13 @@ void XrdOfsHanTab::Add(XrdOfsHandle *hip)
 //
    if (++nashnum > Threshold) Expand();
 
-// Add the entry to the table
+// Add the entry to the table. The entry must be complete before it is linked
+// in as Peek() may see it immediately.
 //
    kent = hip->Path.Hash % nashtablesize;
-   hip->Next = nashtable[kent];
-   nashtable[kent] = hip;
+   XrdOfsHanExt::Of(hip)->hashNext.store(nashtable[kent],
+                                         std::memory_order_relaxed);
+   __atomic_store_n(&nashtable[kent], hip, __ATOMIC_RELEASE);
 }
   
 /******************************************************************************/
@@ -700,20 +842,22 @@ void XrdOfsHanTab::Expand()
    for (i = 0; i < nashtablesize; i++)
        {nip = nashtable[i];
         while(nip)
-             {nextnip = nip->Next;
+             {XrdOfsHanExt *xP = XrdOfsHanExt::Of(nip);
+              nextnip = xP->hashNext.load(std::memory_order_relaxed);
               newent  = nip->Path.Hash % newsize;
-              nip->Next = newtab[newent];
+              xP->hashNext.store(newtab[newent], std::memory_order_relaxed);
               newtab[newent] = nip;
               nip = nextnip;
              }
        }
 
-// Free the old table and plug in the new table
+// Plug in the new table before its size so that Peek() never indexes past the
+// end of the table it sees. The old table is not freed as Peek() may still be
+// using it (the tables grow geometrically so this costs little).
 //
-   free((void *)nashtable);
-   nashtable     = newtab;
+   __atomic_store_n(&nashtable, newtab, __ATOMIC_RELEASE);
    prevtablesize = nashtablesize;
-   nashtablesize = newsize;
+   __atomic_store_n(&nashtablesize, newsize, __ATOMIC_RELEASE);
 
 // Compute new expansion threshold
 //
@@ -736,10 +880,42 @@ XrdOfsHandle *XrdOfsHanTab::Find(XrdOfsHanKey &Key)
 // Find the entry
 //
    nip = nashtable[kent];
-   while(nip && nip->Path != Key) nip = nip->Next;
+   while(nip && nip->Path != Key)
+        nip = XrdOfsHanExt::Of(nip)->hashNext.load(std::memory_order_relaxed);
    return nip;
 }
 
+/******************************************************************************/
+/* public                           P e e k                                   */
+/******************************************************************************/
+  
+XrdOfsHandle *XrdOfsHanTab::Peek(XrdOfsHanKey &Key)
+{
+  int tsize = __atomic_load_n(&nashtablesize, __ATOMIC_ACQUIRE);
+  XrdOfsHandle **tab = __atomic_load_n(&nashtable, __ATOMIC_ACQUIRE);
+  XrdOfsHandle *nip;
+  XrdOfsHanExt *xP;
+  int hops = MaxHops;
+
+// Walk the chain without a lock. A handle's fields are only stable once we
+// hold a reference to it, so reference each likely candidate before checking
+// it. A handle may have been recycled under us, hence we must recheck it.
+//
+   if (!Key.Hash) return 0;
+   nip = __atomic_load_n(&tab[Key.Hash%tsize], __ATOMIC_ACQUIRE);
+   while(nip && hops--)
+        {xP = XrdOfsHanExt::Of(nip);
+         if (xP->peekHash.load(std::memory_order_relaxed) == Key.Hash
+         &&  nip->Pin())
+            {if (xP->peekHash.load(std::memory_order_relaxed) == Key.Hash
+             &&  !nip->isRW && nip->Path == Key) return nip;
+             nip->Drop();
+            }
+         nip = xP->hashNext.load(std::memory_order_acquire);
+        }
+   return 0;
+}
+
 /******************************************************************************/
 /* public                         R e m o v e                                 */
 /******************************************************************************/
@@ -756,13 +932,19 @@ int XrdOfsHanTab::Remove(XrdOfsHandle *rip)
 // Find the entry
 //
    nip = nashtable[kent];
-   while(nip && nip != rip) {pip = nip; nip = nip->Next;}
+   while(nip && nip != rip)
+        {pip = nip;
+         nip = XrdOfsHanExt::Of(nip)->hashNext.load(std::memory_order_relaxed);
+        }
 
-// Remove if found
+// Remove if found. The entry keeps its link so that Peek() can move past it.
 //
    if (nip)
-      {if (pip) pip->Next = nip->Next;
-          else nashtable[kent] = nip->Next;
+      {nip = XrdOfsHanExt::Of(nip)->hashNext.load(std::memory_order_relaxed);
+       if (pip) XrdOfsHanExt::Of(pip)->hashNext.store(nip,
+                                                  std::memory_order_release);
+          else __atomic_store_n(&nashtable[kent], nip, __ATOMIC_RELEASE);
+       nip = rip;
        nashnum--;
       }
    return nip != 0;
@@ -828,9 +1010,10 @@ do{do{if (!(xP = xprQ)) waitTime = 2592000;
          }
 
 // Since we are still holding the xqCV lock we must get a conditional lock on
-// the handle. If we can't then reschedule this object for later.
+// the handle. If we can't then reschedule this object for later rather than
+// stall the whole queue waiting for it.
 //
-      if (!(hP->WaitLock()))
+      if (!(hP->TryLock()))
          {OfsEroute.Emsg("Retire", "defering retire of", hP->Path.Val);
           xP->xTime = time(0)+30;
           xP->add2Q(0);
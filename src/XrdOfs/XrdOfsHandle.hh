@@ -84,7 +84,12 @@ inline int           operator!=(const XrdOfsHanKey &oth)
 /******************************************************************************/
 
 class XrdOfsHandle;
-  
+
+// Add(), Find() and Remove() must be called with the table locked. Peek()
+// takes no lock; it returns the matching r/o handle with a reference already
+// added or nil. A concurrent update can at worst make Peek() miss, in which
+// case the caller falls back to a locked Find().
+//
 class XrdOfsHanTab
 {
 public:
@@ -92,6 +97,8 @@ void           Add(XrdOfsHandle *hP);
 
 XrdOfsHandle  *Find(XrdOfsHanKey &Key);
 
+XrdOfsHandle  *Peek(XrdOfsHanKey &Key);
+
 int            Remove(XrdOfsHandle *rip);
 
 // When allocateing a new nash, specify the required starting size. Make
@@ -119,8 +126,10 @@ int              Threshold;
 /******************************************************************************/
   
 class XrdOssDF;
+class XrdOfsCksStream;
 class XrdOfsHanCB;
 class XrdOfsHanPsc;
+class XrdOfsHanStripe;
 
 class XrdOfsHandle
 {
@@ -135,6 +144,8 @@ char                isRW;         // T-> File  is open in r/w mode
 
 void                Activate(XrdOssDF *ssP) {ssi = ssP;}
 
+             XrdOfsCksStream *CksRun();   // -> Running checksum or nil
+
 static const int    opRW = 1;
 static const int    opPC = 3;
 
@@ -160,6 +171,8 @@ inline const char  *Name() {return Path.Val;}
 
 XrdOssDF           &Select(void) {return *ssi;}   // To allow for mt interfaces
 
+             void   SetCksRun(XrdOfsCksStream *csP);
+
 static       int    StartXpr(int Init=0);         // Internal use only!
 
              void   Suppress(int rrc=-EDOM, int wrc=-EDOM); // Only for R/W!
@@ -175,6 +188,10 @@ inline       void   UnLock() {hMutex.UnLock();}
 
 private:
 static int           Alloc(XrdOfsHanKey, int Opts, XrdOfsHandle **Handle);
+       void          Drop();
+       bool          Pin();
+static XrdOfsHanStripe &Stripe(int rw, unsigned int hash);
+inline int           TryLock() {return hMutex.CondLock();}
        int           WaitLock(void);
 
 static const int     LockTries =   3; // Times to try for a lock
@@ -182,9 +199,7 @@ static const int     LockWait  = 333; // Mills to wait between tries
 static const int     nolokDelay=   3; // Secs to delay client when lock failed
 static const int     nomemDelay=  15; // Secs to delay client when ENOMEM
 
-static XrdSysMutex   myMutex;
-static XrdOfsHanTab  roTable;    // File handles open r/o
-static XrdOfsHanTab  rwTable;    // File Handles open r/w
+static XrdSysMutex   myMutex;    // Protects the free list
 static XrdOssDF     *ossDF;      // Dummy storage sysem
 static XrdOfsHandle *Free;       // List of free handles
 
@@ -45,6 +45,7 @@
 
 #include "XrdOss/XrdOssApi.hh"
 #include "XrdOss/XrdOssTrace.hh"
+#include "XrdOss/XrdOssUring.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysPlatform.hh"
 #include "XrdSys/XrdSysPthread.hh"
@@ -154,6 +155,14 @@ int XrdOssFile::Fsync(XrdSfsAio *aiop)
 int XrdOssFile::Read(XrdSfsAio *aiop)
 {
 
+// Use the io_uring engine if we have one, it completes via its own ring
+//
+   if (XrdOssUring::isOn())
+      {int urc;
+       aiop->TIdent = tident;
+       if ((urc = XrdOssUring::Read(fd, aiop)) <= 0) return urc;
+      }
+
 #ifdef _POSIX_ASYNCHRONOUS_IO
    EPNAME("AioRead");
    int rc;
@@ -211,6 +220,14 @@ int XrdOssFile::Read(XrdSfsAio *aiop)
   
 int XrdOssFile::Write(XrdSfsAio *aiop)
 {
+
+// Use the io_uring engine if we have one, it completes via its own ring
+//
+   if (XrdOssUring::isOn())
+      {int urc;
+       aiop->TIdent = tident;
+       if ((urc = XrdOssUring::Write(fd, aiop)) <= 0) return urc;
+      }
 #ifdef _POSIX_ASYNCHRONOUS_IO
    EPNAME("AioWrite");
    int rc;
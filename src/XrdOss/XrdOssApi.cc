@@ -54,6 +54,7 @@
 #include "XrdOss/XrdOssError.hh"
 #include "XrdOss/XrdOssMio.hh"
 #include "XrdOss/XrdOssTrace.hh"
+#include "XrdOss/XrdOssUring.hh"
 #include "XrdOuc/XrdOucEnv.hh"
 #include "XrdOuc/XrdOucName2Name.hh"
 #include "XrdOuc/XrdOucPinLoader.hh"
@@ -899,6 +900,12 @@ ssize_t XrdOssFile::ReadV(XrdOucIOVec *readV, int n)
    ssize_t rdsz, totBytes = 0;
    int i;
 
+// If we have an io_uring engine, submit the whole vector as a batch. There is
+// no need to pre-advise as all of the reads are handed to the kernel at once.
+//
+   if (XrdOssUring::isOn() && n > 1 && XrdOssUring::ReadV(fd, readV, n, totBytes))
+      return totBytes;
+
 // For platforms that support fadvise, pre-advise what we will be reading
 //
 #if (defined(__linux__) || (defined(__FreeBSD_kernel__) && defined(__GLIBC__))) && defined(HAVE_ATOMICS)
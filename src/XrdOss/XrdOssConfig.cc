@@ -53,6 +53,7 @@
 #include "XrdOss/XrdOssOpaque.hh"
 #include "XrdOss/XrdOssSpace.hh"
 #include "XrdOss/XrdOssTrace.hh"
+#include "XrdOss/XrdOssUring.hh"
 #include "XrdOuc/XrdOuca2x.hh"
 #include "XrdOuc/XrdOucEnv.hh"
 #include "XrdSys/XrdSysError.hh"
@@ -320,6 +321,10 @@ int XrdOssSys::Configure(const char *configfn, XrdSysError &Eroute,
 //
    if (!NoGo) NoGo = !AioInit();
 
+// Configure the io_uring engine (we fall back to posix I/O should this fail)
+//
+   if (!NoGo) XrdOssUring::Init(Eroute);
+
 // Initialize memory mapping setting to speed execution
 //
    if (!NoGo) ConfigMio(Eroute);
@@ -439,6 +444,7 @@ void XrdOssSys::Config_Display(XrdSysError &Eroute)
      Eroute.Say(buff);
 
      XrdOssMio::Display(Eroute);
+     XrdOssUring::Display(Eroute);
 
      XrdOssCache::List("       oss.", Eroute);
            List_Path("       oss.defaults ", "", DirFlags, Eroute);
@@ -1050,6 +1056,7 @@ int XrdOssSys::ConfigXeq(char *var, XrdOucStream &Config, XrdSysError &Eroute)
    TS_Xeq("spacescan",     xcachescan);
    TS_Xeq("defaults",      xdefault);
    TS_Xeq("fdlimit",       xfdlimit);
+   TS_Xeq("ioengine",      xioeng);
    TS_Xeq("maxsize",       xmaxsz);
    TS_Xeq("memfile",       xmemf);
    TS_Xeq("namelib",       xnml);
@@ -1273,6 +1280,63 @@ int XrdOssSys::xfdlimit(XrdOucStream &Config, XrdSysError &Eroute)
     return 0;
 }
   
+/******************************************************************************/
+/*                                x i o e n g                                 */
+/******************************************************************************/
+
+/* Function: xioeng
+
+   Purpose:  To parse the directive: ioengine {posix | uring} [depth <qd>]
+                                              [rings <nr>]
+
+             posix    use pread/pwrite and POSIX AIO (the default).
+             uring    use io_uring for vector reads and async reads/writes.
+             <qd>     the submission queue depth of each ring. A read vector
+                      larger than this is submitted in several batches. The
+                      default is 256.
+             <nr>     the number of rings available for concurrent vector
+                      reads. When all are busy, a vector read uses pread.
+                      The default is 16.
+
+   Output: 0 upon success or !0 upon failure.
+*/
+
+int XrdOssSys::xioeng(XrdOucStream &Config, XrdSysError &Eroute)
+{
+    char *val;
+    int onoff, depth = -1, rings = -1;
+
+      if (!(val = Config.GetWord()))
+         {Eroute.Emsg("Config", "ioengine type not specified"); return 1;}
+
+           if (!strcmp(val, "posix")) onoff = 0;
+      else if (!strcmp(val, "uring")) onoff = 1;
+      else {Eroute.Emsg("Config", "invalid ioengine type -", val); return 1;}
+
+      while((val = Config.GetWord()))
+           {     if (!strcmp(val, "depth"))
+                    {if (!(val = Config.GetWord()))
+                        {Eroute.Emsg("Config","ioengine depth not specified");
+                         return 1;
+                        }
+                     if (XrdOuca2x::a2i(Eroute,"ioengine depth",val,&depth,8,4096))
+                        return 1;
+                    }
+            else if (!strcmp(val, "rings"))
+                    {if (!(val = Config.GetWord()))
+                        {Eroute.Emsg("Config","ioengine rings not specified");
+                         return 1;
+                        }
+                     if (XrdOuca2x::a2i(Eroute,"ioengine rings",val,&rings,0,1024))
+                        return 1;
+                    }
+            else {Eroute.Emsg("Config","invalid ioengine option -",val); return 1;}
+           }
+
+      XrdOssUring::Set(onoff, depth, rings);
+      return 0;
+}
+
 /******************************************************************************/
 /*                                x m a x s z                                 */
 /******************************************************************************/
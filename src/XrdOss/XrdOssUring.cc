@@ -0,0 +1,361 @@
+/******************************************************************************/
+/*                                                                            */
+/*                        X r d O s s U r i n g . c c                         */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+#include "XrdOss/XrdOssTrace.hh"
+#include "XrdOss/XrdOssUring.hh"
+#include "XrdOuc/XrdOucIOVec.hh"
+#include "XrdSfs/XrdSfsAio.hh"
+#include "XrdSys/XrdSysError.hh"
+#include "XrdSys/XrdSysTimer.hh"
+
+/******************************************************************************/
+/*                               G l o b a l s                                */
+/******************************************************************************/
+
+extern XrdOucTrace OssTrace;
+
+extern XrdSysError OssEroute;
+
+XrdSysMutex  XrdOssUring::UR_Mutex;
+XrdOssUring *XrdOssUring::UR_Free     = 0;
+XrdSysMutex  XrdOssUring::UR_AioMutex;
+XrdOssUring *XrdOssUring::UR_Aio      = 0;
+int          XrdOssUring::UR_AioNum   = 0;
+int          XrdOssUring::UR_AioMax   = 0;
+int          XrdOssUring::UR_depth    = 256;
+int          XrdOssUring::UR_rings    = 16;
+bool         XrdOssUring::UR_want     = false;
+bool         XrdOssUring::UR_on       = false;
+
+/******************************************************************************/
+/*            E x t e r n a l   T h r e a d   I n t e r f a c e s             */
+/******************************************************************************/
+
+void *XrdOssUringReap(void *carg)
+{
+   XrdOssUring *rP = (XrdOssUring *)carg;
+   rP->Reap();
+   return (void *)0;
+}
+
+/******************************************************************************/
+/*                               D i s p l a y                                */
+/******************************************************************************/
+
+void XrdOssUring::Display(XrdSysError &Eroute)
+{
+   char buff[128];
+
+   if (UR_on)
+      {snprintf(buff, sizeof(buff), "       oss.ioengine uring depth %d rings %d",
+                UR_depth, UR_rings);
+       Eroute.Say(buff);
+      }
+}
+
+/******************************************************************************/
+/*                                  I n i t                                   */
+/******************************************************************************/
+
+bool XrdOssUring::Init(XrdSysError &Eroute)
+{
+#ifdef HAVE_IO_URING
+   static const int ops[] = {IORING_OP_READ, IORING_OP_WRITE};
+   const int nops = sizeof(ops)/sizeof(int);
+   XrdOssUring *rP;
+   pthread_t tid;
+   int i, rc;
+
+// Check if we need to do anything here
+//
+   if (!UR_want) return true;
+
+// Create the ring used for async requests and the thread that drains it
+//
+   rP = new XrdOssUring;
+   if ((rc = rP->ring.Setup(UR_depth, ops, nops)))
+      {Eroute.Emsg("Config", rc, "create io_uring; using posix I/O engine");
+       delete rP;
+       return false;
+      }
+   if ((rc = XrdSysThread::Run(&tid, XrdOssUringReap, (void *)rP, 0,
+                               "io_uring completion")))
+      {Eroute.Emsg("Config", rc, "create io_uring thread; using posix I/O engine");
+       delete rP;
+       return false;
+      }
+   UR_Aio    = rP;
+   UR_AioMax = rP->ring.cqSize();
+
+// Create the rings used for vector reads. These are handed out to a single
+// thread at a time so submission and completion need no locking.
+//
+   for (i = 0; i < UR_rings; i++)
+       {rP = new XrdOssUring;
+        if ((rc = rP->ring.Setup(UR_depth, ops, nops)))
+           {Eroute.Emsg("Config", rc, "create io_uring for vector reads");
+            delete rP;
+            break;
+           }
+        rP->next = UR_Free; UR_Free = rP;
+       }
+   UR_rings = i;
+
+// All done
+//
+   UR_on = true;
+   return true;
+#else
+   if (UR_want)
+      Eroute.Say("Config warning: io_uring is not supported on this platform; "
+                 "using posix I/O engine.");
+   return !UR_want;
+#endif
+}
+
+/******************************************************************************/
+/*                                  R e a d                                   */
+/******************************************************************************/
+
+/*
+  Function: Async read via the async ring.
+
+   Output:  <0 -> Operation failed, value is negative errno value.
+            =0 -> Operation queued
+            >0 -> Operation not queued, the caller should use another path.
+*/
+
+int XrdOssUring::Read(int fd, XrdSfsAio *aiop)
+{
+#ifdef HAVE_IO_URING
+   return Submit(IORING_OP_READ, fd, aiop);
+#else
+   return 1;
+#endif
+}
+
+/******************************************************************************/
+/*                                 R e a d V                                  */
+/******************************************************************************/
+
+// Returns false if no ring is available in which case the caller must do the
+// reads itself. Otherwise, totBytes holds the result using the same rules as
+// XrdOssFile::ReadV(); a short read is reported as -ESPIPE.
+//
+bool XrdOssUring::ReadV(int fd, XrdOucIOVec *readV, int n, ssize_t &totBytes)
+{
+#ifdef HAVE_IO_URING
+   EPNAME("UringReadV");
+   io_uring_cqe cqe;
+   XrdOssUring *rP;
+   unsigned int bnum, done, toSub;
+   int i, k, rc, badIdx = n, badRC = 0, ringRC = 0;
+
+// Obtain a ring for our exclusive use
+//
+   UR_Mutex.Lock();
+   if ((rP = UR_Free)) UR_Free = rP->next;
+   UR_Mutex.UnLock();
+   if (!rP) return false;
+
+// Submit the vector in batches as large as the ring allows, waiting for all
+// the reads in a batch to complete before submitting the next one.
+//
+   totBytes = 0; bnum = done = 0;
+   for (i = 0; i < n && !badRC && !ringRC; i += bnum)
+       {bnum = (unsigned int)(n - i);
+        if (bnum > rP->ring.sqSize()) bnum = rP->ring.sqSize();
+        for (k = 0; k < (int)bnum; k++)
+            rP->ring.Prep(IORING_OP_READ, fd, readV[i+k].data, readV[i+k].size,
+                     readV[i+k].offset, i+k);
+        toSub = bnum; done = 0;
+        while(done < bnum)
+             {if ((rc = rP->ring.Enter(toSub, bnum-done)) >= 0) toSub -= rc;
+                 else if (toSub)
+                         {rP->ring.Unprep(toSub);
+                          bnum -= toSub; toSub = 0;
+                          if (!i && !bnum)
+                             {UR_Mutex.Lock();
+                              rP->next = UR_Free; UR_Free = rP;
+                              UR_Mutex.UnLock();
+                              return false;
+                             }
+                          if (i+(int)bnum < badIdx) {badIdx = i+bnum; badRC = rc;}
+                         }
+                 else {ringRC = rc; break;}
+              while(rP->ring.Next(cqe))
+                   {k = (int)cqe.user_data;
+                    if (cqe.res == readV[k].size) totBytes += cqe.res;
+                       else if (k < badIdx)
+                               {badIdx = k;
+                                badRC = (cqe.res < 0 ? cqe.res : -ESPIPE);
+                               }
+                    done++;
+                   }
+             }
+       }
+
+// If we can no longer wait on the ring, the reads in flight still complete
+// into the caller's buffers. Collect them, retire the ring, and let the caller
+// redo the whole vector with ordinary reads.
+//
+   if (ringRC)
+      {OssEroute.Emsg("UringReadV", -ringRC, "wait for io_uring completions;"
+                      " using pread");
+       while(done < bnum)
+            {while(done < bnum && rP->ring.Next(cqe)) done++;
+             if (done < bnum) XrdSysTimer::Wait(1);
+            }
+       delete rP;
+       return false;
+      }
+
+// Return the ring and report the result
+//
+   UR_Mutex.Lock();
+   rP->next = UR_Free; UR_Free = rP;
+   UR_Mutex.UnLock();
+
+   if (badRC) totBytes = badRC;
+   DEBUG("fd=" <<fd <<" n=" <<n <<" result=" <<totBytes);
+   return true;
+#else
+   return false;
+#endif
+}
+
+/******************************************************************************/
+/*                                  R e a p                                   */
+/******************************************************************************/
+
+// Completion loop for the async ring. Bit 0 of the user data distinguishes
+// writes from reads.
+//
+void XrdOssUring::Reap()
+{
+#ifdef HAVE_IO_URING
+   EPNAME("UringReap");
+   io_uring_cqe cqe;
+   XrdSfsAio   *aiop;
+   int rc;
+
+   do {while(ring.Next(cqe))
+             {aiop = (XrdSfsAio *)(cqe.user_data & ~1ULL);
+              aiop->Result = cqe.res;
+              UR_AioMutex.Lock(); UR_AioNum--; UR_AioMutex.UnLock();
+              DEBUG((cqe.user_data & 1 ? "write" : "read") <<" completed for "
+                    <<aiop->TIdent <<"; result=" <<cqe.res <<" aiocb="
+                    <<std::hex <<aiop <<std::dec);
+              if (cqe.user_data & 1) aiop->doneWrite();
+                 else                aiop->doneRead();
+             }
+       if ((rc = ring.Enter(0, 1)) < 0)
+          {OssEroute.Emsg("UringReap", -rc, "wait for io_uring completions");
+           UR_AioMutex.Lock(); UR_AioMax = 0; UR_AioMutex.UnLock();
+           XrdSysTimer::Wait(1000);
+          }
+      } while(1);
+#endif
+}
+
+/******************************************************************************/
+/*                                   S e t                                    */
+/******************************************************************************/
+
+void XrdOssUring::Set(int V_on, int V_depth, int V_rings)
+{
+   if (V_on    >= 0) UR_want  = V_on != 0;
+   if (V_depth >  0) UR_depth = V_depth;
+   if (V_rings >= 0) UR_rings = V_rings;
+}
+
+/******************************************************************************/
+/*                                 W r i t e                                  */
+/******************************************************************************/
+
+int XrdOssUring::Write(int fd, XrdSfsAio *aiop)
+{
+#ifdef HAVE_IO_URING
+   return Submit(IORING_OP_WRITE, fd, aiop);
+#else
+   return 1;
+#endif
+}
+
+/******************************************************************************/
+/*                       P r i v a t e   M e t h o d s                        */
+/******************************************************************************/
+/******************************************************************************/
+/*                                S u b m i t                                 */
+/******************************************************************************/
+
+int XrdOssUring::Submit(int opc, int fd, XrdSfsAio *aiop)
+{
+#ifdef HAVE_IO_URING
+   EPNAME("UringSubmit");
+   unsigned long long udata = (unsigned long long)aiop;
+   int rc;
+
+// Check if the ring can take another request. If not, tell the caller to
+// use some other way of doing this.
+//
+   UR_AioMutex.Lock();
+   if (UR_AioNum >= UR_AioMax
+   ||  !UR_Aio->ring.Prep(opc, fd, (void *)aiop->sfsAio.aio_buf,
+                     (unsigned int)aiop->sfsAio.aio_nbytes,
+                     (long long)aiop->sfsAio.aio_offset,
+                     udata | (opc == IORING_OP_WRITE ? 1 : 0)))
+      {UR_AioMutex.UnLock();
+       return 1;
+      }
+
+// Submit the request
+//
+   if ((rc = UR_Aio->ring.Enter(1, 0)) <= 0)
+      {UR_Aio->ring.Unprep(1);
+       UR_AioMutex.UnLock();
+       return (rc == -EAGAIN || rc == -EBUSY || !rc ? 1 : rc);
+      }
+   UR_AioNum++;
+   UR_AioMutex.UnLock();
+
+   DEBUG((opc == IORING_OP_WRITE ? "Write " : "Read ")
+         <<aiop->sfsAio.aio_nbytes <<'@' <<aiop->sfsAio.aio_offset
+         <<" started; aiocb=" <<std::hex <<aiop <<std::dec);
+   return 0;
+#else
+   return 1;
+#endif
+}
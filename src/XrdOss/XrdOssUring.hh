@@ -0,0 +1,85 @@
+#ifndef _XRDOSS_URING_H
+#define _XRDOSS_URING_H
+/******************************************************************************/
+/*                                                                            */
+/*                        X r d O s s U r i n g . h h                         */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <sys/types.h>
+
+#include "XrdSys/XrdSysIOUring.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+struct XrdOucIOVec;
+class  XrdSfsAio;
+class  XrdSysError;
+
+//-----------------------------------------------------------------------------
+//! XrdOssUring is an optional I/O engine based on the Linux io_uring interface.
+//! A pool of rings is used to submit a complete read vector as one batch and
+//! a separate ring, drained by a dedicated thread, completes XrdSfsAio
+//! requests without the signal based POSIX AIO machinery. When the engine is
+//! not configured or not supported, all methods decline the request and the
+//! caller uses the POSIX path.
+//-----------------------------------------------------------------------------
+
+class XrdOssUring
+{
+public:
+static void  Display(XrdSysError &Eroute);
+
+static bool  Init(XrdSysError &Eroute);
+
+static bool  isOn() {return UR_on;}
+
+static int   Read(int fd, XrdSfsAio *aiop);
+
+static bool  ReadV(int fd, XrdOucIOVec *readV, int n, ssize_t &totBytes);
+
+static void  Set(int V_on, int V_depth, int V_rings);
+
+static int   Write(int fd, XrdSfsAio *aiop);
+
+       void  Reap();
+
+             XrdOssUring() : next(0) {}
+            ~XrdOssUring() {}
+
+private:
+static int   Submit(int opc, int fd, XrdSfsAio *aiop);
+
+XrdOssUring  *next;
+XrdSysIOUring ring;
+
+static XrdSysMutex  UR_Mutex;    // Protects the free ring list
+static XrdOssUring *UR_Free;     // Rings available for vector reads
+static XrdSysMutex  UR_AioMutex; // Serializes async submissions
+static XrdOssUring *UR_Aio;      // Ring used for async requests
+static int          UR_AioNum;   // Async requests in flight
+static int          UR_AioMax;   // Maximum async requests in flight
+static int          UR_depth;
+static int          UR_rings;
+static bool         UR_want;
+static bool         UR_on;
+};
+#endif
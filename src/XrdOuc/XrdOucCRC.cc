@@ -199,20 +199,17 @@ uint32_t XrdOucCRC::Calc32C(const void* data, size_t count, uint32_t prevcs)
   
 void XrdOucCRC::Calc32C(const void* data, size_t count, uint32_t* csval)
 {
-   int i, numpages = count/XrdSys::PageSize;
+   int numpages = count/XrdSys::PageSize;
    const uint8_t* dataP = (const uint8_t*)data;
 
-// Calculate the CRC32C for each page
+// Calculate the CRC32C for each full page, several pages at a time
 //
-   for (i = 0; i < numpages; i++)
-       {csval[i] = crc32c(0, dataP, XrdSys::PageSize);
-        count -= XrdSys::PageSize;
-        dataP += XrdSys::PageSize;
-       }
+   crc32c_blocks(dataP, XrdSys::PageSize, numpages, csval);
 
 // if there is anything left, calculate that as well
 //
-   if (count > 0) csval[i] = crc32c(0, dataP, count);
+   if ((count -= numpages*XrdSys::PageSize))
+      csval[numpages] = crc32c(0, dataP + numpages*XrdSys::PageSize, count);
 }
 
 /******************************************************************************/
@@ -233,33 +230,42 @@ bool XrdOucCRC::Ver32C(const void*    data,  size_t    count,
 
 /******************************************************************************/
 
+// The page verifiers below compute checksums for a group of pages at a time
+// so that the multi-buffer crc kernel can be used. The group is small enough
+// to live on the stack and to keep early termination on a mismatch cheap.
+//
+namespace
+{
+const int verGroup = 48;
+}
+
 int  XrdOucCRC::Ver32C(const void*     data,  size_t    count,
                        const uint32_t* csval, uint32_t& valcs)
 {
-   int i, numpages = count/XrdSys::PageSize;
+   int i, k, n, numpages = count/XrdSys::PageSize;
    const uint8_t* dataP = (const uint8_t*)data;
-   uint32_t actualCS;
+   uint32_t actualCS[verGroup];
 
 // Calculate the CRC32C for each page and make sure it is the same.
 //
-   for (i = 0; i < numpages; i++)
-       {
-        actualCS = crc32c(0, dataP, XrdSys::PageSize);
-        if (csval[i] != actualCS)
-           {valcs = actualCS;
-            return i;
-           }
-        count -= XrdSys::PageSize;
-        dataP += XrdSys::PageSize;
+   for (i = 0; i < numpages; i += n)
+       {n = (numpages - i < verGroup ? numpages - i : verGroup);
+        crc32c_blocks(dataP, XrdSys::PageSize, n, actualCS);
+        for (k = 0; k < n; k++)
+            if (csval[i+k] != actualCS[k])
+               {valcs = actualCS[k];
+                return i+k;
+               }
+        dataP += n*XrdSys::PageSize;
        }
 
 // if there is anything left, verify that as well
 //
-   if (count > 0)
+   if ((count -= numpages*XrdSys::PageSize))
       {
-       actualCS = crc32c(0, dataP, count);
-       if (csval[i] != actualCS)
-          {valcs = actualCS;
+       actualCS[0] = crc32c(0, dataP, count);
+       if (csval[i] != actualCS[0])
+          {valcs = actualCS[0];
            return i;
           }
       }
@@ -274,28 +280,28 @@ int  XrdOucCRC::Ver32C(const void*     data,  size_t    count,
 bool XrdOucCRC::Ver32C(const void*     data,  size_t count,
                        const uint32_t* csval, bool*  valok)
 {
-   int i, numpages = count/XrdSys::PageSize;
+   int i, k, n, numpages = count/XrdSys::PageSize;
    const uint8_t* dataP = (const uint8_t*)data;
-   uint32_t actualCS;
+   uint32_t actualCS[verGroup];
    bool retval = true;
 
 // Calculate the CRC32C for each page and make sure it is the same.
 //
-   for (i = 0; i < numpages; i++)
-       {
-        actualCS = crc32c(0, dataP, XrdSys::PageSize);
-        if (csval[i] == actualCS) valok[i] = true;
-           else valok[i] = retval = false;
-        count -= XrdSys::PageSize;
-        dataP += XrdSys::PageSize;
+   for (i = 0; i < numpages; i += n)
+       {n = (numpages - i < verGroup ? numpages - i : verGroup);
+        crc32c_blocks(dataP, XrdSys::PageSize, n, actualCS);
+        for (k = 0; k < n; k++)
+            if (csval[i+k] == actualCS[k]) valok[i+k] = true;
+               else valok[i+k] = retval = false;
+        dataP += n*XrdSys::PageSize;
        }
 
 // if there is anything left, verify that as well
 //
-   if (count > 0)
+   if ((count -= numpages*XrdSys::PageSize))
       {
-       actualCS = crc32c(0, dataP, count);
-       if (csval[i] == actualCS) valok[i] = true;
+       actualCS[0] = crc32c(0, dataP, count);
+       if (csval[i] == actualCS[0]) valok[i] = true;
            else valok[i] = retval = false;
       }
 
@@ -310,26 +316,14 @@ bool XrdOucCRC::Ver32C(const void*     data,  size_t    count,
                        const uint32_t* csval, uint32_t* valcs)
 {
    int i, numpages = count/XrdSys::PageSize;
-   const uint8_t* dataP = (const uint8_t*)data;
    bool retval = true;
 
-// Calculate the CRC32C for each page and make sure it is the same.
+// Calculate the CRC32C for all the pages and then make sure they are the same.
 //
+   Calc32C(data, count, valcs);
+   if (count > (size_t)numpages*XrdSys::PageSize) numpages++;
    for (i = 0; i < numpages; i++)
-       {
-        valcs[i] = crc32c(0, dataP, XrdSys::PageSize);
-        if (csval[i] != valcs[i]) retval = false;
-        count -= XrdSys::PageSize;
-        dataP += XrdSys::PageSize;
-       }
-
-// if there is anything left, verify that as well
-//
-   if (count > 0)
-      {
-       valcs[i] = crc32c(0, dataP, count);
        if (csval[i] != valcs[i]) retval = false;
-      }
 
 // All done.
 //
@@ -15,4 +15,9 @@ uint32_t crc32c(uint32_t crc, void const *buf, size_t len);
 // crc32c_sw() is the same, but does not use the hardware instruction, even if
 // available.
 uint32_t crc32c_sw(uint32_t crc, void const *buf, size_t len);
+
+// Compute the CRC-32C of each of the n consecutive blocks of blen bytes that
+// start at buf, placing the crc of block i in crcs[i]. When the crc32 hardware
+// instruction is available, three blocks are processed in parallel.
+void crc32c_blocks(void const *buf, size_t blen, size_t n, uint32_t *crcs);
 #endif
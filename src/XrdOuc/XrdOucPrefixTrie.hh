@@ -0,0 +1,147 @@
+#ifndef __OUC_PREFIXTRIE__
+#define __OUC_PREFIXTRIE__
+/******************************************************************************/
+/*                                                                            */
+/*                   X r d O u c P r e f i x T r i e . h h                    */
+/*                                                                            */
+/* (c) 2026 by European Organization for Nuclear Research (CERN)              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+/******************************************************************************/
+/*                       X r d O u c P r e f i x T r i e                      */
+/******************************************************************************/
+
+// A radix (path compressed) trie keyed by string prefixes. The trie is filled
+// by Insert() and is then meant to be treated as immutable; Match() does not
+// modify anything so any number of threads may search it without a lock. A
+// search visits every inserted key that is a prefix of the supplied path, in
+// order of increasing length, and costs O(length of the path).
+//
+template<class T>
+class XrdOucPrefixTrie
+{
+public:
+
+// Insert() returns the value slot for key, creating a default constructed
+// value if the key is new. The caller merges its data into the slot.
+//
+T          &Insert(const char *key, int klen)
+                  {Node *np = &root;
+                   while(klen)
+                        {Node *cp = np->Child(*key);
+                         if (!cp) {np = np->Attach(new Node(key, klen)); break;}
+                         int n = 0, lim = (int)cp->label.size();
+                         while(n < lim && n < klen && cp->label[n] == key[n]) n++;
+                         if (n < lim) cp = np->Split(cp, n);
+                         np = cp; key += n; klen -= n;
+                        }
+                   if (!np->isKey) {np->isKey = true; keys++;}
+                   return np->value;
+                  }
+
+T          &Insert(const char *key) {return Insert(key, strlen(key));}
+
+// Match() calls visit(value) for every key that is a prefix of path, shortest
+// key first. It returns the number of keys visited.
+//
+template<class V>
+int         Match(const char *path, int plen, V &visit) const
+                 {const Node *np = &root;
+                  int hits = 0;
+                  if (np->isKey) {visit(np->value); hits++;}
+                  while(plen > 0 && (np = np->Child(*path)))
+                       {int n = (int)np->label.size();
+                        if (n > plen || memcmp(path, np->label.data(), n))
+                           break;
+                        if (np->isKey) {visit(np->value); hits++;}
+                        path += n; plen -= n;
+                       }
+                  return hits;
+                 }
+
+int         Num() const {return keys;}
+
+            XrdOucPrefixTrie() : keys(0) {}
+           ~XrdOucPrefixTrie() {}
+
+            XrdOucPrefixTrie(const XrdOucPrefixTrie &) = delete;
+XrdOucPrefixTrie &operator=(const XrdOucPrefixTrie &) = delete;
+
+private:
+
+struct Node
+      {std::string          label;   // Edge label leading to this node
+       std::vector<Node *>  kids;    // Children sorted by first label byte
+       T                    value;
+       bool                 isKey;
+
+       // Children are kept sorted so a lookup is a binary search over at
+       // most 256 entries (i.e. at most 8 probes) per path component.
+       //
+       Node *Child(char c) const
+             {int lo = 0, hi = (int)kids.size() - 1;
+              unsigned char uc = (unsigned char)c;
+              while(lo <= hi)
+                   {int mid = (lo + hi) / 2;
+                    unsigned char kc = (unsigned char)kids[mid]->label[0];
+                    if (kc == uc) return kids[mid];
+                    if (kc < uc) lo = mid + 1;
+                       else      hi = mid - 1;
+                   }
+              return 0;
+             }
+
+       Node *Attach(Node *np)
+             {unsigned char uc = (unsigned char)np->label[0];
+              typename std::vector<Node *>::iterator it = kids.begin();
+              while(it != kids.end() && (unsigned char)(*it)->label[0] < uc) ++it;
+              kids.insert(it, np);
+              return np;
+             }
+
+       // Split the edge to child cp after n bytes, returning the new node
+       // that now sits between this node and cp.
+       //
+       Node *Split(Node *cp, int n)
+             {Node *mp = new Node(cp->label.data(), n);
+              cp->label.erase(0, n);
+              mp->kids.push_back(cp);
+              for (size_t i = 0; i < kids.size(); i++)
+                  if (kids[i] == cp) {kids[i] = mp; break;}
+              return mp;
+             }
+
+             Node(const char *lbl="", int llen=0)
+                 : label(lbl, llen), value(), isKey(false) {}
+            ~Node() {for (size_t i = 0; i < kids.size(); i++) delete kids[i];}
+      };
+
+Node        root;
+int         keys;
+};
+#endif
@@ -21,6 +21,8 @@ add_library(
   XrdPfc/XrdPfc.cc              XrdPfc/XrdPfc.hh
   XrdPfc/XrdPfcConfiguration.cc
   XrdPfc/XrdPfcPurge.cc
+  XrdPfc/XrdPfcBufferPool.cc    XrdPfc/XrdPfcBufferPool.hh
+  XrdPfc/XrdPfcUsageIndex.cc    XrdPfc/XrdPfcUsageIndex.hh
   XrdPfc/XrdPfcCommand.cc
   XrdPfc/XrdPfcFile.cc          XrdPfc/XrdPfcFile.hh
   XrdPfc/XrdPfcVRead.cc
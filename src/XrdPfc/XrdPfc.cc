@@ -40,6 +40,7 @@
 #include "XrdPfcInfo.hh"
 #include "XrdPfcIOEntireFile.hh"
 #include "XrdPfcIOFileBlock.hh"
+#include "XrdPfcUsageIndex.hh"
 
 using namespace XrdPfc;
 
@@ -66,9 +67,9 @@ void *ProcessWriteTaskThread(void*)
    return 0;
 }
 
-void *PrefetchThread(void*)
+void *PrefetchThread(void* shard)
 {
-   Cache::GetInstance().Prefetch();
+   Cache::GetInstance().Prefetch((int) (long) shard);
    return 0;
 }
 
@@ -110,7 +111,10 @@ XrdOucCache *XrdOucGetCache(XrdSysLogger *logger,
 
       if (instance.RefConfiguration().m_prefetch_max_blocks > 0)
       {
-         XrdSysThread::Run(&tid, PrefetchThread, 0, 0, "XrdPfc Prefetch ");
+         for (int pti = 0; pti < instance.RefConfiguration().m_prefetch_workers; ++pti)
+         {
+            XrdSysThread::Run(&tid, PrefetchThread, (void*) (long) pti, 0, "XrdPfc Prefetch ");
+         }
       }
 
       XrdSysThread::Run(&tid, ResourceMonitorHeartBeatThread, 0, 0, "XrdPfc ResourceMonitorHeartBeat");
@@ -185,16 +189,15 @@ Cache::Cache(XrdSysLogger *logger, XrdOucEnv *env) :
    m_traceID("Cache"),
    m_oss(0),
    m_gstream(0),
-   m_prefetch_condVar(0),
    m_prefetch_enabled(false),
-   m_RAM_used(0),
    m_RAM_write_queue(0),
-   m_RAM_std_size(0),
    m_isClient(false),
    m_in_purge(false),
    m_active_cond(0),
+   m_prefetch_next_shard(0),
    m_stats_n_purge_cond(0),
    m_fs_state(0),
+   m_usage_index(0),
    m_last_scan_duration(0),
    m_last_purge_duration(0),
    m_spt_state(SPTS_Idle)
@@ -249,10 +252,7 @@ void Cache::AddWriteTask(Block* b, bool fromRead)
 {
    TRACE(Dump, "AddWriteTask() bOff=" <<  b->m_offset);
 
-   {
-      XrdSysMutexHelper lock(&m_RAM_mutex);
-      m_RAM_write_queue += b->get_size();
-   }
+   m_RAM_write_queue += b->get_size();
 
    m_writeQ.condVar.Lock();
    if (fromRead)
@@ -289,10 +289,7 @@ void Cache::RemoveWriteQEntriesFor(File *file)
    }
    m_writeQ.condVar.UnLock();
 
-   {
-      XrdSysMutexHelper lock(&m_RAM_mutex);
-      m_RAM_write_queue -= sum_size;
-   }
+   m_RAM_write_queue -= sum_size;
 
    file->BlocksRemovedFromWriteQ(removed_blocks);
 }
@@ -330,10 +327,7 @@ void Cache::ProcessWriteTasks()
 
       m_writeQ.condVar.UnLock();
 
-      {
-         XrdSysMutexHelper lock(&m_RAM_mutex);
-         m_RAM_write_queue -= sum_size;
-      }
+      m_RAM_write_queue -= sum_size;
 
       for (int bi = 0; bi < n_pushed; ++bi)
       {
@@ -348,60 +342,12 @@ void Cache::ProcessWriteTasks()
 
 char* Cache::RequestRAM(long long size)
 {
-   static const size_t s_block_align = sysconf(_SC_PAGESIZE);
-
-   bool  std_size = (size == m_configuration.m_bufferSize);
-
-   m_RAM_mutex.Lock();
-
-   long long total = m_RAM_used + size;
-
-   if (total <= m_configuration.m_RamAbsAvailable)
-   {
-      m_RAM_used = total;
-      if (std_size && m_RAM_std_size > 0)
-      {
-         char *buf = m_RAM_std_blocks.back();
-         m_RAM_std_blocks.pop_back();
-         --m_RAM_std_size;
-
-         m_RAM_mutex.UnLock();
-
-         return buf;
-      }
-      else
-      {
-         m_RAM_mutex.UnLock();
-         char *buf;
-         if (posix_memalign((void**) &buf, s_block_align, (size_t) size))
-         {
-            // Report out of mem? Probably should report it at least the first time,
-            // then periodically.
-            return 0;
-         }
-         return buf;
-      }
-   }
-   m_RAM_mutex.UnLock();
-   return 0;
+   return m_RAM_pool.Request(size);
 }
 
 void Cache::ReleaseRAM(char* buf, long long size)
 {
-   bool std_size = (size == m_configuration.m_bufferSize);
-   {
-      XrdSysMutexHelper lock(&m_RAM_mutex);
-
-      m_RAM_used -= size;
-
-      if (std_size && m_RAM_std_size < m_configuration.m_RamKeepStdBlocks)
-      {
-         m_RAM_std_blocks.push_back(buf);
-         ++m_RAM_std_size;
-         return;
-      }
-   }
-   free(buf);
+   m_RAM_pool.Release(buf, size);
 }
 
 File* Cache::GetFile(const std::string& path, IO* io, long long off, long long filesize)
@@ -680,17 +626,23 @@ bool Cache::IsFileActiveOrPurgeProtected(const std::string& path)
 
 void Cache::RegisterPrefetchFile(File* file)
 {
-   // Can be called with other locks held.
+   // Can be called with other locks held. Registration state of a file is
+   // only changed with the file's state lock held.
 
-   if ( ! m_prefetch_enabled)
+   if ( ! m_prefetch_enabled || file->m_prefetch_shard >= 0)
    {
       return;
    }
 
-   m_prefetch_condVar.Lock();
-   m_prefetchList.push_back(file);
-   m_prefetch_condVar.Signal();
-   m_prefetch_condVar.UnLock();
+   int            si = m_prefetch_next_shard++ % m_prefetch_shards.size();
+   PrefetchShard &ps = * m_prefetch_shards[si];
+
+   ps.m_cond.Lock();
+   file->m_prefetch_shard = si;
+   file->m_prefetch_slot  = ps.m_files.size();
+   ps.m_files.push_back(PrefetchEntry(file));
+   ps.m_cond.Signal();
+   ps.m_cond.UnLock();
 }
 
 
@@ -698,56 +650,155 @@ void Cache::DeRegisterPrefetchFile(File* file)
 {
    // Can be called with other locks held.
 
-   if ( ! m_prefetch_enabled)
+   if ( ! m_prefetch_enabled || file->m_prefetch_shard < 0)
+   {
+      return;
+   }
+
+   PrefetchShard &ps = * m_prefetch_shards[file->m_prefetch_shard];
+
+   ps.m_cond.Lock();
+   int slot = file->m_prefetch_slot;
+   if (slot < (int) ps.m_files.size() && ps.m_files[slot].m_file == file)
+   {
+      // Move the last entry into the freed slot.
+      if (slot != (int) ps.m_files.size() - 1)
+      {
+         ps.m_files[slot] = ps.m_files.back();
+         ps.m_files[slot].m_file->m_prefetch_slot = slot;
+      }
+      ps.m_files.pop_back();
+   }
+   file->m_prefetch_shard = -1;
+   file->m_prefetch_slot  = -1;
+   ps.m_cond.UnLock();
+}
+
+
+void Cache::PrefetchDemand(File* file)
+{
+   // Called with file's state lock held.
+
+   if ( ! m_prefetch_enabled || file->m_prefetch_shard < 0)
    {
       return;
    }
 
-   m_prefetch_condVar.Lock();
-   for (PrefetchList::iterator it = m_prefetchList.begin(); it != m_prefetchList.end(); ++it)
+   PrefetchShard &ps = * m_prefetch_shards[file->m_prefetch_shard];
+
+   ps.m_cond.Lock();
+   int slot = file->m_prefetch_slot;
+   if (slot >= 0 && slot < (int) ps.m_files.size() && ps.m_files[slot].m_file == file)
    {
-      if (*it == file)
+      ps.m_files[slot].m_miss_time = time(0);
+   }
+   ps.m_cond.UnLock();
+}
+
+
+PrefetchOrigin* Cache::PrefetchIssued(File* file, const char *location, long long bytes)
+{
+   // Called with file's state lock held.
+
+   PrefetchOrigin *origin;
+   {
+      XrdSysMutexHelper lock(&m_prefetch_origin_mutex);
+
+      std::string loc(location ? location : "");
+      PrefetchOriginMap_t::iterator i = m_prefetch_origins.find(loc);
+      if (i == m_prefetch_origins.end())
       {
-         m_prefetchList.erase(it);
-         break;
+         i = m_prefetch_origins.insert(std::make_pair(loc, new PrefetchOrigin)).first;
       }
+      origin = i->second;
    }
-   m_prefetch_condVar.UnLock();
+   origin->m_inflight += bytes;
+
+   if (file->m_prefetch_shard >= 0)
+   {
+      PrefetchShard &ps = * m_prefetch_shards[file->m_prefetch_shard];
+
+      ps.m_cond.Lock();
+      int slot = file->m_prefetch_slot;
+      if (slot >= 0 && slot < (int) ps.m_files.size() && ps.m_files[slot].m_file == file)
+      {
+         ps.m_files[slot].m_origin = origin;
+      }
+      ps.m_cond.UnLock();
+   }
+
+   return origin;
+}
+
+
+void Cache::PrefetchDone(PrefetchOrigin *origin, long long bytes)
+{
+   origin->m_inflight -= bytes;
 }
 
 
-File* Cache::GetNextFileToPrefetch()
+File* Cache::GetNextFileToPrefetch(int shard)
 {
-   m_prefetch_condVar.Lock();
-   while (m_prefetchList.empty())
+   // Pick a few random candidates and take the best one: files with a recent
+   // client miss first, then files whose origin has the least prefetch data
+   // in flight. This is O(1) regardless of the number of files.
+
+   static const int    s_n_candidates = 4;
+   static const time_t s_demand_window = 10;
+
+   PrefetchShard &ps = * m_prefetch_shards[shard];
+
+   ps.m_cond.Lock();
+   while (ps.m_files.empty())
    {
-      m_prefetch_condVar.Wait();
+      ps.m_cond.Wait();
    }
 
-   //  std::sort(m_prefetchList.begin(), m_prefetchList.end(), myobject);
+   size_t    l      = ps.m_files.size();
+   time_t    now    = time(0);
+   int       n      = std::min((size_t) s_n_candidates, l);
+   size_t    start  = rand_r(&ps.m_seed) % l;
+   size_t    best   = start;
+   bool      best_d = false;
+   long long best_f = 0;
 
-   size_t l = m_prefetchList.size();
-   int idx = rand() % l;
-   File* f = m_prefetchList[idx];
+   for (int i = 0; i < n; ++i)
+   {
+      size_t idx = (n == (int) l) ? i : (i == 0 ? start : rand_r(&ps.m_seed) % l);
+
+      const PrefetchEntry &e = ps.m_files[idx];
+
+      bool      demand   = now - e.m_miss_time < s_demand_window;
+      long long inflight = e.m_origin ? e.m_origin->m_inflight.load() : 0;
+
+      if (i == 0 || (demand && ! best_d) || (demand == best_d && inflight < best_f))
+      {
+         best   = idx;
+         best_d = demand;
+         best_f = inflight;
+      }
+   }
+
+   File* f = ps.m_files[best].m_file;
 
-   m_prefetch_condVar.UnLock();
+   ps.m_cond.UnLock();
    return f;
 }
 
 
-void Cache::Prefetch()
+void Cache::Prefetch(int shard)
 {
    const long long limit_RAM = m_configuration.m_RamAbsAvailable * 7 / 10;
 
+   m_prefetch_shards[shard]->m_seed = shard + 1;
+
    while (true)
    {
-      m_RAM_mutex.Lock();
-      bool doPrefetch = (m_RAM_used < limit_RAM);
-      m_RAM_mutex.UnLock();
+      bool doPrefetch = (m_RAM_pool.GetUsed() < limit_RAM);
 
       if (doPrefetch)
       {
-         File* f = GetNextFileToPrefetch();
+         File* f = GetNextFileToPrefetch(shard);
          f->Prefetch();
       }
       else
@@ -1059,6 +1110,8 @@ int Cache::UnlinkFile(const std::string& f_name, bool fail_if_open)
    int f_ret = m_oss->Unlink(f_name.c_str());
    int i_ret = m_oss->Unlink(i_name.c_str());
 
+   if (m_usage_index) m_usage_index->Remove(f_name);
+
    TRACE(Debug, "UnlinkCommon " << f_name << ", f_ret=" << f_ret << ", i_ret=" << i_ret);
 
    {
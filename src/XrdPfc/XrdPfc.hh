@@ -17,6 +17,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
 //----------------------------------------------------------------------------------
+#include <atomic>
 #include <string>
 #include <list>
 #include <map>
@@ -29,6 +30,7 @@
 #include "XrdOuc/XrdOucCallBack.hh"
 #include "XrdCl/XrdClDefaultEnv.hh"
 
+#include "XrdPfcBufferPool.hh"
 #include "XrdPfcFile.hh"
 #include "XrdPfcDecision.hh"
 
@@ -43,12 +45,24 @@ class File;
 class IO;
 
 class DataFsState;
+class UsageIndex;
 }
 
 
 namespace XrdPfc
 {
 
+//----------------------------------------------------------------------------
+//! Prefetch accounting for an origin server, used to balance prefetching
+//! between servers. Objects are created on first use and never deleted.
+//----------------------------------------------------------------------------
+struct PrefetchOrigin
+{
+   std::atomic<long long> m_inflight;   //!< bytes of prefetch requests in flight
+
+   PrefetchOrigin() : m_inflight(0) {}
+};
+
 //----------------------------------------------------------------------------
 //! Contains parameters configurable from the xrootd config file.
 //----------------------------------------------------------------------------
@@ -92,6 +106,7 @@ struct Configuration
    int       m_purgeColdFilesAge;       //!< purge files older than this age
    int       m_purgeAgeBasedPeriod;     //!< peform cold file / uvkeep purge every this many purge cycles
    int       m_accHistorySize;          //!< max number of entries in access history part of cinfo file
+   std::string m_purgeIndexPath;        //!< persistent usage index for purge, empty when not used
 
    std::set<std::string> m_dirStatsDirs;     //!< directories for which stat reporting was requested
    std::set<std::string> m_dirStatsDirGlobs; //!< directory globs for which stat reporting was requested
@@ -101,9 +116,11 @@ struct Configuration
    long long m_bufferSize;              //!< prefetch buffer size, default 1MB
    long long m_RamAbsAvailable;         //!< available from configuration
    int       m_RamKeepStdBlocks;        //!< number of standard-sized blocks kept after release
+   bool      m_RamHugePages;            //!< request huge pages for large RAM blocks
    int       m_wqueue_blocks;           //!< maximum number of blocks written per write-queue loop
    int       m_wqueue_threads;          //!< number of threads writing blocks to disk
    int       m_prefetch_max_blocks;     //!< maximum number of blocks to prefetch per file
+   int       m_prefetch_workers;        //!< number of prefetch threads, each serving its own set of files
 
    long long m_hdfsbsize;               //!< used with m_hdfsmode, default 128MB
    long long m_flushCnt;                //!< nuber of unsynced blcoks on disk before flush is called
@@ -369,9 +386,23 @@ public:
    void RegisterPrefetchFile(File*);
    void DeRegisterPrefetchFile(File*);
 
-   File* GetNextFileToPrefetch();
+   //---------------------------------------------------------------------
+   //! Note a client miss on a file, such files are prefetched first.
+   //---------------------------------------------------------------------
+   void PrefetchDemand(File*);
+
+   //---------------------------------------------------------------------
+   //! Account prefetch bytes in flight against the origin server.
+   //---------------------------------------------------------------------
+   PrefetchOrigin* PrefetchIssued(File*, const char *location, long long bytes);
+   void            PrefetchDone(PrefetchOrigin *origin, long long bytes);
 
-   void Prefetch();
+   File* GetNextFileToPrefetch(int shard);
+
+   //---------------------------------------------------------------------
+   //! Thread function of a prefetch worker serving the given shard.
+   //---------------------------------------------------------------------
+   void Prefetch(int shard);
 
    XrdOss* GetOss() const { return m_oss; }
 
@@ -390,6 +421,8 @@ public:
 
    XrdXrootdGStream* GetGStream() { return m_gstream; }
 
+   UsageIndex* GetUsageIndex() { return m_usage_index; }
+
    void ExecuteCommandUrl(const std::string& command_url);
 
    static XrdScheduler *schedP;
@@ -418,14 +451,10 @@ private:
 
    Configuration m_configuration;           //!< configurable parameters
 
-   XrdSysCondVar m_prefetch_condVar;        //!< lock for vector of prefetching files
    bool          m_prefetch_enabled;        //!< set to true when prefetching is enabled
 
-   XrdSysMutex m_RAM_mutex;                 //!< lock for allcoation of RAM blocks
-   long long   m_RAM_used;
-   long long   m_RAM_write_queue;
-   std::list<char*> m_RAM_std_blocks;       //!< A list of blocks of standard size, to be reused.
-   int              m_RAM_std_size;
+   BufferPool             m_RAM_pool;        //!< allocation and accounting of RAM blocks
+   std::atomic<long long> m_RAM_write_queue;
 
    bool        m_isClient;                  //!< True if running as client
 
@@ -460,8 +489,33 @@ private:
    void schedule_file_sync(File*, bool ref_cnt_already_set, bool high_debug);
 
    // prefetching
-   typedef std::vector<File*>  PrefetchList;
-   PrefetchList m_prefetchList;
+   //
+   // Files being prefetched are spread over shards, one per prefetch worker.
+   // A file keeps its shard and slot so that it can be removed in O(1).
+   struct PrefetchEntry
+   {
+      File           *m_file;
+      PrefetchOrigin *m_origin;     //!< origin of latest prefetch, 0 if none yet
+      time_t          m_miss_time;  //!< time of latest client miss
+
+      PrefetchEntry(File *f) : m_file(f), m_origin(0), m_miss_time(0) {}
+   };
+
+   struct PrefetchShard
+   {
+      XrdSysCondVar              m_cond;  //!< protects m_files, signaled on registration
+      std::vector<PrefetchEntry> m_files;
+      unsigned int               m_seed;  //!< for random sampling of candidates
+
+      PrefetchShard() : m_cond(0), m_seed(0) {}
+   };
+
+   typedef std::map<std::string, PrefetchOrigin*> PrefetchOriginMap_t;
+
+   std::vector<PrefetchShard*> m_prefetch_shards;
+   std::atomic<unsigned int>   m_prefetch_next_shard;
+   XrdSysMutex                 m_prefetch_origin_mutex;
+   PrefetchOriginMap_t         m_prefetch_origins;
 
    //---------------------------------------------------------------------------
    // Statistics, heart-beat, scan-and-purge
@@ -472,6 +526,8 @@ private:
 
    DataFsState     *m_fs_state;           //!< directory state for access / usage info and quotas
 
+   UsageIndex      *m_usage_index;        //!< persistent per-file usage, avoids namespace traversal in purge
+
    int                       m_last_scan_duration;
    int                       m_last_purge_duration;
    ScanAndPurgeThreadState_e m_spt_state;
@@ -0,0 +1,337 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#include "XrdPfcBufferPool.hh"
+
+using namespace XrdPfc;
+
+namespace
+{
+   const int       s_page_shift = 12;
+   const long long s_page_size  = 1ll << s_page_shift;
+   const long long s_huge_size  = 2ll * 1024 * 1024;
+
+   const int       s_mag_slots  = 4;
+
+   inline int high_bit(unsigned long long x)
+   {
+      return 63 - __builtin_clzll(x);
+   }
+}
+
+//==============================================================================
+// Per-thread magazine
+//==============================================================================
+
+//------------------------------------------------------------------------------
+//! A few recently released buffers kept by each thread so that a thread doing
+//! request / release in a loop does not touch the shared queues at all.
+//! Contents are given back to the pool when the thread exits.
+//------------------------------------------------------------------------------
+
+struct BufferPool::Magazine
+{
+   BufferPool *m_pool;
+   char       *m_buf[s_mag_slots];
+   int         m_cls[s_mag_slots];
+   long long   m_bytes;
+
+   Magazine() : m_pool(0), m_bytes(0)
+   {
+      for (int i = 0; i < s_mag_slots; ++i) { m_buf[i] = 0; m_cls[i] = -1; }
+   }
+
+   ~Magazine()
+   {
+      for (int i = 0; i < s_mag_slots; ++i)
+      {
+         if (m_buf[i]) m_pool->release_to_ring(m_buf[i], m_cls[i], class_size(m_cls[i]));
+      }
+   }
+
+   char* take(int cls, long long csize)
+   {
+      for (int i = 0; i < s_mag_slots; ++i)
+      {
+         if (m_cls[i] == cls && m_buf[i])
+         {
+            char *buf = m_buf[i];
+            m_buf[i] = 0;
+            m_cls[i] = -1;
+            m_bytes -= csize;
+            return buf;
+         }
+      }
+      return 0;
+   }
+
+   bool put(char *buf, int cls, long long csize)
+   {
+      if (m_bytes + csize > m_pool->m_mag_max) return false;
+
+      for (int i = 0; i < s_mag_slots; ++i)
+      {
+         if ( ! m_buf[i])
+         {
+            m_buf[i] = buf;
+            m_cls[i] = cls;
+            m_bytes += csize;
+            return true;
+         }
+      }
+      return false;
+   }
+};
+
+namespace
+{
+   thread_local BufferPool::Magazine t_magazine;
+}
+
+//==============================================================================
+// Ring -- bounded MPMC queue, each cell carries a sequence number telling
+// whether it is ready for the next push or for the next pop.
+//==============================================================================
+
+void BufferPool::Ring::init(size_t capacity)
+{
+   size_t cap = 2;
+   while (cap < capacity) cap <<= 1;
+
+   m_cells = new Cell[cap];
+   m_mask  = cap - 1;
+   for (size_t i = 0; i < cap; ++i)
+   {
+      m_cells[i].m_seq.store(i, std::memory_order_relaxed);
+      m_cells[i].m_buf = 0;
+   }
+}
+
+bool BufferPool::Ring::push(char *buf)
+{
+   if ( ! m_cells) return false;
+
+   Cell   *cell;
+   size_t  pos = m_enq.load(std::memory_order_relaxed);
+   while (true)
+   {
+      cell = &m_cells[pos & m_mask];
+      size_t   seq = cell->m_seq.load(std::memory_order_acquire);
+      intptr_t dif = (intptr_t) seq - (intptr_t) pos;
+      if (dif == 0)
+      {
+         if (m_enq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            break;
+      }
+      else if (dif < 0)
+      {
+         return false; // full
+      }
+      else
+      {
+         pos = m_enq.load(std::memory_order_relaxed);
+      }
+   }
+   cell->m_buf = buf;
+   cell->m_seq.store(pos + 1, std::memory_order_release);
+   return true;
+}
+
+char* BufferPool::Ring::pop()
+{
+   if ( ! m_cells) return 0;
+
+   Cell   *cell;
+   size_t  pos = m_deq.load(std::memory_order_relaxed);
+   while (true)
+   {
+      cell = &m_cells[pos & m_mask];
+      size_t   seq = cell->m_seq.load(std::memory_order_acquire);
+      intptr_t dif = (intptr_t) seq - (intptr_t) (pos + 1);
+      if (dif == 0)
+      {
+         if (m_deq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            break;
+      }
+      else if (dif < 0)
+      {
+         return 0; // empty
+      }
+      else
+      {
+         pos = m_deq.load(std::memory_order_relaxed);
+      }
+   }
+   char *buf = cell->m_buf;
+   cell->m_seq.store(pos + m_mask + 1, std::memory_order_release);
+   return buf;
+}
+
+//==============================================================================
+// BufferPool
+//==============================================================================
+
+BufferPool::BufferPool() :
+   m_used(0),
+   m_kept(0),
+   m_used_max(0),
+   m_keep_max(0),
+   m_mag_max(0),
+   m_hugepages(false)
+{}
+
+void BufferPool::Configure(long long used_max, long long keep_max, bool hugepages)
+{
+   m_used_max  = used_max;
+   m_keep_max  = keep_max;
+   m_mag_max   = keep_max / 64;
+   m_hugepages = hugepages;
+
+   // Queue capacity is bounded by what could be kept of a given class, so
+   // that large classes do not reserve big, never used queues.
+   for (int c = 0; c < s_max_classes; ++c)
+   {
+      long long n = keep_max / class_size(c) + 1;
+      if (n > 1024) n = 1024;
+      m_rings[c].init((size_t) n);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Size classes: one class for each of 1 - 4 pages and then four classes per
+// power of two pages, i.e. 5, 6, 7, 8, 10, 12, 14, 16, 20, ... pages. The
+// rounding overhead is at most 25% and all usual block sizes are exact.
+// Returns -1 for sizes above the largest class; those are not pooled.
+//------------------------------------------------------------------------------
+
+int BufferPool::size_class(long long size)
+{
+   long long n = (size + s_page_size - 1) >> s_page_shift;
+   if (n <= 4) return n > 0 ? (int) n - 1 : 0;
+
+   long long m = n - 1;
+   int       k = high_bit(m);
+   int       q = (int) ((m - (1ll << k)) >> (k - 2));
+   int     cls = 4 + (k - 2) * 4 + q;
+
+   return cls < s_max_classes ? cls : -1;
+}
+
+long long BufferPool::class_size(int cls)
+{
+   if (cls < 4) return (long long) (cls + 1) << s_page_shift;
+
+   int k = (cls - 4) / 4 + 2;
+   int q = (cls - 4) % 4;
+   return ((1ll << k) + ((long long) (q + 1) << (k - 2))) << s_page_shift;
+}
+
+char* BufferPool::sys_alloc(long long size)
+{
+   bool   huge  = m_hugepages && size >= s_huge_size;
+   size_t align = huge ? s_huge_size : s_page_size;
+
+   char *buf;
+   if (posix_memalign((void**) &buf, align, (size_t) size))
+   {
+      return 0;
+   }
+#ifdef MADV_HUGEPAGE
+   if (huge) madvise(buf, (size_t) size, MADV_HUGEPAGE);
+#endif
+   return buf;
+}
+
+void BufferPool::sys_free(char *buf, long long)
+{
+   free(buf);
+}
+
+void BufferPool::release_to_ring(char *buf, int cls, long long csize)
+{
+   // Bytes in magazines are already counted in m_kept.
+   if ( ! m_rings[cls].push(buf))
+   {
+      m_kept.fetch_sub(csize, std::memory_order_relaxed);
+      sys_free(buf, csize);
+   }
+}
+
+//------------------------------------------------------------------------------
+
+char* BufferPool::Request(long long size)
+{
+   int       cls   = size_class(size);
+   long long csize = cls >= 0 ? class_size(cls) : (size + s_page_size - 1) & ~(s_page_size - 1);
+
+   if (m_used.fetch_add(csize, std::memory_order_relaxed) + csize > m_used_max)
+   {
+      m_used.fetch_sub(csize, std::memory_order_relaxed);
+      return 0;
+   }
+
+   char *buf = 0;
+   if (cls >= 0)
+   {
+      Magazine &mag = t_magazine;
+      if (mag.m_pool == this)
+         buf = mag.take(cls, csize);
+      if ( ! buf)
+         buf = m_rings[cls].pop();
+      if (buf)
+      {
+         m_kept.fetch_sub(csize, std::memory_order_relaxed);
+         return buf;
+      }
+   }
+
+   buf = sys_alloc(csize);
+   if ( ! buf)
+   {
+      // Report out of mem? Probably should report it at least the first time,
+      // then periodically.
+      m_used.fetch_sub(csize, std::memory_order_relaxed);
+   }
+   return buf;
+}
+
+void BufferPool::Release(char *buf, long long size)
+{
+   int       cls   = size_class(size);
+   long long csize = cls >= 0 ? class_size(cls) : (size + s_page_size - 1) & ~(s_page_size - 1);
+
+   m_used.fetch_sub(csize, std::memory_order_relaxed);
+
+   if (cls < 0 || m_kept.fetch_add(csize, std::memory_order_relaxed) + csize > m_keep_max)
+   {
+      if (cls >= 0) m_kept.fetch_sub(csize, std::memory_order_relaxed);
+      sys_free(buf, csize);
+      return;
+   }
+
+   Magazine &mag = t_magazine;
+   if (mag.m_pool == 0)
+      mag.m_pool = this;
+   if (mag.m_pool == this && mag.put(buf, cls, csize))
+      return;
+
+   release_to_ring(buf, cls, csize);
+}
@@ -0,0 +1,114 @@
+#ifndef __XRDPFC_BUFFERPOOL_HH__
+#define __XRDPFC_BUFFERPOOL_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <atomic>
+#include <stddef.h>
+
+namespace XrdPfc
+{
+
+//----------------------------------------------------------------------------
+//! Page aligned, size-classed pool of RAM blocks.
+//!
+//! Requested sizes are rounded up to a size class (four classes per power of
+//! two pages, so standard block sizes map exactly). Released blocks are kept
+//! in a small per-thread magazine and in a bounded lock-free queue per class,
+//! up to a configured total, and are otherwise returned to the system. The
+//! amount of RAM handed out is accounted for against a maximum without
+//! taking any lock.
+//----------------------------------------------------------------------------
+
+class BufferPool
+{
+public:
+   BufferPool();
+
+   //---------------------------------------------------------------------
+   //! Set limits. Must be called before first use.
+   //!
+   //! @param used_max   maximum bytes handed out at any time
+   //! @param keep_max   maximum bytes kept for reuse after release
+   //! @param hugepages  request transparent huge pages for large blocks
+   //---------------------------------------------------------------------
+   void Configure(long long used_max, long long keep_max, bool hugepages);
+
+   //---------------------------------------------------------------------
+   //! Get a buffer of at least size bytes, 0 if over the limit or out of memory.
+   //---------------------------------------------------------------------
+   char* Request(long long size);
+
+   //---------------------------------------------------------------------
+   //! Return a buffer, size must be the same as passed to Request() or
+   //! anything that rounds up to the same page count.
+   //---------------------------------------------------------------------
+   void  Release(char *buf, long long size);
+
+   long long GetUsed() const { return m_used.load(std::memory_order_relaxed); }
+   long long GetKept() const { return m_kept.load(std::memory_order_relaxed); }
+
+   static const int s_max_classes = 64;
+
+   struct Magazine;
+
+private:
+   //! Bounded multi-producer / multi-consumer queue of free buffers.
+   class Ring
+   {
+   public:
+      Ring() : m_cells(0), m_mask(0), m_enq(0), m_deq(0) {}
+
+      void  init(size_t capacity);
+      bool  push(char *buf);
+      char* pop();
+
+   private:
+      struct Cell
+      {
+         std::atomic<size_t>  m_seq;
+         char                *m_buf;
+      };
+
+      Cell               *m_cells;
+      size_t              m_mask;
+      char                m_pad0[64];
+      std::atomic<size_t> m_enq;
+      char                m_pad1[64];
+      std::atomic<size_t> m_deq;
+      char                m_pad2[64];
+   };
+
+   static int       size_class(long long size);
+   static long long class_size(int cls);
+
+   char* sys_alloc(long long size);
+   void  sys_free(char *buf, long long size);
+   void  release_to_ring(char *buf, int cls, long long csize);
+
+   Ring                   m_rings[s_max_classes];
+   std::atomic<long long> m_used;
+   std::atomic<long long> m_kept;
+   long long              m_used_max;
+   long long              m_keep_max;
+   long long              m_mag_max;      //!< bytes kept per thread
+   bool                   m_hugepages;
+};
+
+}
+
+#endif
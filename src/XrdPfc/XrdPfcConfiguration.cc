@@ -1,6 +1,7 @@
 #include "XrdPfc.hh"
 #include "XrdPfcTrace.hh"
 #include "XrdPfcInfo.hh"
+#include "XrdPfcUsageIndex.hh"
 
 #include "XrdOss/XrdOss.hh"
 
@@ -39,9 +40,11 @@ Configuration::Configuration() :
    m_bufferSize(1024*1024),
    m_RamAbsAvailable(0),
    m_RamKeepStdBlocks(0),
+   m_RamHugePages(false),
    m_wqueue_blocks(16),
    m_wqueue_threads(4),
    m_prefetch_max_blocks(10),
+   m_prefetch_workers(1),
    m_hdfsbsize(128*1024*1024),
    m_flushCnt(2000),
    m_cs_UVKeep(-1),
@@ -451,6 +454,9 @@ bool Cache::Config(const char *config_filename, const char *parameters)
    }
    // Setup number of standard-size blocks not released back to the system to 5% of total RAM.
    m_configuration.m_RamKeepStdBlocks = (m_configuration.m_RamAbsAvailable / m_configuration.m_bufferSize + 1) * 5 / 100;
+   m_RAM_pool.Configure(m_configuration.m_RamAbsAvailable,
+                        m_configuration.m_RamKeepStdBlocks * m_configuration.m_bufferSize,
+                        m_configuration.m_RamHugePages);
    
 
    // Set tracing to debug if this is set in environment
@@ -477,8 +483,8 @@ bool Cache::Config(const char *config_filename, const char *parameters)
       loff = snprintf(buff, sizeof(buff), "Config effective %s pfc configuration:\n"
                       "       pfc.cschk %s uvkeep %s\n"
                       "       pfc.blocksize %lld\n"
-                      "       pfc.prefetch %d\n"
-                      "       pfc.ram %.fg\n"
+                      "       pfc.prefetch %d workers %d\n"
+                      "       pfc.ram %.fg%s\n"
                       "       pfc.writequeue %d %d\n"
                       "       # Total available disk: %lld\n"
                       "       pfc.diskusage %lld %lld files %lld %lld %lld purgeinterval %d purgecoldfiles %d\n"
@@ -489,8 +495,8 @@ bool Cache::Config(const char *config_filename, const char *parameters)
                       config_filename,
                       csc[int(m_configuration.m_cs_Chk)], uvk,
                       m_configuration.m_bufferSize,
-                      m_configuration.m_prefetch_max_blocks,
-                      rg,
+                      m_configuration.m_prefetch_max_blocks, m_configuration.m_prefetch_workers,
+                      rg, m_configuration.m_RamHugePages ? " hugepages" : "",
                       m_configuration.m_wqueue_blocks, m_configuration.m_wqueue_threads,
                       sP.Total,
                       m_configuration.m_diskUsageLWM, m_configuration.m_diskUsageHWM,
@@ -516,6 +522,11 @@ bool Cache::Config(const char *config_filename, const char *parameters)
             loff += snprintf(buff + loff, sizeof(buff) - loff, "               %s/*\n", i->c_str());
       }
 
+      if ( ! m_configuration.m_purgeIndexPath.empty())
+      {
+         loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.purgeindex %s\n", m_configuration.m_purgeIndexPath.c_str());
+      }
+
       if (m_configuration.m_hdfsmode)
       {
          loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.hdfsmode hdfsbsize %lld\n", m_configuration.m_hdfsbsize);
@@ -537,8 +548,29 @@ bool Cache::Config(const char *config_filename, const char *parameters)
 
    // Derived settings
    m_prefetch_enabled   = m_configuration.m_prefetch_max_blocks > 0;
+   if (m_prefetch_enabled)
+   {
+      for (int i = 0; i < m_configuration.m_prefetch_workers; ++i)
+      {
+         m_prefetch_shards.push_back(new PrefetchShard);
+      }
+   }
    Info::s_maxNumAccess = m_configuration.m_accHistorySize;
 
+   if (aOK && ! m_configuration.m_purgeIndexPath.empty())
+   {
+      m_usage_index = new UsageIndex(m_configuration.m_purgeIndexPath, m_trace);
+      if ( ! m_usage_index->Load())
+      {
+         m_log.Emsg("Config", "Error: can not set up purge index", m_configuration.m_purgeIndexPath.c_str());
+         aOK = false;
+      }
+      else if ( ! m_usage_index->IsValid())
+      {
+         m_log.Say("Config info: purge index will be rebuilt by a full scan of the cache namespace.");
+      }
+   }
+
    m_gstream = (XrdXrootdGStream*) m_env->GetPtr("pfc.gStream*");
 
    m_log.Say("Config Proxy File Cache g-stream has", m_gstream ? "" : " NOT", " been configured via xrootd.monitor directive");
@@ -644,6 +676,28 @@ bool Cache::ConfigParameters(std::string part, XrdOucStream& config, TmpConfigur
          }
       }
    }
+   else if ( part == "purgeindex" )
+   {
+      const char *p = cwg.GetWord();
+      if ( ! cwg.HasLast())
+      {
+         m_log.Emsg("Config", "Error: pfc.purgeindex requires a parameter.");
+         return false;
+      }
+      if (strcmp(p, "off") == 0)
+      {
+         m_configuration.m_purgeIndexPath.clear();
+      }
+      else if (*p != '/')
+      {
+         m_log.Emsg("Config", "Error: pfc.purgeindex path must be absolute", p);
+         return false;
+      }
+      else
+      {
+         m_configuration.m_purgeIndexPath = p;
+      }
+   }
    else if ( part == "acchistorysize" )
    {
       if ( XrdOuca2x::a2i(m_log, "Error getting access-history-size", cwg.GetWord(), &m_configuration.m_accHistorySize, 20, 200))
@@ -749,6 +803,23 @@ bool Cache::ConfigParameters(std::string part, XrdOucStream& config, TmpConfigur
          return false;
       }
 
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "workers") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error setting prefetch worker count", cwg.GetWord(), &m_configuration.m_prefetch_workers, 1, 64))
+            {
+               return false;
+            }
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: prefetch stanza contains unknown directive", p);
+            return false;
+         }
+      }
+
    }
    else if ( part == "nramread" )
    {
@@ -763,6 +834,20 @@ bool Cache::ConfigParameters(std::string part, XrdOucStream& config, TmpConfigur
       {
          return false;
       }
+
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "hugepages") == 0)
+         {
+            m_configuration.m_RamHugePages = true;
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: ram stanza contains unknown directive", p);
+            return false;
+         }
+      }
    }
    else if ( part == "writequeue")
    {
@@ -33,6 +33,7 @@
 #include "XrdOuc/XrdOucEnv.hh"
 #include "XrdSfs/XrdSfsInterface.hh"
 #include "XrdPfc.hh"
+#include "XrdPfcUsageIndex.hh"
 
 
 using namespace XrdPfc;
@@ -66,6 +67,8 @@ File::File(const std::string& path, long long iOffset, long long iFileSize) :
    m_in_sync(false),
    m_state_cond(0),
    m_prefetch_state(kOff),
+   m_prefetch_shard(-1),
+   m_prefetch_slot(-1),
    m_prefetch_read_cnt(0),
    m_prefetch_hit_cnt(0),
    m_prefetch_score(1),
@@ -486,6 +489,12 @@ bool File::Open()
    }
 
    m_cfi.WriteIOStatAttach();
+
+   if (UsageIndex *ui = Cache::GetInstance().GetUsageIndex())
+   {
+      ui->Update(m_filename, m_cfi);
+   }
+
    m_state_cond.Lock();
    m_is_open = true;
    m_prefetch_state = (m_cfi.IsComplete()) ? kComplete : kStopped; // Will engage in AddIO().
@@ -759,6 +768,12 @@ int File::Read(IO *io, char* iUserBuff, long long iUserOff, int iUserSize)
       }
    }
 
+   // Client misses make this file a preferred prefetch candidate.
+   if ( ! blks_to_request.empty() && m_prefetch_state == kOn)
+   {
+      cache()->PrefetchDemand(this);
+   }
+
    m_state_cond.UnLock();
 
    ProcessBlockRequests(blks_to_request);
@@ -1043,6 +1058,10 @@ void File::Sync()
          TRACEF(Error, "Sync cinfo file sync error " << cret);
          errorp = true;
       }
+      else if (UsageIndex *ui = Cache::GetInstance().GetUsageIndex())
+      {
+         ui->Update(m_filename, m_cfi);
+      }
    }
    else
    {
@@ -1197,6 +1216,12 @@ void File::ProcessBlockResponse(BlockResponseHandler* brh, int res)
    // Deregister block from IO's prefetch count, if needed.
    if (b->m_prefetch)
    {
+      if (b->m_prefetch_origin)
+      {
+         cache()->PrefetchDone(b->m_prefetch_origin, b->get_size());
+         b->m_prefetch_origin = 0;
+      }
+
       IoMap_i mi = m_io_map.find(b->get_io());
       if (mi != m_io_map.end())
       {
@@ -1319,6 +1344,7 @@ void File::Prefetch()
                if (b)
                {
                   TRACEF(Dump, "Prefetch take block " << f_act);
+                  b->m_prefetch_origin = cache()->PrefetchIssued(this, m_current_io->first->GetLocation(), b->get_size());
                   blks.push_back(b);
                   // Note: block ref_cnt not increased, it will be when placed into write queue.
                   m_prefetch_read_cnt++;
@@ -56,6 +56,7 @@ namespace XrdPfc
 {
 
 class File;
+struct PrefetchOrigin;
 
 class Block
 {
@@ -72,11 +73,12 @@ public:
    bool                m_prefetch;
    bool                m_req_cksum_net;
    vCkSum_t            m_cksum_vec;
+   PrefetchOrigin     *m_prefetch_origin; // origin charged for an in-flight prefetch
 
    Block(File *f, IO *io, char *buf, long long off, int size, bool m_prefetch, bool cks_net) :
       m_file(f), m_io(io), m_buff(buf), m_offset(off), m_size(size),
       m_refcnt(0), m_errno(0), m_downloaded(false), m_prefetch(m_prefetch),
-      m_req_cksum_net(cks_net)
+      m_req_cksum_net(cks_net), m_prefetch_origin(0)
    {}
 
    char*     get_buff()   { return m_buff;   }
@@ -242,6 +244,8 @@ public:
    bool is_in_emergency_shutdown() { return m_in_shutdown; }
 
 private:
+   friend class Cache;
+
    enum PrefetchState_e { kOff=-1, kOn, kHold, kStopped, kComplete };
 
    int            m_ref_cnt;            //!< number of references from IO or sync
@@ -311,6 +315,9 @@ private:
 
    PrefetchState_e m_prefetch_state;
 
+   int   m_prefetch_shard;              //!< prefetch shard and slot in it, managed by Cache under shard lock
+   int   m_prefetch_slot;
+
    int   m_prefetch_read_cnt;
    int   m_prefetch_hit_cnt;
    float m_prefetch_score;              // cached
@@ -50,13 +50,13 @@ bool IO::Detach(XrdOucCacheIOCD &iocdP)
       {
          IO              *f_io;
          XrdOucCacheIOCD *f_detach_cb;
-         time_t           f_wait_time;
+         int              f_wait_ms;
 
       public:
-         FutureDetach(IO *io, XrdOucCacheIOCD *cb, time_t wt) :
+         FutureDetach(IO *io, XrdOucCacheIOCD *cb, int wms) :
             f_io        (io),
             f_detach_cb (cb),
-            f_wait_time (wt)
+            f_wait_ms   (wms)
          {}
 
          void DoIt()
@@ -64,7 +64,7 @@ bool IO::Detach(XrdOucCacheIOCD &iocdP)
             if (f_io->ioActive())
             {
                // Reschedule up to 120 sec in the future.
-               f_wait_time = std::min(2 * f_wait_time, (time_t) 120);
+               f_wait_ms = std::min(2 * f_wait_ms, 120 * 1000);
                Schedule();
             }
             else
@@ -78,11 +78,13 @@ bool IO::Detach(XrdOucCacheIOCD &iocdP)
 
          void Schedule()
          {
-            Cache::schedP->Schedule(this, time(0) + f_wait_time);
+            Cache::schedP->ScheduleMS(this, f_wait_ms);
          }
       };
 
-      (new FutureDetach(this, &iocdP, 30))->Schedule();
+      // Most outstanding requests complete within milliseconds, start with
+      // a short wait so that the detach is not held up for long.
+      (new FutureDetach(this, &iocdP, 100))->Schedule();
 
       return false;
    }
@@ -1,5 +1,6 @@
 #include "XrdPfc.hh"
 #include "XrdPfcTrace.hh"
+#include "XrdPfcUsageIndex.hh"
 
 #include <fcntl.h>
 #include <sys/time.h>
@@ -267,6 +268,7 @@ public:
 
    const char   *m_info_ext;
    const size_t  m_info_ext_len;
+   UsageIndex   *m_usage_index;  // set when traversal is used to rebuild the usage index
    XrdSysTrace  *m_trace;
 
    static const char *m_traceID;
@@ -339,6 +341,7 @@ public:
       m_max_dir_level_for_stat_collection(Cache::Conf().m_dirStatsStoreDepth),
       m_info_ext(XrdPfc::Info::s_infoExtension),
       m_info_ext_len(strlen(XrdPfc::Info::s_infoExtension)),
+      m_usage_index(0),
       m_trace(Cache::GetInstance().GetTrace())
    {
       m_current_path.reserve(256);
@@ -351,6 +354,7 @@ public:
    void      setMinTime(time_t min_time) { tMinTimeStamp = min_time; }
    time_t    getMinTime()          const { return tMinTimeStamp; }
    void      setUVKeepMinTime(time_t min_time) { tMinUVKeepTimeStamp = min_time; }
+   void      setUsageIndex(UsageIndex *ui) { m_usage_index = ui; }
    long long getNBytesTotal()      const { return nBytesTotal; }
 
    void MoveListEntriesToMap()
@@ -402,6 +406,13 @@ public:
       }
       // TRACE(Dump, trc_pfx << "checking " << fname << " accessTime  " << atime);
 
+      if (m_usage_index)
+      {
+         std::string lfn(m_current_path);
+         lfn.append(fname, strlen(fname) - m_info_ext_len);
+         m_usage_index->AddScanned(lfn, info, atime);
+      }
+
       nBytesTotal += nbytes;
 
       m_dir_usage_stack.back() += nbytes;
@@ -444,6 +455,48 @@ public:
       }
    }
 
+   void ProcessUsageIndex(const UsageIndex &ui, DataFsState &fs_state)
+   {
+      // Select purge candidates from the usage index instead of traversing the
+      // namespace. Entries are visited oldest first so only the candidates
+      // themselves (and cold / uvkeep files, when requested) are looked at.
+      // Directory usage is not re-measured here, only purged amounts are
+      // accounted for.
+
+      std::set<std::string> listed;
+
+      nBytesTotal = ui.GetNBytesTotal();
+
+      if (tMinUVKeepTimeStamp > 0)
+      {
+         ui.VisitByNoCkSumTime([&](const std::string &lfn, const UsageIndex::Entry &e) -> bool
+         {
+            if (e.m_noCksTime >= tMinUVKeepTimeStamp) return false;
+
+            m_flist.push_back(FS(lfn, m_info_ext, e.m_nBytes, 0, fs_state.find_dirstate_for_lfn(lfn)));
+            nBytesAccum += e.m_nBytes;
+            listed.insert(lfn);
+            return true;
+         });
+      }
+
+      ui.VisitByAccessTime([&](const std::string &lfn, const UsageIndex::Entry &e) -> bool
+      {
+         bool is_cold = tMinTimeStamp > 0 && e.m_atime < tMinTimeStamp;
+
+         if ( ! is_cold && nBytesAccum >= nBytesReq) return false;
+
+         if (listed.find(lfn) != listed.end()) return true;
+
+         if (is_cold)
+            m_flist.push_back(FS(lfn, m_info_ext, e.m_nBytes, 0, fs_state.find_dirstate_for_lfn(lfn)));
+         else
+            m_fmap.insert(std::make_pair(e.m_atime, FS(lfn, m_info_ext, e.m_nBytes, e.m_atime, fs_state.find_dirstate_for_lfn(lfn))));
+         nBytesAccum += e.m_nBytes;
+         return true;
+      });
+   }
+
    void TraverseNamespace(XrdOssDF *iOssDF)
    {
       static const char *trc_pfx = "FPurgeState::TraverseNamespace ";
@@ -649,8 +702,7 @@ void Cache::ResourceMonitorHeartBeat()
       // - available / used disk space (files usage calculated elsewhere (maybe))
 
       // - RAM usage
-      {  XrdSysMutexHelper lck(&m_RAM_mutex);
-         X.MemUsed   = m_RAM_used;
+      {  X.MemUsed   = m_RAM_pool.GetUsed();
          X.MemWriteQ = m_RAM_write_queue;
       }
       // - files opened / closed etc
@@ -789,7 +841,12 @@ void Cache::Purge()
          }
       }
 
-      bool enforce_traversal_for_usage_collection = is_first;
+      // With a valid usage index purge candidates and file usage are taken from
+      // it and the namespace is only traversed to (re)build the index.
+      bool use_usage_index   = m_usage_index && m_usage_index->IsValid();
+      bool rebuild_usage_index = m_usage_index && ! use_usage_index;
+
+      bool enforce_traversal_for_usage_collection = (is_first && ! use_usage_index) || rebuild_usage_index;
       // XXX Other conditions? Periodic checks?
 
       copy_out_active_stats_and_update_data_fs_state();
@@ -799,6 +856,7 @@ void Cache::Purge()
       TRACE(Debug, "\tbytes_to remove_files   = " << bytesToRemove_f << " B (" << (is_first ? "max possible for initial run" : "estimated") << ")");
       TRACE(Debug, "\tbytes_to_remove         = " << bytesToRemove   << " B");
       TRACE(Debug, "\tenforce_age_based_purge = " << enforce_age_based_purge);
+      TRACE(Debug, "\tuse_usage_index         = " << use_usage_index);
       is_first = false;
 
       long long bytesToRemove_at_start = 0; // set after file scan
@@ -810,31 +868,54 @@ void Cache::Purge()
       // the traversal more often than really needed.
       FPurgeState purgeState(2 * bytesToRemove, *m_oss); // prepare twice more volume than required
 
-      if (purge_required || enforce_traversal_for_usage_collection)
+      if (purge_required || enforce_traversal_for_usage_collection || use_usage_index)
       {
          // Make a sorted map of file paths sorted by access time.
+         // The index only needs to be searched for cold files when they are to be purged.
 
-         if (m_configuration.is_age_based_purge_in_effect())
+         if (m_configuration.is_age_based_purge_in_effect() && (enforce_age_based_purge || ! use_usage_index))
          {
             purgeState.setMinTime(time(0) - m_configuration.m_purgeColdFilesAge);
          }
-         if (m_configuration.is_uvkeep_purge_in_effect())
+         if (m_configuration.is_uvkeep_purge_in_effect() && (enforce_age_based_purge || ! use_usage_index))
          {
             purgeState.setUVKeepMinTime(time(0) - m_configuration.m_cs_UVKeep);
          }
 
-         XrdOssDF* dh = m_oss->newDir(m_configuration.m_username.c_str());
-         if (dh->Opendir("/", env) == XrdOssOK)
+         if (use_usage_index)
          {
-            purgeState.begin_traversal(m_fs_state->get_root());
+            purgeState.ProcessUsageIndex(*m_usage_index, *m_fs_state);
+         }
+         else
+         {
+            bool traversal_ok = false;
+
+            if (rebuild_usage_index)
+            {
+               purgeState.setUsageIndex(m_usage_index);
+               m_usage_index->BeginRebuild();
+            }
+
+            XrdOssDF* dh = m_oss->newDir(m_configuration.m_username.c_str());
+            if (dh->Opendir("/", env) == XrdOssOK)
+            {
+               purgeState.begin_traversal(m_fs_state->get_root());
 
-            purgeState.TraverseNamespace(dh);
+               purgeState.TraverseNamespace(dh);
 
-            purgeState.end_traversal();
+               purgeState.end_traversal();
 
-            dh->Close();
+               dh->Close();
+
+               traversal_ok = true;
+            }
+            delete dh; dh = 0;
+
+            if (rebuild_usage_index)
+            {
+               m_usage_index->EndRebuild(traversal_ok);
+            }
          }
-         delete dh; dh = 0;
 
          estimated_file_usage = purgeState.getNBytesTotal();
 
@@ -940,6 +1021,11 @@ void Cache::Purge()
                else
                   TRACE(Error, trc_pfx << "DirState not set for file '" << dataPath << "'.");
             }
+
+            if (m_usage_index)
+            {
+               m_usage_index->Remove(dataPath);
+            }
          }
          if (protected_cnt > 0)
          {
@@ -956,6 +1042,11 @@ void Cache::Purge()
          m_in_purge = false;
       }
 
+      if (m_usage_index)
+      {
+         m_usage_index->Checkpoint();
+      }
+
       int purge_duration = time(0) - purge_start;
 
       TRACE(Info, trc_pfx << "Finished, removed " << deleted_file_count << " data files, total size " <<
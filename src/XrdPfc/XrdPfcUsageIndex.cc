@@ -0,0 +1,611 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <vector>
+
+#include "XrdPfcUsageIndex.hh"
+#include "XrdPfcInfo.hh"
+#include "XrdPfc.hh"
+#include "XrdPfcTrace.hh"
+
+using namespace XrdPfc;
+
+namespace
+{
+//------------------------------------------------------------------------------
+// On-disk format, shared by snapshot and journal: a header followed by
+// records, each one immediately followed by lfnLen bytes of the lfn.
+// The files are private to the host so native byte order is used.
+//------------------------------------------------------------------------------
+
+const char    s_magic[8] = { 'X', 'r', 'd', 'P', 'f', 'c', 'U', 'I' };
+const int32_t s_version  = 1;
+
+struct DiskHdr
+{
+   char    m_magic[8];
+   int32_t m_version;
+   int32_t m_recSize;
+};
+
+struct DiskRec
+{
+   int64_t  m_nBytes;
+   int64_t  m_atime;
+   int64_t  m_noCksTime;
+   int32_t  m_accCnt;
+   uint16_t m_lfnLen;
+   uint8_t  m_cksState;
+   uint8_t  m_op;
+};
+
+void fill_hdr(DiskHdr &h)
+{
+   memcpy(h.m_magic, s_magic, sizeof(s_magic));
+   h.m_version = s_version;
+   h.m_recSize = sizeof(DiskRec);
+}
+
+// Returns number of bytes placed in buf which must hold sizeof(DiskRec) + 65535.
+int fill_rec(char *buf, int op, const std::string &lfn, const UsageIndex::Entry &e)
+{
+   DiskRec r;
+   r.m_nBytes    = e.m_nBytes;
+   r.m_atime     = e.m_atime;
+   r.m_noCksTime = e.m_noCksTime;
+   r.m_accCnt    = e.m_accCnt;
+   r.m_lfnLen    = lfn.size();
+   r.m_cksState  = e.m_cksState;
+   r.m_op        = op;
+   memcpy(buf, &r, sizeof(r));
+   memcpy(buf + sizeof(r), lfn.data(), lfn.size());
+   return sizeof(r) + lfn.size();
+}
+
+const size_t s_maxLfnLen   = 65535;
+const int    s_snapChunk   = 4096;
+const long long s_minJrnl  = 65536;
+}
+
+//==============================================================================
+// Construction
+//==============================================================================
+
+UsageIndex::UsageIndex(const std::string &path, XrdSysTrace *trace) :
+   m_nBytesTotal(0),
+   m_snap_path(path),
+   m_jrnl_path(path + ".journal"),
+   m_jold_path(path + ".journal.old"),
+   m_jrnl_fd(-1),
+   m_jrnl_recs(0),
+   m_valid(false),
+   m_rebuilding(false),
+   m_in_checkpoint(false),
+   m_trace(trace),
+   m_traceID("UsageIndex")
+{}
+
+UsageIndex::~UsageIndex()
+{
+   if (m_jrnl_fd >= 0) close(m_jrnl_fd);
+}
+
+//------------------------------------------------------------------------------
+
+bool UsageIndex::Load()
+{
+   // Called during configuration, before any file can be opened.
+
+   XrdSysMutexHelper _jlck(&m_jrnl_mutex);
+   XrdSysMutexHelper _lck(&m_mutex);
+
+   // A missing snapshot means the index was never built or that a rebuild
+   // was in progress. Journals left over from a failed checkpoint are
+   // replayed in order; each record carries full state so this is safe.
+   m_valid = replay(m_snap_path, true) && replay(m_jold_path, false) && replay(m_jrnl_path, false);
+
+   if ( ! m_valid)
+   {
+      m_entries.clear(); m_by_atime.clear(); m_by_nocks.clear();
+      m_nBytesTotal = 0;
+   }
+
+   TRACE(Info, "Load() " << (m_valid ? "loaded " : "not usable, will be rebuilt, ") << m_snap_path <<
+         ", n_files=" << m_entries.size() << ", n_bytes=" << m_nBytesTotal);
+
+   return open_journal( ! m_valid);
+}
+
+//------------------------------------------------------------------------------
+
+bool UsageIndex::replay(const std::string &fname, bool must_exist)
+{
+   // Called under lock.
+
+   FILE *fp = fopen(fname.c_str(), "r");
+   if ( ! fp)
+   {
+      if (errno == ENOENT && ! must_exist) return true;
+      if (errno != ENOENT) TRACE(Error, "replay() can not open " << fname << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+
+   DiskHdr hdr, ref;
+   fill_hdr(ref);
+   size_t hlen = fread(&hdr, 1, sizeof(hdr), fp);
+   if (hlen != sizeof(hdr) || memcmp(&hdr, &ref, sizeof(hdr)) != 0)
+   {
+      // An empty journal is fine, it may have been created just before a crash.
+      bool ok = ! must_exist && hlen == 0;
+      if ( ! ok) TRACE(Error, "replay() bad header in " << fname);
+      fclose(fp);
+      return ok;
+   }
+
+   bool        ok      = true;
+   long long   n_recs  = 0;
+   long        end_pos = sizeof(hdr);
+   DiskRec     r;
+   std::string lfn;
+   Entry       e;
+   while (fread(&r, sizeof(r), 1, fp) == 1)
+   {
+      if (r.m_lfnLen == 0 || (r.m_op != RO_Update && r.m_op != RO_Remove))
+      {
+         TRACE(Error, "replay() corrupted record " << n_recs << " in " << fname);
+         ok = false;
+         break;
+      }
+      lfn.resize(r.m_lfnLen);
+      if (fread(&lfn[0], r.m_lfnLen, 1, fp) != 1)
+      {
+         break;
+      }
+      e.m_nBytes    = r.m_nBytes;
+      e.m_atime     = r.m_atime;
+      e.m_noCksTime = r.m_noCksTime;
+      e.m_accCnt    = r.m_accCnt;
+      e.m_cksState  = r.m_cksState;
+      apply((RecOp_e) r.m_op, lfn, e);
+      ++n_recs;
+      end_pos += sizeof(r) + r.m_lfnLen;
+   }
+
+   if (ok && ferror(fp))
+   {
+      TRACE(Error, "replay() read error in " << fname);
+      ok = false;
+   }
+   else if (ok && fseek(fp, 0, SEEK_END) == 0 && ftell(fp) != end_pos)
+   {
+      // The snapshot is always written completely before it gets renamed.
+      // A truncated last record in a journal is a crash artifact, cut it off
+      // so that further appends remain readable.
+      if (must_exist)
+      {
+         TRACE(Error, "replay() truncated " << fname);
+         ok = false;
+      }
+      else
+      {
+         TRACE(Warning, "replay() dropping partial record at the end of " << fname);
+         truncate(fname.c_str(), end_pos);
+      }
+   }
+
+   if ( ! must_exist) m_jrnl_recs += n_recs;
+
+   TRACE(Debug, "replay() " << fname << ", n_records=" << n_recs);
+
+   fclose(fp);
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+
+bool UsageIndex::open_journal(bool trunc)
+{
+   // Called under both locks.
+
+   if (m_jrnl_fd >= 0) close(m_jrnl_fd);
+   m_jrnl_queue.clear();
+
+   m_jrnl_fd = open(m_jrnl_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | (trunc ? O_TRUNC : 0), 0644);
+   if (m_jrnl_fd < 0)
+   {
+      TRACE(Error, "open_journal() can not open " << m_jrnl_path << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+   fcntl(m_jrnl_fd, F_SETFD, FD_CLOEXEC);
+
+   struct stat st;
+   if (fstat(m_jrnl_fd, &st) == 0 && st.st_size == 0)
+   {
+      DiskHdr hdr;
+      fill_hdr(hdr);
+      if (write(m_jrnl_fd, &hdr, sizeof(hdr)) != (ssize_t) sizeof(hdr))
+      {
+         TRACE(Error, "open_journal() can not write " << m_jrnl_path << ERRNO_AND_ERRSTR(errno));
+         close(m_jrnl_fd); m_jrnl_fd = -1;
+         return false;
+      }
+   }
+   if (trunc) m_jrnl_recs = 0;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+void UsageIndex::journal(RecOp_e op, const std::string &lfn, const Entry &e)
+{
+   // Called under lock. The record is only queued here, in the order the
+   // updates were applied; the caller writes it out with flush_journal()
+   // once m_mutex is released.
+
+   if (m_jrnl_fd < 0) return;
+
+   size_t pos = m_jrnl_queue.size();
+   m_jrnl_queue.resize(pos + sizeof(DiskRec) + s_maxLfnLen);
+   m_jrnl_queue.resize(pos + fill_rec(&m_jrnl_queue[pos], op, lfn, e));
+   ++m_jrnl_recs;
+}
+
+void UsageIndex::flush_journal()
+{
+   // Called without m_mutex. Holding m_jrnl_mutex keeps concurrent writers
+   // in queue order and the descriptor from being rotated under the write.
+   // The journal is not synced, a crash of the host loses at most the
+   // latest updates which only makes files look older.
+
+   XrdSysMutexHelper _jlck(&m_jrnl_mutex);
+
+   int fd;
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+      if (m_jrnl_queue.empty()) return;
+      m_jrnl_wbuf.swap(m_jrnl_queue);
+      fd = m_jrnl_fd;
+   }
+
+   ssize_t len = m_jrnl_wbuf.size();
+   bool    ok  = write(fd, m_jrnl_wbuf.data(), len) == len;
+   int     err = errno;
+   m_jrnl_wbuf.clear();
+
+   if ( ! ok)
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+      invalidate("journal write failed", err);
+   }
+}
+
+//------------------------------------------------------------------------------
+
+void UsageIndex::invalidate(const char *what, int err)
+{
+   // Called under both locks. Remove the snapshot so that a restart also
+   // triggers a rebuild; purge will rebuild the index on its next cycle.
+
+   TRACE(Error, "invalidate() " << what << ERRNO_AND_ERRSTR(err) << ", index will be rebuilt.");
+
+   m_valid = false;
+   if (m_jrnl_fd >= 0) { close(m_jrnl_fd); m_jrnl_fd = -1; }
+   m_jrnl_queue.clear();
+   unlink(m_snap_path.c_str());
+}
+
+//==============================================================================
+// Updates
+//==============================================================================
+
+void UsageIndex::apply(RecOp_e op, const std::string &lfn, const Entry &e)
+{
+   // Called under lock.
+
+   EntryMap_i it = m_entries.find(lfn);
+
+   if (it != m_entries.end())
+   {
+      m_by_atime.erase(TimeKey_t(it->second.m_atime, &*it));
+      m_by_nocks.erase(TimeKey_t(it->second.m_noCksTime, &*it));
+      m_nBytesTotal -= it->second.m_nBytes;
+
+      if (op == RO_Remove)
+      {
+         m_entries.erase(it);
+         return;
+      }
+      it->second = e;
+   }
+   else
+   {
+      if (op == RO_Remove) return;
+
+      it = m_entries.insert(std::make_pair(lfn, e)).first;
+   }
+
+   m_by_atime.insert(TimeKey_t(e.m_atime, &*it));
+   if (Cache::Conf().does_cschk_have_missing_bits((CkSumCheck_e) e.m_cksState))
+   {
+      m_by_nocks.insert(TimeKey_t(e.m_noCksTime, &*it));
+   }
+   m_nBytesTotal += e.m_nBytes;
+}
+
+void UsageIndex::fill_entry(const Info &cfi, Entry &e, time_t atime)
+{
+   e.m_nBytes    = cfi.GetNDownloadedBytes();
+   e.m_atime     = atime;
+   e.m_noCksTime = cfi.GetNoCkSumTimeForUVKeep();
+   e.m_accCnt    = cfi.GetAccessCnt();
+   e.m_cksState  = cfi.GetCkSumState();
+}
+
+//------------------------------------------------------------------------------
+
+void UsageIndex::Update(const std::string &lfn, const Info &cfi)
+{
+   if (lfn.size() > s_maxLfnLen) return;
+
+   time_t atime;
+   if ( ! cfi.GetLatestDetachTime(atime)) atime = time(0);
+
+   Entry e;
+   fill_entry(cfi, e, atime);
+
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+
+      apply(RO_Update, lfn, e);
+      journal(RO_Update, lfn, e);
+   }
+   flush_journal();
+}
+
+void UsageIndex::Remove(const std::string &lfn)
+{
+   if (lfn.size() > s_maxLfnLen) return;
+
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+
+      if (m_entries.find(lfn) == m_entries.end()) return;
+
+      Entry e;
+      apply(RO_Remove, lfn, e);
+      journal(RO_Remove, lfn, e);
+   }
+   flush_journal();
+}
+
+//==============================================================================
+// Rebuild
+//==============================================================================
+
+void UsageIndex::BeginRebuild()
+{
+   XrdSysMutexHelper _jlck(&m_jrnl_mutex);
+   XrdSysMutexHelper _lck(&m_mutex);
+
+   TRACE(Info, "BeginRebuild() full namespace scan will rebuild " << m_snap_path);
+
+   m_rebuilding = true;
+   m_valid      = false;
+
+   m_entries.clear(); m_by_atime.clear(); m_by_nocks.clear();
+   m_nBytesTotal = 0;
+
+   // Until the new snapshot is written the previous one is of no use. Updates
+   // from now on go into a fresh journal that is replayed over the new snapshot.
+   unlink(m_snap_path.c_str());
+   unlink(m_jold_path.c_str());
+   open_journal(true);
+}
+
+void UsageIndex::AddScanned(const std::string &lfn, const Info &cfi, time_t atime)
+{
+   if (lfn.size() > s_maxLfnLen) return;
+
+   Entry e;
+   fill_entry(cfi, e, atime);
+
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+
+      if ( ! m_rebuilding) return;
+
+      // Entries already present were updated from an open file during the
+      // scan. Only take the scanned state if it is newer and journal it in
+      // this case so that the replay order remains correct.
+      EntryMap_i it = m_entries.find(lfn);
+      if (it == m_entries.end())
+      {
+         apply(RO_Update, lfn, e);
+         return;
+      }
+      if (it->second.m_atime >= atime) return;
+      apply(RO_Update, lfn, e);
+      journal(RO_Update, lfn, e);
+   }
+   flush_journal();
+}
+
+void UsageIndex::EndRebuild(bool traversal_ok)
+{
+   {
+      XrdSysMutexHelper _lck(&m_mutex);
+      m_rebuilding = false;
+   }
+   if (traversal_ok) Checkpoint(true);
+}
+
+//==============================================================================
+// Checkpoint
+//==============================================================================
+
+void UsageIndex::Checkpoint(bool force)
+{
+   static const char *trc_pfx = "Checkpoint() ";
+
+   {
+      XrdSysMutexHelper _jlck(&m_jrnl_mutex);
+      XrdSysMutexHelper _lck(&m_mutex);
+
+      if (m_in_checkpoint || m_jrnl_fd < 0) return;
+
+      if ( ! force && ( ! m_valid || m_jrnl_recs < std::max((long long) m_entries.size(), s_minJrnl))) return;
+
+      m_in_checkpoint = true;
+
+      // Rotate the journal unless an older one is still around from a failed
+      // checkpoint. In that case keep appending, replay handles both.
+      // Records still queued belong to the old journal.
+      ssize_t len = m_jrnl_queue.size();
+      if (len && write(m_jrnl_fd, m_jrnl_queue.data(), len) != len)
+      {
+         invalidate("journal write failed", errno);
+         m_in_checkpoint = false;
+         return;
+      }
+      m_jrnl_queue.clear();
+
+      struct stat st;
+      if (stat(m_jold_path.c_str(), &st) != 0)
+      {
+         if (rename(m_jrnl_path.c_str(), m_jold_path.c_str()) != 0 || ! open_journal(true))
+         {
+            invalidate("journal rotation failed", errno);
+            m_in_checkpoint = false;
+            return;
+         }
+      }
+   }
+
+   // Write the snapshot in chunks so that updates are not blocked for the
+   // duration of the write. Everything changed meanwhile is in the new journal.
+   std::string tmp_path = m_snap_path + ".tmp";
+   FILE       *fp       = fopen(tmp_path.c_str(), "w");
+   bool        ok       = (fp != 0);
+   long long   n_recs   = 0;
+
+   if (ok)
+   {
+      DiskHdr hdr;
+      fill_hdr(hdr);
+      ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+   }
+
+   std::vector<std::pair<std::string, Entry> > chunk;
+   chunk.reserve(s_snapChunk);
+   std::string last;
+   bool        done  = false;
+   std::vector<char> buf(sizeof(DiskRec) + s_maxLfnLen);
+
+   while (ok && ! done)
+   {
+      chunk.clear();
+      {
+         XrdSysMutexHelper _lck(&m_mutex);
+
+         EntryMap_i it = n_recs ? m_entries.upper_bound(last) : m_entries.begin();
+         for ( ; it != m_entries.end() && (int) chunk.size() < s_snapChunk; ++it)
+         {
+            chunk.push_back(*it);
+         }
+         done = (it == m_entries.end());
+      }
+      for (size_t i = 0; ok && i < chunk.size(); ++i)
+      {
+         int len = fill_rec(&buf[0], RO_Update, chunk[i].first, chunk[i].second);
+         ok = fwrite(&buf[0], len, 1, fp) == 1;
+      }
+      if ( ! chunk.empty())
+      {
+         last    = chunk.back().first;
+         n_recs += chunk.size();
+      }
+   }
+
+   if (fp)
+   {
+      ok = ok && fflush(fp) == 0 && fsync(fileno(fp)) == 0;
+      ok = (fclose(fp) == 0) && ok;
+   }
+   ok = ok && rename(tmp_path.c_str(), m_snap_path.c_str()) == 0;
+
+   XrdSysMutexHelper _jlck(&m_jrnl_mutex);
+   XrdSysMutexHelper _lck(&m_mutex);
+
+   if (ok)
+   {
+      unlink(m_jold_path.c_str());
+      m_valid = true;
+      TRACE(Info, trc_pfx << "wrote " << m_snap_path << ", n_files=" << n_recs);
+   }
+   else
+   {
+      int err = errno;
+      unlink(tmp_path.c_str());
+      invalidate("snapshot write failed", err);
+   }
+   m_in_checkpoint = false;
+}
+
+//==============================================================================
+// Queries
+//==============================================================================
+
+void UsageIndex::VisitByAccessTime(const Visitor_t &v) const
+{
+   XrdSysMutexHelper _lck(&m_mutex);
+
+   for (TimeSet_t::const_iterator i = m_by_atime.begin(); i != m_by_atime.end(); ++i)
+   {
+      if ( ! v(i->second->first, i->second->second)) break;
+   }
+}
+
+void UsageIndex::VisitByNoCkSumTime(const Visitor_t &v) const
+{
+   XrdSysMutexHelper _lck(&m_mutex);
+
+   for (TimeSet_t::const_iterator i = m_by_nocks.begin(); i != m_by_nocks.end(); ++i)
+   {
+      if ( ! v(i->second->first, i->second->second)) break;
+   }
+}
+
+long long UsageIndex::GetNBytesTotal() const
+{
+   XrdSysMutexHelper _lck(&m_mutex);
+   return m_nBytesTotal;
+}
+
+size_t UsageIndex::GetNFiles() const
+{
+   XrdSysMutexHelper _lck(&m_mutex);
+   return m_entries.size();
+}
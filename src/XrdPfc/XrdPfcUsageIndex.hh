@@ -0,0 +1,154 @@
+#ifndef __XRDPFC_USAGEINDEX_HH__
+#define __XRDPFC_USAGEINDEX_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <time.h>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+#include "XrdSys/XrdSysPthread.hh"
+
+class XrdSysTrace;
+
+namespace XrdPfc
+{
+class Info;
+
+//----------------------------------------------------------------------------
+//! Persistent index of per-file usage (size on disk, last access time and
+//! access count) used by the purge to select victims without traversing
+//! the cache namespace.
+//!
+//! The index is kept in memory and persisted as a snapshot file plus an
+//! append-only journal of updates. Entries are updated from File open and
+//! cinfo write-back (which includes close) and removed on unlink / purge.
+//! A full namespace traversal is only needed to (re)build the index when
+//! it can not be loaded.
+//----------------------------------------------------------------------------
+
+class UsageIndex
+{
+public:
+   struct Entry
+   {
+      long long     m_nBytes;     //!< downloaded bytes, i.e. data on disk
+      time_t        m_atime;      //!< latest access (detach) time
+      time_t        m_noCksTime;  //!< time of missing cksum bits for uvkeep
+      int           m_accCnt;     //!< number of accesses
+      unsigned char m_cksState;   //!< cksum state as in CkSumCheck_e
+
+      Entry() : m_nBytes(0), m_atime(0), m_noCksTime(0), m_accCnt(0), m_cksState(0) {}
+   };
+
+   //! Visitor, return false to stop the iteration.
+   typedef std::function<bool(const std::string &lfn, const Entry &e)> Visitor_t;
+
+   UsageIndex(const std::string &path, XrdSysTrace *trace);
+   ~UsageIndex();
+
+   //---------------------------------------------------------------------
+   //! Load snapshot and replay journals. Returns false if the index could
+   //! not be set up for writing; IsValid() tells if a rebuild is needed.
+   //---------------------------------------------------------------------
+   bool Load();
+
+   bool IsValid() const { return m_valid; }
+
+   //---------------------------------------------------------------------
+   //! Record current state of a cached file from its cinfo.
+   //---------------------------------------------------------------------
+   void Update(const std::string &lfn, const Info &cfi);
+
+   //---------------------------------------------------------------------
+   //! Forget a file, called when data and cinfo files are removed.
+   //---------------------------------------------------------------------
+   void Remove(const std::string &lfn);
+
+   //---------------------------------------------------------------------
+   //! Rebuild support. Between the two calls entries reported by the
+   //! namespace traversal are added unless a newer update exists. The
+   //! index becomes valid when a completed traversal has been persisted.
+   //---------------------------------------------------------------------
+   void BeginRebuild();
+   void AddScanned(const std::string &lfn, const Info &cfi, time_t atime);
+   void EndRebuild(bool traversal_ok);
+
+   //---------------------------------------------------------------------
+   //! Write a new snapshot if the journal got large (or when forced).
+   //---------------------------------------------------------------------
+   void Checkpoint(bool force = false);
+
+   //---------------------------------------------------------------------
+   //! Iterate over files, oldest access first.
+   //---------------------------------------------------------------------
+   void VisitByAccessTime(const Visitor_t &v) const;
+
+   //---------------------------------------------------------------------
+   //! Iterate over files with missing cksum bits, oldest first.
+   //---------------------------------------------------------------------
+   void VisitByNoCkSumTime(const Visitor_t &v) const;
+
+   long long GetNBytesTotal() const;
+   size_t    GetNFiles()      const;
+
+private:
+   typedef std::map<std::string, Entry>                   EntryMap_t;
+   typedef EntryMap_t::iterator                           EntryMap_i;
+   typedef std::pair<time_t, const EntryMap_t::value_type*> TimeKey_t;
+   typedef std::set<TimeKey_t>                            TimeSet_t;
+
+   enum RecOp_e { RO_Update = 1, RO_Remove = 2 };
+
+   void apply(RecOp_e op, const std::string &lfn, const Entry &e);
+   void fill_entry(const Info &cfi, Entry &e, time_t atime);
+   void flush_journal();
+   void invalidate(const char *what, int err);
+   void journal(RecOp_e op, const std::string &lfn, const Entry &e);
+   bool open_journal(bool trunc);
+   bool replay(const std::string &fname, bool must_exist);
+
+   mutable XrdSysMutex m_mutex;
+   XrdSysMutex         m_jrnl_mutex;  //!< orders journal writes, taken before m_mutex
+
+   EntryMap_t    m_entries;
+   TimeSet_t     m_by_atime;      //!< all entries by access time
+   TimeSet_t     m_by_nocks;      //!< entries with missing cksum bits
+   long long     m_nBytesTotal;
+
+   std::string   m_snap_path;     //!< snapshot
+   std::string   m_jrnl_path;     //!< journal
+   std::string   m_jold_path;     //!< journal rotated out during checkpoint
+   int           m_jrnl_fd;       //!< changed only with both mutexes held
+   std::string   m_jrnl_queue;    //!< records not yet written, under m_mutex
+   std::string   m_jrnl_wbuf;     //!< records being written, under m_jrnl_mutex
+   long long     m_jrnl_recs;     //!< records in journal since last snapshot
+   bool          m_valid;
+   bool          m_rebuilding;
+   bool          m_in_checkpoint;
+
+   XrdSysTrace  *m_trace;
+   const char   *m_traceID;
+
+   XrdSysTrace* GetTrace() const { return m_trace; }
+};
+
+}
+
+#endif
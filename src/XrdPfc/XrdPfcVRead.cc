@@ -115,6 +115,11 @@ int File::ReadV(IO *io, const XrdOucIOVec *readV, int n)
 
    VReadPreProcess(io, readV, n, blks_to_request, blocks_to_process, blocks_on_disk, chunkVec);
 
+   if ( ! blks_to_request.empty() && m_prefetch_state == kOn)
+   {
+      Cache::GetInstance().PrefetchDemand(this);
+   }
+
    m_state_cond.UnLock();
 
    // ----------------------------------------------------------------
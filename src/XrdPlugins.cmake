@@ -137,6 +137,7 @@ add_library(
   XrdThrottle/XrdThrottleFileSystemConfig.cc
   XrdThrottle/XrdThrottleFile.cc
   XrdThrottle/XrdThrottleManager.cc    XrdThrottle/XrdThrottleManager.hh
+  XrdThrottle/XrdThrottleBucket.hh
 )
 
 target_link_libraries(
@@ -1,6 +1,7 @@
 
 #include "XrdAcc/XrdAccAuthorize.hh"
 #include "XrdOuc/XrdOucEnv.hh"
+#include "XrdOuc/XrdOucPrefixTrie.hh"
 #include "XrdSec/XrdSecEntity.hh"
 #include "XrdSec/XrdSecEntityAttr.hh"
 #include "XrdSys/XrdSysLogger.hh"
@@ -223,13 +224,14 @@ public:
 
     ~XrdAccRules() {}
 
-    bool apply(Access_Operation oper, std::string path) {
-        for (const auto & rule : m_rules) {
-            if ((oper == rule.first) && !path.compare(0, rule.second.size(), rule.second, 0, rule.second.size())) {
-                return true;
-            }
-        }
-        return false;
+    // The scopes are compiled into a prefix trie whose entries hold the set of
+    // operations allowed under that prefix; a lookup is a single pass over the
+    // path regardless of the number of scopes in the token.
+    bool apply(Access_Operation oper, const std::string &path) {
+        uint32_t allowed = 0;
+        auto merge = [&](const uint32_t &ops) {allowed |= ops;};
+        m_trie.Match(path.c_str(), path.size(), merge);
+        return (allowed & OperMask(oper)) != 0;
     }
 
     bool expired() const {return monotonic_time() > m_expiry_time;}
@@ -238,6 +240,7 @@ public:
         m_rules.reserve(rules.size());
         for (const auto &entry : rules) {
             m_rules.emplace_back(entry.first, entry.second);
+            m_trie.Insert(entry.second.c_str(), entry.second.size()) |= OperMask(entry.first);
         }
     }
 
@@ -259,7 +262,10 @@ public:
     const std::vector<std::string> &groups() const {return m_groups;}
 
 private:
+    static uint32_t OperMask(Access_Operation oper) {return 1U << static_cast<unsigned>(oper);}
+
     AccessRulesRaw m_rules;
+    XrdOucPrefixTrie<uint32_t> m_trie;
     uint64_t m_expiry_time{0};
     const std::string m_username;
     const std::string m_token_username;
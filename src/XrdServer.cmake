@@ -61,6 +61,7 @@ add_library(
 #-------------------------------------------------------------------------------
   XrdOfs/XrdOfs.cc              XrdOfs/XrdOfs.hh
   XrdOfs/XrdOfsChkPnt.cc        XrdOfs/XrdOfsChkPnt.hh
+  XrdOfs/XrdOfsCksStream.cc     XrdOfs/XrdOfsCksStream.hh
   XrdOfs/XrdOfsConfig.cc
   XrdOfs/XrdOfsConfigCP.cc      XrdOfs/XrdOfsConfigCP.hh
   XrdOfs/XrdOfsConfigPI.cc      XrdOfs/XrdOfsConfigPI.hh
@@ -132,6 +133,7 @@ add_library(
   XrdOss/XrdOssStage.cc        XrdOss/XrdOssStage.hh
   XrdOss/XrdOssStat.cc         XrdOss/XrdOssStatInfo.hh
   XrdOss/XrdOssUnlink.cc
+  XrdOss/XrdOssUring.cc        XrdOss/XrdOssUring.hh
                                XrdOss/XrdOssVS.hh
                                XrdOss/XrdOssError.hh
 
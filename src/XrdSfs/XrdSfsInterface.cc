@@ -111,21 +111,13 @@ XrdSfsXferSize XrdSfsFile::pgRead(XrdSfsFileOffset   offset,
 //
    if ((bytes = read(offset, buffer, rdlen)) <= 0) return bytes;
 
-// If the output needs to be in network byte order, then unroll the calculation
-// Otherwise, use the vector version of the crc calculation.
+// Calculate the checksums using the vector version of the crc calculation. If
+// the output needs to be in network byte order, then convert them in place.
 //
+   XrdOucCRC::Calc32C((void *)buffer, bytes, csvec);
    if (opts & NetOrder)
-      {int i = 0, quant = bytes;
-       while (quant >= XrdSys::PageSize)
-             {csvec[i++] = htonl(XrdOucCRC::Calc32C((void *)buffer,
-                                                    XrdSys::PageSize));
-              buffer += XrdSys::PageSize;
-              quant  -= XrdSys::PageSize;
-             }
-       if (quant) csvec[i] = htonl(XrdOucCRC::Calc32C((void *)buffer,quant));
-       return bytes;
-      } else {
-       XrdOucCRC::Calc32C((void *)buffer, bytes, csvec);
+      {int n = (bytes + XrdSys::PageSize - 1) / XrdSys::PageSize;
+       for (int i = 0; i < n; i++) csvec[i] = htonl(csvec[i]);
       }
 
 // All done
@@ -0,0 +1,233 @@
+/******************************************************************************/
+/*                                                                            */
+/*                      X r d S y s I O U r i n g . c c                       */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include "XrdSys/XrdSysIOUring.hh"
+
+/******************************************************************************/
+/*                            D e s t r u c t o r                             */
+/******************************************************************************/
+
+XrdSysIOUring::~XrdSysIOUring()
+{
+#ifdef HAVE_IO_URING
+   if (sqes)                    munmap(sqes,  sqesSz);
+   if (cqMap && cqMap != sqMap) munmap(cqMap, cqMapSz);
+   if (sqMap)                   munmap(sqMap, sqMapSz);
+   if (ringFD >= 0) close(ringFD);
+#endif
+}
+
+/******************************************************************************/
+/*                                 E n t e r                                  */
+/******************************************************************************/
+
+int XrdSysIOUring::Enter(unsigned int toSubmit, unsigned int minDone)
+{
+#ifdef HAVE_IO_URING
+   unsigned int flags = (minDone ? IORING_ENTER_GETEVENTS : 0);
+   int rc;
+
+   do {rc = syscall(__NR_io_uring_enter, ringFD, toSubmit, minDone, flags,
+                    (void *)0, 0);
+      } while(rc < 0 && errno == EINTR);
+   return (rc < 0 ? -errno : rc);
+#else
+   return -ENOTSUP;
+#endif
+}
+
+/******************************************************************************/
+/*                                  N e x t                                   */
+/******************************************************************************/
+
+bool XrdSysIOUring::Next(io_uring_cqe &cqe)
+{
+#ifdef HAVE_IO_URING
+   unsigned int head = *cqHead;
+
+   if (head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) return false;
+   cqe = cqes[head & *cqMask];
+   __atomic_store_n(cqHead, head+1, __ATOMIC_RELEASE);
+   return true;
+#else
+   return false;
+#endif
+}
+
+/******************************************************************************/
+/*                                  P r e p                                   */
+/******************************************************************************/
+
+bool XrdSysIOUring::Prep(int opc, int fd, void *buff, unsigned int blen,
+                         long long offs, unsigned long long udata)
+{
+#ifdef HAVE_IO_URING
+   io_uring_sqe *sqe;
+   unsigned int  tail = *sqTail, idx;
+
+   if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+      return false;
+
+   idx = tail & *sqMask;
+   sqe = &sqes[idx];
+   memset(sqe, 0, sizeof(io_uring_sqe));
+   sqe->opcode    = (unsigned char)opc;
+   sqe->fd        = fd;
+   sqe->addr      = (unsigned long long)buff;
+   sqe->len       = blen;
+   sqe->off       = (unsigned long long)offs;
+   sqe->user_data = udata;
+   sqArray[idx]   = idx;
+   __atomic_store_n(sqTail, tail+1, __ATOMIC_RELEASE);
+   return true;
+#else
+   return false;
+#endif
+}
+
+/******************************************************************************/
+/*                                 S e t u p                                  */
+/******************************************************************************/
+
+int XrdSysIOUring::Setup(unsigned int qdepth, const int *ops, int nops)
+{
+#ifdef HAVE_IO_URING
+   io_uring_params parms;
+   char *sqP, *cqP;
+   int rc;
+
+// Create the ring
+//
+   memset(&parms, 0, sizeof(parms));
+   if ((ringFD = syscall(__NR_io_uring_setup, qdepth, &parms)) < 0)
+      return errno;
+
+// We rely on the no-drop guarantee for completions and the caller relies on
+// its operations, which came in various kernel releases, so ask about them.
+//
+   if (!(parms.features & IORING_FEAT_NODROP)) return ENOTSUP;
+   if ((rc = Probe(ops, nops))) return rc;
+
+// Map the submission and completion rings (a single map in newer kernels)
+//
+   sqMapSz = parms.sq_off.array + parms.sq_entries*sizeof(unsigned int);
+   cqMapSz = parms.cq_off.cqes  + parms.cq_entries*sizeof(io_uring_cqe);
+   if (parms.features & IORING_FEAT_SINGLE_MMAP)
+      {if (cqMapSz > sqMapSz) sqMapSz = cqMapSz;
+       cqMapSz = sqMapSz;
+      }
+   sqMap = mmap(0, sqMapSz, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE,
+                ringFD, IORING_OFF_SQ_RING);
+   if (sqMap == MAP_FAILED) {sqMap = 0; return errno;}
+   if (parms.features & IORING_FEAT_SINGLE_MMAP) cqMap = sqMap;
+      else {cqMap = mmap(0, cqMapSz, PROT_READ|PROT_WRITE,
+                         MAP_SHARED|MAP_POPULATE, ringFD, IORING_OFF_CQ_RING);
+            if (cqMap == MAP_FAILED) {cqMap = 0; return errno;}
+           }
+
+// Map the submission queue entries
+//
+   sqesSz = parms.sq_entries*sizeof(io_uring_sqe);
+   sqes = (io_uring_sqe *)mmap(0, sqesSz, PROT_READ|PROT_WRITE,
+                               MAP_SHARED|MAP_POPULATE, ringFD,
+                               IORING_OFF_SQES);
+   if (sqes == MAP_FAILED) {sqes = 0; return errno;}
+
+// Locate all of the ring fields
+//
+   sqP = (char *)sqMap; cqP = (char *)cqMap;
+   sqHead    = (unsigned int *)(sqP + parms.sq_off.head);
+   sqTail    = (unsigned int *)(sqP + parms.sq_off.tail);
+   sqMask    = (unsigned int *)(sqP + parms.sq_off.ring_mask);
+   sqArray   = (unsigned int *)(sqP + parms.sq_off.array);
+   sqEntries = parms.sq_entries;
+   cqHead    = (unsigned int *)(cqP + parms.cq_off.head);
+   cqTail    = (unsigned int *)(cqP + parms.cq_off.tail);
+   cqMask    = (unsigned int *)(cqP + parms.cq_off.ring_mask);
+   cqes      = (io_uring_cqe *)(cqP + parms.cq_off.cqes);
+   cqEntries = parms.cq_entries;
+   return 0;
+#else
+   return ENOTSUP;
+#endif
+}
+
+/******************************************************************************/
+/*                                U n p r e p                                 */
+/******************************************************************************/
+
+void XrdSysIOUring::Unprep(unsigned int num)
+{
+#ifdef HAVE_IO_URING
+   __atomic_store_n(sqTail, *sqTail - num, __ATOMIC_RELEASE);
+#endif
+}
+
+/******************************************************************************/
+/*                       P r i v a t e   M e t h o d s                        */
+/******************************************************************************/
+/******************************************************************************/
+/*                                 P r o b e                                  */
+/******************************************************************************/
+
+// Returns 0 if the kernel supports all of the operations or the errno value.
+//
+int XrdSysIOUring::Probe(const int *ops, int nops)
+{
+#ifdef HAVE_IO_URING
+   const unsigned int maxops = 256;
+   io_uring_probe *probe;
+   int rc = 0;
+
+   if (!(probe = (io_uring_probe *)calloc(1, sizeof(io_uring_probe)
+                                          + maxops*sizeof(io_uring_probe_op))))
+      return ENOMEM;
+
+// Kernels without the probe do not have the read and write operations either
+//
+   if (syscall(__NR_io_uring_register, ringFD, IORING_REGISTER_PROBE,
+               probe, maxops) < 0) rc = (errno == EINVAL ? ENOTSUP : errno);
+      else for (int i = 0; i < nops; i++)
+               if (ops[i] > probe->last_op
+               ||  !(probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED))
+                  {rc = ENOTSUP; break;}
+
+   free(probe);
+   return rc;
+#else
+   return ENOTSUP;
+#endif
+}
@@ -0,0 +1,129 @@
+#ifndef __XRDSYSIOURING_HH__
+#define __XRDSYSIOURING_HH__
+/******************************************************************************/
+/*                                                                            */
+/*                      X r d S y s I O U r i n g . h h                       */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <sys/types.h>
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+
+//-----------------------------------------------------------------------------
+//! XrdSysIOUring is a minimal driver for a Linux io_uring instance. The ring
+//! is created and driven through the raw system calls so no library is
+//! needed. Entries are added by a single submitter at a time and completions
+//! are consumed by a single reaper at a time; the caller provides any
+//! serialization beyond that. Without io_uring support Setup() fails with
+//! ENOTSUP and the caller is expected to use some other I/O path.
+//-----------------------------------------------------------------------------
+
+class XrdSysIOUring
+{
+public:
+
+//-----------------------------------------------------------------------------
+//! Enter the ring to submit entries and/or wait for completions.
+//!
+//! @param  toSubmit  The number of prepared entries to submit.
+//! @param  minDone   The number of completions to wait for (0 -> no wait).
+//!
+//! @return The number of entries submitted or -errno upon failure.
+//-----------------------------------------------------------------------------
+
+int          Enter(unsigned int toSubmit, unsigned int minDone);
+
+//-----------------------------------------------------------------------------
+//! Copy out the next completion, if any.
+//!
+//! @return True if cqe holds a completion and false if there is none.
+//-----------------------------------------------------------------------------
+
+bool         Next(io_uring_cqe &cqe);
+
+//-----------------------------------------------------------------------------
+//! Add an entry to the submission queue. A null buff, zero blen and offs
+//! suit operations that do not transfer data (e.g. fsync).
+//!
+//! @return True if the entry was added and false if the queue is full.
+//-----------------------------------------------------------------------------
+
+bool         Prep(int opc, int fd, void *buff, unsigned int blen,
+                  long long offs, unsigned long long udata);
+
+//-----------------------------------------------------------------------------
+//! Create the ring and check that the kernel supports the needed operations.
+//!
+//! @param  qdepth    The number of submission queue entries.
+//! @param  ops       The io_uring opcodes the caller will use.
+//! @param  nops      The number of elements in ops.
+//!
+//! @return 0 upon success or the errno value describing the failure.
+//-----------------------------------------------------------------------------
+
+int          Setup(unsigned int qdepth, const int *ops, int nops);
+
+//-----------------------------------------------------------------------------
+//! Withdraw entries that were prepared but not submitted.
+//!
+//! @param  num       The number of entries to withdraw.
+//-----------------------------------------------------------------------------
+
+void         Unprep(unsigned int num);
+
+//-----------------------------------------------------------------------------
+//! Queue sizes (only valid after a successful Setup()).
+//-----------------------------------------------------------------------------
+
+unsigned int cqSize() {return cqEntries;}
+
+unsigned int sqSize() {return sqEntries;}
+
+             XrdSysIOUring() : ringFD(-1), sqMap(0), sqMapSz(0), cqMap(0),
+                               cqMapSz(0), sqes(0), sqesSz(0), sqEntries(0),
+                               cqEntries(0) {}
+            ~XrdSysIOUring();
+
+private:
+int           Probe(const int *ops, int nops);
+
+int           ringFD;
+void         *sqMap;
+size_t        sqMapSz;
+void         *cqMap;
+size_t        cqMapSz;
+io_uring_sqe *sqes;
+size_t        sqesSz;
+unsigned int *sqHead;
+unsigned int *sqTail;
+unsigned int *sqMask;
+unsigned int *sqArray;
+unsigned int  sqEntries;
+unsigned int *cqHead;
+unsigned int *cqTail;
+unsigned int *cqMask;
+io_uring_cqe *cqes;
+unsigned int  cqEntries;
+};
+#endif
@@ -27,7 +27,10 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
 #include <fcntl.h>
+#include <limits.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -44,6 +47,8 @@
 #include <sys/uio.h>
 #endif // WIN32
 
+#include <vector>
+
 #include "XrdOuc/XrdOucTList.hh"
 
 #include "XrdSys/XrdSysE2T.hh"
@@ -99,6 +104,414 @@ void Snatch(struct iovec *iov, int iovnum) // Called with logger mutex locked!
 }
 }
 
+/******************************************************************************/
+/*                    C l a s s   X r d S y s L o g g e r A s y n c           */
+/******************************************************************************/
+
+// Asynchronous logging uses one ring buffer per thread. Only the owning thread
+// adds messages to its ring and only the flusher thread removes them, so no
+// lock is needed to log a message. Each message is tagged with a global
+// sequence number and every drain writes what it collected in that order.
+// A message published after a drain looked at its ring goes out with the next
+// drain, so it may follow messages issued after it by other threads.
+// Rings are never freed. When a thread exits its ring is drained and then
+// handed to the next thread that logs a message. Whatever is left in the rings
+// when the process exits is written out by an exit handler; paths that end
+// the process via _exit() must call XrdSysLogger::Flush() themselves.
+//
+class XrdSysLoggerAsync
+{
+public:
+
+static void  AtExit();
+
+static XrdSysLoggerAsync *For(XrdSysLogger *lP);
+
+static int   Start(XrdSysLogger *lP, int bsz, bool drop);
+
+       void  Drain();
+
+       void  Flusher();
+
+       bool  Put(int iovcnt, struct iovec *iov);
+
+std::atomic<long long> numDrop;
+
+private:
+
+struct Ring
+      {Ring                      *next;
+       char                      *buff;
+       std::atomic<unsigned int>  head;    // Bytes added   (owner only)
+       std::atomic<unsigned int>  tail;    // Bytes removed (flusher only)
+       std::atomic<int>           state;
+
+       static const int inUse  = 0;
+       static const int orphan = 1;        // Owner has exited
+       static const int isFree = 2;        // Drained and available
+
+       Ring(char *bP) : next(0), buff(bP), head(0), tail(0), state(inUse) {}
+      };
+
+// Each message in a ring is preceded by this header and padded to a multiple
+// of the header size. A zero seq marks filler up to the end of the ring.
+//
+struct Rec
+      {unsigned long long seq;
+       unsigned int       len;
+       unsigned int       skip;
+      };
+
+struct Msg
+      {unsigned long long seq;
+       char              *msg;
+       unsigned int       len;
+       bool operator<(const Msg &rhs) const {return seq < rhs.seq;}
+      };
+
+static void  Orphan(void *rP)
+                   {static_cast<Ring *>(rP)->state.store(Ring::orphan);}
+
+       Ring *getRing();
+       bool  Pending();
+       void  Wake();
+
+              XrdSysLoggerAsync(XrdSysLogger *lP, unsigned int bsz, bool drop)
+                               : numDrop(0), logP(lP), rings(0), msgSeq(1),
+                                 flushCV(0), spaceCV(0), ringSize(bsz),
+                                 numWait(0), idle(false), dropMsg(drop) {}
+             ~XrdSysLoggerAsync() {}
+
+XrdSysLogger            *logP;
+std::atomic<Ring *>      rings;
+std::atomic<unsigned long long> msgSeq;
+pthread_key_t            ringKey;
+XrdSysCondVar            flushCV;
+XrdSysCondVar            spaceCV;
+std::vector<Msg>         msgVec;      // These are only used by Drain()
+std::vector<iovec>       iovVec;
+std::vector<std::pair<Ring *, unsigned int> > posVec;
+unsigned int             ringSize;
+int                      numWait;
+std::atomic<bool>        idle;
+bool                     dropMsg;
+};
+
+namespace
+{
+std::atomic<XrdSysLoggerAsync *> theAsync(0);
+
+void *XrdSysLoggerAF(void *carg)
+     {static_cast<XrdSysLoggerAsync *>(carg)->Flusher();
+      return (void *)0;
+     }
+}
+
+/******************************************************************************/
+/*                    X r d S y s L o g g e r A s y n c : : A t E x i t       */
+/******************************************************************************/
+
+void XrdSysLoggerAsync::AtExit()
+{
+   XrdSysLoggerAsync *aP = theAsync.load(std::memory_order_acquire);
+
+// Write out whatever is still waiting in the rings
+//
+   if (aP) aP->logP->Flush();
+}
+
+/******************************************************************************/
+/*                        X r d S y s L o g g e r A s y n c : : D r a i n     */
+/******************************************************************************/
+
+// Called with the logger mutex held!
+
+void XrdSysLoggerAsync::Drain()
+{
+   Ring *rP;
+   Rec  *recP;
+   unsigned int tail, mask = ringSize-1;
+   int retc;
+
+// Collect every message currently in every ring, remembering how far we got
+//
+   msgVec.clear(); posVec.clear();
+   for (rP = rings.load(std::memory_order_acquire); rP; rP = rP->next)
+       {bool gone = rP->state.load(std::memory_order_acquire) == Ring::orphan;
+        unsigned int head = rP->head.load(std::memory_order_acquire);
+        tail = rP->tail.load(std::memory_order_relaxed);
+        if (tail == head)
+           {int expect = Ring::orphan;
+            if (gone) rP->state.compare_exchange_strong(expect, Ring::isFree);
+            continue;
+           }
+        while(tail != head)
+             {recP = (Rec *)(rP->buff + (tail & mask));
+              if (recP->seq)
+                 {Msg theMsg = {recP->seq, (char *)(recP+1), recP->len};
+                  msgVec.push_back(theMsg);
+                 }
+              tail += recP->skip;
+             }
+        posVec.push_back(std::make_pair(rP, head));
+       }
+
+// Write them out in sequence order. In theory, writev may write
+// out a partial list. This rarely happens in practice and so we ignore that
+// possibility (recovery is pretty tough).
+//
+   if (!msgVec.empty())
+      {std::sort(msgVec.begin(), msgVec.end());
+       iovVec.resize(msgVec.size());
+       for (size_t i = 0; i < msgVec.size(); i++)
+           {iovVec[i].iov_base = msgVec[i].msg;
+            iovVec[i].iov_len  = msgVec[i].len;
+           }
+       for (size_t i = 0; i < iovVec.size(); i += IOV_MAX)
+           {int n = static_cast<int>(std::min(iovVec.size()-i, (size_t)IOV_MAX));
+            do {retc = writev(logP->eFD, &iovVec[i], n);}
+               while (retc < 0 && errno == EINTR);
+           }
+      }
+
+// Now release the space. A ring whose thread has exited can be reused once
+// it is empty (its head can no longer change).
+//
+   for (size_t i = 0; i < posVec.size(); i++)
+       {rP = posVec[i].first;
+        rP->tail.store(posVec[i].second, std::memory_order_release);
+        int expect = Ring::orphan;
+        if (rP->head.load(std::memory_order_acquire) == posVec[i].second)
+           rP->state.compare_exchange_strong(expect, Ring::isFree);
+       }
+}
+
+/******************************************************************************/
+/*                   X r d S y s L o g g e r A s y n c : : F l u s h e r      */
+/******************************************************************************/
+
+void XrdSysLoggerAsync::Flusher()
+{
+   long long nDrop, lastDrop = 0;
+   time_t    nowT,  lastT = 0;
+   char eBuff[80];
+
+// Wait for messages and write them out. Before going idle we check for any
+// messages that arrived while we were busy. A thread adding a message sees
+// that we went idle (and wakes us) or we see its message; never neither.
+// Dropped messages are reported at most once a second.
+//
+   while(true)
+        {flushCV.Lock();
+         idle.store(true);
+         std::atomic_thread_fence(std::memory_order_seq_cst);
+         if (!Pending()) flushCV.Wait(1);
+         idle.store(false);
+         flushCV.UnLock();
+
+         logP->Logger_Mutex.Lock();
+         Drain();
+         nDrop = numDrop.load(std::memory_order_relaxed);
+         if (nDrop != lastDrop && (nowT = time(0)) != lastT)
+            {int n = snprintf(eBuff, sizeof(eBuff), "Logger: %lld message%s "
+                              "dropped; %lld so far!\n", nDrop-lastDrop,
+                              (nDrop-lastDrop == 1 ? "" : "s"), nDrop);
+             logP->putEmsg(eBuff, n);
+             lastDrop = nDrop; lastT = nowT;
+            }
+         logP->Logger_Mutex.UnLock();
+
+         spaceCV.Lock();
+         if (numWait) spaceCV.Broadcast();
+         spaceCV.UnLock();
+        }
+}
+
+/******************************************************************************/
+/*                   X r d S y s L o g g e r A s y n c : : g e t R i n g      */
+/******************************************************************************/
+  
+XrdSysLoggerAsync::Ring *XrdSysLoggerAsync::getRing()
+{
+   Ring *rP;
+   char *bP;
+
+// Return the ring assigned to this thread, if any
+//
+   if ((rP = (Ring *)pthread_getspecific(ringKey))) return rP;
+
+// Try to reuse a ring left behind by a thread that has exited
+//
+   for (rP = rings.load(std::memory_order_acquire); rP; rP = rP->next)
+       {int expect = Ring::isFree;
+        if (rP->state.compare_exchange_strong(expect, Ring::inUse)) break;
+       }
+
+// Otherwise, allocate a new ring and add it to the list
+//
+   if (!rP)
+      {if (!(bP = (char *)malloc(ringSize))) return 0;
+       rP = new Ring(bP);
+       rP->next = rings.load(std::memory_order_relaxed);
+       while(!rings.compare_exchange_weak(rP->next, rP,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {}
+      }
+
+// Assign the ring to this thread
+//
+   pthread_setspecific(ringKey, rP);
+   return rP;
+}
+
+/******************************************************************************/
+/*                   X r d S y s L o g g e r A s y n c : : P e n d i n g      */
+/******************************************************************************/
+  
+bool XrdSysLoggerAsync::Pending()
+{
+   Ring *rP;
+
+   for (rP = rings.load(std::memory_order_acquire); rP; rP = rP->next)
+       if (rP->head.load(std::memory_order_acquire)
+       !=  rP->tail.load(std::memory_order_relaxed)) return true;
+   return false;
+}
+
+/******************************************************************************/
+/*                       X r d S y s L o g g e r A s y n c : : P u t          */
+/******************************************************************************/
+
+// Returns false if the message must be written synchronously.
+
+bool XrdSysLoggerAsync::Put(int iovcnt, struct iovec *iov)
+{
+   const unsigned int hdrSz = sizeof(Rec), mask = ringSize-1;
+   Ring *rP;
+   Rec  *recP;
+   char *mP;
+   unsigned int head, need, recSz, toEnd, mLen = 0;
+
+// Compute the space needed. Messages that would use more than half of the
+// ring are written synchronously.
+//
+   for (int i = 0; i < iovcnt; i++) mLen += iov[i].iov_len;
+   recSz = (hdrSz + mLen + hdrSz - 1) / hdrSz * hdrSz;
+   if (recSz > ringSize/2 || !(rP = getRing())) return false;
+
+// Wait for enough space to become available or drop the message
+//
+   head  = rP->head.load(std::memory_order_relaxed);
+   toEnd = ringSize - (head & mask);
+   need  = (toEnd < recSz ? toEnd + recSz : recSz);
+   while(ringSize - (head - rP->tail.load(std::memory_order_acquire)) < need)
+        {if (dropMsg)
+            {numDrop.fetch_add(1, std::memory_order_relaxed);
+             if (idle.load(std::memory_order_relaxed)) Wake();
+             return true;
+            }
+         spaceCV.Lock();
+         numWait++;
+         Wake();
+         spaceCV.WaitMS(10);
+         numWait--;
+         spaceCV.UnLock();
+        }
+
+// If the message does not fit before the end of the ring, skip to the start
+//
+   if (toEnd < recSz)
+      {recP = (Rec *)(rP->buff + (head & mask));
+       recP->seq = 0; recP->skip = toEnd;
+       head += toEnd;
+      }
+
+// Copy in the message
+//
+   recP = (Rec *)(rP->buff + (head & mask));
+   recP->seq  = msgSeq.fetch_add(1, std::memory_order_relaxed);
+   recP->len  = mLen;
+   recP->skip = recSz;
+   mP = (char *)(recP+1);
+   for (int i = 0; i < iovcnt; i++)
+       {memcpy(mP, iov[i].iov_base, iov[i].iov_len);
+        mP += iov[i].iov_len;
+       }
+
+// Publish the message and wake up the flusher if it is idle
+//
+   rP->head.store(head + recSz, std::memory_order_release);
+   std::atomic_thread_fence(std::memory_order_seq_cst);
+   if (idle.load(std::memory_order_relaxed)) Wake();
+   return true;
+}
+
+/******************************************************************************/
+/*                       X r d S y s L o g g e r A s y n c : : F o r          */
+/******************************************************************************/
+
+// Return the asynchronous writer if it belongs to the logger. It is kept here
+// rather than in the logger so that the logger's layout is unchanged.
+//
+XrdSysLoggerAsync *XrdSysLoggerAsync::For(XrdSysLogger *lP)
+{
+   XrdSysLoggerAsync *aP = theAsync.load(std::memory_order_acquire);
+
+   return (aP && aP->logP == lP ? aP : 0);
+}
+
+/******************************************************************************/
+/*                     X r d S y s L o g g e r A s y n c : : S t a r t        */
+/******************************************************************************/
+  
+int XrdSysLoggerAsync::Start(XrdSysLogger *lP, int bsz, bool drop)
+{
+   static XrdSysMutex startMutex;
+   XrdSysMutexHelper mHelp(startMutex);
+   XrdSysLoggerAsync *aP;
+   pthread_t tid;
+   unsigned int rsz = 4096;
+   int rc;
+
+// Only one logger may be asynchronous
+//
+   if ((aP = theAsync.load())) return (aP->logP == lP ? 0 : -EBUSY);
+
+// Round the ring size up to a power of two
+//
+   if (bsz < 4096 || bsz > 64*1024*1024) return -EINVAL;
+   while(rsz < (unsigned int)bsz) rsz <<= 1;
+
+// Create the object and start the flusher
+//
+   aP = new XrdSysLoggerAsync(lP, rsz, drop);
+   if ((rc = pthread_key_create(&aP->ringKey, Orphan)))
+      {delete aP; return -rc;}
+   if (XrdSysThread::Run(&tid, XrdSysLoggerAF, (void *)aP, 0, "Log flusher"))
+      {rc = errno;
+       pthread_key_delete(aP->ringKey);
+       delete aP;
+       return -rc;
+      }
+
+// Make sure that queued messages are written out when the process exits
+//
+   theAsync.store(aP);
+   atexit(XrdSysLoggerAsync::AtExit);
+   return 0;
+}
+
+/******************************************************************************/
+/*                       X r d S y s L o g g e r A s y n c : : W a k e        */
+/******************************************************************************/
+  
+void XrdSysLoggerAsync::Wake()
+{
+   flushCV.Lock();
+   flushCV.Signal();
+   flushCV.UnLock();
+}
+
 /******************************************************************************/
 /*                         L o c a l   D e f i n e s                          */
 /******************************************************************************/
@@ -288,6 +701,38 @@ void XrdSysLogger::Capture(XrdOucTListFIFO *tFIFO)
    Logger_Mutex.UnLock();
 }
   
+/******************************************************************************/
+/*                               D r o p p e d                                */
+/******************************************************************************/
+
+long long XrdSysLogger::Dropped()
+{
+   XrdSysLoggerAsync *aP = XrdSysLoggerAsync::For(this);
+
+   return (aP ? aP->numDrop.load(std::memory_order_relaxed) : 0);
+}
+
+/******************************************************************************/
+/*                                 F l u s h                                  */
+/******************************************************************************/
+
+void XrdSysLogger::Flush()
+{
+   XrdSysLoggerAsync *aP = XrdSysLoggerAsync::For(this);
+
+// Write out any messages still waiting to be written
+//
+   if (aP)
+      {Logger_Mutex.Lock();
+       aP->Drain();
+       Logger_Mutex.UnLock();
+      }
+
+// Make sure it all reaches the disk
+//
+   fsync(eFD);
+}
+
 /******************************************************************************/
 /*                             P a r s e K e e p                              */
 /******************************************************************************/
@@ -329,9 +774,9 @@ int XrdSysLogger::ParseKeep(const char *arg)
   
 void XrdSysLogger::Put(int iovcnt, struct iovec *iov)
 {
+    XrdSysLoggerAsync *aP;
     struct timeval tVal;
     unsigned long  tID = XrdSysThread::Num();
-    int retc;
     char tbuff[32];
 
 // Get current time
@@ -354,10 +799,44 @@ void XrdSysLogger::Put(int iovcnt, struct iovec *iov)
        iov[0].iov_len  = TimeStamp(tVal, tID, tbuff, sizeof(tbuff), hiRes);
       }
 
+// Hand off the message if we are logging asynchronously. Captured messages
+// are always handled inline.
+//
+   if (!tFifo && (aP = XrdSysLoggerAsync::For(this)) && aP->Put(iovcnt, iov))
+      return;
+
+// Write out the message
+//
+   putMsg(iovcnt, iov);
+}
+
+/******************************************************************************/
+/*                              s e t A s y n c                               */
+/******************************************************************************/
+
+int XrdSysLogger::setAsync(int bsz, bool drop)
+{
+   return XrdSysLoggerAsync::Start(this, bsz, drop);
+}
+
+/******************************************************************************/
+/* Private:                       p u t M s g                                 */
+/******************************************************************************/
+  
+void XrdSysLogger::putMsg(int iovcnt, struct iovec *iov)
+{
+    XrdSysLoggerAsync *aP;
+    int retc;
+
 // Obtain the serailization mutex if need be
 //
    Logger_Mutex.Lock();
 
+// When logging asynchronously, write out what is queued before this message so
+// that it does not overtake earlier messages from the same thread.
+//
+   if ((aP = XrdSysLoggerAsync::For(this))) aP->Drain();
+
 // If we are capturing messages, do so now
 //
    if (tFifo)
@@ -48,9 +48,12 @@
 //-----------------------------------------------------------------------------
 
 class XrdOucTListFIFO;
+class XrdSysLoggerAsync;
 
 class XrdSysLogger
 {
+friend class XrdSysLoggerAsync;
+
 public:
 
 //-----------------------------------------------------------------------------
@@ -145,11 +148,20 @@ int Bind(const char *path, int lfh=0);
 
 void Capture(XrdOucTListFIFO *tFIFO);
 
+//-----------------------------------------------------------------------------
+//! Get the number of messages dropped because asynchronous logging could not
+//! keep up (see setAsync()).
+//!
+//! @return the number of messages dropped so far.
+//-----------------------------------------------------------------------------
+
+long long Dropped();
+
 //-----------------------------------------------------------------------------
 //! Flush any pending output
 //-----------------------------------------------------------------------------
 
-void Flush() {fsync(eFD);}
+void Flush();
 
 //-----------------------------------------------------------------------------
 //! Get the file descriptor passed at construction time.
@@ -182,6 +194,25 @@ int  ParseKeep(const char *arg);
 
 void Put(int iovcnt, struct iovec *iov);
 
+//-----------------------------------------------------------------------------
+//! Write messages asynchronously. Each thread places its messages in its own
+//! ring buffer and a dedicated thread periodically writes them to the log.
+//! Each batch is written in the order the messages were issued; a message
+//! may follow later ones from other threads if it was published while the
+//! previous batch was being collected. Asynchronous logging can only be
+//! enabled for a single logger and, once enabled, it cannot be disabled.
+//!
+//! @param  bsz       The size of each thread's ring buffer. It is rounded up
+//!                   to a power of two and must be at least 4K.
+//! @param  drop      When true, a message that does not fit in the thread's
+//!                   buffer is dropped and counted (see Dropped()). Otherwise,
+//!                   the thread waits until space becomes available.
+//!
+//! @return 0 upon success and -errno upon failure.
+//-----------------------------------------------------------------------------
+
+int  setAsync(int bsz, bool drop);
+
 //-----------------------------------------------------------------------------
 //! Set call-out to logging plug-in on or off.
 //-----------------------------------------------------------------------------
@@ -279,6 +310,7 @@ pthread_t  lfhTID;
 static bool doForward;
 
 void   putEmsg(char *msg, int msz);
+void   putMsg(int iovcnt, struct iovec *iov);
 int    ReBind(int dorename=1);
 void   Trim();
 };
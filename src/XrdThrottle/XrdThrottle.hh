@@ -23,10 +23,12 @@ typedef std::unique_ptr<XrdSfsFile> unique_sfs_ptr;
 typedef std::auto_ptr<XrdSfsFile> unique_sfs_ptr;
 #endif
 
+class AioJob;
 class FileSystem;
 
 class File : public XrdSfsFile {
 
+friend class AioJob;
 friend class FileSystem;
 
 public:
@@ -122,8 +124,14 @@ private:
    virtual
    ~File();
 
+   bool
+   DeferAio(XrdSfsAio *aiop, int op, uint64_t opts=0);
+
+   void
+   DoAio(XrdSfsAio *aiop, int op, uint64_t opts);
+
    unique_sfs_ptr m_sfs;
-   int m_uid; // A unique identifier for this user; has no meaning except for the fairshare.
+   XrdThrottleNode m_node; // This file's place in the fairshare hierarchy.
    std::string m_loadshed;
    std::string m_user;
    XrdThrottleManager &m_throttle;
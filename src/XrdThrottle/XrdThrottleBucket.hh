@@ -0,0 +1,131 @@
+
+/*
+ * XrdThrottleBucket
+ *
+ * A lock-free token bucket.  Rather than a token count, the bucket keeps
+ * the "theoretical arrival time" (TAT) of the next request, which is the
+ * generic cell rate algorithm formulation of a token bucket.  Consuming
+ * tokens is then a single compare-and-swap that pushes the TAT forward;
+ * there is no refill step and nothing needs to be periodically recomputed.
+ * Since the rate is supplied by the caller it may change at any time.
+ *
+ * XrdThrottleNode
+ *
+ * A node in the throttle hierarchy (server, VO, user, file).  Each node
+ * has a bucket for bytes and one for operations, and counts how many of
+ * its children were active in the current and the previous interval so
+ * that a child can compute its fair share of the parent's rate without
+ * any periodic pass over the hierarchy.
+ */
+
+#ifndef __XrdThrottleBucket_hh_
+#define __XrdThrottleBucket_hh_
+
+#include <atomic>
+#include <string>
+
+class XrdThrottleBucket
+{
+
+public:
+
+/*
+ * Reserve amount units at rate units per second, allowing bursts of up to
+ * burst_ns worth of the rate.  The reservation is only made when the
+ * request conforms, in which case zero is returned.  Otherwise the bucket
+ * is left alone and the return value is the number of nanoseconds the
+ * caller must wait before trying again.
+ */
+long long   Reserve(long long amount, double rate, long long burst_ns, long long now)
+            {
+               if (rate <= 0 || amount <= 0) return 0;
+               long long cost = static_cast<long long>(amount * 1e9 / rate);
+               long long tat = m_tat.load(std::memory_order_relaxed), start;
+               do {start = tat > now ? tat : now;
+                   if (start - burst_ns > now) return start - burst_ns - now;
+                  }
+               while (!m_tat.compare_exchange_weak(tat, start + cost, std::memory_order_relaxed));
+               return 0;
+            }
+
+            XrdThrottleBucket() : m_tat(0) {}
+
+private:
+
+std::atomic<long long> m_tat;
+};
+
+class XrdThrottleNode
+{
+
+public:
+
+/*
+ * Mark this node active during the interval epoch; the parent's count of
+ * active children is incremented the first time this happens per interval.
+ */
+void        Touch(unsigned epoch)
+            {
+               unsigned last = m_epoch.load(std::memory_order_relaxed);
+               if (last != epoch && m_epoch.compare_exchange_strong(last, epoch, std::memory_order_relaxed) && m_parent)
+                  m_parent->AddChild(epoch);
+            }
+
+/*
+ * Number of children active in the current or previous interval; never
+ * less than one so it can be used directly as a divisor.
+ */
+int         Children(unsigned epoch) const
+            {
+               int cur  = Count(m_kids[epoch & 1].load(std::memory_order_relaxed), epoch);
+               int prev = Count(m_kids[(epoch - 1) & 1].load(std::memory_order_relaxed), epoch - 1);
+               int n = cur > prev ? cur : prev;
+               return n > 0 ? n : 1;
+            }
+
+XrdThrottleNode *Parent() const {return m_parent;}
+
+void        SetParent(XrdThrottleNode *parent) {m_parent = parent;}
+
+XrdThrottleBucket m_bytes;
+XrdThrottleBucket m_ops;
+
+// Usage statistics; maintained for user nodes only.
+std::atomic<long long> m_stat_bytes;
+std::atomic<long long> m_stat_ops;
+std::atomic<long long> m_stat_io_ns;
+std::atomic<long long> m_stat_delay_ns;
+
+// Registry bookkeeping; protected by the manager's registry mutex.
+std::string m_name;
+std::string m_vo;
+int         m_refs;
+
+            XrdThrottleNode(XrdThrottleNode *parent=0) :
+               m_stat_bytes(0), m_stat_ops(0), m_stat_io_ns(0), m_stat_delay_ns(0),
+               m_refs(0), m_parent(parent), m_epoch(~0U)
+            {
+               m_kids[0].store(0, std::memory_order_relaxed);
+               m_kids[1].store(0, std::memory_order_relaxed);
+            }
+
+private:
+
+// Each slot holds the interval it counts for in the upper 32 bits.
+static int  Count(unsigned long long slot, unsigned epoch)
+            {return (slot >> 32) == epoch ? static_cast<int>(slot & 0xffffffff) : 0;}
+
+void        AddChild(unsigned epoch)
+            {
+               std::atomic<unsigned long long> &slot = m_kids[epoch & 1];
+               unsigned long long cur = slot.load(std::memory_order_relaxed), next;
+               do {next = (static_cast<unsigned long long>(epoch) << 32) | (Count(cur, epoch) + 1);}
+               while (!slot.compare_exchange_weak(cur, next, std::memory_order_relaxed));
+            }
+
+XrdThrottleNode *m_parent;
+std::atomic<unsigned> m_epoch;
+std::atomic<unsigned long long> m_kids[2];
+};
+
+#endif
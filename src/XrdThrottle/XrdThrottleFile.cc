@@ -1,4 +1,5 @@
 
+#include "Xrd/XrdJob.hh"
 #include "XrdSfs/XrdSfsAio.hh"
 #include "XrdSec/XrdSecEntity.hh"
 
@@ -6,6 +7,48 @@
 
 using namespace XrdThrottle;
 
+namespace XrdThrottle {
+
+enum AioOp {AioRead, AioWrite, AioPgRead, AioPgWrite};
+
+/*
+ * A throttled asynchronous request.  Rather than holding the thread that
+ * issued it, the request is rescheduled until it conforms to the throttle
+ * and then issued synchronously to the underlying file.
+ */
+class AioJob : public XrdJob
+{
+public:
+
+void DoIt()
+{
+   long long delay = m_file.m_throttle.Next(m_req);
+   if (delay)
+   {
+      m_file.m_throttle.Defer(this, delay);
+      return;
+   }
+   m_file.m_throttle.Finish(m_req);
+   m_file.DoAio(m_aiop, m_op, m_opts);
+   delete this;
+}
+
+AioJob(File &file, XrdSfsAio *aiop, int op, uint64_t opts) :
+   XrdJob("throttled aio"), m_file(file), m_aiop(aiop), m_op(op), m_opts(opts)
+{}
+
+XrdThrottleRequest m_req;
+
+private:
+
+File      &m_file;
+XrdSfsAio *m_aiop;
+int        m_op;
+uint64_t   m_opts;
+};
+
+}
+
 #define DO_LOADSHED if (m_throttle.CheckLoadShed(m_loadshed)) \
 { \
    unsigned port; \
@@ -18,8 +61,8 @@ using namespace XrdThrottle;
 
 #define DO_THROTTLE(amount) \
 DO_LOADSHED \
-m_throttle.Apply(amount, 1, m_uid); \
-XrdThrottleTimer xtimer = m_throttle.StartIOTimer();
+m_throttle.Apply(amount, 1, m_node); \
+XrdThrottleTimer xtimer = m_throttle.StartIOTimer(&m_node);
 
 File::File(const char                     *user,
                  unique_sfs_ptr            sfs,
@@ -31,14 +74,71 @@ File::File(const char                     *user,
 #else
      m_sfs(sfs),
 #endif
-     m_uid(0),
      m_user(user),
      m_throttle(throttle),
      m_eroute(eroute)
 {}
 
 File::~File()
-{}
+{
+   if (m_node.Parent()) m_throttle.Detach(m_node);
+}
+
+/*
+ * If the request must be throttled and a scheduler is available, defer it;
+ * returns false if the request should be handled synchronously instead.
+ */
+bool
+File::DeferAio(XrdSfsAio *aiop, int op, uint64_t opts)
+{
+   if (!m_throttle.IsThrottling() || !m_throttle.CanDefer()
+   ||  m_throttle.CheckLoadShed(m_loadshed))
+      return false;
+
+   AioJob *jp = new AioJob(*this, aiop, op, opts);
+   if (!m_throttle.Begin(jp->m_req, aiop->sfsAio.aio_nbytes, 1, m_node))
+   {
+      delete jp;
+      DoAio(aiop, op, opts);
+      return true;
+   }
+   jp->DoIt();
+   return true;
+}
+
+/*
+ * Issue an asynchronous request, which has already been throttled, as a
+ * synchronous one and report its completion.
+ */
+void
+File::DoAio(XrdSfsAio *aiop, int op, uint64_t opts)
+{
+   XrdSfsFileOffset offset = (XrdSfsFileOffset)aiop->sfsAio.aio_offset;
+   char            *buffer = (char *)aiop->sfsAio.aio_buf;
+   XrdSfsXferSize   amount = (XrdSfsXferSize)aiop->sfsAio.aio_nbytes;
+
+   {
+      XrdThrottleTimer xtimer = m_throttle.StartIOTimer(&m_node);
+      switch (op)
+      {
+         case AioRead:
+            aiop->Result = m_sfs->read(offset, buffer, amount);
+            break;
+         case AioWrite:
+            aiop->Result = m_sfs->write(offset, buffer, amount);
+            break;
+         case AioPgRead:
+            aiop->Result = m_sfs->pgRead(offset, buffer, amount, aiop->cksVec, opts);
+            break;
+         case AioPgWrite:
+            aiop->Result = m_sfs->pgWrite(offset, buffer, amount, aiop->cksVec, opts);
+            break;
+      }
+   }
+
+   if (op == AioRead || op == AioPgRead) aiop->doneRead();
+      else aiop->doneWrite();
+}
 
 int
 File::open(const char                *fileName,
@@ -47,7 +147,7 @@ File::open(const char                *fileName,
            const XrdSecEntity        *client,
            const char                *opaque)
 {
-   m_uid = XrdThrottleManager::GetUid(client->name);
+   m_throttle.Attach(m_node, client);
    m_throttle.PrepLoadShed(opaque, m_loadshed);
    return m_sfs->open(fileName, openMode, createMode, client, opaque);
 }
@@ -55,6 +155,7 @@ File::open(const char                *fileName,
 int
 File::close()
 {
+   if (m_node.Parent()) m_throttle.Detach(m_node);
    return m_sfs->close();
 }
 
@@ -101,7 +202,9 @@ File::pgRead(XrdSfsFileOffset   offset,
 
 XrdSfsXferSize
 File::pgRead(XrdSfsAio *aioparm, uint64_t opts)
-{  // We disable all AIO-based reads.
+{
+   if (DeferAio(aioparm, AioPgRead, opts)) return SFS_OK;
+   // Otherwise, handle AIO-based reads synchronously.
    aioparm->Result = this->pgRead((XrdSfsFileOffset)aioparm->sfsAio.aio_offset,
                                             (char *)aioparm->sfsAio.aio_buf,
                                     (XrdSfsXferSize)aioparm->sfsAio.aio_nbytes,
@@ -123,7 +226,9 @@ File::pgWrite(XrdSfsFileOffset   offset,
 
 XrdSfsXferSize
 File::pgWrite(XrdSfsAio *aioparm, uint64_t opts)
-{  // We disable all AIO-based writes.
+{
+   if (DeferAio(aioparm, AioPgWrite, opts)) return SFS_OK;
+   // Otherwise, handle AIO-based writes synchronously.
    aioparm->Result = this->pgWrite((XrdSfsFileOffset)aioparm->sfsAio.aio_offset,
                                              (char *)aioparm->sfsAio.aio_buf,
                                      (XrdSfsXferSize)aioparm->sfsAio.aio_nbytes,
@@ -151,7 +256,9 @@ File::read(XrdSfsFileOffset   fileOffset,
 
 int
 File::read(XrdSfsAio *aioparm)
-{  // We disable all AIO-based reads.
+{
+   if (DeferAio(aioparm, AioRead)) return SFS_OK;
+   // Otherwise, handle AIO-based reads synchronously.
    aioparm->Result = this->read((XrdSfsFileOffset)aioparm->sfsAio.aio_offset,
                                           (char *)aioparm->sfsAio.aio_buf,
                                   (XrdSfsXferSize)aioparm->sfsAio.aio_nbytes);
@@ -171,6 +278,7 @@ File::write(      XrdSfsFileOffset   fileOffset,
 int
 File::write(XrdSfsAio *aioparm)
 {
+   if (DeferAio(aioparm, AioWrite)) return SFS_OK;
    aioparm->Result = this->write((XrdSfsFileOffset)aioparm->sfsAio.aio_offset,
                                            (char *)aioparm->sfsAio.aio_buf,
                                    (XrdSfsXferSize)aioparm->sfsAio.aio_nbytes);
@@ -1,6 +1,13 @@
 
 #include "XrdThrottleManager.hh"
 
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Xrd/XrdScheduler.hh"
+#include "XrdSec/XrdSecEntity.hh"
 #include "XrdSys/XrdSysAtomics.hh"
 #include "XrdSys/XrdSysTimer.hh"
 
@@ -13,7 +20,7 @@ const char *
 XrdThrottleManager::TraceID = "ThrottleManager";
 
 const
-int XrdThrottleManager::m_max_users = 1024;
+int XrdThrottleManager::m_max_stats_users = 64;
 
 #if defined(__linux__) || defined(__GNU__) || (defined(__FreeBSD_kernel__) && defined(__GLIBC__))
 int clock_id;
@@ -25,11 +32,12 @@ int XrdThrottleTimer::clock_id = 0;
 XrdThrottleManager::XrdThrottleManager(XrdSysError *lP, XrdOucTrace *tP) :
    m_trace(tP),
    m_log(lP),
+   m_sched(0),
    m_interval_length_seconds(1.0),
    m_bytes_per_second(-1),
    m_ops_per_second(-1),
    m_concurrency_limit(-1),
-   m_last_round_allocation(100*1024),
+   m_epoch(0),
    m_io_counter(0),
    m_loadshed_host(""),
    m_loadshed_port(0),
@@ -44,19 +52,6 @@ void
 XrdThrottleManager::Init()
 {
    TRACE(DEBUG, "Initializing the throttle manager.");
-   // Initialize all our shares to zero.
-   m_primary_bytes_shares.reserve(m_max_users);
-   m_secondary_bytes_shares.reserve(m_max_users);
-   m_primary_ops_shares.reserve(m_max_users);
-   m_secondary_ops_shares.reserve(m_max_users);
-   // Allocate each user 100KB and 10 ops to bootstrap;
-   for (int i=0; i<m_max_users; i++)
-   {
-      m_primary_bytes_shares[i] = m_last_round_allocation;
-      m_secondary_bytes_shares[i] = 0;
-      m_primary_ops_shares[i] = 10;
-      m_secondary_ops_shares[i] = 0;
-   }
 
    m_io_wait.tv_sec = 0;
    m_io_wait.tv_nsec = 0;
@@ -68,87 +63,190 @@ XrdThrottleManager::Init()
 
 }
 
+static inline long long
+NowNs()
+{
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
 /*
- * Take as many shares as possible to fulfill the request; update
- * request with current remaining value, or zero if satisfied.
+ * Find or create a registry node; the caller holds the registry mutex.
  */
-inline void
-XrdThrottleManager::GetShares(int &shares, int &request)
+XrdThrottleNode *
+XrdThrottleManager::Find(const std::string &key, const std::string &name, const std::string &vo, XrdThrottleNode *parent)
 {
-   int remaining;
-   AtomicFSub(remaining, shares, request);
-   if (remaining > 0)
+   XrdThrottleNode *&node = m_registry[key];
+   if (!node)
    {
-      request -= (remaining < request) ? remaining : request;
+      node = new XrdThrottleNode(parent);
+      node->m_name = name;
+      node->m_vo = vo;
+      if (parent && parent != &m_root) parent->m_refs++;
    }
+   node->m_refs++;
+   return node;
 }
 
 /*
- * Iterate through all of the secondary shares, attempting 
- * to steal enough to fulfill the request.
+ * Drop a reference to a registry node and, if it was the last one, to its
+ * parent; the caller holds the registry mutex.
  */
 void
-XrdThrottleManager::StealShares(int uid, int &reqsize, int &reqops)
+XrdThrottleManager::Release(XrdThrottleNode *node)
 {
-   if (!reqsize && !reqops) return;
-   TRACE(BANDWIDTH, "Stealing shares to fill request of " << reqsize << " bytes");
-   TRACE(IOPS, "Stealing shares to fill request of " << reqops << " ops.");
+   while (node && node != &m_root && --node->m_refs == 0)
+   {
+      XrdThrottleNode *parent = node->Parent();
+      m_registry.erase(parent == &m_root ? "v:" + node->m_name
+                                         : "u:" + node->m_vo + ":" + node->m_name);
+      delete node;
+      node = parent;
+   }
+}
+
+/*
+ * Place a file in the hierarchy under its user and the user's VO.
+ */
+void
+XrdThrottleManager::Attach(XrdThrottleNode &file, const XrdSecEntity *client)
+{
+   std::string user = (client && client->name && client->name[0]) ? client->name : "anon";
+   std::string vo   = (client && client->vorg && client->vorg[0]) ? client->vorg : "none";
+
+   XrdSysMutexHelper lock(m_registry_mutex);
+   if (file.Parent()) Release(file.Parent());
+   XrdThrottleNode *vo_node = Find("v:" + vo, vo, "", &m_root);
+   vo_node->m_refs--; // Only referenced through its users
+   file.SetParent(Find("u:" + vo + ":" + user, user, vo, vo_node));
+   TRACE(DEBUG, "Attached file to user " << user << " of VO " << vo);
+}
+
+void
+XrdThrottleManager::Detach(XrdThrottleNode &file)
+{
+   XrdSysMutexHelper lock(m_registry_mutex);
+   Release(file.Parent());
+   file.SetParent(0);
+}
+
+/*
+ * Start a request: account it to the user, mark the path to the server as
+ * active and compute the fair-share rates from the server down.
+ */
+bool
+XrdThrottleManager::Begin(XrdThrottleRequest &req, int reqsize, int reqops, XrdThrottleNode &file)
+{
+   XrdThrottleNode *user = file.Parent();
+   if (user)
+   {
+      user->m_stat_bytes.fetch_add(reqsize, std::memory_order_relaxed);
+      user->m_stat_ops.fetch_add(reqops, std::memory_order_relaxed);
+   }
+   if (m_bytes_per_second < 0) reqsize = 0;
+   if (m_ops_per_second < 0) reqops = 0;
+   if (!reqsize && !reqops) return false;
+
+   unsigned epoch = m_epoch.load(std::memory_order_relaxed);
+   int depth = 0;
+   for (XrdThrottleNode *node = &file; node && depth < XrdThrottleRequest::MaxDepth; node = node->Parent())
+   {
+      node->Touch(epoch);
+      req.m_chain[depth++] = node;
+   }
 
-   for (int i=uid+1; i % m_max_users == uid; i++)
+   int top = depth - 1;
+   req.m_byte_rate[top] = m_bytes_per_second;
+   req.m_op_rate[top]   = m_ops_per_second;
+   for (int i = top - 1; i >= 0; i--)
    {
-      if (reqsize) GetShares(m_secondary_bytes_shares[i % m_max_users], reqsize);
-      if (reqops)  GetShares(m_secondary_ops_shares[  i % m_max_users], reqops);
+      int share = req.m_chain[i+1]->Children(epoch);
+      req.m_byte_rate[i] = req.m_byte_rate[i+1] / share;
+      req.m_op_rate[i]   = req.m_op_rate[i+1] / share;
    }
 
-   TRACE(BANDWIDTH, "After stealing shares, " << reqsize << " of request bytes remain.");
-   TRACE(IOPS, "After stealing shares, " << reqops << " of request ops remain.");
+   req.m_depth    = depth;
+   req.m_level    = 0;
+   req.m_bytes_ok = false;
+   req.m_bytes    = reqsize;
+   req.m_ops      = reqops;
+   req.m_delay_ns = 0;
+   return true;
 }
 
 /*
- * Apply the throttle.  If there are no limits set, returns immediately.  Otherwise,
- * this applies the limits as best possible, stalling the thread if necessary.
+ * Take tokens level by level.  A level is only charged once the request
+ * conforms there; otherwise the caller waits and retries the same level.
+ * The byte bucket is charged first and is not charged again on the retry.
  */
-void
-XrdThrottleManager::Apply(int reqsize, int reqops, int uid)
+long long
+XrdThrottleManager::Next(XrdThrottleRequest &req)
 {
-   if (m_bytes_per_second < 0)
-      reqsize = 0;
-   if (m_ops_per_second < 0)
-      reqops = 0;
-   while (reqsize || reqops)
+   long long burst_ns = static_cast<long long>(m_interval_length_seconds * 1e9);
+   long long now = NowNs();
+   while (req.m_level < req.m_depth)
    {
-      // Subtract the requested out of the shares
-      AtomicBeg(m_compute_var);
-      GetShares(m_primary_bytes_shares[uid], reqsize);
-      if (reqsize)
-      {
-         TRACE(BANDWIDTH, "Using secondary shares; request has " << reqsize << " bytes left.");
-         GetShares(m_secondary_bytes_shares[uid], reqsize);
-         TRACE(BANDWIDTH, "Finished with secondary shares; request has " << reqsize << " bytes left.");
-      }
-      else
+      XrdThrottleNode *node = req.m_chain[req.m_level];
+      long long delay;
+      if (!req.m_bytes_ok)
       {
-         TRACE(BANDWIDTH, "Filled byte shares out of primary; " << m_primary_bytes_shares[uid] << " left.");
+         if ((delay = node->m_bytes.Reserve(req.m_bytes, req.m_byte_rate[req.m_level], burst_ns, now)))
+         {
+            TRACE(BANDWIDTH, "Delaying request by " << delay/1000 << "us at level " << req.m_level+1);
+            req.m_delay_ns += delay;
+            return delay;
+         }
+         req.m_bytes_ok = true;
       }
-      GetShares(m_primary_ops_shares[uid], reqops);
-      if (reqops)
+      if ((delay = node->m_ops.Reserve(req.m_ops, req.m_op_rate[req.m_level], burst_ns, now)))
       {
-         GetShares(m_secondary_ops_shares[uid], reqops);
-      }
-      StealShares(uid, reqsize, reqops);
-      AtomicEnd(m_compute_var);
-
-      if (reqsize || reqops)
-      {
-         if (reqsize) TRACE(BANDWIDTH, "Sleeping to wait for throttle fairshare.");
-         if (reqops) TRACE(IOPS, "Sleeping to wait for throttle fairshare.");
-         m_compute_var.Wait();
-         AtomicBeg(m_compute_var);
-         AtomicInc(m_loadshed_limit_hit);
-         AtomicEnd(m_compute_var);
+         TRACE(IOPS, "Delaying request by " << delay/1000 << "us at level " << req.m_level+1);
+         req.m_delay_ns += delay;
+         return delay;
       }
+      req.m_bytes_ok = false;
+      req.m_level++;
    }
+   return 0;
+}
+
+void
+XrdThrottleManager::Finish(XrdThrottleRequest &req)
+{
+   if (!req.m_delay_ns) return;
+   AtomicBeg(m_compute_var);
+   AtomicInc(m_loadshed_limit_hit);
+   AtomicEnd(m_compute_var);
+   XrdThrottleNode *user = req.m_depth > 1 ? req.m_chain[1] : 0;
+   if (user) user->m_stat_delay_ns.fetch_add(req.m_delay_ns, std::memory_order_relaxed);
+}
 
+void
+XrdThrottleManager::Defer(XrdJob *jp, long long delay_ns)
+{
+   m_sched->ScheduleMS(jp, static_cast<int>((delay_ns + 999999) / 1000000));
+}
+
+/*
+ * Apply the throttle.  If there are no limits set, returns immediately.  Otherwise,
+ * this stalls the thread for exactly as long as the request exceeds the limits.
+ */
+void
+XrdThrottleManager::Apply(int reqsize, int reqops, XrdThrottleNode &file)
+{
+   XrdThrottleRequest req;
+   if (!Begin(req, reqsize, reqops, file)) return;
+
+   long long delay;
+   while ((delay = Next(req)))
+   {
+      struct timespec ts;
+      ts.tv_sec  = delay / 1000000000LL;
+      ts.tv_nsec = delay % 1000000000LL;
+      while (nanosleep(&ts, &ts) && errno == EINTR) {}
+   }
+   Finish(req);
 }
 
 void *
@@ -172,72 +270,22 @@ XrdThrottleManager::Recompute()
 }
 
 /*
- * The heart of the manager approach.
- *
- * This routine periodically recomputes the shares of each current user.
- * Each user has a "primary" and a "secondary" share.  At the end of the
- * each time interval, the remaining primary share is moved to secondary.
- * A user can utilize both shares; if both are gone, they must block until
- * the next recompute interval.
- *
- * The secondary share can be "stolen" by any other user; so, if a user
- * is idle or under-utilizing, their share can be used by someone else.
- * However, they can never be completely starved, as no one can steal
- * primary share.
- *
- * In this way, we violate the throttle for an interval, but never starve.
- *
+ * The fair shares themselves need no recomputation; the buckets refill
+ * continuously.  Each interval we only start a new activity window so that
+ * nodes idle for a whole interval stop counting against their siblings.
  */
 void
 XrdThrottleManager::RecomputeInternal()
 {
-   // Compute total shares for this interval; 
    float intervals_per_second = 1.0/m_interval_length_seconds;
-   float total_bytes_shares = m_bytes_per_second / intervals_per_second;
-   float total_ops_shares   = m_ops_per_second / intervals_per_second;
 
-   // Compute the number of active users; a user is active if they used
-   // any primary share during the last interval;
-   AtomicBeg(m_compute_var);
-   float active_users = 0;
-   long bytes_used = 0;
-   for (int i=0; i<m_max_users; i++)
-   {
-      int primary = AtomicFAZ(m_primary_bytes_shares[i]);
-      if (primary != m_last_round_allocation)
-      {
-         active_users++;
-         if (primary >= 0)
-            m_secondary_bytes_shares[i] = primary;
-         primary = AtomicFAZ(m_primary_ops_shares[i]);
-         if (primary >= 0)
-             m_secondary_ops_shares[i] = primary;
-         bytes_used += (primary < 0) ? m_last_round_allocation : (m_last_round_allocation-primary);
-      }
-   }
-
-   if (active_users == 0)
-   {
-      active_users++;
-   }
-
-   // Note we allocate the same number of shares to *all* users, not
-   // just the active ones.  If a new user becomes active in the next
-   // interval, we'll go over our bandwidth budget just a bit.
-   m_last_round_allocation = static_cast<int>(total_bytes_shares / active_users);
-   int ops_shares = static_cast<int>(total_ops_shares / active_users);
-   TRACE(BANDWIDTH, "Round byte allocation " << m_last_round_allocation << " ; last round used " << bytes_used << ".");
-   TRACE(IOPS, "Round ops allocation " << ops_shares);
-   for (int i=0; i<m_max_users; i++)
-   {
-      m_primary_bytes_shares[i] = m_last_round_allocation;
-      m_primary_ops_shares[i] = ops_shares;
-   }
+   unsigned epoch = m_epoch.fetch_add(1, std::memory_order_relaxed);
+   TRACE(BANDWIDTH, "Interval " << epoch << " had " << m_root.Children(epoch) << " active VOs.");
 
    // Reset the loadshed limit counter.
+   AtomicBeg(m_compute_var);
    int limit_hit = AtomicFAZ(m_loadshed_limit_hit);
    TRACE(DEBUG, "Throttle limit hit " << limit_hit << " times during last interval.");
-
    AtomicEnd(m_compute_var);
 
    // Update the IO counters
@@ -257,29 +305,11 @@ XrdThrottleManager::RecomputeInternal()
    m_compute_var.Broadcast();
 }
 
-/*
- * Do a simple hash across the username.
- */
-int
-XrdThrottleManager::GetUid(const char *username)
-{
-   const char *cur = username;
-   int hval = 0;
-   while (cur && *cur && *cur != '@' && *cur != '.')
-   {
-      hval += *cur;
-      hval %= m_max_users;
-      cur++;
-   }
-   //cerr << "Calculated UID " << hval << " for " << username << endl;
-   return hval;
-}
-
 /*
  * Create an IO timer object; increment the number of outstanding IOs.
  */
 XrdThrottleTimer
-XrdThrottleManager::StartIOTimer()
+XrdThrottleManager::StartIOTimer(XrdThrottleNode *file)
 {
    AtomicBeg(m_compute_var);
    int cur_counter = AtomicInc(m_io_counter);
@@ -295,15 +325,16 @@ XrdThrottleManager::StartIOTimer()
       cur_counter = AtomicInc(m_io_counter);
       AtomicEnd(m_compute_var);
    }
-   return XrdThrottleTimer(*this);
+   return XrdThrottleTimer(*this, file ? file->Parent() : 0);
 }
 
 /*
  * Finish recording an IO timer.
  */
 void
-XrdThrottleManager::StopIOTimer(struct timespec timer)
+XrdThrottleManager::StopIOTimer(struct timespec timer, XrdThrottleNode *user, long long wall_ns)
 {
+   if (user) user->m_stat_io_ns.fetch_add(wall_ns, std::memory_order_relaxed);
    AtomicBeg(m_compute_var);
    AtomicDec(m_io_counter);
    AtomicAdd(m_io_wait.tv_sec, timer.tv_sec);
@@ -312,6 +343,65 @@ XrdThrottleManager::StopIOTimer(struct timespec timer)
    AtomicEnd(m_compute_var);
 }
 
+/*
+ * Report per-user usage.  The counters are cumulative: bytes and operations
+ * requested, time spent in the underlying file system and time spent waiting
+ * on the throttle (in microseconds), and the average IO latency.  Only users
+ * with open files are listed, at most m_max_stats_users of them.
+ */
+int
+XrdThrottleManager::Stats(char *buff, int blen)
+{
+   static const char statfmt0[] = "<stats id=\"throttle\"><users>%d</users>";
+   static const char statfmt1[] = "<user><name>%s</name><vo>%s</vo>"
+          "<bytes>%lld</bytes><ops>%lld</ops><iot>%lld</iot><lat>%lld</lat>"
+          "<dly>%lld</dly></user>";
+   static const char statfmt2[] = "</stats>";
+   static const int  userLen = sizeof(statfmt1) + 2*64 + 5*20;
+
+   if (!buff) return sizeof(statfmt0) + 12 + m_max_stats_users*userLen + sizeof(statfmt2);
+
+   XrdSysMutexHelper lock(m_registry_mutex);
+   int users = 0;
+   for (auto it = m_registry.begin(); it != m_registry.end(); ++it)
+      if (it->second->Parent() != &m_root) users++;
+
+   int len = snprintf(buff, blen, statfmt0, users);
+   if (len >= blen) return 0;
+
+   int listed = 0;
+   for (auto it = m_registry.begin(); it != m_registry.end() && listed < m_max_stats_users; ++it)
+   {
+      XrdThrottleNode *node = it->second;
+      if (node->Parent() == &m_root) continue;
+      if (blen - len <= userLen + (int)sizeof(statfmt2)) break;
+
+      // Names come from the client so keep them short and well-formed.
+      char name[65], vo[65];
+      const std::string *src[2] = {&node->m_name, &node->m_vo};
+      char *dst[2] = {name, vo};
+      for (int i = 0; i < 2; i++)
+      {
+         int n = 0;
+         for (const char *cp = src[i]->c_str(); *cp && n < 64; cp++)
+            dst[i][n++] = (isalnum(*cp) || *cp == '-' || *cp == '_' || *cp == '.' || *cp == '/') ? *cp : '_';
+         dst[i][n] = 0;
+      }
+
+      long long ops = node->m_stat_ops.load(std::memory_order_relaxed);
+      long long iot = node->m_stat_io_ns.load(std::memory_order_relaxed) / 1000;
+      len += snprintf(buff+len, blen-len, statfmt1, name, vo,
+                      node->m_stat_bytes.load(std::memory_order_relaxed), ops,
+                      iot, ops ? iot/ops : 0,
+                      node->m_stat_delay_ns.load(std::memory_order_relaxed) / 1000);
+      listed++;
+   }
+
+   if (blen - len < (int)sizeof(statfmt2)) return 0;
+   strcpy(buff+len, statfmt2);
+   return len + sizeof(statfmt2) - 1;
+}
+
 /*
  * Check the counters to see if we have hit any throttle limits in the
  * current time period.  If so, shed the client randomly.
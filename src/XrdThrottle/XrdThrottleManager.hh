@@ -9,12 +9,17 @@
  *
  * The XrdThrottleManager is user-aware and provides fairshare.
  *
- * This works by having a separate thread periodically refilling
- * each user's shares.
+ * This works with a hierarchy of token buckets: the server, each VO,
+ * each user within a VO and each open file of a user.  The rate of a
+ * node is its parent's rate divided by the number of the parent's
+ * children that are currently active, so bandwidth is shared fairly
+ * between VOs, then between the users of a VO, then between the files
+ * of a user.  A request must conform at every level, starting from the
+ * file, so a heavy user is delayed by its own bucket before it can
+ * consume any of the server's rate.
  *
- * Note that we do not actually keep close track of users, but rather
- * put them into a hash.  This way, we can pretend there's a constant
- * number of users and use a lock-free algorithm.
+ * All bucket operations are lock-free; the periodic thread only
+ * advances the interval counter used to decide which nodes are active.
  */
 
 #ifndef __XrdThrottleManager_hh_
@@ -28,16 +33,40 @@
 #define unlikely(x)     x
 #endif
 
+#include <atomic>
 #include <string>
-#include <vector>
+#include <unordered_map>
 #include <time.h>
 
 #include "XrdSys/XrdSysPthread.hh"
+#include "XrdThrottle/XrdThrottleBucket.hh"
 
-class XrdSysError;
+class XrdJob;
 class XrdOucTrace;
+class XrdScheduler;
+class XrdSecEntity;
+class XrdSysError;
 class XrdThrottleTimer;
 
+/*
+ * The state of one throttled request as it makes its way up the hierarchy;
+ * it may be carried across deferrals.
+ */
+struct XrdThrottleRequest
+{
+   static const int MaxDepth = 4;
+
+   XrdThrottleNode *m_chain[MaxDepth];  // File first, server last
+   double           m_byte_rate[MaxDepth];
+   double           m_op_rate[MaxDepth];
+   int              m_depth;
+   int              m_level;
+   bool             m_bytes_ok;          // Bytes charged at m_level
+   long long        m_bytes;
+   long long        m_ops;
+   long long        m_delay_ns;
+};
+
 class XrdThrottleManager
 {
 
@@ -47,7 +76,28 @@ public:
 
 void        Init();
 
-void        Apply(int reqsize, int reqops, int uid);
+void        Attach(XrdThrottleNode &file, const XrdSecEntity *client);
+
+void        Detach(XrdThrottleNode &file);
+
+// Throttle the request, sleeping the calling thread as needed.
+void        Apply(int reqsize, int reqops, XrdThrottleNode &file);
+
+// Asynchronous variant: Begin() returns false if the request need not be
+// throttled at all.  Otherwise, Next() returns the number of nanoseconds to
+// wait (e.g., via Defer()) before calling it again, or zero once the request
+// may proceed, after which Finish() must be called.
+bool        Begin(XrdThrottleRequest &req, int reqsize, int reqops, XrdThrottleNode &file);
+
+long long   Next(XrdThrottleRequest &req);
+
+void        Finish(XrdThrottleRequest &req);
+
+bool        CanDefer() {return m_sched != 0;}
+
+void        Defer(XrdJob *jp, long long delay_ns);
+
+void        SetScheduler(XrdScheduler *sched) {m_sched = sched;}
 
 bool        IsThrottling() {return (m_ops_per_second > 0) || (m_bytes_per_second > 0);}
 
@@ -58,12 +108,9 @@ void        SetThrottles(float reqbyterate, float reqoprate, int concurrency, fl
 void        SetLoadShed(std::string &hostname, unsigned port, unsigned frequency)
             {m_loadshed_host = hostname; m_loadshed_port = port; m_loadshed_frequency = frequency;}
 
-//int         Stats(char *buff, int blen, int do_sync=0) {return m_pool.Stats(buff, blen, do_sync);}
-
-static
-int         GetUid(const char *username);
+int         Stats(char *buff, int blen);
 
-XrdThrottleTimer StartIOTimer();
+XrdThrottleTimer StartIOTimer(XrdThrottleNode *file=0);
 
 void        PrepLoadShed(const char *opaque, std::string &lsOpaque);
 
@@ -77,7 +124,7 @@ void        PerformLoadShed(const std::string &opaque, std::string &host, unsign
 
 protected:
 
-void        StopIOTimer(struct timespec);
+void        StopIOTimer(struct timespec, XrdThrottleNode *user, long long wall_ns);
 
 private:
 
@@ -88,14 +135,13 @@ void        RecomputeInternal();
 static
 void *      RecomputeBootstrap(void *pp);
 
-int         WaitForShares();
-
-void        GetShares(int &shares, int &request);
+XrdThrottleNode *Find(const std::string &key, const std::string &name, const std::string &vo, XrdThrottleNode *parent);
 
-void        StealShares(int uid, int &reqsize, int &reqops);
+void        Release(XrdThrottleNode *node);
 
 XrdOucTrace * m_trace;
 XrdSysError * m_log;
+XrdScheduler *m_sched;
 
 XrdSysCondVar m_compute_var;
 
@@ -105,14 +151,16 @@ float       m_bytes_per_second;
 float       m_ops_per_second;
 int         m_concurrency_limit;
 
-// Maintain the shares
+// The throttle hierarchy.  VO and user nodes are kept in the registry while
+// any file refers to them; the registry is only used at open and close.
+XrdThrottleNode m_root;
+std::atomic<unsigned> m_epoch;
+XrdSysMutex m_registry_mutex;
+std::unordered_map<std::string, XrdThrottleNode*> m_registry;
+
+// Maximum number of users listed in the statistics.
 static const
-int         m_max_users;
-std::vector<int> m_primary_bytes_shares;
-std::vector<int> m_secondary_bytes_shares;
-std::vector<int> m_primary_ops_shares;
-std::vector<int> m_secondary_ops_shares;
-int         m_last_round_allocation;
+int         m_max_stats_users;
 
 // Active IO counter
 int         m_io_counter;
@@ -156,9 +204,17 @@ void StopTimer()
          end_timer.tv_nsec += 1000000000;
       }
    }
+   long long wall_ns = 0;
+   if (m_user)
+   {
+      struct timespec wall_end;
+      clock_gettime(CLOCK_MONOTONIC, &wall_end);
+      wall_ns = (wall_end.tv_sec - m_wall.tv_sec) * 1000000000LL
+              + (wall_end.tv_nsec - m_wall.tv_nsec);
+   }
    if (m_timer.tv_nsec != -1)
    {
-      m_manager.StopIOTimer(end_timer);
+      m_manager.StopIOTimer(end_timer, m_user, wall_ns);
    }
    m_timer.tv_sec = 0;
    m_timer.tv_nsec = -1;
@@ -174,9 +230,11 @@ void StopTimer()
 
 protected:
 
-XrdThrottleTimer(XrdThrottleManager & manager) :
-   m_manager(manager)
+XrdThrottleTimer(XrdThrottleManager & manager, XrdThrottleNode *user=0) :
+   m_manager(manager),
+   m_user(user)
 {
+   if (m_user) clock_gettime(CLOCK_MONOTONIC, &m_wall);
 #if defined(__linux__) || defined(__GNU__) || (defined(__FreeBSD_kernel__) && defined(__GLIBC__))
    int retval = clock_gettime(clock_id, &m_timer);
 #else
@@ -191,7 +249,9 @@ XrdThrottleTimer(XrdThrottleManager & manager) :
 
 private:
 XrdThrottleManager &m_manager;
+XrdThrottleNode *m_user; // Accumulates the wall clock time, if not null
 struct timespec m_timer;
+struct timespec m_wall;
 
 static int clock_id;
 };
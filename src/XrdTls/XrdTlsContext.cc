@@ -639,6 +639,13 @@ XrdTlsContext::XrdTlsContext(const char *cert,  const char *key,
 //
    SSL_CTX_set_options(pImpl->ctx, sslOpts);
 
+// Let the kernel do record encryption if so wanted and it is able to do so.
+// OpenSSL silently falls back to user space encryption when it can't.
+//
+#ifdef SSL_OP_ENABLE_KTLS
+   if (opts & ktlsON) SSL_CTX_set_options(pImpl->ctx, SSL_OP_ENABLE_KTLS);
+#endif
+
 // Handle session re-negotiation automatically
 //
 // SSL_CTX_set_mode(pImpl->ctx, sslMode);
@@ -196,6 +196,8 @@ void            SetDefaultCiphers(const char *ciphers);
 //!                  crlRF   - Initial crl refresh interval in minutes.
 //!                  dnsok   - trust DNS when verifying hostname.
 //!                  hsto    - the handshake timeout value in seconds.
+//!                  ktlsON  - Use kernel TLS offload when the kernel and the
+//!                            negotiated cipher allow it.
 //!                  logVF   - Turn on verification failure logging.
 //!                  nopxy   - Do not allow proxy cert (normally allowed)
 //!                  servr   - This is a server-side context and x509 peer
@@ -233,6 +235,7 @@ static const uint64_t crlFC = 0x000000C000000000; //!< Full crl chain checking
 static const uint64_t crlRF = 0x000000003fff0000; //!< Init crl refresh in Min
 static const int      crlRS = 16;                 //!< Bits to shift   vdept
 static const uint64_t artON = 0x0000002000000000; //!< Auto retry Handshake
+static const uint64_t ktlsON= 0x0000001000000000; //!< Use kernel TLS offload
 
        XrdTlsContext(const char *cert=0,  const char *key=0,
                      const char *cadir=0, const char *cafile=0,
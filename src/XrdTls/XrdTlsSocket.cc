@@ -40,6 +40,13 @@
 
 #include <stdexcept>
 
+// Kernel TLS (and with it SSL_sendfile) is available starting with OpenSSL 3
+// provided the library was not built without it.
+//
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_NO_KTLS)
+#define XRDTLS_KTLS 1
+#endif
+
 /******************************************************************************/
 /*                      X r d T l s S o c k e t I m p l                       */
 /******************************************************************************/
@@ -523,6 +530,23 @@ const char *XrdTlsSocket::Init( XrdTlsContext &ctx, int sfd,
    return 0;
 }
 
+/******************************************************************************/
+/*                                  k T L S                                   */
+/******************************************************************************/
+
+bool XrdTlsSocket::kTLS()
+{
+#ifdef XRDTLS_KTLS
+// Once the handshake is done the kernel either has the send keys or not and
+// this never changes, so there is no need to serialize this call.
+//
+   if (!pImpl->ssl || pImpl->fatal) return false;
+   return BIO_get_ktls_send(SSL_get_wbio(pImpl->ssl)) != 0;
+#else
+   return false;
+#endif
+}
+
 /******************************************************************************/
 /*                                  P e e k                                   */
 /******************************************************************************/
@@ -679,6 +703,72 @@ XrdTls::RC XrdTlsSocket::Read( char *buffer, size_t size, int &bytesRead )
     return XrdTls::TLS_SYS_Error;
   }
 
+/******************************************************************************/
+/*                              S e n d F i l e                               */
+/******************************************************************************/
+
+XrdTls::RC XrdTlsSocket::SendFile( int fd, off_t offset, size_t size,
+                                   int &bytesOut )
+{
+#ifdef XRDTLS_KTLS
+    EPNAME("SendFile");
+    XrdSysMutexHelper mHelper;
+    int ssler;
+
+    //------------------------------------------------------------------------
+    // Serialize call if need be
+    //------------------------------------------------------------------------
+
+    if (pImpl->isSerial) mHelper.Lock(&(pImpl->sslMutex));
+
+    //------------------------------------------------------------------------
+    // Return an error if this socket received a fatal error as OpenSSL will
+    // SEGV when called after such an error.
+    //------------------------------------------------------------------------
+
+    if (pImpl->fatal) return (XrdTls::RC)pImpl->fatal;
+
+    //------------------------------------------------------------------------
+    // SSL_sendfile() only works when the kernel does the encryption. Since
+    // it cannot negotiate a session the handshake must also be complete.
+    //------------------------------------------------------------------------
+
+    if (NeedHS() || !BIO_get_ktls_send(SSL_get_wbio(pImpl->ssl)))
+       {errno = ENOTSUP;
+        return XrdTls::TLS_SYS_Error;
+       }
+
+ do{ossl_ssize_t rc = SSL_sendfile( pImpl->ssl, fd, offset, size, 0 );
+
+    if (rc > 0)
+      {bytesOut = (int)rc;
+       DBG_SIO(rc <<" out of " <<size <<" bytes.");
+       return XrdTls::TLS_AOK;
+      }
+
+    // We have a potential error. The handling is the same as for Write().
+    //
+    ssler = Diagnose("TLS_SendFile", (int)rc, XrdTls::dbgSIO);
+    if (ssler == SSL_ERROR_NONE)
+       {bytesOut = 0;
+        DBG_SIO(rc <<" out of " <<size <<" bytes.");
+        return XrdTls::TLS_AOK;
+       }
+
+    if (ssler != SSL_ERROR_WANT_READ && ssler != SSL_ERROR_WANT_WRITE)
+       return XrdTls::ssl2RC(ssler);
+
+    if (!(pImpl->cAttr & wBlocking)) return XrdTls::ssl2RC(ssler);
+
+   } while(Wait4OK(ssler == SSL_ERROR_WANT_READ));
+
+    return XrdTls::TLS_SYS_Error;
+#else
+    errno = ENOTSUP;
+    return XrdTls::TLS_SYS_Error;
+#endif
+}
+
 /******************************************************************************/
 /*                            S e t T r a c e I D                             */
 /******************************************************************************/
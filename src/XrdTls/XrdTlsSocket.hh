@@ -19,6 +19,7 @@
 //------------------------------------------------------------------------------
 
 #include <string>
+#include <sys/types.h>
 
 #include "XrdTls/XrdTls.hh"
 
@@ -205,6 +206,24 @@ XrdTlsPeerCerts *getCerts(bool ver=true);
 
   XrdTls::RC Read( char *buffer, size_t size, int &bytesRead );
 
+//------------------------------------------------------------------------
+//! Send file data over the TLS connection. This is only possible when the
+//! kernel does the record encryption (see kTLS()); the data then moves
+//! from the page cache to the socket without being copied to user space.
+//!
+//! @param  fd         - The file descriptor of the file holding the data.
+//! @param  offset     - The offset in the file where the data starts.
+//! @param  size       - The number of bytes to send.
+//! @param  bytesOut   - Number of bytes actually sent, if successful.
+//!
+//! @return TLS_AOK if the operation was successful; otherwise the appropraite
+//!                 return code indicating the problem. TLS_SYS_Error with
+//!                 errno set to ENOTSUP is returned when kernel TLS is not
+//!                 in effect for this connection.
+//------------------------------------------------------------------------
+
+  XrdTls::RC SendFile( int fd, off_t offset, size_t size, int &bytesOut );
+
 //------------------------------------------------------------------------
 //! Set the trace identifier (used when it's updated).
 //!
@@ -246,6 +265,13 @@ XrdTlsPeerCerts *getCerts(bool ver=true);
 
   bool NeedHandShake();
 
+//------------------------------------------------------------------------
+//! @return  :  true if the kernel encrypts outgoing records (i.e. kernel
+//!             TLS offload is active for sending), false otherwise.
+//------------------------------------------------------------------------
+
+  bool kTLS();
+
 //------------------------------------------------------------------------
 //! @return The TLS version number being used.
 //------------------------------------------------------------------------
@@ -64,6 +64,11 @@ bool TPCHandler::Configure(const char *configfn, XrdOucEnv *myEnv)
             } else {
                 m_first_timeout = 2*m_timeout;
             }
+        } else if (!strcmp("tpc.loopthreads", val)) {
+            if (!(val = Config.GetWord())) {
+                m_log.Emsg("Config","tpc.loopthreads value not specified.");  return false;
+            }
+            if (XrdOuca2x::a2i(m_log, "event loop threads", val, &m_loop_threads, 1, 256)) return false;
         }
     }
     Config.Close();
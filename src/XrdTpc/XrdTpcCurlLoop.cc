@@ -0,0 +1,436 @@
+/**
+ * Implementation of the shared libcurl event loop.
+ */
+
+#include "XrdTpcCurlLoop.hh"
+
+#include "XrdSys/XrdSysError.hh"
+#include "XrdSys/XrdSysFD.hh"
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <sstream>
+
+using namespace TPC;
+
+namespace {
+long long NowMS()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
+/******************************************************************************/
+/*                       C u r l L o o p : : W o r k e r                      */
+/******************************************************************************/
+
+// A single event-loop thread owning one multi-handle.  The multi-handle is
+// only ever touched from the worker thread; other threads hand it work
+// through the command queue and wake it up via a pipe.
+class CurlLoop::Worker {
+public:
+    Worker(XrdSysError &log) :
+        m_load(0),
+        m_log(log),
+        m_multi(NULL),
+        m_stop(false),
+        m_deadline(-1)
+    {
+        m_pipe[0] = m_pipe[1] = -1;
+    }
+
+    ~Worker()
+    {
+        if (m_multi) {
+            Command cmd(Command::Stop);
+            Submit(cmd);
+            XrdSysThread::Wait(m_tid);
+            curl_multi_cleanup(m_multi);
+        }
+        if (m_pipe[0] >= 0) {close(m_pipe[0]);}
+        if (m_pipe[1] >= 0) {close(m_pipe[1]);}
+    }
+
+    bool Start()
+    {
+        if (XrdSysFD_Pipe(m_pipe)) {
+            m_log.Emsg("CurlLoop", errno, "create event loop pipe");
+            return false;
+        }
+        fcntl(m_pipe[0], F_SETFL, fcntl(m_pipe[0], F_GETFL) | O_NONBLOCK);
+        fcntl(m_pipe[1], F_SETFL, fcntl(m_pipe[1], F_GETFL) | O_NONBLOCK);
+
+        if (!(m_multi = curl_multi_init())) {
+            m_log.Emsg("CurlLoop", "Failed to initialize a libcurl multi-handle");
+            return false;
+        }
+        curl_multi_setopt(m_multi, CURLMOPT_SOCKETFUNCTION, &Worker::SocketCB);
+        curl_multi_setopt(m_multi, CURLMOPT_SOCKETDATA, this);
+        curl_multi_setopt(m_multi, CURLMOPT_TIMERFUNCTION, &Worker::TimerCB);
+        curl_multi_setopt(m_multi, CURLMOPT_TIMERDATA, this);
+#ifdef USE_PIPELINING
+        curl_multi_setopt(m_multi, CURLMOPT_PIPELINING, 1);
+#endif
+
+        int rc;
+        if ((rc = XrdSysThread::Run(&m_tid, &Worker::Launch, this,
+                                    XRDSYSTHREAD_HOLD, "TPC curl event loop"))) {
+            m_log.Emsg("CurlLoop", rc, "create event loop thread");
+            curl_multi_cleanup(m_multi);
+            m_multi = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    CURLMcode Add(CURL *curl, Waiter *waiter)
+    {
+        Command cmd(Command::Add, curl, waiter);
+        Submit(cmd);
+        return cmd.m_result;
+    }
+
+    void Remove(CURL *curl)
+    {
+        Command cmd(Command::Remove, curl);
+        Submit(cmd);
+    }
+
+    void Resume(CURL *curl)
+    {
+        Command cmd(Command::Resume, curl);
+        Submit(cmd);
+    }
+
+    // Number of transfers currently bound to this worker.
+    std::atomic<int> m_load;
+
+private:
+    struct Command {
+        enum Op {Add, Remove, Resume, Stop};
+
+        Command(Op op, CURL *curl=NULL, Waiter *waiter=NULL) :
+            m_op(op), m_curl(curl), m_waiter(waiter), m_result(CURLM_OK), m_done(0)
+        {}
+
+        Op               m_op;
+        CURL            *m_curl;
+        Waiter          *m_waiter;
+        CURLMcode        m_result;
+        XrdSysSemaphore  m_done;
+    };
+
+    // Queue a command for the worker thread and wait for it to be processed.
+    void Submit(Command &cmd)
+    {
+        m_cmd_mutex.Lock();
+        m_cmds.push_back(&cmd);
+        m_cmd_mutex.UnLock();
+        char c = 0;
+        // A full pipe means a wakeup is already pending.
+        while (write(m_pipe[1], &c, 1) < 0 && errno == EINTR) {}
+        cmd.m_done.Wait();
+    }
+
+    static void *Launch(void *arg)
+    {
+        static_cast<Worker *>(arg)->Run();
+        return NULL;
+    }
+
+    static int SocketCB(CURL *, curl_socket_t s, int what, void *userp, void *)
+    {
+        Worker *me = static_cast<Worker *>(userp);
+        if (what == CURL_POLL_REMOVE) {me->m_sockets.erase(s);}
+        else {me->m_sockets[s] = what;}
+        return 0;
+    }
+
+    static int TimerCB(CURLM *, long timeout_ms, void *userp)
+    {
+        Worker *me = static_cast<Worker *>(userp);
+        me->m_deadline = (timeout_ms < 0) ? -1 : NowMS() + timeout_ms;
+        return 0;
+    }
+
+    void Run()
+    {
+        std::vector<struct pollfd> fds;
+        while (!m_stop) {
+            fds.resize(1 + m_sockets.size());
+            fds[0].fd = m_pipe[0];
+            fds[0].events = POLLIN;
+            fds[0].revents = 0;
+            size_t idx = 1;
+            for (std::map<curl_socket_t, int>::const_iterator it = m_sockets.begin();
+                 it != m_sockets.end();
+                 ++it, ++idx) {
+                fds[idx].fd = it->first;
+                fds[idx].events = ((it->second & CURL_POLL_IN) ? POLLIN : 0) |
+                                  ((it->second & CURL_POLL_OUT) ? POLLOUT : 0);
+                fds[idx].revents = 0;
+            }
+
+            int timeout = -1;
+            if (m_deadline >= 0) {
+                long long remaining = m_deadline - NowMS();
+                timeout = remaining > 0 ? static_cast<int>(std::min(remaining, 60000LL)) : 0;
+            }
+
+            int rc = poll(&fds[0], fds.size(), timeout);
+            if (rc < 0 && errno != EINTR) {
+                m_log.Emsg("CurlLoop", errno, "poll transfer sockets");
+            }
+
+            int running;
+            for (idx = 1; rc > 0 && idx < fds.size(); idx++) {
+                if (!fds[idx].revents) {continue;}
+                // An earlier action may have closed this socket.
+                if (m_sockets.find(fds[idx].fd) == m_sockets.end()) {continue;}
+                int ev = 0;
+                if (fds[idx].revents & (POLLIN | POLLHUP)) {ev |= CURL_CSELECT_IN;}
+                if (fds[idx].revents & POLLOUT) {ev |= CURL_CSELECT_OUT;}
+                if (fds[idx].revents & (POLLERR | POLLNVAL)) {ev |= CURL_CSELECT_ERR;}
+                Action(fds[idx].fd, ev, running);
+            }
+            if (m_deadline >= 0 && NowMS() >= m_deadline) {
+                m_deadline = -1;
+                Action(CURL_SOCKET_TIMEOUT, 0, running);
+            }
+            Harvest();
+
+            if (rc > 0 && fds[0].revents) {
+                char buf[64];
+                while (read(m_pipe[0], buf, sizeof(buf)) > 0) {}
+                RunCommands();
+                // Resuming a handle may have completed it.
+                Harvest();
+            }
+        }
+    }
+
+    void Action(curl_socket_t s, int ev, int &running)
+    {
+        CURLMcode mres = curl_multi_socket_action(m_multi, s, ev, &running);
+        if (mres != CURLM_OK) {
+            std::stringstream ss;
+            ss << "Internal libcurl multi-handle error: " << curl_multi_strerror(mres);
+            m_log.Emsg("CurlLoop", ss.str().c_str());
+        }
+    }
+
+    // Hand all completed transfers back to their waiters.
+    void Harvest()
+    {
+        CURLMsg *msg;
+        int msgq = 0;
+        while ((msg = curl_multi_info_read(m_multi, &msgq))) {
+            if (msg->msg != CURLMSG_DONE) {continue;}
+            CURL *curl = msg->easy_handle;
+            CURLcode res = msg->data.result;
+            curl_multi_remove_handle(m_multi, curl);
+            std::map<CURL *, Waiter *>::iterator it = m_owners.find(curl);
+            if (it != m_owners.end()) {
+                it->second->Post(curl, res);
+                m_owners.erase(it);
+            }
+        }
+    }
+
+    void RunCommands()
+    {
+        std::vector<Command *> cmds;
+        m_cmd_mutex.Lock();
+        cmds.swap(m_cmds);
+        m_cmd_mutex.UnLock();
+
+        for (std::vector<Command *>::iterator it = cmds.begin(); it != cmds.end(); ++it) {
+            Command &cmd = **it;
+            switch (cmd.m_op) {
+            case Command::Add:
+                // The callbacks find the waiter to wake through the handle.
+                curl_easy_setopt(cmd.m_curl, CURLOPT_PRIVATE, cmd.m_waiter);
+                if ((cmd.m_result = curl_multi_add_handle(m_multi, cmd.m_curl)) == CURLM_OK) {
+                    m_owners[cmd.m_curl] = cmd.m_waiter;
+                }
+                break;
+            case Command::Remove:
+                if (m_owners.erase(cmd.m_curl)) {
+                    curl_multi_remove_handle(m_multi, cmd.m_curl);
+                }
+                break;
+            case Command::Resume:
+                // libcurl wants a handle unpaused from the thread driving it.
+                if (m_owners.count(cmd.m_curl)) {
+                    curl_easy_pause(cmd.m_curl, CURLPAUSE_CONT);
+                }
+                break;
+            case Command::Stop:
+                for (std::map<CURL *, Waiter *>::iterator oit = m_owners.begin();
+                     oit != m_owners.end();
+                     ++oit) {
+                    curl_multi_remove_handle(m_multi, oit->first);
+                    oit->second->Post(oit->first, CURLE_ABORTED_BY_CALLBACK);
+                }
+                m_owners.clear();
+                m_stop = true;
+                break;
+            }
+            cmd.m_done.Post();
+        }
+    }
+
+    XrdSysError                      &m_log;
+    CURLM                            *m_multi;
+    pthread_t                         m_tid;
+    int                               m_pipe[2];
+    bool                              m_stop;
+    XrdSysMutex                       m_cmd_mutex;
+    std::vector<Command *>            m_cmds;
+
+    // The following are only accessed from the worker thread.
+    long long                         m_deadline;  // Next libcurl timeout (ms) or -1.
+    std::map<curl_socket_t, int>      m_sockets;
+    std::map<CURL *, Waiter *>        m_owners;
+};
+
+/******************************************************************************/
+/*                       C u r l L o o p : : W a i t e r                      */
+/******************************************************************************/
+
+CurlLoop::Waiter::Waiter(CurlLoop &loop) :
+    m_worker(loop.Assign()),
+    m_cond(0),
+    m_woken(false)
+{
+}
+
+CurlLoop::Waiter::~Waiter()
+{
+    for (std::vector<CURL *>::iterator it = m_handles.begin(); it != m_handles.end(); ++it) {
+        m_worker.Remove(*it);
+    }
+    m_worker.m_load--;
+}
+
+CURLMcode CurlLoop::Waiter::Add(CURL *curl)
+{
+    CURLMcode mres = m_worker.Add(curl, this);
+    if (mres == CURLM_OK) {m_handles.push_back(curl);}
+    return mres;
+}
+
+void CurlLoop::Waiter::Remove(CURL *curl)
+{
+    std::vector<CURL *>::iterator it = std::find(m_handles.begin(), m_handles.end(), curl);
+    if (it == m_handles.end()) {return;}
+    m_handles.erase(it);
+    m_worker.Remove(curl);
+
+    // Drop any completion that raced with the removal.
+    XrdSysCondVarHelper lock(m_cond);
+    for (std::vector<Result>::iterator rit = m_done.begin(); rit != m_done.end(); ++rit) {
+        if (rit->first == curl) {
+            m_done.erase(rit);
+            break;
+        }
+    }
+}
+
+void CurlLoop::Waiter::Resume(CURL *curl)
+{
+    if (std::find(m_handles.begin(), m_handles.end(), curl) != m_handles.end()) {
+        m_worker.Resume(curl);
+    }
+}
+
+bool CurlLoop::Waiter::Wait(time_t deadline, std::vector<Result> &done)
+{
+    m_cond.Lock();
+    while (m_done.empty() && !m_woken) {
+        time_t now = time(NULL);
+        if (now >= deadline) {
+            m_cond.UnLock();
+            return false;
+        }
+        m_cond.Wait(static_cast<int>(deadline - now));
+    }
+    for (std::vector<Result>::const_iterator it = m_done.begin(); it != m_done.end(); ++it) {
+        m_handles.erase(std::remove(m_handles.begin(), m_handles.end(), it->first),
+                        m_handles.end());
+        done.push_back(*it);
+    }
+    m_done.clear();
+    m_woken = false;
+    m_cond.UnLock();
+    return true;
+}
+
+void CurlLoop::Waiter::Wake(CURL *curl)
+{
+    char *ptr = NULL;
+    if (curl_easy_getinfo(curl, CURLINFO_PRIVATE, &ptr) != CURLE_OK || !ptr) {return;}
+    Waiter *me = reinterpret_cast<Waiter *>(ptr);
+    XrdSysCondVarHelper lock(me->m_cond);
+    me->m_woken = true;
+    me->m_cond.Signal();
+}
+
+void CurlLoop::Waiter::Post(CURL *curl, CURLcode result)
+{
+    XrdSysCondVarHelper lock(m_cond);
+    m_done.push_back(Result(curl, result));
+    m_cond.Signal();
+}
+
+/******************************************************************************/
+/*                              C u r l L o o p                               */
+/******************************************************************************/
+
+CurlLoop::CurlLoop(XrdSysError &log) :
+    m_log(log)
+{
+}
+
+CurlLoop::~CurlLoop()
+{
+    for (std::vector<Worker *>::iterator it = m_workers.begin(); it != m_workers.end(); ++it) {
+        delete *it;
+    }
+}
+
+bool CurlLoop::Start(unsigned threads)
+{
+    XrdSysMutexHelper lock(m_mutex);
+    if (!threads) {threads = 1;}
+    while (m_workers.size() < threads) {
+        Worker *worker = new Worker(m_log);
+        if (!worker->Start()) {
+            delete worker;
+            return false;
+        }
+        m_workers.push_back(worker);
+    }
+    return true;
+}
+
+// Bind a new transfer to the least-loaded worker.
+CurlLoop::Worker &CurlLoop::Assign()
+{
+    XrdSysMutexHelper lock(m_mutex);
+    Worker *best = m_workers[0];
+    for (std::vector<Worker *>::const_iterator it = m_workers.begin() + 1;
+         it != m_workers.end();
+         ++it) {
+        if ((*it)->m_load < best->m_load) {best = *it;}
+    }
+    best->m_load++;
+    return *best;
+}
@@ -0,0 +1,112 @@
+/**
+ * A shared, multi-threaded libcurl event loop.
+ *
+ * Rather than each transfer driving a private multi-handle with its own
+ * curl_multi_perform / curl_multi_wait loop, all transfers are multiplexed
+ * over a small, fixed set of worker threads.  Each worker owns one
+ * multi-handle and drives it with curl_multi_socket_action, using the
+ * socket and timer callbacks to learn which descriptors to poll and when
+ * the next timeout is due.  The worker therefore does all network I/O for
+ * its transfers, including the libcurl read/write callbacks.
+ *
+ * Only the curl side is shared: the thread handling the HTTP request still
+ * belongs to its transfer until the transfer is over, as XrdHttp requires
+ * the whole chunked response to be sent from within ProcessReq.  That
+ * thread also does all of the transfer's disk I/O; the libcurl callbacks
+ * merely hand data to and from it, pausing the handle (and waking the
+ * request thread) when it falls behind, so that a slow filesystem never
+ * stalls the other transfers on the same worker.
+ *
+ * A transfer binds a Waiter to one worker; every handle added through that
+ * waiter runs on the same thread, so the callbacks of one transfer are never
+ * concurrent with each other.  The request thread sleeps on the waiter until
+ * a handle completes, a callback asks for service or it is time to send the
+ * next performance marker to the client.
+ */
+
+#ifndef __XRDTPC_CURLLOOP_HH__
+#define __XRDTPC_CURLLOOP_HH__
+
+#include <ctime>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include "XrdSys/XrdSysPthread.hh"
+
+class XrdSysError;
+
+namespace TPC {
+
+class CurlLoop {
+    class Worker;
+
+public:
+    // A handle that has finished, along with the result of its transfer.
+    typedef std::pair<CURL *, CURLcode> Result;
+
+    class Waiter {
+    public:
+        Waiter(CurlLoop &loop);
+
+        // Any handle still running in the loop is removed.
+        ~Waiter();
+
+        // Start running the given handle on the loop.  On failure, the
+        // libcurl error is returned and the handle is left untouched.
+        CURLMcode Add(CURL *curl);
+
+        // Stop running the given handle; after this returns, no further
+        // libcurl callbacks will be made for it.  Completed handles are
+        // already removed from the loop, so this is only needed when a
+        // transfer is abandoned.
+        void Remove(CURL *curl);
+
+        // Resume a handle that a libcurl callback has paused; a no-op if
+        // the handle is no longer running.
+        void Resume(CURL *curl);
+
+        // Wait until at least one handle has completed, Wake() has been
+        // called or the deadline has passed.  Completed handles are appended
+        // to `done`; returns false if the deadline passed first.
+        bool Wait(time_t deadline, std::vector<Result> &done);
+
+        // Wake up the thread waiting on the waiter the given handle was
+        // added through.  Only to be called from within a libcurl callback.
+        static void Wake(CURL *curl);
+
+        Waiter(const Waiter &) = delete;
+
+    private:
+        friend class Worker;
+
+        void Post(CURL *curl, CURLcode result);
+
+        Worker              &m_worker;
+        XrdSysCondVar        m_cond;
+        std::vector<Result>  m_done;
+        std::vector<CURL *>  m_handles;  // Handles added and not yet completed.
+        bool                 m_woken;    // Wake() called since the last Wait().
+    };
+
+    CurlLoop(XrdSysError &log);
+    ~CurlLoop();
+
+    // Start the given number of worker threads; returns false on failure.
+    bool Start(unsigned threads);
+
+    CurlLoop(const CurlLoop &) = delete;
+
+private:
+    Worker &Assign();
+
+    XrdSysError           &m_log;
+    XrdSysMutex            m_mutex;
+    std::vector<Worker *>  m_workers;
+};
+
+}
+
+#endif
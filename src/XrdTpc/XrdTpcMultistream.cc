@@ -6,7 +6,7 @@
 
 #include "XrdTpcTPC.hh"
 #include "XrdTpcState.hh"
-#include "XrdTpcCurlMulti.hh"
+#include "XrdTpcCurlLoop.hh"
 
 #include "XrdSys/XrdSysError.hh"
 
@@ -31,17 +31,16 @@ public:
 namespace {
 class MultiCurlHandler {
 public:
-    MultiCurlHandler(std::vector<State*> &states, XrdSysError &log) :
-        m_handle(curl_multi_init()),
+    MultiCurlHandler(std::vector<State*> &states, CurlLoop::Waiter &waiter,
+                     size_t max_active, XrdSysError &log) :
+        m_waiter(waiter),
+        m_max_active(max_active),
         m_states(states),
         m_log(log),
         m_bytes_transferred(0),
         m_error_code(0),
         m_status_code(0)
     {
-        if (m_handle == NULL) {
-            throw CurlHandlerSetupError("Failed to initialize a libcurl multi-handle");
-        }
         m_avail_handles.reserve(states.size());
         m_active_handles.reserve(states.size());
         for (std::vector<State*>::const_iterator state_iter = states.begin();
@@ -53,11 +52,10 @@ public:
 
     ~MultiCurlHandler()
     {
-        if (!m_handle) {return;}
         for (std::vector<CURL *>::const_iterator it = m_active_handles.begin();
              it != m_active_handles.end();
              it++) {
-            curl_multi_remove_handle(m_handle, *it);
+            m_waiter.Remove(*it);
             curl_easy_cleanup(*it);
         }
         for (std::vector<CURL *>::const_iterator it = m_avail_handles.begin();
@@ -65,25 +63,19 @@ public:
              it++) {
             curl_easy_cleanup(*it);
         }
-        curl_multi_cleanup(m_handle);
     }
 
     MultiCurlHandler(const MultiCurlHandler &) = delete;
 
-    CURLM *Get() const {return m_handle;}
-
+    // Account for a transfer the event loop has completed (and already
+    // removed from its multi-handle).
     void FinishCurlXfer(CURL *curl) {
-        CURLMcode mres = curl_multi_remove_handle(m_handle, curl);
-        if (mres) {
-            std::stringstream ss;
-            ss << "Failed to remove transfer from set: "
-               << curl_multi_strerror(mres);
-            throw std::runtime_error(ss.str());
-        }
         for (std::vector<State*>::iterator state_iter = m_states.begin();
              state_iter != m_states.end();
              state_iter++) {
             if (curl == (*state_iter)->GetHandle()) {
+                // Write out whatever the handle staged before it completed.
+                (*state_iter)->Service(m_waiter);
                 m_bytes_transferred += (*state_iter)->BytesTransferred();
                 int error_code = (*state_iter)->GetErrorCode();
                 if (error_code && !m_error_code) {
@@ -115,6 +107,7 @@ public:
                          int &running_handles) {
          bool started_new_xfer = false;
          do {
+             if (running_handles >= static_cast<int>(m_max_active)) {return current_offset;}
              size_t xfer_size = std::min(content_length - current_offset, static_cast<off_t>(block_size));
              if (xfer_size == 0) {return current_offset;}
              if (!(started_new_xfer = StartTransfer(current_offset, xfer_size))) {
@@ -133,6 +126,19 @@ public:
         return current_offset;
     }
 
+    // Do the disk I/O the running handles are waiting for.
+    void Service() {
+        for (std::vector<State*>::iterator state_it = m_states.begin();
+             state_it != m_states.end();
+             state_it++)
+        {
+            if (std::find(m_active_handles.begin(), m_active_handles.end(),
+                          (*state_it)->GetHandle()) != m_active_handles.end()) {
+                (*state_it)->Service(m_waiter);
+            }
+        }
+    }
+
     int Flush() {
         int last_error = 0;
         for (std::vector<State*>::iterator state_it = m_states.begin();
@@ -193,7 +199,7 @@ private:
         CURL *curl = state.GetHandle();
         m_active_handles.push_back(curl);
         CURLMcode mres;
-        mres = curl_multi_add_handle(m_handle, curl);
+        mres = m_waiter.Add(curl);
         if (mres) {
             std::stringstream ss;
             ss << "Failed to add transfer to libcurl multi-handle"
@@ -249,7 +255,8 @@ private:
         return available_buffers > 0;
     }
 
-    CURLM *m_handle;
+    CurlLoop::Waiter    &m_waiter;
+    size_t               m_max_active;
     std::vector<CURL *> m_avail_handles;
     std::vector<CURL *> m_active_handles;
     std::vector<State*> &m_states;
@@ -285,16 +292,23 @@ int TPCHandler::RunCurlWithStreamsImpl(XrdHttpExtReq &req, State &state,
         handles.push_back(handles[0]->Duplicate());
     }
 
-    // Create the multi-handle and add in the current transfer to it.
-    MultiCurlHandler mch(handles, m_log);
-    CURLM *multi_handle = mch.Get();
-
 #ifdef USE_PIPELINING
-    curl_multi_setopt(multi_handle, CURLMOPT_PIPELINING, 1);
-    curl_multi_setopt(multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, streams);
+    // The transfer's private multi-handle used to be capped at one connection
+    // per stream (CURLMOPT_MAX_HOST_CONNECTIONS), the other handles queueing
+    // behind those connections; since 7.62 libcurl no longer pipelines them.
+    // The shared multi-handle can only cap connections per host across all
+    // transfers, so keep the limit by having one request per stream in flight.
+    size_t max_active = streams;
+#else
+    size_t max_active = concurrency;
 #endif
 
-    // Start response to client prior to the first call to curl_multi_perform
+    // Bind the transfer to the shared event loop; all of its handles run
+    // on the same loop thread.
+    CurlLoop::Waiter waiter(*m_loop);
+    MultiCurlHandler mch(handles, waiter, max_active, m_log);
+
+    // Start response to client prior to starting any of the transfers
     int retval = req.StartChunkedResp(201, "Created", "Content-Type: text/plain");
     if (retval) {
         logTransferEvent(LogMask::Error, rec, "RESPONSE_FAIL",
@@ -309,15 +323,16 @@ int TPCHandler::RunCurlWithStreamsImpl(XrdHttpExtReq &req, State &state,
     int running_handles = 0;
     current_offset = mch.StartTransfers(current_offset, content_size, m_block_size, running_handles);
 
-    // Transfer loop: use curl to actually run the transfer, but periodically
-    // interrupt things to send back performance updates to the client.
+    // Transfer loop: the event loop runs the transfers while we write out
+    // their data, and periodically wake up to send back performance updates
+    // to the client.
     time_t last_marker = 0;
     // Track the time since the transfer last made progress
     off_t last_advance_bytes = 0;
     time_t last_advance_time = time(NULL);
     time_t transfer_start = last_advance_time;
     CURLcode res = static_cast<CURLcode>(-1);
-    CURLMcode mres = CURLM_OK;
+    std::vector<CurlLoop::Result> done;
     do {
         time_t now = time(NULL);
         time_t next_marker = last_marker + m_marker_period;
@@ -340,39 +355,30 @@ int TPCHandler::RunCurlWithStreamsImpl(XrdHttpExtReq &req, State &state,
                 break;
             }
             last_marker = now;
+            next_marker = now + m_marker_period;
         }
 
-        mres = curl_multi_perform(multi_handle, &running_handles);
-        if (mres == CURLM_CALL_MULTI_PERFORM) {
-            // curl_multi_perform should be called again immediately.  On newer
-            // versions of curl, this is no longer used.
-            continue;
-        } else if (mres != CURLM_OK) {
-            break;
+        // Sleep until a transfer completes, a handle needs its data written
+        // out or the next marker is due.
+        done.clear();
+        waiter.Wait(next_marker, done);
+        mch.Service();
+        for (std::vector<CurlLoop::Result>::const_iterator it = done.begin();
+             it != done.end();
+             ++it) {
+            mch.FinishCurlXfer(it->first);
+            running_handles--;
+            // If any requests fail, cut off the entire transfer.
+            if (res == CURLE_OK || res == static_cast<CURLcode>(-1))
+                res = it->second;
         }
-
-        // Harvest any messages, looking for CURLMSG_DONE.
-        CURLMsg *msg;
-        do {
-            int msgq = 0;
-            msg = curl_multi_info_read(multi_handle, &msgq);
-            if (msg && (msg->msg == CURLMSG_DONE)) {
-                CURL *easy_handle = msg->easy_handle;
-                mch.FinishCurlXfer(easy_handle);
-                res = msg->data.result;
-                // If any requests fail, cut off the entire transfer.
-                if (res != CURLE_OK) {
-                    break;
-                }
-            }
-        } while (msg);
         if (res != static_cast<CURLcode>(-1) && res != CURLE_OK) {
             logTransferEvent(LogMask::Debug, rec, "MULTISTREAM_CURL_FAILURE",
                 "Breaking loop due to failed curl transfer");
             break;
         }
 
-        if (running_handles < static_cast<int>(concurrency)) {
+        if (running_handles < static_cast<int>(max_active)) {
             // Issue new transfers if there is still pending work to do.
             // Otherwise, continue running until there are no handles left.
             if (current_offset != content_size) {
@@ -391,45 +397,19 @@ int TPCHandler::RunCurlWithStreamsImpl(XrdHttpExtReq &req, State &state,
                 break;
             }
         }
-
-        int64_t max_sleep_time = next_marker - time(NULL);
-        if (max_sleep_time <= 0) {
-            continue;
-        }
-        int fd_count;
-#ifdef HAVE_CURL_MULTI_WAIT
-        mres = curl_multi_wait(multi_handle, NULL, 0, max_sleep_time*1000,
-                               &fd_count);
-#else
-        mres = curl_multi_wait_impl(multi_handle, max_sleep_time*1000,
-                                    &fd_count);
-#endif
-        if (mres != CURLM_OK) {
-            break;
-        }
     } while (running_handles);
 
-    if (mres != CURLM_OK) {
-        std::stringstream ss;
-        ss << "Internal libcurl multi-handle error: "
-           << curl_multi_strerror(mres);
-        logTransferEvent(LogMask::Error, rec, "MULTISTREAM_ERROR", ss.str());
-        throw std::runtime_error(ss.str());
+    // Harvest any transfers that completed since the last wakeup.
+    done.clear();
+    waiter.Wait(0, done);
+    for (std::vector<CurlLoop::Result>::const_iterator it = done.begin();
+         it != done.end();
+         ++it) {
+        mch.FinishCurlXfer(it->first);
+        if (res == CURLE_OK || res == static_cast<CURLcode>(-1))
+            res = it->second;  // Transfer result will be examined below.
     }
 
-    // Harvest any messages, looking for CURLMSG_DONE.
-    CURLMsg *msg;
-    do {
-        int msgq = 0;
-        msg = curl_multi_info_read(multi_handle, &msgq);
-        if (msg && (msg->msg == CURLMSG_DONE)) {
-            CURL *easy_handle = msg->easy_handle;
-            mch.FinishCurlXfer(easy_handle);
-            if (res == CURLE_OK || res == static_cast<CURLcode>(-1))
-                res = msg->data.result;  // Transfer result will be examined below.
-        }
-    } while (msg);
-
     if (!state.GetErrorCode() && res == static_cast<CURLcode>(-1)) { // No transfers returned?!?
         logTransferEvent(LogMask::Error, rec, "MULTISTREAM_ERROR",
             "Internal state error in libcurl");
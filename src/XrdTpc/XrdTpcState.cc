@@ -1,5 +1,6 @@
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 
@@ -29,10 +30,10 @@ void State::Move(State &other)
     m_push = other.m_push;
     m_recv_status_line = other.m_recv_status_line;
     m_recv_all_headers = other.m_recv_all_headers;
-    m_offset = other.m_offset;
+    m_offset = other.m_offset.load();
     m_start_offset = other.m_start_offset;
     m_status_code = other.m_status_code;
-    m_content_length = other.m_content_length;
+    m_content_length = other.m_content_length.load();
     m_stream = other.m_stream;
     m_curl = other.m_curl;
     m_headers = other.m_headers;
@@ -113,6 +114,13 @@ void State::ResetAfterRequest() {
     m_content_length = -1;
     m_recv_all_headers = false;
     m_recv_status_line = false;
+    XrdSysMutexHelper lock(m_stage_mutex);
+    m_stage.clear();
+    m_stage_pos = 0;
+    m_read_offset = 0;
+    m_paused = false;
+    m_woken = false;
+    m_eof = false;
 }
 
 size_t State::HeaderCB(char *buffer, size_t size, size_t nitems, void *userdata)
@@ -141,6 +149,7 @@ int State::Header(const std::string &header) {
             return 0;
         }
         m_recv_status_line = true;
+        UpdateConnectionDescription();
     } else if (header.size() == 0 || header == "\n" || header == "\r\n") {
         m_recv_all_headers = true;
     }
@@ -188,15 +197,94 @@ size_t State::WriteCB(void *buffer, size_t size, size_t nitems, void *userdata)
     return obj->Write(static_cast<char*>(buffer), size*nitems);
 }
 
+// Runs on the event loop; the data is only staged here and written out by
+// the request thread.  Once the stage is full, the handle is paused until the
+// request thread has made room.
 ssize_t State::Write(char *buffer, size_t size) {
-    ssize_t retval = m_stream->Write(m_start_offset + m_offset, buffer, size, false);
+    XrdSysMutexHelper lock(m_stage_mutex);
+    if (m_error_code) {
+        return -1;
+    }
+    if (!m_stage.empty() && m_stage.size() + size > m_stage_size) {
+        m_paused = true;
+        m_woken = true;
+        lock.UnLock();
+        CurlLoop::Waiter::Wake(m_curl);
+        return CURL_WRITEFUNC_PAUSE;
+    }
+    m_stage.insert(m_stage.end(), buffer, buffer + size);
+    if (!m_woken && m_stage.size() >= m_stage_size/2) {
+        m_woken = true;
+        lock.UnLock();
+        CurlLoop::Waiter::Wake(m_curl);
+    }
+    return size;
+}
+
+// Write out whatever the callbacks have staged so far.  The stage is swapped
+// out first, so a handle paused for lack of room can be resumed through the
+// waiter (if given) while the data goes to disk.
+int State::WriteStaged(CurlLoop::Waiter *waiter) {
+    m_stage_mutex.Lock();
+    m_spare.swap(m_stage);
+    bool paused = m_paused;
+    m_paused = false;
+    m_woken = false;
+    m_stage_mutex.UnLock();
+    if (paused && waiter) {
+        waiter->Resume(m_curl);
+    }
+    if (m_spare.empty()) {
+        return 0;
+    }
+
+    ssize_t retval = m_stream->Write(m_start_offset + m_offset, &m_spare[0], m_spare.size(), false);
+    m_spare.clear();
     if (retval == SFS_ERROR) {
         m_error_buf = m_stream->GetErrorMessage();
         m_error_code = 1;
         return -1;
     }
     m_offset += retval;
-    return retval;
+    return 0;
+}
+
+void State::Service(CurlLoop::Waiter &waiter) {
+    if (!m_push) {
+        WriteStaged(&waiter);
+        return;
+    }
+
+    m_stage_mutex.Lock();
+    bool fill = !m_eof && m_stage.size() - m_stage_pos < m_stage_size/2;
+    m_woken = false;
+    m_stage_mutex.UnLock();
+
+    if (fill) {
+        m_spare.resize(m_stage_size);
+        int retval = m_stream->Read(m_start_offset + m_read_offset, &m_spare[0], m_stage_size);
+        XrdSysMutexHelper lock(m_stage_mutex);
+        if (retval == SFS_ERROR) {
+            m_error_buf = m_stream->GetErrorMessage();
+            m_error_code = 1;
+            m_eof = true;
+        } else if (!retval) {
+            m_eof = true;
+        } else {
+            m_read_offset += retval;
+            m_stage.erase(m_stage.begin(), m_stage.begin() + m_stage_pos);
+            m_stage_pos = 0;
+            m_stage.insert(m_stage.end(), m_spare.begin(), m_spare.begin() + retval);
+        }
+    }
+
+    m_stage_mutex.Lock();
+    bool paused = m_paused;
+    m_paused = false;
+    m_stage_mutex.UnLock();
+    if (paused) {
+        waiter.Resume(m_curl);
+    }
 }
 
 int State::Flush() {
@@ -204,6 +292,9 @@ int State::Flush() {
         return 0;
     }
 
+    if (WriteStaged(NULL)) {
+        return -1;
+    }
     ssize_t retval = m_stream->Write(m_start_offset + m_offset, 0, 0, true);
     if (retval == SFS_ERROR) {
         m_error_buf = m_stream->GetErrorMessage();
@@ -221,14 +312,32 @@ size_t State::ReadCB(void *buffer, size_t size, size_t nitems, void *userdata) {
     return obj->Read(static_cast<char*>(buffer), size*nitems);
 }
 
+// Runs on the event loop; sends data the request thread has already read
+// from disk.  Once the stage runs dry, the handle is paused until the request
+// thread has refilled it.
 int State::Read(char *buffer, size_t size) {
-    int retval = m_stream->Read(m_start_offset + m_offset, buffer, size);
-    if (retval == SFS_ERROR) {
-        return -1;
+    XrdSysMutexHelper lock(m_stage_mutex);
+    size_t avail = m_stage.size() - m_stage_pos;
+    if (!avail) {
+        if (m_error_code) {return CURL_READFUNC_ABORT;}
+        if (m_eof) {return 0;}
+        m_paused = true;
+        m_woken = true;
+        lock.UnLock();
+        CurlLoop::Waiter::Wake(m_curl);
+        return CURL_READFUNC_PAUSE;
+    }
+    size = std::min(size, avail);
+    memcpy(buffer, &m_stage[m_stage_pos], size);
+    m_stage_pos += size;
+    m_offset += size;
+    if (!m_eof && !m_woken && avail - size < m_stage_size/2) {
+        m_woken = true;
+        lock.UnLock();
+        CurlLoop::Waiter::Wake(m_curl);
     }
-    m_offset += retval;
     //printf("Read a total of %ld bytes.\n", m_offset);
-    return retval;
+    return size;
 }
 
 State *State::Duplicate() {
@@ -285,18 +394,26 @@ bool State::Finalize()
 
 std::string State::GetConnectionDescription()
 {
+    XrdSysMutexHelper lock(m_conn_mutex);
+    return m_conn_desc;
+}
+
+void State::UpdateConnectionDescription()
+{
+    std::string desc;
+
     // CURLINFO_PRIMARY_PORT is only defined for 7.21.0 or later; on older
     // library versions, simply omit this information.
 #if LIBCURL_VERSION_NUM >= 0x071500
     char *curl_ip = NULL;
     CURLcode rc = curl_easy_getinfo(m_curl, CURLINFO_PRIMARY_IP, &curl_ip);
     if ((rc != CURLE_OK) || !curl_ip) {
-        return "";
+        return;
     }
     long curl_port = 0;
     rc = curl_easy_getinfo(m_curl, CURLINFO_PRIMARY_PORT, &curl_port);
     if ((rc != CURLE_OK) || !curl_port) {
-        return "";
+        return;
     }
     std::stringstream ss;
     // libcurl returns IPv6 addresses of the form:
@@ -308,8 +425,9 @@ std::string State::GetConnectionDescription()
         ss << "tcp:" << curl_ip << ":" << curl_port;
     else
         ss << "tcp:[" << curl_ip << "]:" << curl_port;
-    return ss.str();
-#else
-    return "";
+    desc = ss.str();
 #endif
+
+    XrdSysMutexHelper lock(m_conn_mutex);
+    m_conn_desc = desc;
 }
@@ -4,14 +4,18 @@
  * Helper class for managing the state of a single TPC request.
  */
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "XrdSys/XrdSysPthread.hh"
+
+#include "XrdTpcCurlLoop.hh"
+
 // Forward dec'ls
 class XrdSfsFile;
 class XrdHttpExtReq;
-typedef void CURL;
-struct curl_slist;
 
 namespace TPC {
 class Stream;
@@ -30,7 +34,12 @@ public:
         m_content_length(-1),
         m_stream(NULL),
         m_curl(NULL),
-        m_headers(NULL)
+        m_headers(NULL),
+        m_stage_pos(0),
+        m_read_offset(0),
+        m_paused(false),
+        m_woken(false),
+        m_eof(false)
     {}
 
     // Note that we are "borrowing" a reference to the curl handle;
@@ -47,7 +56,12 @@ public:
         m_content_length(-1),
         m_stream(&stream),
         m_curl(curl),
-        m_headers(NULL)
+        m_headers(NULL),
+        m_stage_pos(0),
+        m_read_offset(0),
+        m_paused(false),
+        m_woken(false),
+        m_eof(false)
     {
         InstallHandlers(curl);
     }
@@ -106,15 +120,30 @@ public:
     // backends may be unable to handle unaligned writes unless it's the last write).
     int Flush();
 
+    // Move data between the libcurl callbacks and the disk: in pull mode,
+    // write out what the callbacks have staged; in push mode, read ahead what
+    // they are going to send.  Resumes the handle through the waiter if a
+    // callback had to pause it.  Only called from the thread handling the
+    // request, which is where all of the transfer's disk I/O is done.
+    void Service(CurlLoop::Waiter &waiter);
+
     // Retrieve the description of the remote connection; is of the form:
     //   tcp:129.93.3.4:1234
     //   tcp:[2600:900:6:1301:268a:7ff:fef6:a590]:2345
     // This is meant to facilitate the monitoring via the performance markers.
+    //
+    // The transfer itself runs on the shared curl event loop, so the value is
+    // captured from within the libcurl callbacks and is safe to call from any
+    // thread.
     std::string GetConnectionDescription();
 
 private:
     bool InstallHandlers(CURL *curl);
 
+    int WriteStaged(CurlLoop::Waiter *waiter);
+
+    void UpdateConnectionDescription();
+
     State(const State&);
     // Add back once C++11 is available
     //State(State &&) noexcept;
@@ -131,17 +160,32 @@ private:
     bool m_push;  // whether we are transferring in "push-mode"
     bool m_recv_status_line;  // whether we have received a status line in the response from the remote host.
     bool m_recv_all_headers;  // true if we have seen the end of headers.
-    off_t m_offset;  // number of bytes we have received.
+    std::atomic<off_t> m_offset;  // number of bytes we have received.
     off_t m_start_offset;  // offset where we started in the file.
     int m_status_code;  // status code from HTTP response.
-    int m_error_code; // error code from underlying stream operations.
-    off_t m_content_length;  // value of Content-Length header, if we received one.
+    std::atomic<int> m_error_code; // error code from underlying stream operations.
+    std::atomic<off_t> m_content_length;  // value of Content-Length header, if we received one.
     Stream *m_stream;  // stream corresponding to this transfer.
     CURL *m_curl;  // libcurl handle
     struct curl_slist *m_headers; // any headers we set as part of the libcurl request.
     std::vector<std::string> m_headers_copy; // Copies of custom headers.
     std::string m_resp_protocol;  // Response protocol in the HTTP status line.
     std::string m_error_buf;  // Any error associated with a response.
+    XrdSysMutex m_conn_mutex;  // Protects m_conn_desc.
+    std::string m_conn_desc;  // Description of the remote connection.
+
+    // Data on its way between the libcurl callbacks and the disk.  The
+    // callbacks only touch m_stage; the request thread fills or empties
+    // m_spare without holding the lock and swaps the two.
+    static const size_t m_stage_size = 1024*1024;
+    XrdSysMutex m_stage_mutex;  // Protects the fields below except m_spare.
+    std::vector<char> m_stage;  // Received (pull) or to be sent (push).
+    std::vector<char> m_spare;  // Buffer being written to or read from disk.
+    size_t m_stage_pos;  // push: bytes of m_stage already sent.
+    off_t m_read_offset;  // push: bytes read from disk so far.
+    bool m_paused;  // a callback paused the handle for lack of buffer or data.
+    bool m_woken;  // the request thread was asked to service the stage.
+    bool m_eof;  // push: everything has been read from disk.
 };
 
 };
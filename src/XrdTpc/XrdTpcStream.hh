@@ -7,6 +7,7 @@
  * supports single-stream writes.
  */
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <string>
@@ -161,7 +162,7 @@ private:
     ssize_t WriteImpl(off_t offset, const char *buffer, size_t size);
 
     bool m_open_for_write;
-    size_t m_avail_count;
+    std::atomic<size_t> m_avail_count;  // Also read by the thread driving the transfer.
     std::unique_ptr<XrdSfsFile> m_fh;
     off_t m_offset;
     std::vector<Entry*> m_buffers;
@@ -19,7 +19,7 @@
 #include "XrdTpcState.hh"
 #include "XrdTpcStream.hh"
 #include "XrdTpcTPC.hh"
-#include "XrdTpcCurlMulti.hh"
+#include "XrdTpcCurlLoop.hh"
 
 using namespace TPC;
 
@@ -144,12 +144,19 @@ TPCHandler::TPCHandler(XrdSysError *log, const char *config, XrdOucEnv *myEnv) :
         m_desthttps(false),
         m_timeout(60),
         m_first_timeout(120),
+        m_loop_threads(4),
         m_log(log->logger(), "TPC_"),
         m_sfs(NULL)
 {
     if (!Configure(config, myEnv)) {
         throw std::runtime_error("Failed to configure the HTTP third-party-copy handler.");
     }
+#ifdef XRD_CHUNK_RESP
+    m_loop.reset(new CurlLoop(m_log));
+    if (!m_loop->Start(m_loop_threads)) {
+        throw std::runtime_error("Failed to start the HTTP third-party-copy event loop.");
+    }
+#endif
 }
 
 /**
@@ -348,21 +355,17 @@ int TPCHandler::SendPerfMarker(XrdHttpExtReq &req, TPCLogRecord &rec, std::vecto
 int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
     TPCLogRecord &rec)
 {
-    // Create the multi-handle and add in the current transfer to it.
-    CURLM *multi_handle = curl_multi_init();
-    if (!multi_handle) {
-        rec.status = 500;
-        logTransferEvent(LogMask::Error, rec, "CURL_INIT_FAIL",
-            "Failed to initialize a libcurl multi-handle");
-        char msg[] = "Failed to initialize internal server memory";
-        curl_easy_cleanup(curl);
-        return req.SendSimpleResp(rec.status, NULL, NULL, msg, 0);
-    }
+    // Bind the transfer to the shared event loop; libcurl I/O happens on the
+    // loop's threads while this one does the disk I/O and emits the
+    // performance markers.
+    CurlLoop::Waiter waiter(*m_loop);
 
     //curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, 128*1024);
 
-    CURLMcode mres;
-    mres = curl_multi_add_handle(multi_handle, curl);
+    // When pushing, have the first data ready before the request goes out.
+    state.Service(waiter);
+
+    CURLMcode mres = waiter.Add(curl);
     if (mres) {
         rec.status = 500;
         std::stringstream ss;
@@ -370,15 +373,14 @@ int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
         logTransferEvent(LogMask::Error, rec, "CURL_INIT_FAIL", ss.str());
         char msg[] = "Failed to initialize internal server handle";
         curl_easy_cleanup(curl);
-        curl_multi_cleanup(multi_handle);
         return req.SendSimpleResp(rec.status, NULL, NULL, msg, 0);
     }
 
-    // Start response to client prior to the first call to curl_multi_perform
+    // Start response to client; the transfer itself is already running.
     int retval = req.StartChunkedResp(201, "Created", "Content-Type: text/plain");
     if (retval) {
+        waiter.Remove(curl);
         curl_easy_cleanup(curl);
-        curl_multi_cleanup(multi_handle);
         logTransferEvent(LogMask::Error, rec, "RESPONSE_FAIL",
             "Failed to send the initial response to the TPC client");
         return retval;
@@ -387,15 +389,17 @@ int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
             "Initial transfer response sent to the TPC client");
     }
 
-    // Transfer loop: use curl to actually run the transfer, but periodically
-    // interrupt things to send back performance updates to the client.
-    int running_handles = 1;
+    // Transfer loop: wait for curl to finish the transfer, moving the data
+    // to or from disk as the callbacks ask for it, and periodically wake up
+    // to send back performance updates to the client.
+    bool running = true;
     time_t last_marker = 0;
     // Track how long it's been since the last time we recorded more bytes being transferred.
     off_t last_advance_bytes = 0;
     time_t last_advance_time = time(NULL);
     time_t transfer_start = last_advance_time;
     CURLcode res = static_cast<CURLcode>(-1);
+    std::vector<CurlLoop::Result> done;
     do {
         time_t now = time(NULL);
         time_t next_marker = last_marker + m_marker_period;
@@ -406,9 +410,8 @@ int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
                 last_advance_time = now;
             }
             if (SendPerfMarker(req, rec, state)) {
-                curl_multi_remove_handle(multi_handle, curl);
+                waiter.Remove(curl);
                 curl_easy_cleanup(curl);
-                curl_multi_cleanup(multi_handle);
                 logTransferEvent(LogMask::Error, rec, "PERFMARKER_FAIL",
                     "Failed to send a perf marker to the TPC client");
                 return -1;
@@ -422,82 +425,23 @@ int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
                 break;
             }
             last_marker = now;
+            next_marker = now + m_marker_period;
         }
-        mres = curl_multi_perform(multi_handle, &running_handles);
-        if (mres == CURLM_CALL_MULTI_PERFORM) {
-            // curl_multi_perform should be called again immediately.  On newer
-            // versions of curl, this is no longer used.
-            continue;
-        } else if (mres != CURLM_OK) {
-            break;
-        } else if (running_handles == 0) {
-            break;
-        }
-        //printf("There are %d running handles\n", running_handles);
-
-        // Harvest any messages, looking for CURLMSG_DONE.
-        CURLMsg *msg;
-        do {
-            int msgq = 0;
-            msg = curl_multi_info_read(multi_handle, &msgq);
-            if (msg && (msg->msg == CURLMSG_DONE)) {
-                CURL *easy_handle = msg->easy_handle;
-                res = msg->data.result;
-                curl_multi_remove_handle(multi_handle, easy_handle);
-                curl_easy_cleanup(easy_handle);
-            }
-        } while (msg);
 
-        int64_t max_sleep_time = next_marker - time(NULL);
-        if (max_sleep_time <= 0) {
-            continue;
+        waiter.Wait(next_marker, done);
+        state.Service(waiter);
+        if (!done.empty()) {
+            res = done[0].second;
+            running = false;
         }
-        int fd_count;
-#ifdef HAVE_CURL_MULTI_WAIT
-        mres = curl_multi_wait(multi_handle, NULL, 0, max_sleep_time*1000, &fd_count);
-#else
-        mres = curl_multi_wait_impl(multi_handle, max_sleep_time*1000, &fd_count);
-#endif
-        if (mres != CURLM_OK) {
-            break;
-        }
-    } while (running_handles);
-
-    if (mres != CURLM_OK) {
-        std::stringstream ss;
-        ss << "Internal libcurl multi-handle error: " << curl_multi_strerror(mres);
-        logTransferEvent(LogMask::Error, rec, "TRANSFER_CURL_ERROR", ss.str());
+    } while (running);
 
-        char msg[] = "Internal server error due to libcurl";
-        curl_multi_remove_handle(multi_handle, curl);
-        curl_easy_cleanup(curl);
-        curl_multi_cleanup(multi_handle);
-
-        if ((retval = req.ChunkResp(msg, 0))) {
-            logTransferEvent(LogMask::Error, rec, "RESPONSE_FAIL",
-                "Failed to send error message to the TPC client");
-            return retval;
-        }
-        return req.ChunkResp(NULL, 0);
-    }
-
-    // Harvest any messages, looking for CURLMSG_DONE.
-    CURLMsg *msg;
-    do {
-        int msgq = 0;
-        msg = curl_multi_info_read(multi_handle, &msgq);
-        if (msg && (msg->msg == CURLMSG_DONE)) {
-            CURL *easy_handle = msg->easy_handle;
-            res = msg->data.result;
-            curl_multi_remove_handle(multi_handle, easy_handle);
-            curl_easy_cleanup(easy_handle);
-        }
-    } while (msg);
+    // Either the loop has already removed the finished handle, or the
+    // transfer timed out and must be pulled off the loop before cleanup.
+    waiter.Remove(curl);
+    curl_easy_cleanup(curl);
 
     if (!state.GetErrorCode() && res == static_cast<CURLcode>(-1)) { // No transfers returned?!?
-        curl_multi_remove_handle(multi_handle, curl);
-        curl_easy_cleanup(curl);
-        curl_multi_cleanup(multi_handle);
         char msg[] = "Internal state error in libcurl";
         logTransferEvent(LogMask::Error, rec, "TRANSFER_CURL_ERROR", msg);
 
@@ -508,7 +452,6 @@ int TPCHandler::RunCurlWithUpdates(CURL *curl, XrdHttpExtReq &req, State &state,
         }
         return req.ChunkResp(NULL, 0);
     }
-    curl_multi_cleanup(multi_handle);
 
     state.Flush();
 
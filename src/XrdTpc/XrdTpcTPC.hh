@@ -15,6 +15,7 @@ class XrdSfsFileSystem;
 typedef void CURL;
 
 namespace TPC {
+class CurlLoop;
 class State;
 
 enum LogMask {
@@ -114,11 +115,13 @@ private:
     int m_timeout; // the 'timeout interval'; if no bytes have been received during this time period, abort the transfer.
     int m_first_timeout; // the 'first timeout interval'; the amount of time we're willing to wait to get the first byte.
                          // Unless explicitly specified, this is 2x the timeout interval.
+    int m_loop_threads; // number of threads running the shared curl event loop.
     std::string m_cadir;
     static XrdSysMutex m_monid_mutex;
     static uint64_t m_monid;
     XrdSysError m_log;
     XrdSfsFileSystem *m_sfs;
+    std::unique_ptr<CurlLoop> m_loop; // shared event loop on which all transfers are run.
 
     // 16 blocks in flight at 16 MB each, meaning that there will be up to 256MB
     // in flight; this is equal to the bandwidth delay product of a 200ms transcontinental
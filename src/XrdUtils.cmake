@@ -41,6 +41,7 @@ add_library(
                                 XrdSys/XrdSysIOEventsPollKQ.icc
                                 XrdSys/XrdSysIOEventsPollPoll.icc
                                 XrdSys/XrdSysIOEventsPollPort.icc
+  XrdSys/XrdSysIOUring.cc       XrdSys/XrdSysIOUring.hh
                                 XrdSys/XrdSysLinuxSemaphore.hh
                                 XrdSys/XrdSysLogPI.hh
   XrdSys/XrdSysLogger.cc        XrdSys/XrdSysLogger.hh
@@ -121,6 +122,7 @@ add_library(
                                 XrdOuc/XrdOucIOVec.hh
                                 XrdOuc/XrdOucLock.hh
                                 XrdOuc/XrdOucPList.hh
+                                XrdOuc/XrdOucPrefixTrie.hh
                                 XrdOuc/XrdOucRash.hh
                                 XrdOuc/XrdOucRash.icc
                                 XrdOuc/XrdOucTable.hh
@@ -29,11 +29,14 @@
 /******************************************************************************/
   
 #include <unistd.h>
+#include <sys/uio.h>
 
 #include "Xrd/XrdBuffer.hh"
 #include "Xrd/XrdLink.hh"
 #include "XProtocol/XProtocol.hh"
 #include "XrdSys/XrdSysError.hh"
+#include "XrdSys/XrdSysPageSize.hh"
+#include "XrdSys/XrdSysPlatform.hh"
 #include "XrdSys/XrdSysPthread.hh"
 #include "XrdSfs/XrdSfsInterface.hh"
 #include "XrdXrootd/XrdXrootdAio.hh"
@@ -116,6 +119,21 @@ XrdXrootdAio *XrdXrootdAio::Alloc(XrdXrootdAioReq *arp, int bsize)
   
 void XrdXrootdAio::doneRead()
 {
+// Segmented reads may have several requests in flight. So, queue this one and
+// schedule the request unless someone is already handling completions.
+//
+   if (aioReq->aioType != 'r')
+      {XrdXrootdAioReq *arp = aioReq;
+       arp->Lock();
+       Next = arp->aioDone; arp->aioDone = this;
+       if (!arp->isActive)
+          {arp->isActive = 1;
+           Sched->Schedule((XrdJob *)arp);
+          }
+       arp->UnLock();
+       return;
+      }
+
 // Place this aio request on the completed queue
 //
    aioReq->aioDone = this;
@@ -273,6 +291,11 @@ XrdXrootdAioReq *XrdXrootdAioReq::Alloc(XrdXrootdProtocol *prot,
 // Get appropriate number of aio objects
 //
    i = (maxAioPR < cntaio ? maxAioPR : cntaio);
+
+// Vector reads obtain aio objects as segments are issued as each one needs a
+// buffer of a different size.
+//
+   if (iotype == 'v') i = 0;
    while(i && (aiop = XrdXrootdAio::Alloc(arp, myQuantum)))
         {aiop->Next = arp->aioFree; arp->aioFree = aiop; i--;}
 
@@ -361,6 +384,35 @@ void XrdXrootdAioReq::Init(int iosize, int maxaiopr, int maxaio)
    if ((aiop = XrdXrootdAio::addBlock())) aiop->Recycle();
 }
 
+/******************************************************************************/
+/*               X r d X r o o t d A i o R e q : : P g R e a d                */
+/******************************************************************************/
+
+// Implicit Parameters: myIOLen   // Length of the page read (page multiple)
+//                      myOffset  // Starting offset (page aligned)
+
+int XrdXrootdAioReq::PgRead(uint64_t opts)
+{
+   static const int maxPages = 1022; // As for synchronous page reads
+   int pages;
+
+// Each segment buffer holds the pages followed by their checksums. All of the
+// buffers were obtained by Alloc() for the same quantum, so size segments so
+// that the checksums fit into whatever is left over.
+//
+   if (!aioFree) {Recycle(); return -ENOBUFS;}
+   pages = aioFree->buffp->bsize / (XrdSys::PageSize + sizeof(uint32_t));
+   if (pages > maxPages) pages = maxPages;
+   if (!pages) {Recycle(); return -ENOBUFS;}
+
+// Complete the request and start it off
+//
+   segSize = pages * XrdSys::PageSize;
+   segNum  = (myIOLen + segSize - 1) / segSize;
+   pgOpts  = opts;
+   return Start();
+}
+
 /******************************************************************************/
 /*                 X r d X r o o t d A i o R e q : : R e a d                  */
 /******************************************************************************/
@@ -400,6 +452,27 @@ int XrdXrootdAioReq::Read()
    return rc;
 }
 
+/******************************************************************************/
+/*                X r d X r o o t d A i o R e q : : R e a d V                 */
+/******************************************************************************/
+
+int XrdXrootdAioReq::ReadV(const XrdOucIOVec *rdVec, XrdXrootdFile **fVec,
+                           int rdVecNum, int maxRsp)
+{
+
+// Copy the read vector as the caller's copy is gone once we return. The
+// vectors keep their capacity across recycling so this rarely allocates.
+//
+   rvVec.assign(rdVec, rdVec+rdVecNum);
+   rvFile.assign(fVec, fVec+rdVecNum);
+   segNum = rdVecNum;
+   rspMax = maxRsp;
+
+// Start the I/O
+//
+   return Start();
+}
+
 /******************************************************************************/
 /*              X r d X r o o t d A i o R e q : : R e c y c l e               */
 /******************************************************************************/
@@ -430,6 +503,7 @@ void XrdXrootdAioReq::Recycle(int dref, XrdXrootdAio *oldp)
 // Get rid of any aio objects that we might have
 //
    while((aiop = aioDone)) {aioDone = aiop->Next; aiop->Recycle();}
+   while((aiop = aioPend)) {aioPend = aiop->Next; aiop->Recycle();}
    while((aiop = aioFree)) {aioFree = aiop->Next; aiop->Recycle();}
 
 // If we have a link and it should be derefernced, do so now
@@ -518,6 +592,16 @@ aioType   = 0;
 respDone  = 0;
 isLocked  = 0;
 reDrive   = 0;
+isActive  = 0;
+aioPend   = 0;
+segNext   = 0;
+segSend   = 0;
+segNum    = 0;
+segSize   = 0;
+rspMax    = 0;
+pgOpts    = 0;
+rvVec.clear();
+rvFile.clear();
 }
   
 /******************************************************************************/
@@ -595,6 +679,70 @@ void XrdXrootdAioReq::endRead()
            }
 }
   
+/******************************************************************************/
+/*              X r d X r o o t d A i o R e q : : e n d S e g s               */
+/******************************************************************************/
+
+void XrdXrootdAioReq::endSegs()
+{
+   XrdXrootdAio *aiop, *doneQ, **pP;
+
+// We own this request while isActive is set. The lock only protects the queue
+// of completed segments which doneRead() fills in from any thread.
+//
+   Lock();
+   while((doneQ = aioDone))
+        {aioDone = 0;
+         UnLock();
+
+      // Order the completed segments. Anything past the end, which is possible
+      // once a page read comes up short, is simply discarded.
+      //
+         while((aiop = doneQ))
+              {doneQ = aiop->Next; numActive--;
+               if (aiop->aioSeq >= segNum)
+                  {aiop->Next = aioFree; aioFree = aiop; continue;}
+               pP = &aioPend;
+               while(*pP && (*pP)->aioSeq < aiop->aioSeq) pP = &((*pP)->Next);
+               aiop->Next = *pP; *pP = aiop;
+              }
+
+      // Do a sanity check. The link should not have changed hands but
+      // stranger things have happened.
+      //
+         if (!respDone && !(Link->isInstance(Instance)))
+            {eDest->Emsg("scuttle", "aio read failed; link reassigned to",
+                         Link->ID);
+             respDone = 1;
+            }
+
+      // Send whatever we can and keep the pipeline full
+      //
+         if (!aioError && !respDone)
+            {sendSegs();
+             if (!aioError && !respDone)
+                {Issue();
+                 if (!numActive && segSend < segNum && !aioError)
+                    aioError = -ENOMEM;
+                }
+            }
+
+      // Once nothing is in flight we are done if we finished or failed
+      //
+         if (!numActive && (aioError || respDone || segSend >= segNum))
+            {if (aioError) sendError((char *)Link->ID);
+             Recycle(1);
+             return;
+            }
+         Lock();
+        }
+
+// Let the next completion reschedule us
+//
+   isActive = 0;
+   UnLock();
+}
+
 /******************************************************************************/
 /*             X r d X r o o t d A i o R e q : : e n d W r i t e              */
 /******************************************************************************/
@@ -624,6 +772,85 @@ void XrdXrootdAioReq::endWrite()
    Recycle();
 }
 
+/******************************************************************************/
+/*            X r d X r o o t d A i o R e q : : g e t S e g A i o             */
+/******************************************************************************/
+
+XrdXrootdAio *XrdXrootdAioReq::getSegAio(int bsize)
+{
+   XrdXrootdAio *aiop;
+
+// Reuse an aio object whose segment was sent, making sure its buffer is large
+// enough. Otherwise, get a new one subject to the server-wide limit.
+//
+   if (!(aiop = aioFree)) return XrdXrootdAio::Alloc(this, bsize);
+   aioFree = aiop->Next;
+   aiop->Next = 0;
+   if (aiop->buffp->bsize < bsize)
+      {XrdXrootdAio::BPool->Release(aiop->buffp);
+       if (!(aiop->buffp = XrdXrootdAio::BPool->Obtain(bsize)))
+          {aiop->Recycle(); return 0;}
+      }
+   return aiop;
+}
+
+/******************************************************************************/
+/*                X r d X r o o t d A i o R e q : : I s s u e                 */
+/******************************************************************************/
+
+// Warning! Only the thread owning the request may call this method.
+
+void XrdXrootdAioReq::Issue()
+{
+   static const int hdrSZ = sizeof(readahead_list);
+   XrdXrootdAio  *aiop;
+   XrdXrootdFile *fP;
+   int rc;
+
+// Issue as many segment reads as we may have in flight for one request. The
+// read may complete before it returns; doneRead() then simply queues it.
+//
+   while(segNext < segNum && numActive < maxAioPR)
+        {if (aioType == 'v')
+            {const XrdOucIOVec &seg = rvVec[segNext];
+             readahead_list *rhP;
+             if (!(aiop = getSegAio(seg.size + hdrSZ))) break;
+             rhP = (readahead_list *)aiop->buffp->buff;
+             memcpy(rhP->fhandle, &seg.info, sizeof(rhP->fhandle));
+             rhP->rlen   = htonl(seg.size);
+             rhP->offset = htonll(seg.offset);
+             aiop->sfsAio.aio_buf    = aiop->buffp->buff + hdrSZ;
+             aiop->sfsAio.aio_offset = seg.offset;
+             aiop->sfsAio.aio_nbytes = seg.size;
+             fP = rvFile[segNext];
+            } else {
+             long long segOffs = (long long)segNext * segSize;
+             int segLen = (myIOLen - segOffs < segSize ? myIOLen - segOffs
+                                                       : segSize);
+             if (!(aiop = getSegAio(segSize + (segSize/XrdSys::PageSize)
+                                              * sizeof(uint32_t)))) break;
+             aiop->sfsAio.aio_buf    = aiop->buffp->buff;
+             aiop->sfsAio.aio_offset = myOffset + segOffs;
+             aiop->sfsAio.aio_nbytes = segLen;
+             aiop->cksVec = (uint32_t *)(aiop->buffp->buff + segSize);
+             fP = myFile;
+            }
+
+         aiop->aioSeq = segNext++;
+         numActive++;
+         rc = (aioType == 'v' ? fP->XrdSfsp->read((XrdSfsAio *)aiop)
+                              : fP->XrdSfsp->pgRead((XrdSfsAio *)aiop, pgOpts));
+         if (rc)
+            {int ecode = fP->XrdSfsp->error.getErrInfo();
+             numActive--; segNext--;
+             aiop->Next = aioFree; aioFree = aiop;
+             myFile   = fP;
+             aioError = (ecode > 0 ? -ecode : -EIO);
+             break;
+            }
+        }
+}
+
 /******************************************************************************/
 /*              X r d X r o o t d A i o R e q : : S c u t t l e               */
 /******************************************************************************/
@@ -661,7 +888,7 @@ void XrdXrootdAioReq::sendError(char *tident)
 // that interface is synchronous.
 //
    snprintf(mbuff, sizeof(mbuff)-1, "XrdXrootdAio: Unable to %s %s; %s",
-           (aioType == 'r' ? "read" : "write"), myFile->XrdSfsp->FName(),
+           (aioType == 'w' ? "write" : "read"), myFile->XrdSfsp->FName(),
            eDest->ec2text(aioError));
 
 // Place the error message in the log
@@ -676,3 +903,142 @@ void XrdXrootdAioReq::sendError(char *tident)
 //
    Response.Send((XErrorCode)rc, mbuff);
 }
+
+/******************************************************************************/
+/*             X r d X r o o t d A i o R e q : : s e n d P a g e              */
+/******************************************************************************/
+
+void XrdXrootdAioReq::sendPage(XrdXrootdAio *aiop, bool isLast)
+{
+   static const int maxIOVZ = 1022*2+1;
+   static const int infoLen = sizeof(kXR_int64);
+
+   struct pgReadResponse
+         {ServerResponseStatus rsp;
+          kXR_int64            ofs;
+         } pgrResp;
+
+   struct iovec iov[maxIOVZ];
+   uint32_t *csVP = aiop->cksVec;
+   char *buff = aiop->buffp->buff;
+   int dlen = aiop->Result, items = 0, n = 1;
+
+// Fill out the header. Each segment carries its own offset.
+//
+   pgrResp.rsp.bdy.requestid = kXR_pgread - kXR_1stRequest;
+   pgrResp.rsp.bdy.resptype  = (isLast ? XrdProto::kXR_FinalResult
+                                       : XrdProto::kXR_PartialResult);
+   memset(pgrResp.rsp.bdy.reserved, 0, sizeof(pgrResp.rsp.bdy.reserved));
+   pgrResp.ofs = htonll(aiop->sfsAio.aio_offset);
+
+// Interleave the checksums with the pages (the first element is the header)
+//
+   while(dlen > 0)
+        {iov[n  ].iov_base = csVP++;
+         iov[n++].iov_len  = sizeof(uint32_t);
+         iov[n  ].iov_base = buff;
+         iov[n++].iov_len  = (dlen < XrdSys::PageSize ? dlen : XrdSys::PageSize);
+         buff += XrdSys::PageSize; dlen -= XrdSys::PageSize; items++;
+        }
+   dlen = aiop->Result + items*sizeof(uint32_t);
+
+// Send this off. Should it fail, nothing more can be sent.
+//
+   if (Response.Send(pgrResp.rsp, infoLen, iov, n, dlen) < 0) respDone = 1;
+}
+
+/******************************************************************************/
+/*             X r d X r o o t d A i o R e q : : s e n d S e g s              */
+/******************************************************************************/
+  
+// Warning! Only the thread owning the request may call this method.
+
+void XrdXrootdAioReq::sendSegs()
+{
+   static const int hdrSZ  = sizeof(readahead_list);
+   static const int iovMax = 64;
+   struct iovec iov[iovMax+1];
+   XrdXrootdAio *aiop, *sentQ;
+   int n, dlen, rc;
+
+// Send segments in order as long as the next one has completed. Segments past
+// a short page read may already be pending; those are never sent.
+//
+   while((aiop = aioPend) && aiop->aioSeq == segSend && segSend < segNum)
+        {
+
+      // Page reads are sent one segment at a time. A short segment means we
+      // hit the end of file and the request ends with this segment.
+      //
+         if (aioType == 'p')
+            {if (aiop->Result < 0) {aioError = aiop->Result; return;}
+             aioPend = aiop->Next;
+             if (aiop->Result < (ssize_t)aiop->sfsAio.aio_nbytes)
+                segNum = segSend+1;
+             aioTotal += aiop->Result;
+             sendPage(aiop, ++segSend >= segNum);
+             aiop->Next = aioFree; aioFree = aiop;
+             if (respDone) return;
+             continue;
+            }
+
+      // Vector reads combine as many segments as fit into one response. Each
+      // buffer already holds the readahead_list header for its segment.
+      //
+         n = 1; dlen = 0; sentQ = 0;
+         while((aiop = aioPend) && aiop->aioSeq == segSend && n <= iovMax)
+              {if (aiop->Result != (ssize_t)aiop->sfsAio.aio_nbytes)
+                  {aioError = (aiop->Result < 0 ? aiop->Result : -ENODATA);
+                   myFile   = rvFile[segSend];
+                   break;
+                  }
+               if (dlen && dlen + hdrSZ + aiop->Result > rspMax) break;
+               aioPend = aiop->Next;
+               iov[n  ].iov_base = aiop->buffp->buff;
+               iov[n++].iov_len  = hdrSZ + aiop->Result;
+               dlen += hdrSZ + aiop->Result;
+               aioTotal += aiop->Result;
+               segSend++;
+               aiop->Next = sentQ; sentQ = aiop;
+              }
+
+         if (n > 1)
+            {rc = (segSend >= segNum ? Response.Send(iov, n, dlen)
+                                     : Response.Send(kXR_oksofar, iov, n, dlen));
+             if (rc < 0) respDone = 1;
+             while((aiop = sentQ))
+                  {sentQ = aiop->Next; aiop->Next = aioFree; aioFree = aiop;}
+            }
+         if (aioError || respDone) return;
+        }
+}
+
+/******************************************************************************/
+/*                X r d X r o o t d A i o R e q : : S t a r t                 */
+/******************************************************************************/
+  
+int XrdXrootdAioReq::Start()
+{
+
+// We own the request while the first segments are issued. Completions that
+// arrive in the meantime are handled afterwards by a scheduler thread so that
+// the caller can get back to the link as soon as possible.
+//
+   isActive = 1;
+   Issue();
+
+// If nothing could be started, the caller reverts to synchronous I/O
+//
+   if (!numActive)
+      {Recycle();
+       return (aioError ? aioError : -ENOBUFS);
+      }
+
+// Hand off ownership
+//
+   Lock();
+   if (aioDone) XrdXrootdAio::Sched->Schedule((XrdJob *)this);
+      else isActive = 0;
+   UnLock();
+   return 0;
+}
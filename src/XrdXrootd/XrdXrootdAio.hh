@@ -30,7 +30,10 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <vector>
+
 #include "XProtocol/XPtypes.hh"
+#include "XrdOuc/XrdOucIOVec.hh"
 #include "XrdSys/XrdSysPthread.hh"
 #include "XrdSfs/XrdSfsAio.hh"
 #include "Xrd/XrdScheduler.hh"
@@ -63,7 +66,7 @@ virtual void          doneWrite();
 virtual void          Recycle();
 
 
-              XrdXrootdAio() {Next=0; aioReq=0; buffp=0;}
+              XrdXrootdAio() {Next=0; aioReq=0; buffp=0; aioSeq=0;}
              ~XrdXrootdAio() {};
 
 private:
@@ -81,6 +84,7 @@ static  int              maxAio;  // Maximum Aio objects we can yet have
 
         XrdXrootdAio    *Next;    // Chain pointer
         XrdXrootdAioReq *aioReq;  // -> Associated request object
+        int              aioSeq;  // Segment number (readv and pgread only)
 };
 
 /******************************************************************************/
@@ -89,7 +93,10 @@ static  int              maxAio;  // Maximum Aio objects we can yet have
 
 // The XrdXrootdAioReq object represents a complete aio request. It handles
 // the appropriate translation of the synchrnous request to an async one,
-// provides the redrive logic, and handles ending status.
+// provides the redrive logic, and handles ending status. Plain reads ('r') are
+// double buffered. Vector reads ('v') and page reads ('p') are split into
+// segments several of which are in flight at the same time; completed
+// segments are sent as soon as all of the preceding ones have been sent.
 //
 class XrdLink;
 class XrdXrootdFile;
@@ -102,8 +109,9 @@ public:
 
 static XrdXrootdAioReq   *Alloc(XrdXrootdProtocol *p, char iot, int numaio=0);
 
-       void               DoIt() {if (aioType == 'r') endRead();
-                                     else endWrite();
+       void               DoIt() {     if (aioType == 'r') endRead();
+                                  else if (aioType == 'w') endWrite();
+                                  else endSegs();
                                  }
 
        XrdXrootdAio      *getAio();
@@ -117,8 +125,13 @@ inline void               Push(XrdXrootdAio *newp)
 
 static void               Init(int iosize, int maxaiopr, int maxaio=-80);
 
+       int                PgRead(uint64_t opts);
+
        int                Read();
 
+       int                ReadV(const XrdOucIOVec *rdVec, XrdXrootdFile **fVec,
+                                int rdVecNum, int maxRsp);
+
        void               Recycle(int deref=1, XrdXrootdAio *aiop=0);
 
        int                Write(XrdXrootdAio *aiop);
@@ -132,10 +145,16 @@ private:
 
 static  XrdXrootdAioReq   *addBlock();
         void               endRead();
+        void               endSegs();
         void               endWrite();
+        XrdXrootdAio      *getSegAio(int bsize);
+        void               Issue();
 inline  void               Lock() {aioMutex.Lock(); isLocked = 1;}
         void               Scuttle(const char *opname);
         void               sendError(char *tident);
+        void               sendPage(XrdXrootdAio *aiop, bool isLast);
+        void               sendSegs();
+        int                Start();
 inline  void               UnLock() {isLocked = 0; aioMutex.UnLock();}
 
 static  const char        *TraceID;
@@ -166,6 +185,18 @@ static  int                maxAioPR2;  // aio objects per request (max*2)
         char               respDone;  // 1 -> Response has been sent
         char               isLocked;  // 1 -> Object lock being held
         char               reDrive;   // 1 -> Link redrive is needed
+        char               isActive;  // 1 -> Segment completions being handled
+
+        XrdXrootdAio      *aioPend;   // Completed segments waiting their turn
+        int                segNext;   // Next segment to issue
+        int                segSend;   // Next segment to send
+        int                segNum;    // Number of segments
+        int                segSize;   // Page read segment size
+        int                rspMax;    // Maximum readv response size
+        uint64_t           pgOpts;    // Page read options
+
+        std::vector<XrdOucIOVec>     rvVec;  // Read vector segments
+        std::vector<XrdXrootdFile *> rvFile; // Read vector segment files
 
         XrdXrootdResponse  Response;  // Copy of the original response object
 };
@@ -65,6 +65,7 @@
 /******************************************************************************/
 
 class XrdNetSocket;
+struct XrdOucIOVec;
 class XrdOucEnv;
 class XrdOucErrInfo;
 class XrdOucReqID;
@@ -179,6 +180,7 @@ enum RD_func {RD_chmod = 0, RD_chksum,  RD_dirlist, RD_locate, RD_mkdir,
        int   do_Qxattr();
        int   do_Read();
        int   do_ReadV();
+       int   do_ReadVsf(XrdOucIOVec *rdVec, int rdVecNum, int Quantum);
        int   do_ReadAll(int asyncOK=1);
        int   do_ReadNone(int &retc, int &pathID);
        int   do_Rm();
@@ -197,7 +199,9 @@ enum RD_func {RD_chmod = 0, RD_chksum,  RD_dirlist, RD_locate, RD_mkdir,
        int   do_WriteVec();
 
        int   aio_Error(const char *op, int ecode);
+       int   aio_PgRead();
        int   aio_Read();
+       int   aio_ReadV(XrdOucIOVec *rdVec, int rdVecNum, int Quantum);
        int   aio_Write();
        int   aio_WriteAll();
        int   aio_WriteCont();
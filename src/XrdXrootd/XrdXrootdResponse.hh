@@ -64,6 +64,8 @@ const  char *ID() {return (const char *)trsid;}
 
        int   Send(int fdnum, long long offset, int dlen);
        int   Send(XrdOucSFVec *sfvec, int sfvnum, int dlen);
+       int   Send(XResponseType rcode, XrdOucSFVec *sfvec, int sfvnum,
+                  int dlen);
 
        int   Send(ServerResponseStatus &, int iLen=0);
        int   Send(ServerResponseStatus &, int iLen, void *data, int dlen);
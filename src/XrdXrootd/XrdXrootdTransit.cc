@@ -771,7 +771,7 @@ int XrdXrootdTransit::Wait(XrdXrootd::Bridge::Context &rInfo,
 // All done, schedule the wait
 //
    TRACEP(REQ, "Bridge delaying request " <<runWait <<" sec (" <<eMsg <<")");
-   Sched->Schedule((XrdJob *)&waitJob, time(0)+runWait);
+   Sched->ScheduleMS((XrdJob *)&waitJob, runWait*1000);
    return 0;
 }
 
@@ -2326,9 +2326,11 @@ int XrdXrootdProtocol::do_ReadAll(int asyncOK)
        return Response.Send(myFile->mmAddr+myOffset, xframt);
       }
 
-// If we are sendfile enabled, then just send the file if possible
+// If we are sendfile enabled, then just send the file if possible. This is
+// also possible on TLS links when the kernel does the encryption.
 //
-   if (myFile->sfEnabled && !isTLS && myIOLen >= as_minsfsz
+   if (myFile->sfEnabled && (!isTLS || Link->hasKTLS())
+   &&  myIOLen >= as_minsfsz
    &&  myOffset+myIOLen <= myFile->Stats.fSize)
       {myFile->Stats.rdOps(myIOLen);
        if (myFile->fdNum >= 0)
@@ -2494,6 +2496,17 @@ int XrdXrootdProtocol::do_ReadV()
 // transfer unit and the actual amount we need to transfer.
 //
    if ((Quantum = static_cast<int>(totSZ)) > maxTransz) Quantum = maxTransz;
+
+// If every segment can be sent straight from the file (i.e. the file is memory
+// mapped or sendfile enabled) then avoid copying the data through our buffer.
+//
+   if (FTab && Response.isOurs()
+   &&  (k = do_ReadVsf(rdVec, rdVBreak, Quantum)) != -EAGAIN) return k;
+
+// If the files are in async mode, read the segments asynchronously so that
+// other requests on this link need not wait for this one to complete.
+//
+   if (FTab && (k = aio_ReadV(rdVec, rdVBreak, Quantum)) != -EAGAIN) return k;
    
 // Now obtain the right size buffer
 //
@@ -2580,6 +2593,126 @@ int XrdXrootdProtocol::do_ReadV()
    return (Quantum != Qleft ? Response.Send(argp->buff, Quantum-Qleft) : 0);
 }
 
+/******************************************************************************/
+/*                             d o _ R e a d V s f                            */
+/******************************************************************************/
+
+// Send a read vector without copying the data. Each response is a sendfile
+// vector of the response header followed by readahead_list header and data
+// element pairs. Data comes from the memory map or the file descriptor, so
+// -EAGAIN is returned (nothing having been sent) when any segment cannot be
+// sent this way and the caller must read the data into a buffer.
+  
+int XrdXrootdProtocol::do_ReadVsf(XrdOucIOVec *rdVec, int rdVecNum, int Quantum)
+{
+   const int hdrSZ = sizeof(readahead_list);
+   const int sfMax = 64;  // Must not exceed what XrdLink::Send(sfVec) takes
+   struct readahead_list hdrVec[XrdProto::maxRvecsz];
+   XrdXrootdFile        *fileVec[XrdProto::maxRvecsz], *fP = 0;
+   XrdOucSFVec           sfVec[sfMax];
+   struct iovec          ioVec[sfMax];
+   long long sfBytes = 0;
+   XrdSfsXferSize xfrSZ;
+   int currFH = -1, sfSegs = 0, sfN, Qleft, rdVBeg, rdVXfr, i, k;
+   int rvMon = Monitor.InOut();
+   int ioMon = (rvMon > 1);
+   char vType = (ioMon ? XROOTD_MON_READU : XROOTD_MON_READV);
+   bool hasFD;
+
+// Verify that every segment lies within a file that is either memory mapped
+// or can be sent using sendfile. Anything out of the ordinary, including
+// errors, is left to the regular path which knows how to report it.
+//
+   for (i = 0; i < rdVecNum; i++)
+       {if (rdVec[i].info != currFH)
+           {currFH = rdVec[i].info;
+            if (!(fP = FTab->Get(currFH))) return -EAGAIN;
+            if (!fP->isMMapped && (!fP->sfEnabled || fP->fdNum < 0
+            ||  (isTLS && !Link->hasKTLS())))
+               return -EAGAIN;
+           }
+        if (rdVec[i].offset < 0
+        ||  rdVec[i].offset + rdVec[i].size > fP->Stats.fSize) return -EAGAIN;
+        if (!fP->isMMapped) {sfBytes += rdVec[i].size; sfSegs++;}
+        fileVec[i] = fP;
+       }
+
+// Sendfile is only worth it when segments are not too small on average
+//
+   if (sfSegs && sfBytes < (long long)as_minsfsz * sfSegs) return -EAGAIN;
+
+// Run through the elements, sending a response whenever the transfer unit or
+// the vector is full. The last response is sent as the final one.
+//
+   rvSeq++;
+   sfN = 1; Qleft = Quantum; hasFD = false;
+   for (i = 0; i < rdVecNum; i++)
+       {fP = fileVec[i];
+        xfrSZ = rdVec[i].size;
+        if (Qleft < xfrSZ + hdrSZ || sfN + 2 > sfMax)
+           {if (hasFD) k = Response.Send(kXR_oksofar, sfVec, sfN, Quantum-Qleft);
+               else {for (k = 1; k < sfN; k++)
+                         {ioVec[k].iov_base = sfVec[k].buffer;
+                          ioVec[k].iov_len  = sfVec[k].sendsz;
+                         }
+                     k = Response.Send(kXR_oksofar, ioVec, sfN, Quantum-Qleft);
+                    }
+            if (k < 0) return -1;
+            sfN = 1; Qleft = Quantum; hasFD = false;
+           }
+        memcpy(hdrVec[i].fhandle, &rdVec[i].info, sizeof(hdrVec[i].fhandle));
+        hdrVec[i].rlen   = htonl(xfrSZ);
+        hdrVec[i].offset = htonll(rdVec[i].offset);
+        sfVec[sfN].buffer = (char *)&hdrVec[i];
+        sfVec[sfN].sendsz = hdrSZ;
+        sfVec[sfN].fdnum  = -1;
+        sfN++;
+        if (xfrSZ)
+           {if (fP->isMMapped)
+               {sfVec[sfN].buffer = fP->mmAddr + rdVec[i].offset;
+                sfVec[sfN].fdnum  = -1;
+               } else {
+                sfVec[sfN].offset = rdVec[i].offset;
+                sfVec[sfN].fdnum  = fP->fdNum;
+                hasFD = true;
+               }
+            sfVec[sfN].sendsz = xfrSZ;
+            sfN++;
+           }
+        Qleft -= (xfrSZ+hdrSZ);
+        TRACEP(FS,"fh=" <<rdVec[i].info <<" readV " << xfrSZ <<'@' <<rdVec[i].offset);
+       }
+
+// Account for what was sent, one entry per run of segments for the same file
+//
+   rdVBeg = 0; rdVXfr = 0;
+   for (i = 0; i <= rdVecNum; i++)
+       {if (i == rdVecNum || rdVec[i].info != rdVec[rdVBeg].info)
+           {fP = fileVec[rdVBeg];
+            fP->Stats.rvOps(rdVXfr, i - rdVBeg);
+            if (rvMon)
+               {Monitor.Agent->Add_rv(fP->Stats.FileID, htonl(rdVXfr),
+                                      htons(i - rdVBeg), rvSeq, vType);
+                if (ioMon) for (k = rdVBeg; k < i; k++)
+                    Monitor.Agent->Add_rd(fP->Stats.FileID,
+                            htonl(rdVec[k].size), htonll(rdVec[k].offset));
+               }
+            if (i == rdVecNum) break;
+            rdVBeg = i; rdVXfr = 0;
+           }
+        rdVXfr += rdVec[i].size;
+       }
+
+// Send the last response
+//
+   if (hasFD) return Response.Send(kXR_ok, sfVec, sfN, Quantum-Qleft);
+   for (k = 1; k < sfN; k++)
+       {ioVec[k].iov_base = sfVec[k].buffer;
+        ioVec[k].iov_len  = sfVec[k].sendsz;
+       }
+   return Response.Send(kXR_ok, ioVec, sfN, Quantum-Qleft);
+}
+
 /******************************************************************************/
 /*                                 d o _ R m                                  */
 /******************************************************************************/
@@ -37,8 +37,11 @@
 #include "XrdSfs/XrdSfsInterface.hh"
 #include "XrdXrootd/XrdXrootdAio.hh"
 #include "XrdXrootd/XrdXrootdFile.hh"
+#include "XrdXrootd/XrdXrootdMonitor.hh"
 #include "XrdXrootd/XrdXrootdProtocol.hh"
+#include "XrdXrootd/XrdXrootdStats.hh"
 #include "XrdXrootd/XrdXrootdTrace.hh"
+#include "XrdXrootd/XrdXrootdXeq.hh"
   
 /******************************************************************************/
 /*                               G l o b a l s                                */
@@ -80,6 +83,42 @@ int XrdXrootdProtocol::aio_Error(const char *op, int ecode)
    return -EIO;
 }
   
+/******************************************************************************/
+/*                            a i o _ P g R e a d                             */
+/******************************************************************************/
+
+// Implied Arguments:
+
+// myFile   = file to be read
+// myOffset = Offset at which to read (page aligned)
+// myIOLen  = Number of bytes to read from file and write to socket
+// myFlags  = pgread request flags
+
+// Returns:
+// =0      -> OK to continue with next operation.
+// -EAGAIN -> Revert to synchronous I/O
+
+int XrdXrootdProtocol::aio_PgRead()
+{
+   XrdXrootdAioReq *arp;
+   uint64_t pgrOpts = XrdSfsFile::NetOrder;
+
+// Set flags, as needed
+//
+   if (myFlags & XrdProto::kXR_pgRetry) pgrOpts |= XrdSfsFile::Verify;
+
+// Allocate a request object and fire off the first segments; they are self
+// sustaining after that. Any errors at this point revert to synchronous i/o.
+//
+   if (!(arp = XrdXrootdAioReq::Alloc(this, 'p')) || arp->PgRead(pgrOpts))
+      return -EAGAIN;
+
+// For statistics, we record the orignal amount of the request
+//
+   myFile->Stats.rdOps(myIOLen);
+   return 0;
+}
+
 /******************************************************************************/
 /*                              a i o _ R e a d                               */
 /******************************************************************************/
@@ -111,6 +150,74 @@ int XrdXrootdProtocol::aio_Read()
    return 0;
 }
 
+/******************************************************************************/
+/*                             a i o _ R e a d V                              */
+/******************************************************************************/
+
+// Implied Arguments:
+
+// rdVec    = the read vector (handle in info) with rdVecNum elements
+// Quantum  = maximum size of a single response
+
+// Returns:
+// =0      -> OK to continue with next operation.
+// -EAGAIN -> Revert to synchronous I/O
+
+int XrdXrootdProtocol::aio_ReadV(XrdOucIOVec *rdVec, int rdVecNum, int Quantum)
+{
+   XrdXrootdFile *fVec[XrdProto::maxRvecsz], *fP = 0;
+   XrdXrootdAioReq *arp;
+   long long totSZ = 0;
+   int i, k, currFH = 0;
+
+// All of the files must be open and in async mode, otherwise the request is
+// handled synchronously (which also reports any errors).
+//
+   for (i = 0; i < rdVecNum; i++)
+       {if (!fP || rdVec[i].info != currFH)
+           {currFH = rdVec[i].info;
+            if (!(fP = FTab->Get(currFH)) || !fP->AsyncMode) return -EAGAIN;
+           }
+        fVec[i] = fP;
+        totSZ  += rdVec[i].size;
+       }
+
+// Small requests are not worth doing asynchronously. Otherwise, allocate a
+// request object and fire off the first segments.
+//
+   if (totSZ < as_miniosz || Link->UseCnt() >= as_maxperlnk)
+      {SI->AsyncRej++; return -EAGAIN;}
+   myFile  = fVec[0]; myIOLen = static_cast<int>(totSZ); myOffset = 0;
+   if (!(arp = XrdXrootdAioReq::Alloc(this, 'v'))
+   ||  arp->ReadV(rdVec, fVec, rdVecNum, Quantum))
+      {SI->AsyncRej++; return -EAGAIN;}
+
+// Account for the request per file as the synchronous path does. The data is
+// already on its way but this only reflects what was asked for.
+//
+   int rvMon = Monitor.InOut();
+   int ioMon = (rvMon > 1);
+   char vType = (ioMon ? XROOTD_MON_READU : XROOTD_MON_READV);
+   rvSeq++;
+   for (i = 0; i < rdVecNum; i = k)
+       {XrdSfsXferSize rdVXfr = 0;
+        for (k = i; k < rdVecNum && fVec[k] == fVec[i]; k++)
+            {rdVXfr += rdVec[k].size;
+             TRACEP(FS, "fh=" <<rdVec[k].info <<" readV "
+                        <<rdVec[k].size <<'@' <<rdVec[k].offset);
+            }
+        fVec[i]->Stats.rvOps(rdVXfr, k-i);
+        if (rvMon)
+           {Monitor.Agent->Add_rv(fVec[i]->Stats.FileID, htonl(rdVXfr),
+                                  htons(k-i), rvSeq, vType);
+            if (ioMon) for (int j = i; j < k; j++)
+                Monitor.Agent->Add_rd(fVec[i]->Stats.FileID,
+                        htonl(rdVec[j].size), htonll(rdVec[j].offset));
+           }
+       }
+   return 0;
+}
+
 /******************************************************************************/
 /*                             a i o _ W r i t e                              */
 /******************************************************************************/
@@ -105,6 +105,16 @@ int XrdXrootdProtocol::do_PgRead()
 //
    if (pathID) return do_Offload(pathID, false, true);
 
+// If we are in async mode, schedule the read to ocur asynchronously
+//
+   if (myFile->AsyncMode)
+      {if (myIOLen >= as_miniosz && Link->UseCnt() < as_maxperlnk)
+          {int rc;
+           if ((rc = aio_PgRead()) != -EAGAIN) return rc;
+          }
+       SI->AsyncRej++;
+      }
+
 // Now do the read on the main path
 //
    return do_PgRIO();
@@ -19,6 +19,15 @@
 #include "TestEnv.hh"
 #include "CppUnitXrdHelpers.hh"
 #include "XrdCl/XrdClFile.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClJobManager.hh"
+#include "XrdCl/XrdClLocalFileUring.hh"
+#include "XrdCl/XrdClCopyProcess.hh"
+#include "XrdSys/XrdSysPthread.hh"
+#include "XrdSys/XrdSysTimer.hh"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -26,6 +35,49 @@
 
 using namespace XrdClTests;
 
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Keeps a worker thread of the job manager busy until released
+  //----------------------------------------------------------------------------
+  class BlockingJob: public XrdCl::Job
+  {
+    public:
+      BlockingJob( XrdSysSemaphore &started, XrdSysSemaphore &release ):
+        pStarted( started ), pRelease( release )
+      {
+      }
+
+      virtual void Run( void* )
+      {
+        pStarted.Post();
+        pRelease.Wait();
+        delete this;
+      }
+
+    private:
+      XrdSysSemaphore &pStarted;
+      XrdSysSemaphore &pRelease;
+  };
+
+  //----------------------------------------------------------------------------
+  // Records the progress of a copy
+  //----------------------------------------------------------------------------
+  class ProgressRecorder: public XrdCl::CopyProgressHandler
+  {
+    public:
+      virtual void JobProgress( uint16_t jobNum,
+                                uint64_t bytesProcessed,
+                                uint64_t bytesTotal )
+      {
+        (void)jobNum; (void)bytesTotal;
+        progress.push_back( bytesProcessed );
+      }
+
+      std::vector<uint64_t> progress;
+  };
+}
+
 //------------------------------------------------------------------------------
 // Declaration
 //------------------------------------------------------------------------------
@@ -36,29 +88,37 @@ class LocalFileHandlerTest: public CppUnit::TestCase
       CPPUNIT_TEST( OpenCloseTest );
       CPPUNIT_TEST( ReadTest );
       CPPUNIT_TEST( ReadWithOffsetTest );
+      CPPUNIT_TEST( ReadAheadTest );
       CPPUNIT_TEST( WriteTest );
       CPPUNIT_TEST( WriteWithOffsetTest );
       CPPUNIT_TEST( WriteMkdirTest );
       CPPUNIT_TEST( TruncateTest );
       CPPUNIT_TEST( VectorReadTest );
+      CPPUNIT_TEST( VectorReadMergeSplitTest );
       CPPUNIT_TEST( VectorWriteTest );
       CPPUNIT_TEST( SyncTest );
       CPPUNIT_TEST( WriteVTest );
       CPPUNIT_TEST( XAttrTest );
+      CPPUNIT_TEST( UringTest );
+      CPPUNIT_TEST( KernelCopyTest );
     CPPUNIT_TEST_SUITE_END();
     void CreateTestFileFunc( std::string url, std::string content = "GenericTestFile" );
     void OpenCloseTest();
     void ReadTest();
     void ReadWithOffsetTest();
+    void ReadAheadTest();
     void WriteTest();
     void WriteWithOffsetTest();
     void WriteMkdirTest();
     void TruncateTest();
     void VectorReadTest();
+    void VectorReadMergeSplitTest();
     void VectorWriteTest();
     void SyncTest();
     void WriteVTest();
     void XAttrTest();
+    void UringTest();
+    void KernelCopyTest();
 };
 CPPUNIT_TEST_SUITE_REGISTRATION( LocalFileHandlerTest );
 
@@ -283,6 +343,148 @@ void LocalFileHandlerTest::ReadWithOffsetTest(){
    delete file;
 }
 
+void LocalFileHandlerTest::ReadAheadTest(){
+   using namespace XrdCl;
+
+   //----------------------------------------------------------------------------
+   // Initialize, prefetch in blocks of 64KiB
+   //----------------------------------------------------------------------------
+   std::string targetURL = "/tmp/lfilehandlertestfilereadahead";
+   const uint32_t block = 64*1024;
+   std::string content( 512*block, 0 );
+   for( size_t i = 0; i < content.size(); ++i )
+     content[i] = 'a' + ( i * 7 + i / 251 ) % 26;
+   CreateTestFileFunc( targetURL, content );
+
+   Env *env = DefaultEnv::GetEnv();
+   env->PutInt( "ReadAheadWindow",    16*block );
+   env->PutInt( "ReadAheadBlockSize", block );
+
+   OpenFlags::Flags flags = OpenFlags::Read;
+   File file;
+   CPPUNIT_ASSERT_XRDST( file.Open( targetURL, flags ) );
+   char *buffer = new char[block];
+   uint32_t bytesRead = 0;
+
+   //----------------------------------------------------------------------------
+   // Two sequential reads start the prefetching of the third block, once it
+   // is there the file is overwritten: the third read has to return the
+   // prefetched (old) data
+   //----------------------------------------------------------------------------
+   for( uint32_t i = 0; i < 2; ++i )
+   {
+     CPPUNIT_ASSERT_XRDST( file.Read( i*block, block, buffer, bytesRead ) );
+     CPPUNIT_ASSERT( bytesRead == block );
+     CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + i*block, buffer, block ) );
+   }
+   std::string inFlight;
+   do
+   {
+     XrdSysTimer::Wait( 1 );
+     CPPUNIT_ASSERT( file.GetProperty( "ReadAheadInFlight", inFlight ) );
+   }
+   while( inFlight != "0" );
+
+   std::string zeros( content.size(), 0 );
+   int fd = open( targetURL.c_str(), O_WRONLY );
+   CPPUNIT_ASSERT( fd >= 0 );
+   CPPUNIT_ASSERT( pwrite( fd, zeros.data(), zeros.size(), 0 ) == ssize_t( zeros.size() ) );
+   CPPUNIT_ASSERT( close( fd ) == 0 );
+
+   CPPUNIT_ASSERT_XRDST( file.Read( 2*block, block, buffer, bytesRead ) );
+   CPPUNIT_ASSERT( bytesRead == block );
+   CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + 2*block, buffer, block ) );
+
+   //----------------------------------------------------------------------------
+   // A read off the pattern drops the prefetched data, so do the reads that
+   // follow it until a new pattern is found
+   //----------------------------------------------------------------------------
+   CPPUNIT_ASSERT_XRDST( file.Read( 40*block + 123, 1000, buffer, bytesRead ) );
+   CPPUNIT_ASSERT( bytesRead == 1000 );
+   CPPUNIT_ASSERT_EQUAL( 0, memcmp( zeros.data(), buffer, 1000 ) );
+   CPPUNIT_ASSERT_XRDST( file.Read( 3*block, block, buffer, bytesRead ) );
+   CPPUNIT_ASSERT( bytesRead == block );
+   CPPUNIT_ASSERT_EQUAL( 0, memcmp( zeros.data(), buffer, block ) );
+   CPPUNIT_ASSERT_XRDST( file.Close() );
+   CreateTestFileFunc( targetURL, content );
+
+   //----------------------------------------------------------------------------
+   // Back to back asynchronous reads, the later ones wait for the prefetches
+   // in flight, strided reads are prefetched too
+   //----------------------------------------------------------------------------
+   env->PutInt( "ReadAheadWindow",    32*block );
+   env->PutInt( "ReadAheadBlockSize", 16*block );
+   for( int strided = 0; strided < 2; ++strided )
+   {
+     const uint32_t size   = strided ? 1000 : 16*block;
+     const uint32_t stride = strided ? 3*block + 17 : 16*block;
+     const int      nreads = 16;
+     std::vector<char> data( nreads * size );
+     SyncResponseHandler handlers[nreads];
+
+     CPPUNIT_ASSERT_XRDST( file.Open( targetURL, flags ) );
+     for( int i = 0; i < nreads; ++i )
+       CPPUNIT_ASSERT_XRDST( file.Read( i*stride, size, &data[i*size], &handlers[i] ) );
+     for( int i = 0; i < nreads; ++i )
+     {
+       ChunkInfo *chunk = 0;
+       CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForResponse( &handlers[i], chunk ) );
+       CPPUNIT_ASSERT( chunk && chunk->offset == i*stride && chunk->length == size );
+       CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + i*stride, chunk->buffer, size ) );
+       delete chunk;
+     }
+     CPPUNIT_ASSERT_XRDST( file.Close() );
+   }
+
+   //----------------------------------------------------------------------------
+   // Each of these reads is covered by a prefetch issued two reads before
+   //----------------------------------------------------------------------------
+   const uint32_t size = 16*block;
+   std::vector<char> data( 5*size );
+   CPPUNIT_ASSERT_XRDST( file.Open( targetURL, flags ) );
+   for( int i = 0; i < 4; ++i )
+   {
+     CPPUNIT_ASSERT_XRDST( file.Read( i*size, size, &data[i*size], bytesRead ) );
+     CPPUNIT_ASSERT( bytesRead == size );
+   }
+
+   //----------------------------------------------------------------------------
+   // The responses to the prefetches are held back by keeping the worker
+   // threads busy: the last read issues a prefetch that is still in flight
+   // when the file is closed, so the close has to wait for it
+   //----------------------------------------------------------------------------
+   JobManager *jobMan  = DefaultEnv::GetPostMaster()->GetJobManager();
+   int         workers = DefaultWorkerThreads;
+   env->GetInt( "WorkerThreads", workers );
+   XrdSysSemaphore started( 0 ), release( 0 );
+   for( int i = 0; i < workers; ++i )
+     jobMan->QueueJob( new BlockingJob( started, release ) );
+   for( int i = 0; i < workers; ++i )
+     started.Wait();
+
+   SyncResponseHandler readHandler, closeHandler;
+   CPPUNIT_ASSERT_XRDST( file.Read( 4*size, size, &data[4*size], &readHandler ) );
+   CPPUNIT_ASSERT_XRDST( file.Close( &closeHandler ) );
+   for( int i = 0; i < workers; ++i )
+     release.Post();
+
+   ChunkInfo *chunk = 0;
+   CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForResponse( &readHandler, chunk ) );
+   CPPUNIT_ASSERT( chunk && chunk->length == size );
+   delete chunk;
+   CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForStatus( &closeHandler ) );
+   CPPUNIT_ASSERT( !file.IsOpen() );
+   CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data(), data.data(), data.size() ) );
+
+   //----------------------------------------------------------------------------
+   // Cleanup
+   //----------------------------------------------------------------------------
+   env->PutInt( "ReadAheadWindow",    DefaultReadAheadWindow );
+   env->PutInt( "ReadAheadBlockSize", DefaultReadAheadBlockSize );
+   CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
+   delete[] buffer;
+}
+
 void LocalFileHandlerTest::TruncateTest(){
    using namespace XrdCl;
    //----------------------------------------------------------------------------
@@ -376,6 +578,104 @@ void LocalFileHandlerTest::VectorReadTest()
    delete info;
 }
 
+void LocalFileHandlerTest::VectorReadMergeSplitTest()
+{
+   using namespace XrdCl;
+
+   //----------------------------------------------------------------------------
+   // Initialize
+   //----------------------------------------------------------------------------
+   std::string targetURL = "/tmp/lfilehandlertestfilevectorreadmerge";
+   std::string content( 1024*1024, 0 );
+   for( size_t i = 0; i < content.size(); ++i )
+     content[i] = 'a' + ( i * 7 + i / 251 ) % 26;
+   CreateTestFileFunc( targetURL, content );
+
+   //----------------------------------------------------------------------------
+   // Out of order chunks, each one overlapping, adjacent to or close to
+   // another one, and one far away from the others
+   //----------------------------------------------------------------------------
+   ChunkList chunks;
+   uint32_t  total = 0;
+   for( int i = 0; i < 100; ++i )
+   {
+     uint64_t offset = ( ( i * 37 ) % 50 ) * 20000;
+     if( i >= 50 ) offset += 60 + ( i % 3 ) * 40;
+     chunks.push_back( ChunkInfo( offset, 100 ) );
+     total += 100;
+   }
+   chunks.push_back( ChunkInfo( content.size() - 10, 10 ) );
+   total += 10;
+
+   auto verify = [&]( VectorReadInfo *info )
+   {
+     CPPUNIT_ASSERT( info );
+     CPPUNIT_ASSERT( info->GetSize() == total );
+     CPPUNIT_ASSERT( info->GetChunks().size() == chunks.size() );
+     for( size_t i = 0; i < chunks.size(); ++i )
+     {
+       const ChunkInfo &chunk = info->GetChunks()[i];
+       CPPUNIT_ASSERT( chunk.offset == chunks[i].offset );
+       CPPUNIT_ASSERT( chunk.length == chunks[i].length );
+       CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + chunk.offset,
+                                        chunk.buffer, chunk.length ) );
+     }
+   };
+
+   OpenFlags::Flags flags = OpenFlags::Read;
+   File file;
+   CPPUNIT_ASSERT_XRDST( file.Open( targetURL, flags ) );
+
+   //----------------------------------------------------------------------------
+   // Chunks less than 64 bytes apart are merged, no request carries more than
+   // 8 chunks
+   //----------------------------------------------------------------------------
+   Env *env = DefaultEnv::GetEnv();
+   env->PutInt( "VectorReadGap",   64 );
+   env->PutInt( "VectorReadSplit", 8 );
+
+   char *buffer = new char[total];
+   VectorReadInfo *info = 0;
+   CPPUNIT_ASSERT_XRDST( file.VectorRead( chunks, buffer, info ) );
+   verify( info );
+   CPPUNIT_ASSERT( info->GetChunks()[0].buffer == buffer );
+   delete info;
+
+   //----------------------------------------------------------------------------
+   // Same with a buffer for every chunk
+   //----------------------------------------------------------------------------
+   ChunkList own( chunks );
+   for( size_t i = 0; i < own.size(); ++i )
+     own[i].buffer = new char[own[i].length];
+   info = 0;
+   CPPUNIT_ASSERT_XRDST( file.VectorRead( own, NULL, info ) );
+   verify( info );
+   for( size_t i = 0; i < own.size(); ++i )
+   {
+     CPPUNIT_ASSERT( info->GetChunks()[i].buffer == own[i].buffer );
+     delete[] (char*)own[i].buffer;
+   }
+   delete info;
+
+   //----------------------------------------------------------------------------
+   // Split only
+   //----------------------------------------------------------------------------
+   env->PutInt( "VectorReadGap", 0 );
+   info = 0;
+   CPPUNIT_ASSERT_XRDST( file.VectorRead( chunks, buffer, info ) );
+   verify( info );
+   delete info;
+
+   //----------------------------------------------------------------------------
+   // Cleanup
+   //----------------------------------------------------------------------------
+   env->PutInt( "VectorReadGap",   DefaultVectorReadGap );
+   env->PutInt( "VectorReadSplit", DefaultVectorReadSplit );
+   CPPUNIT_ASSERT_XRDST( file.Close() );
+   CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
+   delete[] buffer;
+}
+
 void LocalFileHandlerTest::VectorWriteTest()
 {
    using namespace XrdCl;
@@ -548,3 +848,178 @@ void LocalFileHandlerTest::XAttrTest()
   CPPUNIT_ASSERT_XRDST( f.Close() );
   CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
 }
+
+void LocalFileHandlerTest::UringTest()
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // The engine may be disabled or not supported by the kernel
+  //----------------------------------------------------------------------------
+  LocalFileUring *uring = LocalFileUring::Instance();
+  if( !uring ) return;
+
+  std::string targetURL = "/tmp/lfilehandlertestfileuring";
+  std::string content( 1024*1024 + 17, 0 );
+  for( size_t i = 0; i < content.size(); ++i )
+    content[i] = 'a' + ( i * 7 + i / 251 ) % 26;
+
+  mode_t openmode = S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH;
+  int fd = open( targetURL.c_str(), O_RDWR | O_CREAT | O_TRUNC, openmode );
+  CPPUNIT_ASSERT_ERRNO( fd >= 0 );
+  HostList hosts;
+  hosts.push_back( HostInfo( URL( "file://localhost" ) ) );
+
+  //----------------------------------------------------------------------------
+  // Write and sync
+  //----------------------------------------------------------------------------
+  SyncResponseHandler writeHandler, syncHandler;
+  CPPUNIT_ASSERT( uring->Write( fd, 0, content.size(), content.data(), hosts,
+                                &writeHandler ) );
+  CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForStatus( &writeHandler ) );
+  CPPUNIT_ASSERT( uring->Sync( fd, hosts, &syncHandler ) );
+  CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForStatus( &syncHandler ) );
+
+  std::string check( content.size(), 0 );
+  CPPUNIT_ASSERT( pread( fd, &check[0], check.size(), 0 ) == ssize_t( check.size() ) );
+  CPPUNIT_ASSERT( check == content );
+
+  //----------------------------------------------------------------------------
+  // Read, the second one is cut short by the end of the file
+  //----------------------------------------------------------------------------
+  char buffer[1000];
+  SyncResponseHandler readHandler;
+  CPPUNIT_ASSERT( uring->Read( fd, 12345, 1000, buffer, hosts, &readHandler ) );
+  ChunkInfo *chunk = 0;
+  CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForResponse( &readHandler, chunk ) );
+  CPPUNIT_ASSERT( chunk && chunk->offset == 12345 && chunk->length == 1000 );
+  CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + 12345, buffer, 1000 ) );
+  delete chunk;
+
+  SyncResponseHandler eofHandler;
+  CPPUNIT_ASSERT( uring->Read( fd, content.size() - 10, 1000, buffer, hosts,
+                               &eofHandler ) );
+  chunk = 0;
+  CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForResponse( &eofHandler, chunk ) );
+  CPPUNIT_ASSERT( chunk && chunk->length == 10 );
+  CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + content.size() - 10, buffer, 10 ) );
+  delete chunk;
+
+  //----------------------------------------------------------------------------
+  // Vector read into a single buffer and into the chunk buffers
+  //----------------------------------------------------------------------------
+  ChunkList chunks;
+  for( int i = 0; i < 100; ++i )
+    chunks.push_back( ChunkInfo( i * 10007, 500 ) );
+  std::vector<char> vbuffer( 100 * 500 );
+
+  for( int own = 0; own < 2; ++own )
+  {
+    if( own )
+      for( size_t i = 0; i < chunks.size(); ++i )
+        chunks[i].buffer = new char[chunks[i].length];
+
+    SyncResponseHandler vecHandler;
+    CPPUNIT_ASSERT( uring->VectorRead( fd, chunks, own ? 0 : vbuffer.data(),
+                                       hosts, &vecHandler ) );
+    VectorReadInfo *info = 0;
+    CPPUNIT_ASSERT_XRDST( MessageUtils::WaitForResponse( &vecHandler, info ) );
+    CPPUNIT_ASSERT( info && info->GetSize() == 100 * 500 );
+    CPPUNIT_ASSERT( info->GetChunks().size() == chunks.size() );
+    for( size_t i = 0; i < chunks.size(); ++i )
+    {
+      const ChunkInfo &ci = info->GetChunks()[i];
+      CPPUNIT_ASSERT( ci.offset == chunks[i].offset && ci.length == chunks[i].length );
+      CPPUNIT_ASSERT( ci.buffer == ( own ? chunks[i].buffer : &vbuffer[i * 500] ) );
+      CPPUNIT_ASSERT_EQUAL( 0, memcmp( content.data() + ci.offset, ci.buffer, ci.length ) );
+      if( own ) delete[] (char*)chunks[i].buffer;
+    }
+    delete info;
+  }
+
+  //----------------------------------------------------------------------------
+  // Cleanup
+  //----------------------------------------------------------------------------
+  CPPUNIT_ASSERT( close( fd ) == 0 );
+  CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
+}
+
+void LocalFileHandlerTest::KernelCopyTest()
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // Initialize, the source is copied in two slices
+  //----------------------------------------------------------------------------
+  std::string sourceURL = "/tmp/lfilehandlertestfilecopysrc";
+  std::string targetURL = "/tmp/lfilehandlertestfilecopydst";
+  std::string content( 64*1024*1024 + 12345, 0 );
+  for( size_t i = 0; i < content.size(); ++i )
+    content[i] = 'a' + ( i * 7 + i / 251 ) % 26;
+  CreateTestFileFunc( sourceURL, content );
+  remove( targetURL.c_str() );
+
+  //----------------------------------------------------------------------------
+  // Check whether the kernel can copy between these files at all
+  //----------------------------------------------------------------------------
+  bool kernelCopy = false;
+#ifdef HAVE_COPY_FILE_RANGE
+  CreateTestFileFunc( targetURL, "" );
+  int srcfd = open( sourceURL.c_str(), O_RDONLY );
+  int dstfd = open( targetURL.c_str(), O_WRONLY );
+  CPPUNIT_ASSERT_ERRNO( srcfd >= 0 && dstfd >= 0 );
+  kernelCopy = copy_file_range( srcfd, 0, dstfd, 0, 1, 0 ) == 1;
+  close( srcfd );
+  close( dstfd );
+  CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
+#endif
+
+  auto verify = [&]()
+  {
+    std::string check( content.size() + 1, 0 );
+    int fd = open( targetURL.c_str(), O_RDONLY );
+    CPPUNIT_ASSERT_ERRNO( fd >= 0 );
+    ssize_t rc = read( fd, &check[0], check.size() );
+    close( fd );
+    CPPUNIT_ASSERT( rc == ssize_t( content.size() ) );
+    check.resize( rc );
+    CPPUNIT_ASSERT( check == content );
+  };
+
+  //----------------------------------------------------------------------------
+  // Plain copy, done within the kernel the progress is reported per slice
+  //----------------------------------------------------------------------------
+  CopyProcess      process1, process2;
+  PropertyList     properties, results;
+  ProgressRecorder progress1, progress2;
+
+  properties.Set( "source", "file://localhost" + sourceURL );
+  properties.Set( "target", "file://localhost" + targetURL );
+  CPPUNIT_ASSERT_XRDST( process1.AddJob( properties, &results ) );
+  CPPUNIT_ASSERT_XRDST( process1.Prepare() );
+  CPPUNIT_ASSERT_XRDST( process1.Run( &progress1 ) );
+  verify();
+  CPPUNIT_ASSERT( !progress1.progress.empty() );
+  CPPUNIT_ASSERT( progress1.progress.back() == content.size() );
+  if( kernelCopy )
+    CPPUNIT_ASSERT( progress1.progress.size() == 2 );
+
+  //----------------------------------------------------------------------------
+  // Resume a partial copy
+  //----------------------------------------------------------------------------
+  CPPUNIT_ASSERT( truncate( targetURL.c_str(), 1000000 ) == 0 );
+  results.Clear();
+  properties.Set( "continue", true );
+  CPPUNIT_ASSERT_XRDST( process2.AddJob( properties, &results ) );
+  CPPUNIT_ASSERT_XRDST( process2.Prepare() );
+  CPPUNIT_ASSERT_XRDST( process2.Run( &progress2 ) );
+  verify();
+  CPPUNIT_ASSERT( !progress2.progress.empty() );
+  CPPUNIT_ASSERT( progress2.progress.back() == content.size() - 1000000 );
+
+  //----------------------------------------------------------------------------
+  // Cleanup
+  //----------------------------------------------------------------------------
+  CPPUNIT_ASSERT( remove( sourceURL.c_str() ) == 0 );
+  CPPUNIT_ASSERT( remove( targetURL.c_str() ) == 0 );
+}
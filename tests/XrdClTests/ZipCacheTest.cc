@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "CppUnitXrdHelpers.hh"
+#include "XrdCl/XrdClZipCache.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+
+#include <zlib.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Declaration
+//------------------------------------------------------------------------------
+class ZipCacheTest: public CppUnit::TestCase
+{
+  public:
+    CPPUNIT_TEST_SUITE( ZipCacheTest );
+      CPPUNIT_TEST( SeekPointTest );
+      CPPUNIT_TEST( IndexTest );
+    CPPUNIT_TEST_SUITE_END();
+    void setUp();
+    void tearDown();
+    void SeekPointTest();
+    void IndexTest();
+
+  private:
+    uint64_t Inflate( XrdCl::ZipCache &cache, uint64_t offset, uint32_t size );
+
+    std::string pPlain;      // the uncompressed data
+    std::string pDeflated;   // the raw deflate stream
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( ZipCacheTest );
+
+//------------------------------------------------------------------------------
+// Deflate 8MiB of text, seek points are recorded every 1MiB
+//------------------------------------------------------------------------------
+void ZipCacheTest::setUp()
+{
+  static const char *words[] = { "xrootd ", "client ", "zip ", "archive ",
+                                 "inflate ", "seek ", "point ", "window ",
+                                 "index\n", "0123456789 " };
+  pPlain.clear();
+  uint32_t rnd = 12345;
+  while( pPlain.size() < 8*1024*1024 )
+  {
+    rnd = rnd * 1103515245 + 12345;
+    pPlain += words[( rnd >> 16 ) % 10];
+  }
+
+  z_stream strm = z_stream();
+  CPPUNIT_ASSERT( deflateInit2( &strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) == Z_OK );
+  pDeflated.resize( deflateBound( &strm, pPlain.size() ) );
+  strm.next_in   = (Bytef*)pPlain.data();
+  strm.avail_in  = pPlain.size();
+  strm.next_out  = (Bytef*)&pDeflated[0];
+  strm.avail_out = pDeflated.size();
+  CPPUNIT_ASSERT( deflate( &strm, Z_FINISH ) == Z_STREAM_END );
+  pDeflated.resize( strm.total_out );
+  deflateEnd( &strm );
+
+  XrdCl::DefaultEnv::GetEnv()->PutInt( "ZipIndexSpacing", 1 );
+}
+
+void ZipCacheTest::tearDown()
+{
+  XrdCl::Env *env = XrdCl::DefaultEnv::GetEnv();
+  env->PutInt( "ZipIndexSpacing", XrdCl::DefaultZipIndexSpacing );
+  env->PutString( "ZipIndexDir", XrdCl::DefaultZipIndexDir );
+}
+
+//------------------------------------------------------------------------------
+// Read through the cache feeding it with the compressed data it asks for,
+// returns the offset of the first compressed chunk it needed
+//------------------------------------------------------------------------------
+uint64_t ZipCacheTest::Inflate( XrdCl::ZipCache &cache, uint64_t offset,
+                                uint32_t size )
+{
+  using namespace XrdCl;
+
+  std::vector<char> buffer( size );
+  CPPUNIT_ASSERT_XRDST( cache.Output( buffer.data(), size, offset ) );
+  uint64_t first = cache.NextChunkOffset();
+
+  while( true )
+  {
+    uint32_t bytesRead = 0;
+    XRootDStatus st = cache.Read( bytesRead );
+    CPPUNIT_ASSERT_XRDST( st );
+    if( st.code != suContinue ) break;
+
+    uint64_t rawoff = cache.NextChunkOffset();
+    CPPUNIT_ASSERT( rawoff < pDeflated.size() );
+    size_t insize = std::min<size_t>( 64*1024, pDeflated.size() - rawoff );
+    CPPUNIT_ASSERT_XRDST( cache.Input( pDeflated.data() + rawoff, insize, rawoff ) );
+  }
+
+  CPPUNIT_ASSERT( cache.Done() );
+  CPPUNIT_ASSERT( pPlain.compare( offset, size, buffer.data(), size ) == 0 );
+  return first;
+}
+
+//------------------------------------------------------------------------------
+// Seek point test
+//------------------------------------------------------------------------------
+void ZipCacheTest::SeekPointTest()
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // Without seek points a read far into the file starts from the beginning
+  //----------------------------------------------------------------------------
+  ZipCache fresh;
+  CPPUNIT_ASSERT( Inflate( fresh, 6*1024*1024 + 123, 1000 ) == 0 );
+
+  //----------------------------------------------------------------------------
+  // Read the whole file sequentially, each read carries on where the
+  // previous one stopped
+  //----------------------------------------------------------------------------
+  ZipCache cache;
+  const uint32_t chunk = 100000;
+  uint64_t resume = 0;
+  for( uint64_t offset = 0; offset < pPlain.size(); offset += chunk )
+  {
+    uint32_t size = std::min<uint64_t>( chunk, pPlain.size() - offset );
+    uint64_t first = Inflate( cache, offset, size );
+    CPPUNIT_ASSERT( first >= resume );
+    resume = first;
+  }
+
+  //----------------------------------------------------------------------------
+  // A read behind the window restarts from the closest seek point, not from
+  // the beginning
+  //----------------------------------------------------------------------------
+  uint64_t first = Inflate( cache, 6*1024*1024 + 123, 1000 );
+  CPPUNIT_ASSERT( first > 0 );
+
+  //----------------------------------------------------------------------------
+  // Reads ahead of the current position carry on inflating or jump to a
+  // seek point, reads before the first seek point start over
+  //----------------------------------------------------------------------------
+  CPPUNIT_ASSERT( Inflate( cache, 7*1024*1024 + 5, 70000 ) >= first );
+  CPPUNIT_ASSERT( Inflate( cache, 3*1024*1024 + 77, 1 ) > 0 );
+  CPPUNIT_ASSERT( Inflate( cache, 100, 5000 ) == 0 );
+}
+
+//------------------------------------------------------------------------------
+// Index test
+//------------------------------------------------------------------------------
+void ZipCacheTest::IndexTest()
+{
+  using namespace XrdCl;
+
+  char dir[] = "/tmp/zipcachetestXXXXXX";
+  CPPUNIT_ASSERT_ERRNO( mkdtemp( dir ) );
+  DefaultEnv::GetEnv()->PutString( "ZipIndexDir", dir );
+
+  const std::string key   = "root://server//data/archive.zip:file.txt";
+  uint32_t          crc32 = ::crc32( 0, (const Bytef*)pPlain.data(), pPlain.size() );
+  uint64_t          csize = pDeflated.size();
+  uint64_t          usize = pPlain.size();
+
+  //----------------------------------------------------------------------------
+  // Inflate the whole file and store the seek points
+  //----------------------------------------------------------------------------
+  {
+    ZipCache cache;
+    cache.LoadIndex( key, crc32, csize, usize );
+    CPPUNIT_ASSERT( Inflate( cache, 0, usize ) == 0 );
+    cache.SaveIndex();
+  }
+
+  std::string index;
+  DIR *dp = opendir( dir );
+  CPPUNIT_ASSERT( dp );
+  while( dirent *ent = readdir( dp ) )
+  {
+    std::string name = ent->d_name;
+    if( name == "." || name == ".." ) continue;
+    CPPUNIT_ASSERT( index.empty() );
+    CPPUNIT_ASSERT( name.size() > 5 && name.compare( name.size() - 5, 5, ".zidx" ) == 0 );
+    index = std::string( dir ) + "/" + name;
+  }
+  closedir( dp );
+  CPPUNIT_ASSERT( !index.empty() );
+
+  //----------------------------------------------------------------------------
+  // A new reader of the same file starts from the stored seek points
+  //----------------------------------------------------------------------------
+  {
+    ZipCache cache;
+    cache.LoadIndex( key, crc32, csize, usize );
+    CPPUNIT_ASSERT( Inflate( cache, 6*1024*1024 + 123, 1000 ) > 0 );
+  }
+
+  //----------------------------------------------------------------------------
+  // The index of a file that has changed is ignored
+  //----------------------------------------------------------------------------
+  {
+    ZipCache cache;
+    cache.LoadIndex( key, crc32 + 1, csize, usize );
+    CPPUNIT_ASSERT( Inflate( cache, 6*1024*1024 + 123, 1000 ) == 0 );
+  }
+
+  //----------------------------------------------------------------------------
+  // So is a corrupted one
+  //----------------------------------------------------------------------------
+  FILE *f = fopen( index.c_str(), "r+b" );
+  CPPUNIT_ASSERT( f );
+  CPPUNIT_ASSERT( fseek( f, -1, SEEK_END ) == 0 );
+  int c = fgetc( f );
+  CPPUNIT_ASSERT( c != EOF );
+  CPPUNIT_ASSERT( fseek( f, -1, SEEK_END ) == 0 );
+  CPPUNIT_ASSERT( fputc( c ^ 0xff, f ) != EOF );
+  CPPUNIT_ASSERT( fclose( f ) == 0 );
+  {
+    ZipCache cache;
+    cache.LoadIndex( key, crc32, csize, usize );
+    CPPUNIT_ASSERT( Inflate( cache, 6*1024*1024 + 123, 1000 ) == 0 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Cleanup
+  //----------------------------------------------------------------------------
+  CPPUNIT_ASSERT( unlink( index.c_str() ) == 0 );
+  CPPUNIT_ASSERT( rmdir( dir ) == 0 );
+}